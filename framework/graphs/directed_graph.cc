@@ -8,12 +8,13 @@
 
 #include <sstream>
 #include <algorithm>
+#include <limits>
 
 namespace opensn
 {
 
 void
-DirectedGraph::VertexAccessor::AddVertex(size_t id, void* context)
+DirectedGraph::VertexAccessor::AddVertex(uint32_t id, void* context)
 {
   vertices_.emplace_back(id, context);
   vertex_valid_flags_.push_back(true);
@@ -22,12 +23,14 @@ DirectedGraph::VertexAccessor::AddVertex(size_t id, void* context)
 void
 DirectedGraph::VertexAccessor::AddVertex(void* context)
 {
-  vertices_.emplace_back(vertices_.size(), context);
+  OpenSnLogicalErrorIf(vertices_.size() >= std::numeric_limits<uint32_t>::max(),
+                       "The number of graph vertices exceeds the 32-bit vertex ids.");
+  vertices_.emplace_back(static_cast<uint32_t>(vertices_.size()), context);
   vertex_valid_flags_.push_back(true);
 }
 
 void
-DirectedGraph::VertexAccessor::RemoveVertex(size_t v)
+DirectedGraph::VertexAccessor::RemoveVertex(uint32_t v)
 {
   OpenSnLogicalErrorIf(v >= vertices_.size(), "Error removing vertex.");
 
@@ -36,17 +39,17 @@ DirectedGraph::VertexAccessor::RemoveVertex(size_t v)
   // Get adjacent vertices
   auto num_us = vertex.us_edge.size();
   auto num_ds = vertex.ds_edge.size();
-  std::vector<size_t> adj_verts;
+  std::vector<uint32_t> adj_verts;
   adj_verts.reserve(num_us + num_ds);
 
-  for (size_t u : vertex.us_edge)
+  for (uint32_t u : vertex.us_edge)
     adj_verts.push_back(u);
 
-  for (size_t u : vertex.ds_edge)
+  for (uint32_t u : vertex.ds_edge)
     adj_verts.push_back(u);
 
   // Remove v from all u
-  for (size_t u : adj_verts)
+  for (uint32_t u : adj_verts)
   {
     vertices_[u].us_edge.erase(v);
     vertices_[u].ds_edge.erase(v);
@@ -56,7 +59,7 @@ DirectedGraph::VertexAccessor::RemoveVertex(size_t v)
 }
 
 GraphVertex&
-DirectedGraph::VertexAccessor::operator[](size_t v)
+DirectedGraph::VertexAccessor::operator[](uint32_t v)
 {
   if (not vertex_valid_flags_[v])
     log.LogAllError() << "opensn::DirectedGraph::VertexAccessor: "
@@ -65,7 +68,7 @@ DirectedGraph::VertexAccessor::operator[](size_t v)
 }
 
 void
-DirectedGraph::AddVertex(size_t id, void* context)
+DirectedGraph::AddVertex(uint32_t id, void* context)
 {
   vertices.AddVertex(id, context);
 }
@@ -77,13 +80,13 @@ DirectedGraph::AddVertex(void* context)
 }
 
 void
-DirectedGraph::RemoveVertex(size_t v)
+DirectedGraph::RemoveVertex(uint32_t v)
 {
   vertices.RemoveVertex(v);
 }
 
 bool
-DirectedGraph::AddEdge(size_t from, size_t to, double weight)
+DirectedGraph::AddEdge(uint32_t from, uint32_t to, double weight)
 {
   vertices[from].ds_edge.insert(to);
   vertices[to].us_edge.insert(from);
@@ -95,16 +98,16 @@ DirectedGraph::AddEdge(size_t from, size_t to, double weight)
 }
 
 void
-DirectedGraph::RemoveEdge(size_t from, size_t to)
+DirectedGraph::RemoveEdge(uint32_t from, uint32_t to)
 {
   vertices[from].ds_edge.erase(to);
   vertices[to].us_edge.erase(from);
 }
 
 void
-DirectedGraph::DFSAlgorithm(std::vector<size_t>& traversal,
+DirectedGraph::DFSAlgorithm(std::vector<uint32_t>& traversal,
                             std::vector<bool>& visited,
-                            size_t cur_vid)
+                            uint32_t cur_vid)
 {
   traversal.push_back(cur_vid);
   visited[cur_vid] = true;
@@ -115,13 +118,13 @@ DirectedGraph::DFSAlgorithm(std::vector<size_t>& traversal,
 }
 
 void
-DirectedGraph::SCCAlgorithm(size_t u,
+DirectedGraph::SCCAlgorithm(uint32_t u,
                             int& time,
                             std::vector<int>& disc,
                             std::vector<int>& low,
                             std::vector<bool>& on_stack,
-                            std::stack<size_t>& stack,
-                            std::vector<std::vector<size_t>>& SCCs)
+                            std::stack<uint32_t>& stack,
+                            std::vector<std::vector<uint32_t>>& SCCs)
 {
   // Init discovery time and low value
   disc[u] = low[u] = ++time;
@@ -139,10 +142,10 @@ DirectedGraph::SCCAlgorithm(size_t u,
       low[u] = std::min(low[u], disc[v]);
   }
 
-  size_t w = 0;
+  uint32_t w = 0;
   if (low[u] == disc[u])
   {
-    std::vector<size_t> sub_SCC;
+    std::vector<uint32_t> sub_SCC;
     while (stack.top() != u)
     {
       w = stack.top();
@@ -159,32 +162,32 @@ DirectedGraph::SCCAlgorithm(size_t u,
   }
 }
 
-std::vector<std::vector<size_t>>
+std::vector<std::vector<uint32_t>>
 DirectedGraph::FindStronglyConnectedComponents()
 {
-  size_t V = vertices.size();
+  const auto V = static_cast<uint32_t>(vertices.size());
 
   std::vector<int> disc(V, -1);         // Discovery times
   std::vector<int> low(V, -1);          // Earliest visited vertex
   std::vector<bool> on_stack(V, false); // On stack flags
-  std::stack<size_t> stack;             // Stack
+  std::stack<uint32_t> stack;             // Stack
 
-  std::vector<std::vector<size_t>> SCCs; // Collection of SCCs
+  std::vector<std::vector<uint32_t>> SCCs; // Collection of SCCs
 
   int time = 0;
 
-  for (size_t v = 0; v < V; ++v)
+  for (uint32_t v = 0; v < V; ++v)
     if (disc[v] == -1)
       SCCAlgorithm(v, time, disc, low, on_stack, stack, SCCs);
 
   return SCCs;
 }
 
-std::vector<size_t>
+std::vector<uint32_t>
 DirectedGraph::GenerateTopologicalSort()
 {
   bool has_cycles = false;
-  std::vector<size_t> L;
+  std::vector<uint32_t> L;
   std::vector<GraphVertex*> S;
 
   L.reserve(vertices.size());
@@ -208,12 +211,12 @@ DirectedGraph::GenerateTopologicalSort()
   while (not S.empty())
   {
     GraphVertex* node_n = S.back();
-    size_t n = node_n->id;
+    uint32_t n = node_n->id;
     S.erase(S.end() - 1);
 
     L.push_back(n);
     auto nodes_m = node_n->ds_edge;
-    for (size_t m : nodes_m)
+    for (uint32_t m : nodes_m)
     {
       GraphVertex* node_m = &cur_vertices[m];
 
@@ -237,16 +240,16 @@ endofalgo:
   return L;
 }
 
-std::vector<size_t>
+std::vector<uint32_t>
 DirectedGraph::FindApproxMinimumFAS()
 {
   auto GetVertexDelta = [](GraphVertex& vertex)
   {
     double delta = 0.0;
-    for (size_t ds : vertex.ds_edge)
+    for (uint32_t ds : vertex.ds_edge)
       delta += 1.0 * vertex.ds_weights[ds];
 
-    for (size_t us : vertex.us_edge)
+    for (uint32_t us : vertex.us_edge)
       delta -= 1.0 * vertex.us_weights[us];
 
     return delta;
@@ -255,7 +258,7 @@ DirectedGraph::FindApproxMinimumFAS()
   auto& TG = *this;
 
   // Execute GR-algorithm
-  std::vector<size_t> s1, s2, s;
+  std::vector<uint32_t> s1, s2, s;
   while (TG.vertices.GetNumValid() > 0)
   {
     // Remove sinks
@@ -298,9 +301,9 @@ DirectedGraph::FindApproxMinimumFAS()
 
   // Make appr. minimum FAS sequence
   s.reserve(s1.size() + s2.size());
-  for (size_t u : s1)
+  for (uint32_t u : s1)
     s.push_back(u);
-  for (size_t u : s2)
+  for (uint32_t u : s2)
     s.push_back(u);
 
   return s;
@@ -365,13 +368,13 @@ DirectedGraph::PrintSubGraphviz(const std::vector<int>& verts_to_print, int loca
   std::cout << o.str();
 }
 
-std::vector<std::pair<size_t, size_t>>
+std::vector<std::pair<uint32_t, uint32_t>>
 DirectedGraph::RemoveCyclicDependencies()
 {
-  std::vector<std::pair<size_t, size_t>> edges_to_remove;
+  std::vector<std::pair<uint32_t, uint32_t>> edges_to_remove;
 
   // Utility lambdas
-  auto IsInList = [](std::vector<size_t>& list, size_t val)
+  auto IsInList = [](std::vector<uint32_t>& list, uint32_t val)
   { return std::find(list.begin(), list.end(), val) != list.end(); };
 
   // Find initial SCCs
@@ -396,9 +399,9 @@ DirectedGraph::RemoveCyclicDependencies()
       else if (subDG.size() == 3)
       {
         bool found = false;
-        for (size_t u : subDG)
+        for (uint32_t u : subDG)
         {
-          for (size_t v : vertices[u].ds_edge)
+          for (uint32_t v : vertices[u].ds_edge)
             if (IsInList(subDG, v))
             {
               found = true;
@@ -427,7 +430,7 @@ DirectedGraph::RemoveCyclicDependencies()
             auto mapv = std::find(subDG.begin(), subDG.end(), v);
             if (mapv != subDG.end())
             {
-              size_t mapping_v = mapv - subDG.begin();
+              auto mapping_v = static_cast<uint32_t>(mapv - subDG.begin());
               TG.AddEdge(mapping_u, mapping_v, vertices[u].ds_weights[v]);
             }
           } // for v
@@ -452,7 +455,7 @@ DirectedGraph::RemoveCyclicDependencies()
         // smap[v] then gives the position of v in s
         std::vector<int> smap(s.size(), -1);
         int count = 0;
-        for (size_t u : s)
+        for (uint32_t u : s)
           smap[u] = count++;
 
         // Build edges to remove
@@ -460,7 +463,7 @@ DirectedGraph::RemoveCyclicDependencies()
         for (auto& u : verts_copy)
         {
           int cur_map = smap[u.id];
-          for (size_t v : u.ds_edge)
+          for (uint32_t v : u.ds_edge)
           {
             int adj_map = smap[v];
             if (adj_map < cur_map)
@@ -470,8 +473,8 @@ DirectedGraph::RemoveCyclicDependencies()
 
         for (auto& edge : edges_to_rem)
         {
-          size_t u = subDG[edge.first];
-          size_t v = subDG[edge.second];
+          uint32_t u = subDG[edge.first];
+          uint32_t v = subDG[edge.second];
           RemoveEdge(u, v);
           edges_to_remove.emplace_back(u, v);
         }
@@ -25,7 +25,7 @@ public:
 
   public:
     /** Adds a vertex to the graph with a supplied id.*/
-    void AddVertex(size_t id, void* context);
+    void AddVertex(uint32_t id, void* context);
     /** Adds a vertex to the graph where the ID is assigned to
      * the number of vertices already loaded on the graph.
      * For example, if there are 3 vertices on the graph (with
@@ -33,19 +33,19 @@ public:
      * be assigned and ID of 3.*/
     void AddVertex(void* context);
     /** Removes a vertex from the graph.*/
-    void RemoveVertex(size_t v);
+    void RemoveVertex(uint32_t v);
 
     /** Accesses a vertex from the graph.*/
-    GraphVertex& operator[](size_t v);
+    GraphVertex& operator[](uint32_t v);
 
     /**Internal iterator class for vertex accessor.*/
     class iterator
     {
     public:
       VertexAccessor& ref_block;
-      size_t ref_element;
+      uint32_t ref_element;
 
-      iterator(VertexAccessor& block, size_t i) : ref_block(block), ref_element(i) {}
+      iterator(VertexAccessor& block, uint32_t i) : ref_block(block), ref_element(i) {}
 
       iterator operator++()
       {
@@ -84,7 +84,7 @@ public:
 
     iterator begin()
     {
-      size_t count = 0;
+      uint32_t count = 0;
       if (vertex_valid_flags_.empty())
         return {*this, count};
       if (vertex_valid_flags_[count])
@@ -101,7 +101,7 @@ public:
       }
     }
 
-    iterator end() { return {*this, vertices_.size()}; }
+    iterator end() { return {*this, static_cast<uint32_t>(vertices_.size())}; }
 
     size_t size() { return vertices_.size(); }
 
@@ -126,7 +126,7 @@ public:
 
   /** Adds a vertex to the graph. By default <I>context</I> is
    * assumed to be nullptr.*/
-  void AddVertex(size_t id, void* context = nullptr);
+  void AddVertex(uint32_t id, void* context = nullptr);
   /** Adds a vertex to the graph. By default <I>context</I> is
    * assumed to be nullptr and <I>id</I> is assumed to be assigned
    * automatically. In
@@ -135,13 +135,13 @@ public:
   void AddVertex(void* context = nullptr);
   /** Removes a vertex from the graph. This method does not
    * free any context related data.*/
-  void RemoveVertex(size_t v);
+  void RemoveVertex(uint32_t v);
   /** Adds an edge to the graph. Range checks are supplied by the
    * vertex accessor.*/
-  bool AddEdge(size_t from, size_t to, double weight = 1.0);
+  bool AddEdge(uint32_t from, uint32_t to, double weight = 1.0);
   /**Remove an edge from the graph. Range checks are supplied by the
    * vertex accessor.*/
-  void RemoveEdge(size_t from, size_t to);
+  void RemoveEdge(uint32_t from, uint32_t to);
 
   size_t GetNumSinks()
   {
@@ -165,18 +165,18 @@ private:
   /** Depth-First-Search main recursive algorithm. This is the recursive
    * portion of the method below this one
    * (opensn::DirectedGraph::DepthFirstSearch).*/
-  void DFSAlgorithm(std::vector<size_t>& traversal, std::vector<bool>& visited, size_t cur_vid);
+  void DFSAlgorithm(std::vector<uint32_t>& traversal, std::vector<bool>& visited, uint32_t cur_vid);
 
   /**SCC main recursive algorithm. This is the recursive call for the
    * method defined below this one
    * (opensn::DirectedGraph::FindStronglyConnectedConnections).*/
-  void SCCAlgorithm(size_t u,
+  void SCCAlgorithm(uint32_t u,
                     int& time,
                     std::vector<int>& disc,
                     std::vector<int>& low,
                     std::vector<bool>& on_stack,
-                    std::stack<size_t>& stack,
-                    std::vector<std::vector<size_t>>& SCCs);
+                    std::stack<uint32_t>& stack,
+                    std::vector<std::vector<uint32_t>>& SCCs);
 
 public:
   /**Find strongly connected components. This method is the implementation
@@ -187,7 +187,7 @@ public:
    *
    * It returns collections of vertices that form strongly connected
    * components excluding singletons.*/
-  std::vector<std::vector<size_t>> FindStronglyConnectedComponents();
+  std::vector<std::vector<uint32_t>> FindStronglyConnectedComponents();
 
   /** Generates a topological sort. This method is the implementation
    * of Kahn's algorithm [1].
@@ -198,7 +198,7 @@ public:
    * \return Returns the vertex ids sorted topologically. If this
    *         vector is empty the algorithm failed because it detected
    *         cyclic dependencies.*/
-  std::vector<size_t> GenerateTopologicalSort();
+  std::vector<uint32_t> GenerateTopologicalSort();
 
   /**Finds a sequence that minimizes the Feedback Arc Set (FAS). This
    * algorithm implements the algorithm depicted in [1].
@@ -206,7 +206,7 @@ public:
    * [1] Eades P., Lin X., Smyth W.F., "Fast & Effective heuristic for
    *     the feedback arc set problem", Information Processing Letters,
    *     Volume 47. 1993.*/
-  std::vector<size_t> FindApproxMinimumFAS();
+  std::vector<uint32_t> FindApproxMinimumFAS();
 
   /**Prints the graph in Graphviz format.*/
   void PrintGraphviz(int location_mask = 0);
@@ -214,7 +214,7 @@ public:
   /**Prints a sub-graph in Graphviz format.*/
   void PrintSubGraphviz(const std::vector<int>& verts_to_print, int location_mask = 0);
 
-  std::vector<std::pair<size_t, size_t>> RemoveCyclicDependencies();
+  std::vector<std::pair<uint32_t, uint32_t>> RemoveCyclicDependencies();
 
   /**Clears all the data structures associated with the graph.*/
   void Clear();
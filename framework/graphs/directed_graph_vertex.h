@@ -6,6 +6,7 @@
 #include "framework/graphs/graph.h"
 #include <map>
 #include <set>
+#include <cstdint>
 
 namespace opensn
 {
@@ -13,18 +14,18 @@ namespace opensn
 /**General implementation of a directed-graph vertex.*/
 struct GraphVertex
 {
-  size_t id;
+  uint32_t id;
   void* context;
 
-  std::set<size_t> us_edge;
-  std::set<size_t> ds_edge;
+  std::set<uint32_t> us_edge;
+  std::set<uint32_t> ds_edge;
 
-  std::map<size_t, double> us_weights;
-  std::map<size_t, double> ds_weights;
+  std::map<uint32_t, double> us_weights;
+  std::map<uint32_t, double> ds_weights;
 
-  GraphVertex(size_t id, void* context) : id(id), context(context) {}
+  GraphVertex(uint32_t id, void* context) : id(id), context(context) {}
 
-  explicit GraphVertex(size_t id) : id(id), context(nullptr) {}
+  explicit GraphVertex(uint32_t id) : id(id), context(nullptr) {}
 
   GraphVertex(const GraphVertex& vertex)
   {
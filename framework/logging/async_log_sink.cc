@@ -0,0 +1,86 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#include "framework/logging/async_log_sink.h"
+#include <chrono>
+#include <stdexcept>
+
+namespace opensn
+{
+
+AsyncLogSink::AsyncLogSink(const std::string& file_name)
+  : file_name_(file_name), file_(file_name, std::ios_base::out | std::ios_base::trunc)
+{
+  if (not file_.is_open())
+    throw std::runtime_error("Failed to open log file " + file_name);
+  thread_ = std::thread(&AsyncLogSink::Run, this);
+}
+
+AsyncLogSink::~AsyncLogSink()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  wake_.notify_one();
+  thread_.join();
+}
+
+void
+AsyncLogSink::Write(const std::string& text)
+{
+  bool wake = false;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    pending_ += text;
+    wake = pending_.size() >= WAKE_SIZE;
+  }
+  if (wake)
+    wake_.notify_one();
+}
+
+void
+AsyncLogSink::Flush()
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  const auto ticket = ++num_flushes_requested_;
+  wake_.notify_one();
+  written_.wait(lock, [this, ticket] { return num_flushes_done_ >= ticket; });
+}
+
+void
+AsyncLogSink::Run()
+{
+  std::string text;
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true)
+  {
+    wake_.wait_for(lock,
+                   std::chrono::milliseconds(250),
+                   [this]
+                   {
+                     return stop_ or num_flushes_requested_ > num_flushes_done_ or
+                            pending_.size() >= WAKE_SIZE;
+                   });
+
+    const auto num_flushes = num_flushes_requested_;
+    const bool stop = stop_;
+    text.swap(pending_);
+    lock.unlock();
+    file_ << text;
+    if (num_flushes > num_flushes_done_ or stop)
+      file_.flush();
+    text.clear();
+    lock.lock();
+
+    if (num_flushes > num_flushes_done_)
+    {
+      num_flushes_done_ = num_flushes;
+      written_.notify_all();
+    }
+    if (stop and pending_.empty())
+      break;
+  }
+}
+
+} // namespace opensn
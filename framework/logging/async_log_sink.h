@@ -0,0 +1,60 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <condition_variable>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace opensn
+{
+
+/**
+ * Buffered log file written by a background thread. Writers only append to an in-memory buffer,
+ * which the background thread swaps out and writes to the file when it grows large, periodically,
+ * or when the sink is flushed. Writes never block on the file system.
+ */
+class AsyncLogSink
+{
+public:
+  /**Opens the file, truncating it, and starts the writer thread.*/
+  explicit AsyncLogSink(const std::string& file_name);
+
+  /**Writes all pending text and stops the writer thread.*/
+  ~AsyncLogSink();
+
+  AsyncLogSink(const AsyncLogSink&) = delete;
+  AsyncLogSink& operator=(const AsyncLogSink&) = delete;
+
+  /**Appends text to the pending buffer.*/
+  void Write(const std::string& text);
+
+  /**Blocks until all text written so far is in the file.*/
+  void Flush();
+
+  const std::string& FileName() const { return file_name_; }
+
+private:
+  void Run();
+
+  /// Size of the pending buffer at which the writer thread is woken up
+  static constexpr size_t WAKE_SIZE = 1 << 16;
+
+  const std::string file_name_;
+  std::ofstream file_;
+
+  std::mutex mutex_;
+  std::condition_variable wake_;
+  std::condition_variable written_;
+  std::string pending_;
+  /// Number of flushes requested and completed
+  size_t num_flushes_requested_ = 0;
+  size_t num_flushes_done_ = 0;
+  bool stop_ = false;
+  std::thread thread_;
+};
+
+} // namespace opensn
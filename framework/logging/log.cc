@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: MIT
 
 #include "framework/logging/log.h"
+#include "framework/logging/async_log_sink.h"
 #include "framework/logging/stringstream_color.h"
 #include "framework/utils/timer.h"
 #include "framework/runtime.h"
@@ -22,132 +23,55 @@ Logger::Logger() noexcept
   verbosity_ = 0;
 }
 
+Logger::~Logger() = default;
+
+bool
+Logger::IsEnabled(LOG_LVL level) const
+{
+  if (level < LOG_0 or level > LOG_ALLVERBOSE_2)
+    return false;
+  if (not IsVerbosityEnabled(RequiredVerbosity(level)))
+    return false;
+  return level >= LOG_ALL or opensn::mpi_comm.rank() == 0;
+}
+
 LogStream
-Logger::Log(LOG_LVL level)
+Logger::MakeStream(LOG_LVL level)
 {
+  if (not IsEnabled(level))
+    return {};
+
+  std::string header = "[" + std::to_string(opensn::mpi_comm.rank()) + "]  ";
+
+  // Logs of all locations, except errors, go to the log file when there is one
+  const bool to_file = file_sink_ and level >= LOG_ALL and level != LOG_ALLERROR;
+  if (to_file)
+  {
+    if (level == LOG_ALLWARNING)
+      header += "**WARNING** ";
+    return {file_sink_.get(), std::move(header)};
+  }
+
   switch (level)
   {
-    case LOG_0VERBOSE_0:
-    case LOG_0:
-    {
-      if (opensn::mpi_comm.rank() == 0)
-      {
-        std::string header = "[" + std::to_string(opensn::mpi_comm.rank()) + "]  ";
-        return {&std::cout, header};
-      }
-      else
-      {
-        std::string header = " ";
-        return {&dummy_stream_, header, true};
-      }
-    }
     case LOG_0WARNING:
-    {
-      if (opensn::mpi_comm.rank() == 0)
-      {
-        std::string header = "[" + std::to_string(opensn::mpi_comm.rank()) + "]  ";
-        header += StringStreamColor(FG_YELLOW) + "**WARNING** ";
-        return {&std::cout, header};
-      }
-      else
-      {
-        std::string header = " ";
-        return {&dummy_stream_, header, true};
-      }
-    }
-    case LOG_0ERROR:
-    {
-      if (opensn::mpi_comm.rank() == 0)
-      {
-        std::string header = "[" + std::to_string(opensn::mpi_comm.rank()) + "]  ";
-        header += StringStreamColor(FG_RED) + "**!**ERROR**!** ";
-        return {&std::cerr, header};
-      }
-      else
-      {
-        std::string header = " ";
-        return {&dummy_stream_, header, true};
-      }
-    }
-
-    case LOG_0VERBOSE_1:
-    {
-      if ((opensn::mpi_comm.rank() == 0) and (verbosity_ >= 1))
-      {
-        std::string header = "[" + std::to_string(opensn::mpi_comm.rank()) + "]  ";
-        header += StringStreamColor(FG_CYAN);
-        return {&std::cout, header};
-      }
-      else
-      {
-        std::string header = " ";
-        return {&dummy_stream_, header, true};
-      }
-    }
-    case Logger::LOG_LVL::LOG_0VERBOSE_2:
-    {
-      if ((opensn::mpi_comm.rank() == 0) and (verbosity_ >= 2))
-      {
-        std::string header = "[" + std::to_string(opensn::mpi_comm.rank()) + "]  ";
-        header += StringStreamColor(FG_MAGENTA);
-        return {&std::cout, header};
-      }
-      else
-      {
-        std::string header = " ";
-        return {&dummy_stream_, header, true};
-      }
-    }
-    case LOG_ALLVERBOSE_0:
-    case LOG_ALL:
-    {
-      std::string header = "[" + std::to_string(opensn::mpi_comm.rank()) + "]  ";
-      return {&std::cout, header};
-    }
     case LOG_ALLWARNING:
-    {
-      std::string header = "[" + std::to_string(opensn::mpi_comm.rank()) + "]  ";
       header += StringStreamColor(FG_YELLOW) + "**WARNING** ";
-      return {&std::cout, header};
-    }
+      return {&std::cout, std::move(header)};
+    case LOG_0ERROR:
     case LOG_ALLERROR:
-    {
-      std::string header = "[" + std::to_string(opensn::mpi_comm.rank()) + "]  ";
       header += StringStreamColor(FG_RED) + "**!**ERROR**!** ";
-      return {&std::cerr, header};
-    }
-
+      return {&std::cerr, std::move(header)};
+    case LOG_0VERBOSE_1:
     case LOG_ALLVERBOSE_1:
-    {
-      if (verbosity_ >= 1)
-      {
-        std::string header = "[" + std::to_string(opensn::mpi_comm.rank()) + "]  ";
-        header += StringStreamColor(FG_CYAN);
-        return {&std::cout, header};
-      }
-      else
-      {
-        std::string header = " ";
-        return {&dummy_stream_, header, true};
-      }
-    }
+      header += StringStreamColor(FG_CYAN);
+      return {&std::cout, std::move(header)};
+    case LOG_0VERBOSE_2:
     case LOG_ALLVERBOSE_2:
-    {
-      if (verbosity_ >= 2)
-      {
-        std::string header = "[" + std::to_string(opensn::mpi_comm.rank()) + "]  ";
-        header += StringStreamColor(FG_MAGENTA);
-        return {&std::cout, header};
-      }
-      else
-      {
-        std::string header = " ";
-        return {&dummy_stream_, header, true};
-      }
-    }
+      header += StringStreamColor(FG_MAGENTA);
+      return {&std::cout, std::move(header)};
     default:
-      std::string header = " ";
-      return {&dummy_stream_, header};
+      return {&std::cout, std::move(header)};
   }
 }
 
@@ -163,4 +87,20 @@ Logger::GetVerbosity() const
   return verbosity_;
 }
 
+void
+Logger::SetFileSink(const std::string& file_prefix)
+{
+  file_sink_.reset();
+  if (not file_prefix.empty())
+    file_sink_ = std::make_unique<AsyncLogSink>(
+      file_prefix + "_" + std::to_string(opensn::mpi_comm.rank()) + ".log");
+}
+
+void
+Logger::Flush()
+{
+  if (file_sink_)
+    file_sink_->Flush();
+}
+
 } // namespace opensn
@@ -8,6 +8,12 @@
 #include <utility>
 #include <vector>
 #include <memory>
+#include <string>
+
+/// Highest verbosity level compiled in. Logs of a higher verbosity are removed at compile time.
+#ifndef OPENSN_LOG_MAX_VERBOSITY
+#define OPENSN_LOG_MAX_VERBOSITY 2
+#endif
 
 namespace opensn
 {
@@ -68,6 +74,20 @@ namespace opensn
   [0]  **WARNING** This is a warning
   [0]  **!**ERROR**!** This is an error
   \endverbatim
+   *
+   * ## Part B: Cost of filtered logs
+   * The verbosity of a log is checked before its stream is created, and logs
+   * of locations other than the calling one only return an inactive stream
+   * that neither allocates nor formats anything. Only the arguments of a
+   * filtered log are still evaluated. Logs that format expensive values can
+   * be guarded with `IsEnabled`. Logs of a verbosity above
+   * `OPENSN_LOG_MAX_VERBOSITY` are removed at compile time.
+   *
+   * ## Part C: Log files
+   * `SetFileSink` routes the logs of all locations (LOG_ALL, LOG_ALLWARNING
+   * and LOG_ALLVERBOSE_x) to one file per location, written by a background
+   * thread, so that they neither serialize on the console nor stall the
+   * calling code. Errors are always written to the console.
    * */
 class Logger
 {
@@ -90,20 +110,63 @@ public:
   };
 
 private:
-  DummyStream dummy_stream_;
   int verbosity_;
+  std::unique_ptr<AsyncLogSink> file_sink_;
 
   Logger() noexcept;
 
+  /**Returns the verbosity level a log level requires.*/
+  static constexpr int RequiredVerbosity(LOG_LVL level)
+  {
+    switch (level)
+    {
+      case LOG_0VERBOSE_1:
+      case LOG_ALLVERBOSE_1:
+        return 1;
+      case LOG_0VERBOSE_2:
+      case LOG_ALLVERBOSE_2:
+        return 2;
+      default:
+        return 0;
+    }
+  }
+
+  /**Creates the stream of a log whose verbosity is enabled.*/
+  LogStream MakeStream(LOG_LVL level);
+
 public:
   static Logger& GetInstance() noexcept;
 
-  LogStream Log(LOG_LVL level = LOG_0);
+  ~Logger();
+
+  /**Returns true if the verbosity level is enabled, both at compile time and at runtime.*/
+  bool IsVerbosityEnabled(int level) const
+  {
+    return level <= OPENSN_LOG_MAX_VERBOSITY and level <= verbosity_;
+  }
+
+  /**Returns true if a log of the given level is written on this location.*/
+  bool IsEnabled(LOG_LVL level) const;
+
+  LogStream Log(LOG_LVL level = LOG_0)
+  {
+    return IsVerbosityEnabled(RequiredVerbosity(level)) ? MakeStream(level) : LogStream();
+  }
 
   void SetVerbosity(int int_level);
 
   int GetVerbosity() const;
 
+  /**
+   * Routes the logs of all locations to the file `<file_prefix>_<location>.log` of each
+   * location, written asynchronously. An empty prefix closes the files and restores console
+   * output.
+   */
+  void SetFileSink(const std::string& file_prefix);
+
+  /**Blocks until all logs written to the log file of this location are in the file.*/
+  void Flush();
+
   LogStream Log0() { return Log(LOG_0); }
 
   LogStream Log0Warning() { return Log(LOG_0WARNING); }
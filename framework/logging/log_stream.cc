@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: MIT
 
 #include "framework/logging/log_stream.h"
+#include "framework/logging/async_log_sink.h"
 #include "framework/logging/stringstream_color.h"
 
 namespace opensn
@@ -9,14 +10,31 @@ namespace opensn
 
 LogStream::~LogStream()
 {
-  if (dummy_)
+  if (not buffer_)
     return;
 
-  std::string line, oline;
-  while (std::getline(*this, line))
-    oline += log_header_ + line + '\n' + StringStreamColor(RESET);
+  const std::string message = buffer_->str();
+  if (message.empty())
+    return;
+
+  // Console output resets the color of every line, file output is not colored
+  const std::string line_end = log_sink_ ? std::string("\n") : '\n' + StringStreamColor(RESET);
+
+  std::string oline;
+  oline.reserve(message.size() + log_header_.size() + line_end.size());
+  size_t pos = 0;
+  while (pos < message.size())
+  {
+    auto end = message.find('\n', pos);
+    if (end == std::string::npos)
+      end = message.size();
+    oline.append(log_header_).append(message, pos, end - pos).append(line_end);
+    pos = end + 1;
+  }
 
-  if (not oline.empty())
+  if (log_sink_)
+    log_sink_->Write(oline);
+  else
     *log_stream_ << oline << std::flush;
 }
 
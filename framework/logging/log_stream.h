@@ -4,46 +4,83 @@
 #pragma once
 
 #include <iostream>
+#include <memory>
 #include <sstream>
+#include <string>
 
 namespace opensn
 {
 
-/** Log stream for adding header information to a string stream.*/
-class LogStream : public std::stringstream
+class AsyncLogSink;
+
+/**
+ * Log stream for adding header information to a message. The message is formatted into a buffer
+ * and written, with the header prefixed to every line, when the stream is destroyed.
+ *
+ * A default constructed stream is inactive. It owns no buffer and discards everything inserted
+ * into it without formatting, so filtered logs cost no more than the evaluation of their
+ * arguments.
+ */
+class LogStream
 {
 private:
-  std::ostream* log_stream_;
+  std::ostream* log_stream_ = nullptr;
+  AsyncLogSink* log_sink_ = nullptr;
   std::string log_header_;
-  const bool dummy_ = false;
+  std::unique_ptr<std::ostringstream> buffer_;
 
 public:
-  /** Creates a string stream.*/
-  LogStream(std::ostream* output_stream, std::string header, bool dummy_flag = false)
-    : log_stream_(output_stream), log_header_(std::move(header)), dummy_(dummy_flag)
+  /** Creates an inactive stream.*/
+  LogStream() = default;
+
+  /** Creates a stream that writes to an output stream.*/
+  LogStream(std::ostream* output_stream, std::string header)
+    : log_stream_(output_stream),
+      log_header_(std::move(header)),
+      buffer_(std::make_unique<std::ostringstream>())
   {
   }
 
+  /** Creates a stream that writes to an asynchronous sink.*/
+  LogStream(AsyncLogSink* sink, std::string header)
+    : log_sink_(sink),
+      log_header_(std::move(header)),
+      buffer_(std::make_unique<std::ostringstream>())
+  {
+  }
+
+  LogStream(LogStream&& other) noexcept = default;
+  LogStream& operator=(LogStream&&) = delete;
+  LogStream(const LogStream&) = delete;
+  LogStream& operator=(const LogStream&) = delete;
+
   /** Flushes stream.*/
-  virtual ~LogStream();
+  ~LogStream();
+
+  /** Returns true if the stream writes its message.*/
+  bool IsActive() const { return buffer_ != nullptr; }
 
-  LogStream(const LogStream& other)
+  template <typename T>
+  LogStream& operator<<(T&& value)
   {
-    log_stream_ = other.log_stream_;
-    log_header_ = other.log_header_;
+    if (buffer_)
+      *buffer_ << value;
+    return *this;
   }
-};
 
-struct DummyStream : public std::ostream
-{
-  struct DummyStreamBuffer : std::streambuf
+  LogStream& operator<<(std::ostream& (*manipulator)(std::ostream&))
   {
-    virtual int overflow(int c) { return c; };
-  } buffer;
-
-  DummyStream() : std::ostream(&buffer) {}
+    if (buffer_)
+      manipulator(*buffer_);
+    return *this;
+  }
 
-  ~DummyStream() {}
+  LogStream& operator<<(std::ios_base& (*manipulator)(std::ios_base&))
+  {
+    if (buffer_)
+      manipulator(*buffer_);
+    return *this;
+  }
 };
 
 } // namespace opensn
@@ -3,6 +3,8 @@
 
 #include "framework/materials/multi_group_xs/multi_group_xs.h"
 #include "framework/logging/log.h"
+#include <algorithm>
+#include <functional>
 
 namespace opensn
 {
@@ -205,6 +207,138 @@ MultiGroupXS::Initialize(std::vector<std::pair<int, double>>& combinations)
   ComputeDiffusionParameters();
 }
 
+void
+MultiGroupXS::Initialize(const std::vector<double>& temperatures,
+                         const std::vector<std::shared_ptr<MultiGroupXS>>& xsecs)
+{
+  Reset();
+
+  OpenSnInvalidArgumentIf(temperatures.empty(), "At least one table temperature is required.");
+  OpenSnInvalidArgumentIf(temperatures.size() != xsecs.size(),
+                          "The number of table temperatures (" +
+                            std::to_string(temperatures.size()) +
+                            ") does not match the number of cross sections (" +
+                            std::to_string(xsecs.size()) + ").");
+  OpenSnInvalidArgumentIf(
+    std::adjacent_find(temperatures.begin(), temperatures.end(), std::greater_equal<>()) !=
+      temperatures.end(),
+    "The table temperatures must be strictly increasing.");
+
+  // Check that the table points are compatible with each other
+  const auto& ref = *xsecs.front();
+  for (const auto& xs : xsecs)
+  {
+    OpenSnLogicalErrorIf(xs->NumGroups() != ref.NumGroups(),
+                         "All tabulated cross sections must have the same group structure.");
+    OpenSnLogicalErrorIf(xs->ScatteringOrder() != ref.ScatteringOrder() or
+                           xs->TransferMatrices().size() != ref.TransferMatrices().size(),
+                         "All tabulated cross sections must have the same scattering order.");
+    OpenSnLogicalErrorIf(xs->IsFissionable() != ref.IsFissionable() or
+                           xs->NumPrecursors() != ref.NumPrecursors(),
+                         "All tabulated cross sections must have the same fission and "
+                         "precursor data layout.");
+    OpenSnLogicalErrorIf(xs->IsTabulated(), "Tabulated cross sections cannot be nested.");
+  }
+
+  tabulated_temperatures_ = temperatures;
+  tabulated_xs_ = xsecs;
+
+  Interpolate(temperatures.front(), *this);
+}
+
+void
+MultiGroupXS::Interpolate(double temperature, MultiGroupXS& xs) const
+{
+  OpenSnLogicalErrorIf(not IsTabulated(), "The cross section is not tabulated in temperature.");
+
+  // Determine the bracketing table points and interpolation weights. Note that `xs` may be this
+  // cross section, so the state needed from it is copied out first.
+  const auto& temps = tabulated_temperatures_;
+  size_t lo = 0;
+  size_t hi = 0;
+  double w_hi = 0.0;
+  if (temperature >= temps.back())
+    lo = hi = temps.size() - 1;
+  else if (temperature > temps.front())
+  {
+    hi = std::upper_bound(temps.begin(), temps.end(), temperature) - temps.begin();
+    lo = hi - 1;
+    w_hi = (temperature - temps[lo]) / (temps[hi] - temps[lo]);
+  }
+  const double w_lo = 1.0 - w_hi;
+  const auto& xs_lo = *tabulated_xs_[lo];
+  const auto& xs_hi = *tabulated_xs_[hi];
+  const bool adjoint = adjoint_;
+  const double scaling_factor = scaling_factor_;
+
+  // Reaction data carries the scaling factor, other data is interpolated as is
+  const double f_lo = w_lo * scaling_factor;
+  const double f_hi = w_hi * scaling_factor;
+  auto Lerp = [](const std::vector<double>& a, double wa, const std::vector<double>& b, double wb)
+  {
+    std::vector<double> c(a.size(), 0.0);
+    for (size_t i = 0; i < a.size(); ++i)
+      c[i] = wa * a[i] + wb * b[i];
+    return c;
+  };
+
+  xs.num_groups_ = xs_lo.num_groups_;
+  xs.scattering_order_ = xs_lo.scattering_order_;
+  xs.num_precursors_ = xs_lo.num_precursors_;
+  xs.is_fissionable_ = xs_lo.is_fissionable_;
+  xs.scaling_factor_ = scaling_factor;
+  xs.temperature_ = temperature;
+  xs.e_bounds_ = xs_lo.e_bounds_;
+
+  xs.sigma_t_ = Lerp(xs_lo.sigma_t_, f_lo, xs_hi.sigma_t_, f_hi);
+  xs.sigma_a_ = Lerp(xs_lo.sigma_a_, f_lo, xs_hi.sigma_a_, f_hi);
+  xs.sigma_f_ = Lerp(xs_lo.sigma_f_, f_lo, xs_hi.sigma_f_, f_hi);
+  xs.nu_sigma_f_ = Lerp(xs_lo.nu_sigma_f_, f_lo, xs_hi.nu_sigma_f_, f_hi);
+  xs.nu_prompt_sigma_f_ = Lerp(xs_lo.nu_prompt_sigma_f_, f_lo, xs_hi.nu_prompt_sigma_f_, f_hi);
+  xs.nu_delayed_sigma_f_ = Lerp(xs_lo.nu_delayed_sigma_f_, f_lo, xs_hi.nu_delayed_sigma_f_, f_hi);
+  xs.inv_velocity_ = Lerp(xs_lo.inv_velocity_, w_lo, xs_hi.inv_velocity_, w_hi);
+  xs.precursors_ = xs_lo.precursors_;
+
+  xs.production_matrix_.resize(xs_lo.production_matrix_.size());
+  for (size_t g = 0; g < xs_lo.production_matrix_.size(); ++g)
+    xs.production_matrix_[g] =
+      Lerp(xs_lo.production_matrix_[g], f_lo, xs_hi.production_matrix_[g], f_hi);
+
+  // The sparsity patterns of the table points can differ, hence the union of the patterns is
+  // built by adding entries
+  xs.transfer_matrices_.assign(xs_lo.transfer_matrices_.size(),
+                               SparseMatrix(xs.num_groups_, xs.num_groups_));
+  for (const auto& [table_xs, f] : {std::make_pair(&xs_lo, f_lo), std::make_pair(&xs_hi, f_hi)})
+  {
+    if (f == 0.0)
+      continue;
+    for (size_t ell = 0; ell < table_xs->transfer_matrices_.size(); ++ell)
+    {
+      const auto& S_ell = table_xs->transfer_matrices_[ell];
+      for (size_t g = 0; g < xs.num_groups_; ++g)
+      {
+        const auto& cols = S_ell.rowI_indices_[g];
+        const auto& vals = S_ell.rowI_values_[g];
+        for (size_t t = 0; t < cols.size(); ++t)
+          xs.transfer_matrices_[ell].InsertAdd(g, cols[t], f * vals[t]);
+      }
+    }
+  }
+
+  // Recompute derived quantities
+  xs.diffusion_initialized_ = false;
+  xs.sigma_tr_.clear();
+  xs.diffusion_coeff_.clear();
+  xs.sigma_r_.clear();
+  xs.sigma_s_gtog_.clear();
+  xs.ComputeDiffusionParameters();
+
+  xs.transposed_transfer_matrices_.clear();
+  xs.transposed_production_matrix_.clear();
+  xs.adjoint_ = false;
+  xs.SetAdjointMode(adjoint);
+}
+
 void
 MultiGroupXS::Reset()
 {
@@ -226,6 +360,9 @@ MultiGroupXS::Reset()
 
   inv_velocity_.clear();
 
+  tabulated_temperatures_.clear();
+  tabulated_xs_.clear();
+
   // Diffusion quantities
   diffusion_initialized_ = false;
   sigma_tr_.clear();
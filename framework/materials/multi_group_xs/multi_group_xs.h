@@ -5,6 +5,7 @@
 
 #include "framework/materials/material_property.h"
 #include "framework/math/sparse_matrix/math_sparse_matrix.h"
+#include <memory>
 
 namespace opensn
 {
@@ -45,6 +46,30 @@ public:
   void
   Initialize(const std::string& file_name, const std::string& dataset_name, double temperature);
 
+  /**
+   * Populates a temperature-tabulated cross section from cross sections evaluated at the given
+   * (strictly increasing) temperatures. Until the cross section is interpolated, the data of the
+   * first table point is used.
+   */
+  void Initialize(const std::vector<double>& temperatures,
+                  const std::vector<std::shared_ptr<MultiGroupXS>>& xsecs);
+
+  /**
+   * This method populates temperature-tabulated transport cross sections from an OpenMC
+   * cross-section file, reading the dataset at each of the given temperatures.
+   */
+  void Initialize(const std::string& file_name,
+                  const std::string& dataset_name,
+                  const std::vector<double>& temperatures);
+
+  /**
+   * Evaluates the tabulated cross section at the given temperature and stores the result in
+   * `xs`. The data is linearly interpolated between the bracketing table points. Temperatures
+   * outside of the table are clamped to the table range. Decay constants and emission spectra
+   * are not temperature dependent and are taken from the lower table point.
+   */
+  void Interpolate(double temperature, MultiGroupXS& xs) const;
+
   /**
    * A struct containing data for a delayed neutron precursor.
    */
@@ -82,6 +107,13 @@ public:
 
   bool IsFissionable() const { return is_fissionable_; }
 
+  /// Returns true if the cross section is tabulated in temperature.
+  bool IsTabulated() const { return not tabulated_xs_.empty(); }
+
+  const std::vector<double>& TabulatedTemperatures() const { return tabulated_temperatures_; }
+
+  double Temperature() const { return temperature_; }
+
   void SetAdjointMode(bool val)
   {
     adjoint_ = val;
@@ -156,6 +188,10 @@ private:
   std::vector<std::vector<double>> production_matrix_; ///< Total neutron production matrix
   std::vector<std::vector<double>> transposed_production_matrix_;
 
+  // Temperature tabulation
+  std::vector<double> tabulated_temperatures_;              ///< Table temperatures
+  std::vector<std::shared_ptr<MultiGroupXS>> tabulated_xs_; ///< Cross sections per temperature
+
   // Diffusion quantities
   bool diffusion_initialized_;
   std::vector<double> sigma_tr_;        ///< Transport cross section
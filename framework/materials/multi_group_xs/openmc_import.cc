@@ -191,4 +191,21 @@ MultiGroupXS::Initialize(const std::string& file_name,
   H5Fclose(file);
 }
 
+void
+MultiGroupXS::Initialize(const std::string& file_name,
+                         const std::string& dataset_name,
+                         const std::vector<double>& temperatures)
+{
+  std::vector<std::shared_ptr<MultiGroupXS>> xsecs;
+  xsecs.reserve(temperatures.size());
+  for (const auto& temperature : temperatures)
+  {
+    auto xs = std::make_shared<MultiGroupXS>();
+    xs->Initialize(file_name, dataset_name, temperature);
+    xsecs.push_back(xs);
+  }
+
+  Initialize(temperatures, xsecs);
+}
+
 } // namespace opensn
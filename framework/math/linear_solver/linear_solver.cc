@@ -93,7 +93,7 @@ LinearSolver::Setup()
 
   ApplyToleranceOptions();
 
-  if (iterative_method_ == "gmres")
+  if (iterative_method_ == "gmres" or iterative_method_ == "pgmres")
   {
     KSPGMRESSetRestart(ksp_, tolerance_options_.gmres_restart_interval);
     KSPGMRESSetBreakdownTolerance(ksp_, tolerance_options_.gmres_breakdown_tolerance);
@@ -5,12 +5,45 @@
 #include "framework/math/quadratures/angular/legendre_poly/legendrepoly.h"
 #include "framework/logging/log.h"
 #include "framework/runtime.h"
+#include <filesystem>
+#include <fstream>
 #include <iomanip>
 #include <numeric>
+#include <sstream>
+#include <unistd.h>
 
 namespace opensn
 {
 
+namespace
+{
+
+/**FNV-1a hash of the bytes of a value, accumulated onto hash.*/
+template <typename T>
+void
+HashBytes(uint64_t& hash, const T& value)
+{
+  const auto* bytes = reinterpret_cast<const unsigned char*>(&value);
+  for (size_t i = 0; i < sizeof(T); ++i)
+  {
+    hash ^= bytes[i];
+    hash *= 1099511628211ULL;
+  }
+}
+
+/// Identifies cache files of spherical harmonics evaluations, "OSNAQY01"
+constexpr uint64_t HARMONICS_CACHE_MAGIC = 0x31305951414e534fULL;
+
+} // namespace
+
+std::string AngularQuadrature::operator_cache_directory_;
+
+void
+AngularQuadrature::SetOperatorCacheDirectory(const std::string& directory)
+{
+  operator_cache_directory_ = directory;
+}
+
 void
 AngularQuadrature::OptimizeForPolarSymmetry(const double normalization)
 {
@@ -62,29 +95,27 @@ AngularQuadrature::BuildDiscreteToMomentOperator(unsigned int scattering_order,
   if (d2m_op_built_)
     return;
 
-  d2m_op_.clear();
   MakeHarmonicIndices(scattering_order, dimension);
+  ComputeHarmonicsByDirection();
 
   const size_t num_angles = abscissae_.size();
   const size_t num_moms = m_to_ell_em_map_.size();
 
-  for (const auto& ell_em : m_to_ell_em_map_)
-  {
-    std::vector<double> cur_mom;
-    cur_mom.reserve(num_angles);
-
-    for (int n = 0; n < num_angles; n++)
-    {
-      const auto& cur_angle = abscissae_[n];
-      double value = Ylm(ell_em.ell, ell_em.m, cur_angle.phi, cur_angle.theta);
-      double w = weights_[n];
-      cur_mom.push_back(value * w);
-    }
+  d2m_op_by_direction_.resize(num_angles * num_moms);
+  for (size_t n = 0; n < num_angles; ++n)
+    for (size_t m = 0; m < num_moms; ++m)
+      d2m_op_by_direction_[n * num_moms + m] =
+        harmonics_by_direction_[n * num_moms + m] * weights_[n];
 
-    d2m_op_.push_back(cur_mom);
-  }
+  d2m_op_.assign(num_moms, std::vector<double>(num_angles));
+  for (size_t m = 0; m < num_moms; ++m)
+    for (size_t n = 0; n < num_angles; ++n)
+      d2m_op_[m][n] = d2m_op_by_direction_[n * num_moms + m];
   d2m_op_built_ = true;
 
+  if (log.GetVerbosity() < 1)
+    return;
+
   // Verbose printout
   std::stringstream outs;
   outs << "\nQuadrature d2m operator:\n";
@@ -108,31 +139,32 @@ AngularQuadrature::BuildMomentToDiscreteOperator(unsigned int scattering_order,
   if (m2d_op_built_)
     return;
 
-  m2d_op_.clear();
   MakeHarmonicIndices(scattering_order, dimension);
+  ComputeHarmonicsByDirection();
 
   const size_t num_angles = abscissae_.size();
   const size_t num_moms = m_to_ell_em_map_.size();
 
   const auto normalization = std::accumulate(weights_.begin(), weights_.end(), 0.0);
 
-  for (const auto& ell_em : m_to_ell_em_map_)
-  {
-    std::vector<double> cur_mom;
-    cur_mom.reserve(num_angles);
-
-    for (int n = 0; n < num_angles; n++)
+  m2d_op_by_direction_.resize(num_angles * num_moms);
+  for (size_t n = 0; n < num_angles; ++n)
+    for (size_t m = 0; m < num_moms; ++m)
     {
-      const auto& cur_angle = abscissae_[n];
-      double value = ((2.0 * ell_em.ell + 1.0) / normalization) *
-                     Ylm(ell_em.ell, ell_em.m, cur_angle.phi, cur_angle.theta);
-      cur_mom.push_back(value);
+      const auto ell = m_to_ell_em_map_[m].ell;
+      m2d_op_by_direction_[n * num_moms + m] =
+        ((2.0 * ell + 1.0) / normalization) * harmonics_by_direction_[n * num_moms + m];
     }
 
-    m2d_op_.push_back(cur_mom);
-  } // for m
+  m2d_op_.assign(num_moms, std::vector<double>(num_angles));
+  for (size_t m = 0; m < num_moms; ++m)
+    for (size_t n = 0; n < num_angles; ++n)
+      m2d_op_[m][n] = m2d_op_by_direction_[n * num_moms + m];
   m2d_op_built_ = true;
 
+  if (log.GetVerbosity() < 1)
+    return;
+
   // Verbose printout
   std::stringstream outs;
 
@@ -151,6 +183,119 @@ AngularQuadrature::BuildMomentToDiscreteOperator(unsigned int scattering_order,
   log.Log0Verbose1() << outs.str();
 }
 
+void
+AngularQuadrature::ComputeHarmonicsByDirection()
+{
+  const size_t num_angles = abscissae_.size();
+  const size_t num_moms = m_to_ell_em_map_.size();
+
+  uint64_t key = 14695981039346656037ULL;
+  HashBytes(key, num_angles);
+  for (const auto& abscissa : abscissae_)
+  {
+    HashBytes(key, abscissa.phi);
+    HashBytes(key, abscissa.theta);
+  }
+  HashBytes(key, num_moms);
+  for (const auto& ell_em : m_to_ell_em_map_)
+  {
+    HashBytes(key, ell_em.ell);
+    HashBytes(key, ell_em.m);
+  }
+
+  // The d2m and m2d operators are built from the same harmonics
+  if (key == harmonics_key_ and harmonics_by_direction_.size() == num_angles * num_moms)
+    return;
+  harmonics_key_ = key;
+
+  std::filesystem::path cache_path;
+  if (not operator_cache_directory_.empty())
+  {
+    std::stringstream file_name;
+    file_name << "aquad_harmonics_" << std::hex << std::setw(16) << std::setfill('0') << key
+              << ".bin";
+    cache_path = std::filesystem::path(operator_cache_directory_) / file_name.str();
+
+    // Read the cache on the first rank and broadcast it
+    int found = 0;
+    if (mpi_comm.rank() == 0)
+    {
+      std::ifstream file(cache_path, std::ios_base::binary);
+      uint64_t header[4] = {0, 0, 0, 0};
+      if (file.is_open() and file.read(reinterpret_cast<char*>(header), sizeof(header)) and
+          header[0] == HARMONICS_CACHE_MAGIC and header[1] == key and header[2] == num_angles and
+          header[3] == num_moms)
+      {
+        harmonics_by_direction_.resize(num_angles * num_moms);
+        file.read(reinterpret_cast<char*>(harmonics_by_direction_.data()),
+                  static_cast<std::streamsize>(harmonics_by_direction_.size() * sizeof(double)));
+        found = file ? 1 : 0;
+      }
+    }
+    mpi_comm.broadcast(found, 0);
+    if (found)
+    {
+      harmonics_by_direction_.resize(num_angles * num_moms);
+      mpi_comm.broadcast(harmonics_by_direction_.data(),
+                         static_cast<int>(harmonics_by_direction_.size()),
+                         0);
+      log.Log() << "Quadrature harmonics cache hit: " << cache_path.string();
+      return;
+    }
+    log.Log() << "Quadrature harmonics cache miss: " << cache_path.string();
+  }
+
+  // Evaluate a contiguous block of directions on each rank and gather all of them
+  const int num_ranks = mpi_comm.size();
+  const auto BlockBegin = [num_angles, num_ranks](int rank)
+  { return num_angles * static_cast<size_t>(rank) / static_cast<size_t>(num_ranks); };
+
+  const size_t begin = BlockBegin(mpi_comm.rank());
+  const size_t end = BlockBegin(mpi_comm.rank() + 1);
+  std::vector<double> local_harmonics;
+  local_harmonics.reserve((end - begin) * num_moms);
+  for (size_t n = begin; n < end; ++n)
+  {
+    const auto& abscissa = abscissae_[n];
+    for (const auto& ell_em : m_to_ell_em_map_)
+      local_harmonics.push_back(Ylm(ell_em.ell, ell_em.m, abscissa.phi, abscissa.theta));
+  }
+
+  std::vector<int> counts(num_ranks);
+  std::vector<int> offsets(num_ranks);
+  for (int r = 0; r < num_ranks; ++r)
+  {
+    offsets[r] = static_cast<int>(BlockBegin(r) * num_moms);
+    counts[r] = static_cast<int>((BlockBegin(r + 1) - BlockBegin(r)) * num_moms);
+  }
+  mpi_comm.all_gather(local_harmonics, harmonics_by_direction_, counts, offsets);
+
+  // Write the cache from the first rank, through a temporary file so that concurrent runs never
+  // read a partial file
+  if (not cache_path.empty() and mpi_comm.rank() == 0)
+  {
+    std::error_code ec;
+    std::filesystem::create_directories(cache_path.parent_path(), ec);
+    auto tmp_path = cache_path;
+    tmp_path += ".tmp" + std::to_string(static_cast<long long>(getpid()));
+    {
+      std::ofstream file(tmp_path, std::ios_base::binary | std::ios_base::out);
+      if (file.is_open())
+      {
+        const uint64_t header[4] = {HARMONICS_CACHE_MAGIC, key, num_angles, num_moms};
+        file.write(reinterpret_cast<const char*>(header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(harmonics_by_direction_.data()),
+                   static_cast<std::streamsize>(harmonics_by_direction_.size() * sizeof(double)));
+      }
+      if (not file)
+        log.Log0Warning() << "Failed to write quadrature harmonics cache " << tmp_path.string();
+    }
+    std::filesystem::rename(tmp_path, cache_path, ec);
+    if (ec)
+      std::filesystem::remove(tmp_path, ec);
+  }
+}
+
 std::vector<std::vector<double>> const&
 AngularQuadrature::GetDiscreteToMomentOperator() const
 {
@@ -173,6 +318,28 @@ AngularQuadrature::GetMomentToDiscreteOperator() const
   return m2d_op_;
 }
 
+const std::vector<double>&
+AngularQuadrature::GetDiscreteToMomentOperatorByDirection() const
+{
+  const std::string fname = __FUNCTION__;
+  if (not d2m_op_built_)
+    throw std::logic_error(fname +
+                           ": Called but D2M operator not yet built. "
+                           "Make a call to BuildDiscreteToMomentOperator before using this.");
+  return d2m_op_by_direction_;
+}
+
+const std::vector<double>&
+AngularQuadrature::GetMomentToDiscreteOperatorByDirection() const
+{
+  const std::string fname = __FUNCTION__;
+  if (not m2d_op_built_)
+    throw std::logic_error(fname +
+                           ": Called but M2D operator not yet built. "
+                           "Make a call to BuildMomentToDiscreteOperator before using this.");
+  return m2d_op_by_direction_;
+}
+
 const std::vector<AngularQuadrature::HarmonicIndices>&
 AngularQuadrature::GetMomentToHarmonicsIndexMap() const
 {
@@ -4,6 +4,8 @@
 #pragma once
 
 #include "framework/mesh/mesh_vector.h"
+#include <cstdint>
+#include <string>
 #include <vector>
 
 namespace opensn
@@ -45,14 +47,32 @@ public:
 protected:
   std::vector<std::vector<double>> d2m_op_;
   std::vector<std::vector<double>> m2d_op_;
+  std::vector<double> d2m_op_by_direction_;
+  std::vector<double> m2d_op_by_direction_;
   std::vector<HarmonicIndices> m_to_ell_em_map_;
   bool d2m_op_built_ = false;
   bool m2d_op_built_ = false;
 
+  /// Spherical harmonics of all directions, [d * num_moments + m], shared by the d2m and m2d
+  /// operators
+  std::vector<double> harmonics_by_direction_;
+  /// Hash of the directions and harmonic indices the harmonics were evaluated for
+  uint64_t harmonics_key_ = 0;
+
   /**Populates a map of moment m to the Spherical Harmonic indices
    * required.*/
   virtual void MakeHarmonicIndices(unsigned int scattering_order, int dimension);
 
+  /**Evaluates the spherical harmonics of the harmonic index map for all directions. The
+   * directions are split across the ranks and the values are gathered on all ranks, so this
+   * must be called by all ranks. When an operator cache directory is set, the values are read
+   * on the first rank from a cache file keyed by a hash of the directions and harmonic indices,
+   * and broadcast. Otherwise they are computed and written to the cache.*/
+  void ComputeHarmonicsByDirection();
+
+private:
+  static std::string operator_cache_directory_;
+
 public:
   const AngularQuadratureType type_;
   std::vector<QuadraturePointPhiTheta> abscissae_;
@@ -65,6 +85,10 @@ public:
 
   virtual ~AngularQuadrature() = default;
 
+  /**Sets the directory of the persistent cache of the spherical harmonics the d2m and m2d
+   * operators are built from. An empty directory, the default, disables the cache.*/
+  static void SetOperatorCacheDirectory(const std::string& directory);
+
   /**Optimizes the angular quadrature for polar symmetry by removing
    * all the direction with downward pointing polar angles.
    *
@@ -92,6 +116,17 @@ public:
    * and d is the direction index.*/
   std::vector<std::vector<double>> const& GetMomentToDiscreteOperator() const;
 
+  /**Returns a reference to the precomputed d2m operator stored contiguously
+   * by direction. The operator is accessed as [d * num_moments + m], so that
+   * the moments of a direction are adjacent in memory. This will throw a
+   * std::logic_error if the operator has not been built yet.*/
+  const std::vector<double>& GetDiscreteToMomentOperatorByDirection() const;
+
+  /**Returns a reference to the precomputed m2d operator stored contiguously
+   * by direction, accessed as [d * num_moments + m]. This will throw a
+   * std::logic_error if the operator has not been built yet.*/
+  const std::vector<double>& GetMomentToDiscreteOperatorByDirection() const;
+
   /**Returns a reference to the precomputed harmonic index map. This will
    * throw a std::logic_error if the map has not been built yet.*/
   const std::vector<HarmonicIndices>& GetMomentToHarmonicsIndexMap() const;
@@ -170,6 +170,12 @@ CellMapping::ComputeCellVolumeAndAreas(const MeshContinuum& grid,
   }
 }
 
+bool
+CellMapping::ComputeUnitIntegrals(FiniteElementUnitIntegrals& unit_integrals) const
+{
+  return false;
+}
+
 const std::vector<Vector3>&
 CellMapping::GetNodeLocations() const
 {
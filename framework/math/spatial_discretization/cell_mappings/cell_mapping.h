@@ -16,6 +16,7 @@ struct Vector3;
 class Cell;
 class VolumetricFiniteElementData;
 class SurfaceFiniteElementData;
+struct FiniteElementUnitIntegrals;
 
 /**Base class for all cell mappings.
  * \ingroup doc_CellMappings*/
@@ -71,6 +72,11 @@ public:
    * face.*/
   virtual SurfaceFiniteElementData MakeSurfaceFiniteElementData(size_t face_index) const = 0;
 
+  /**Computes the unweighted unit integrals of this element in closed form, without forming
+   * any quadrature point data. Returns false if the element has no closed-form expressions,
+   * in which case the integrals must be computed from the finite element data.*/
+  virtual bool ComputeUnitIntegrals(FiniteElementUnitIntegrals& unit_integrals) const;
+
   virtual ~CellMapping() = default;
 
 protected:
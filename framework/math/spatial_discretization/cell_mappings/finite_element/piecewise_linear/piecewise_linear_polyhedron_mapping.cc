@@ -5,6 +5,7 @@
 #include "framework/math/spatial_discretization/finite_element/finite_element_data.h"
 #include "framework/mesh/mesh_continuum/mesh_continuum.h"
 #include "framework/logging/log.h"
+#include <cmath>
 
 namespace opensn
 {
@@ -167,6 +168,21 @@ PieceWiseLinearPolyhedronMapping::PieceWiseLinearPolyhedronMapping(
     } // for f
     node_side_maps_.push_back(newNodeMap);
   } // for i
+
+  // Tetrahedra are additionally described by their own linear map
+  if (polyh_cell.SubType() == CellType::TETRAHEDRON and num_nodes_ == 4)
+  {
+    is_tetrahedron_ = true;
+
+    const auto& v0 = ref_grid_.vertices[polyh_cell.vertex_ids_[0]];
+    tet_data_.v0 = v0;
+    tet_data_.J.SetColJVec(0, ref_grid_.vertices[polyh_cell.vertex_ids_[1]] - v0);
+    tet_data_.J.SetColJVec(1, ref_grid_.vertices[polyh_cell.vertex_ids_[2]] - v0);
+    tet_data_.J.SetColJVec(2, ref_grid_.vertices[polyh_cell.vertex_ids_[3]] - v0);
+    tet_data_.detJ = tet_data_.J.Det();
+    tet_data_.Jinv = tet_data_.J.Inverse();
+    tet_data_.JTinv = tet_data_.J.Transpose().Inverse();
+  }
 }
 
 double
@@ -573,6 +589,9 @@ PieceWiseLinearPolyhedronMapping::GradShapeValues(const Vector3& xyz,
 VolumetricFiniteElementData
 PieceWiseLinearPolyhedronMapping::MakeVolumetricFiniteElementData() const
 {
+  if (is_tetrahedron_)
+    return MakeTetrahedronVolumetricFiniteElementData();
+
   // Determine number of internal qpoints
   size_t num_tets = 0;
   for (auto& face : face_data_)
@@ -653,6 +672,9 @@ PieceWiseLinearPolyhedronMapping::MakeVolumetricFiniteElementData() const
 SurfaceFiniteElementData
 PieceWiseLinearPolyhedronMapping::MakeSurfaceFiniteElementData(size_t face_index) const
 {
+  if (is_tetrahedron_)
+    return MakeTetrahedronSurfaceFiniteElementData(face_index);
+
   const bool ON_SURFACE = true;
 
   // Init surface quadrature
@@ -726,4 +748,233 @@ PieceWiseLinearPolyhedronMapping::MakeSurfaceFiniteElementData(size_t face_index
                                   F_num_nodes);
 }
 
+VolumetricFiniteElementData
+PieceWiseLinearPolyhedronMapping::MakeTetrahedronVolumetricFiniteElementData() const
+{
+  const size_t num_vol_qpoints = volume_quadrature_.qpoints.size();
+
+  std::vector<unsigned int> V_quadrature_point_indices(num_vol_qpoints);
+  VecVec3 V_qpoints_xyz;
+  std::vector<std::vector<double>> V_shape_value(num_nodes_);
+  std::vector<VecVec3> V_shape_grad(num_nodes_);
+  std::vector<double> V_JxW;
+
+  V_qpoints_xyz.reserve(num_vol_qpoints);
+  V_JxW.reserve(num_vol_qpoints);
+  for (unsigned int qp = 0; qp < num_vol_qpoints; ++qp)
+  {
+    const auto& qpoint = volume_quadrature_.qpoints[qp];
+    V_quadrature_point_indices[qp] = qp;
+    V_qpoints_xyz.push_back(tet_data_.v0 + tet_data_.J * qpoint);
+    V_JxW.push_back(std::fabs(tet_data_.detJ) * volume_quadrature_.weights[qp]);
+  }
+
+  for (size_t i = 0; i < num_nodes_; ++i)
+  {
+    const Vector3 grad_i = tet_data_.JTinv * Vector3(TetGradShape_x(i),
+                                                     TetGradShape_y(i),
+                                                     TetGradShape_z(i));
+    V_shape_value[i].reserve(num_vol_qpoints);
+    for (const auto& qpoint : volume_quadrature_.qpoints)
+      V_shape_value[i].push_back(TetShape(i, qpoint));
+    V_shape_grad[i].assign(num_vol_qpoints, grad_i);
+  }
+
+  return VolumetricFiniteElementData(V_quadrature_point_indices,
+                                     V_qpoints_xyz,
+                                     V_shape_value,
+                                     V_shape_grad,
+                                     V_JxW,
+                                     face_node_mappings_,
+                                     num_nodes_);
+}
+
+SurfaceFiniteElementData
+PieceWiseLinearPolyhedronMapping::MakeTetrahedronSurfaceFiniteElementData(size_t face_index) const
+{
+  const size_t num_srf_qpoints = surface_quadrature_.qpoints.size();
+  const auto& face = cell_.faces_[face_index];
+  const auto& face_node_mapping = face_node_mappings_[face_index];
+
+  const auto& p0 = ref_grid_.vertices[face.vertex_ids_[0]];
+  const Vector3 p01 = ref_grid_.vertices[face.vertex_ids_[1]] - p0;
+  const Vector3 p02 = ref_grid_.vertices[face.vertex_ids_[2]] - p0;
+
+  std::vector<unsigned int> F_quadrature_point_indices(num_srf_qpoints);
+  VecVec3 F_qpoints_xyz;
+  std::vector<std::vector<double>> F_shape_value(num_nodes_,
+                                                 std::vector<double>(num_srf_qpoints, 0.0));
+  std::vector<VecVec3> F_shape_grad(num_nodes_);
+  std::vector<double> F_JxW;
+  VecVec3 F_normals(num_srf_qpoints, face.normal_);
+
+  F_qpoints_xyz.reserve(num_srf_qpoints);
+  F_JxW.reserve(num_srf_qpoints);
+  for (unsigned int qp = 0; qp < num_srf_qpoints; ++qp)
+  {
+    const auto& qpoint = surface_quadrature_.qpoints[qp];
+    F_quadrature_point_indices[qp] = qp;
+    F_qpoints_xyz.push_back(p0 + p01 * qpoint.x + p02 * qpoint.y);
+    F_JxW.push_back(2.0 * areas_[face_index] * surface_quadrature_.weights[qp]);
+
+    // Barycentric coordinates of the face vertices
+    const double lambda[] = {1.0 - qpoint.x - qpoint.y, qpoint.x, qpoint.y};
+    for (size_t fi = 0; fi < 3; ++fi)
+      F_shape_value[face_node_mapping[fi]][qp] = lambda[fi];
+  }
+
+  for (size_t i = 0; i < num_nodes_; ++i)
+  {
+    const Vector3 grad_i = tet_data_.JTinv * Vector3(TetGradShape_x(i),
+                                                     TetGradShape_y(i),
+                                                     TetGradShape_z(i));
+    F_shape_grad[i].assign(num_srf_qpoints, grad_i);
+  }
+
+  return SurfaceFiniteElementData(F_quadrature_point_indices,
+                                  F_qpoints_xyz,
+                                  F_shape_value,
+                                  F_shape_grad,
+                                  F_JxW,
+                                  F_normals,
+                                  face_node_mappings_,
+                                  face.vertex_ids_.size());
+}
+
+bool
+PieceWiseLinearPolyhedronMapping::ComputeUnitIntegrals(
+  FiniteElementUnitIntegrals& unit_integrals) const
+{
+  const size_t num_faces = face_data_.size();
+
+  auto& ui = unit_integrals;
+  ui.intV_gradshapeI_gradshapeJ.assign(num_nodes_, std::vector<double>(num_nodes_, 0.0));
+  ui.intV_shapeI_gradshapeJ.assign(num_nodes_, std::vector<Vector3>(num_nodes_));
+  ui.intV_shapeI_shapeJ.assign(num_nodes_, std::vector<double>(num_nodes_, 0.0));
+  ui.intV_shapeI.assign(num_nodes_, 0.0);
+  ui.intS_shapeI_shapeJ.assign(num_faces,
+                               std::vector<std::vector<double>>(
+                                 num_nodes_, std::vector<double>(num_nodes_, 0.0)));
+  ui.intS_shapeI_gradshapeJ.assign(num_faces,
+                                   std::vector<std::vector<Vector3>>(
+                                     num_nodes_, std::vector<Vector3>(num_nodes_)));
+  ui.intS_shapeI.assign(num_faces, std::vector<double>(num_nodes_, 0.0));
+
+  std::vector<TetCoefficients> coeffs(num_nodes_);
+  std::vector<Vector3> grads(num_nodes_);
+
+  if (is_tetrahedron_)
+  {
+    for (size_t i = 0; i < num_nodes_; ++i)
+    {
+      coeffs[i] = {0.0, 0.0, 0.0, 0.0};
+      coeffs[i][i] = 1.0;
+      grads[i] = tet_data_.JTinv * Vector3(TetGradShape_x(i),
+                                           TetGradShape_y(i),
+                                           TetGradShape_z(i));
+    }
+    AddTetVolumeIntegrals(std::fabs(tet_data_.detJ) / 6.0, coeffs, grads, ui);
+
+    for (size_t f = 0; f < num_faces; ++f)
+    {
+      for (size_t i = 0; i < num_nodes_; ++i)
+        coeffs[i] = {0.0, 0.0, 0.0, 0.0};
+      for (size_t fi = 0; fi < 3; ++fi)
+        coeffs[face_node_mappings_[f][fi]][fi] = 1.0;
+      AddTriangleSurfaceIntegrals(f, areas_[f], coeffs, grads, ui);
+    }
+    return true;
+  }
+
+  for (size_t f = 0; f < num_faces; ++f)
+  {
+    const double betaf = face_betaf_[f];
+    for (size_t s = 0; s < face_data_[f].sides.size(); ++s)
+    {
+      const auto& side = face_data_[f].sides[s];
+
+      // Side-tetrahedron vertices: edge start, face centroid, edge end, cell centroid
+      for (size_t i = 0; i < num_nodes_; ++i)
+      {
+        const auto& side_map = node_side_maps_[i].face_map[f].side_map[s];
+        auto& c = coeffs[i];
+        c[0] = side_map.index == 0 ? 1.0 : 0.0;
+        c[1] = side_map.part_of_face ? betaf : 0.0;
+        c[2] = side_map.index == 2 ? 1.0 : 0.0;
+        c[3] = alphac_;
+        grads[i] = side.JTinv * Vector3(c[1] - c[0], c[2] - c[0], c[3] - c[0]);
+      }
+
+      AddTetVolumeIntegrals(side.detJ / 6.0, coeffs, grads, ui);
+      AddTriangleSurfaceIntegrals(f, side.detJ_surf / 2.0, coeffs, grads, ui);
+    } // for side
+  }   // for face
+
+  return true;
+}
+
+void
+PieceWiseLinearPolyhedronMapping::AddTetVolumeIntegrals(double volume,
+                                                        const std::vector<TetCoefficients>& coeffs,
+                                                        const std::vector<Vector3>& grads,
+                                                        FiniteElementUnitIntegrals& unit_integrals)
+{
+  // For barycentric coordinates, int_V lambda_a = V/4 and int_V lambda_a lambda_b =
+  // V (1 + delta_ab) / 20
+  const size_t num_nodes = coeffs.size();
+  for (size_t i = 0; i < num_nodes; ++i)
+  {
+    const auto& ci = coeffs[i];
+    const double sum_i = ci[0] + ci[1] + ci[2] + ci[3];
+    if (sum_i == 0.0)
+      continue;
+
+    unit_integrals.intV_shapeI[i] += volume * sum_i / 4.0;
+    for (size_t j = 0; j < num_nodes; ++j)
+    {
+      const auto& cj = coeffs[j];
+      const double sum_j = cj[0] + cj[1] + cj[2] + cj[3];
+      const double dot_ij = ci[0] * cj[0] + ci[1] * cj[1] + ci[2] * cj[2] + ci[3] * cj[3];
+
+      unit_integrals.intV_shapeI_shapeJ[i][j] += volume * (sum_i * sum_j + dot_ij) / 20.0;
+      unit_integrals.intV_shapeI_gradshapeJ[i][j] += grads[j] * (volume * sum_i / 4.0);
+      unit_integrals.intV_gradshapeI_gradshapeJ[i][j] += volume * grads[i].Dot(grads[j]);
+    }
+  }
+}
+
+void
+PieceWiseLinearPolyhedronMapping::AddTriangleSurfaceIntegrals(
+  size_t face_index,
+  double area,
+  const std::vector<TetCoefficients>& coeffs,
+  const std::vector<Vector3>& grads,
+  FiniteElementUnitIntegrals& unit_integrals)
+{
+  // For barycentric coordinates, int_S lambda_a = A/3 and int_S lambda_a lambda_b =
+  // A (1 + delta_ab) / 12
+  const size_t num_nodes = coeffs.size();
+  auto& intS_shapeI_shapeJ = unit_integrals.intS_shapeI_shapeJ[face_index];
+  auto& intS_shapeI_gradshapeJ = unit_integrals.intS_shapeI_gradshapeJ[face_index];
+  auto& intS_shapeI = unit_integrals.intS_shapeI[face_index];
+  for (size_t i = 0; i < num_nodes; ++i)
+  {
+    const auto& ci = coeffs[i];
+    const double sum_i = ci[0] + ci[1] + ci[2];
+    if (sum_i == 0.0)
+      continue;
+
+    intS_shapeI[i] += area * sum_i / 3.0;
+    for (size_t j = 0; j < num_nodes; ++j)
+    {
+      const auto& cj = coeffs[j];
+      const double sum_j = cj[0] + cj[1] + cj[2];
+      const double dot_ij = ci[0] * cj[0] + ci[1] * cj[1] + ci[2] * cj[2];
+
+      intS_shapeI_shapeJ[i][j] += area * (sum_i * sum_j + dot_ij) / 12.0;
+      intS_shapeI_gradshapeJ[i][j] += grads[j] * (area * sum_i / 3.0);
+    }
+  }
+}
+
 } // namespace opensn
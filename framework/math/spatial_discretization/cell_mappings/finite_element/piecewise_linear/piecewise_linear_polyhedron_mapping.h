@@ -7,6 +7,7 @@
 #include "framework/math/quadratures/spatial/tetrahedra_quadrature.h"
 #include "framework/math/quadratures/spatial/triangle_quadrature.h"
 #include "framework/mesh/cell/cell.h"
+#include <array>
 
 namespace opensn
 {
@@ -31,6 +32,12 @@ public:
 
   SurfaceFiniteElementData MakeSurfaceFiniteElementData(size_t face_index) const override;
 
+  /**
+   * Computes the unit integrals exactly from the linear side-tetrahedra, without quadrature.
+   * Tetrahedral cells are integrated as a single linear tetrahedron.
+   */
+  bool ComputeUnitIntegrals(FiniteElementUnitIntegrals& unit_integrals) const override;
+
   /**
    * Actual shape functions as function of cartesian coordinates
    */
@@ -94,6 +101,39 @@ private:
     Matrix3x3 JTinv;
   };
 
+  /**
+   * Coefficients of a cell shape function restricted to a linear tetrahedron, in terms of the
+   * barycentric coordinates of the tetrahedron's four vertices.
+   */
+  typedef std::array<double, 4> TetCoefficients;
+
+  /**
+   * Adds the exact volume integrals over one linear tetrahedron of the given volume, on which
+   * shape function i has the barycentric coefficients `coeffs[i]` and gradient `grads[i]`.
+   */
+  static void AddTetVolumeIntegrals(double volume,
+                                    const std::vector<TetCoefficients>& coeffs,
+                                    const std::vector<Vector3>& grads,
+                                    FiniteElementUnitIntegrals& unit_integrals);
+
+  /**
+   * Adds the exact surface integrals, on face `face_index`, over one triangle of the given
+   * area. The first three coefficients of `coeffs[i]` refer to the triangle's vertices.
+   */
+  static void AddTriangleSurfaceIntegrals(size_t face_index,
+                                          double area,
+                                          const std::vector<TetCoefficients>& coeffs,
+                                          const std::vector<Vector3>& grads,
+                                          FiniteElementUnitIntegrals& unit_integrals);
+
+  /**
+   * Finite element data for tetrahedral cells. The piecewise linear shape functions of a
+   * tetrahedron are its standard linear shape functions, so a single tetrahedron is
+   * integrated instead of twelve side-tetrahedra.
+   */
+  VolumetricFiniteElementData MakeTetrahedronVolumetricFiniteElementData() const;
+  SurfaceFiniteElementData MakeTetrahedronSurfaceFiniteElementData(size_t face_index) const;
+
   /**
    * Stores data for each face.
    */
@@ -139,6 +179,9 @@ private:
   std::vector<FEface_data> face_data_;    ///< Holds determinants and data tet-by-tet.
   std::vector<FEnodeMap> node_side_maps_; ///< Maps nodes to side tets.
 
+  bool is_tetrahedron_ = false; ///< Cell is integrated as a single tetrahedron.
+  FEside_data3d tet_data_;      ///< Geometry of the cell itself when it is a tetrahedron.
+
   const TetrahedraQuadrature& volume_quadrature_;
   const TriangleQuadrature& surface_quadrature_;
 };
@@ -91,4 +91,20 @@ private:
   std::vector<Vector3> normals_; ///< node i, then qp
 };
 
+/**Stores the unweighted integrals of the shape functions, and of products of shape functions
+ * and their gradients, over a cell (intV) and over each of its faces (intS). The volume
+ * integrals are indexed by node i, then node j. The surface integrals are indexed by face f
+ * first.*/
+struct FiniteElementUnitIntegrals
+{
+  std::vector<std::vector<double>> intV_gradshapeI_gradshapeJ;
+  std::vector<std::vector<Vector3>> intV_shapeI_gradshapeJ;
+  std::vector<std::vector<double>> intV_shapeI_shapeJ;
+  std::vector<double> intV_shapeI;
+
+  std::vector<std::vector<std::vector<double>>> intS_shapeI_shapeJ;
+  std::vector<std::vector<std::vector<Vector3>>> intS_shapeI_gradshapeJ;
+  std::vector<std::vector<double>> intS_shapeI;
+};
+
 } // namespace opensn
@@ -400,7 +400,7 @@ MeshIO::FromGmsh(const UnpartitionedMesh::Options& options)
 
   mesh->ComputeCentroids();
   mesh->CheckQuality();
-  mesh->BuildMeshConnectivity();
+  mesh->BuildMeshConnectivity(options.connectivity_method);
 
   log.Log() << "Done processing " << options.file_name << ".\n"
             << "Number of nodes read: " << mesh->Vertices().size() << "\n"
@@ -9,6 +9,26 @@
 namespace opensn
 {
 
+/**
+ * The part of a partitioned mesh that is read by a single rank. Cells and vertices are keyed on
+ * the global ids stored in the file so that the parts read on different ranks can be stitched
+ * together without ever forming the global mesh.
+ */
+struct DistributedMeshPart
+{
+  unsigned int dimension = 0;
+  /// False if any piece read lacked global point- or cell-ids.
+  bool has_global_ids = true;
+  /// Number of pieces in the file.
+  size_t num_pieces = 0;
+  /// Cells of the pieces read, keyed on global cell id.
+  std::map<uint64_t, UnpartitionedMesh::LightWeightCell> cells;
+  /// Vertices of the cells read, keyed on global vertex id.
+  std::map<uint64_t, Vector3> vertices;
+  /// Boundary blocks, in file order, each with the (sorted) global vertex ids of its faces.
+  std::vector<std::pair<std::string, std::vector<std::vector<uint64_t>>>> boundary_blocks;
+};
+
 class MeshIO
 {
 public:
@@ -20,6 +40,28 @@ public:
   static std::shared_ptr<UnpartitionedMesh> FromOBJ(const UnpartitionedMesh::Options& options);
   static std::shared_ptr<UnpartitionedMesh> FromGmsh(const UnpartitionedMesh::Options& options);
 
+  /**
+   * Returns the number of pieces of a partitioned mesh. For a .pvtu file these are the pieces
+   * listed in the file, for an ExodusII file `name.e` these are the decomposed files
+   * `name.e.<n>.<i>` next to it. Returns zero if the mesh is not partitioned.
+   */
+  static size_t GetNumberOfPieces(const UnpartitionedMesh::Options& options);
+
+  /**
+   * Reads the pieces `[part * n / num_parts, (part + 1) * n / num_parts)` of the `n` pieces of a
+   * partitioned .pvtu file. The pieces need global point- and cell-ids.
+   */
+  static DistributedMeshPart
+  FromPVTUPieces(const UnpartitionedMesh::Options& options, int part, int num_parts);
+
+  /**
+   * Reads the files `name.e.<n>.<i>`, with `i` in `[part * n / num_parts, (part + 1) * n /
+   * num_parts)`, of a decomposed ExodusII mesh. Material ids are the element block indices and
+   * boundaries are taken from the side sets.
+   */
+  static DistributedMeshPart
+  FromExodusIIPieces(const UnpartitionedMesh::Options& options, int part, int num_parts);
+
   /**
    * Write grid cells into an OBJ file
    *
@@ -32,7 +74,9 @@ public:
                     bool per_material = false);
 
   /**
-   * Write grid cells into an ExodusII file
+   * Write grid cells into an ExodusII file. In parallel, every location writes its local cells to
+   * the decomposed file `<file_name>.<n>.<i>`, which requires cells of every material id on every
+   * location.
    *
    * \param grid Grid to be stored
    * \param file_name Name of the output file
@@ -338,7 +338,7 @@ MeshIO::FromOBJ(const UnpartitionedMesh::Options& options)
 
   mesh->ComputeCentroids();
   mesh->CheckQuality();
-  mesh->BuildMeshConnectivity();
+  mesh->BuildMeshConnectivity(options.connectivity_method);
 
   // Set boundary ids
   if (bndry_block_ids.empty())
@@ -23,7 +23,11 @@
 #include <vtkMultiBlockDataSet.h>
 #include <vtkExodusIIWriter.h>
 #include <vtkModelMetadata.h>
+#include <vtkIdTypeArray.h>
+#include <vtkDataArray.h>
+#include <algorithm>
 #include <fstream>
+#include <filesystem>
 
 namespace opensn
 {
@@ -559,43 +563,155 @@ SetBoundaryIDsFromBlocks(std::shared_ptr<UnpartitionedMesh> mesh,
   } // for boundary_block
 }
 
-} // namespace
+/**
+ * Returns the global point-ids of a grid. ExodusII blocks may carry these only as the
+ * "GlobalNodeId" array.
+ */
+vtkDataArray*
+GetPointGlobalIds(vtkUnstructuredGrid& ugrid)
+{
+  if (auto gids = ugrid.GetPointData()->GetGlobalIds())
+    return gids;
+  return ugrid.GetPointData()->GetArray("GlobalNodeId");
+}
 
-std::shared_ptr<UnpartitionedMesh>
-MeshIO::FromExodusII(const UnpartitionedMesh::Options& options)
+/**
+ * Returns the global cell-ids of a grid. ExodusII blocks may carry these only as the
+ * "GlobalElementId" array.
+ */
+vtkDataArray*
+GetCellGlobalIds(vtkUnstructuredGrid& ugrid)
 {
-  log.Log() << "Reading ExodusII file: " << options.file_name << ".";
+  if (auto gids = ugrid.GetCellData()->GetGlobalIds())
+    return gids;
+  return ugrid.GetCellData()->GetArray("GlobalElementId");
+}
 
-  std::shared_ptr<UnpartitionedMesh> mesh = std::make_shared<UnpartitionedMesh>();
+/**
+ * Copies the cells of the given dimension, and their vertices, into a distributed mesh part.
+ * Point- and cell-ids are replaced by the global ids of the grid, less `id_offset`.
+ */
+void
+CopyUGridToMeshPart(DistributedMeshPart& mesh_part,
+                    vtkUnstructuredGrid& ugrid,
+                    const double scale,
+                    int dimension_to_copy,
+                    const std::vector<int>& material_ids,
+                    vtkIdType id_offset)
+{
+  const std::string fname = "CopyUGridToMeshPart";
 
-  // Read the file
-  auto reader = vtkSmartPointer<vtkExodusIIReader>::New();
-  reader->SetFileName(options.file_name.c_str());
+  const vtkIdType num_cells = ugrid.GetNumberOfCells();
+  if (num_cells == 0)
+    return;
 
-  if (not reader->CanReadFile(options.file_name.c_str()))
-    throw std::logic_error("Unable to read file-type with this routine");
+  auto cell_gids = GetCellGlobalIds(ugrid);
+  auto pnts_gids = GetPointGlobalIds(ugrid);
+  if ((not cell_gids) or (not pnts_gids))
+  {
+    mesh_part.has_global_ids = false;
+    return;
+  }
 
-  reader->UpdateInformation();
-  // Exodus ships boundary-ids via SideSets and NodeSets. This allows
-  // it to be read from the file. Here we have to enable the reader
-  // to process this because it does not do it by default.
-  reader->SetAllArrayStatus(reader->NODE_SET, 1);
-  reader->SetAllArrayStatus(reader->NODE_SET_CONN, 1);
-  reader->SetAllArrayStatus(reader->SIDE_SET, 1);
-  reader->SetAllArrayStatus(reader->SIDE_SET_CONN, 1);
+  auto MapPointID = [&pnts_gids, id_offset](uint64_t pid)
+  {
+    const auto gid = static_cast<vtkIdType>(pnts_gids->GetTuple1(static_cast<vtkIdType>(pid)));
+    return static_cast<uint64_t>(gid - id_offset);
+  };
 
-  // The exodusII file format ships blocks of elements
-  // together with their points/vertices as self-contained (localized)
-  // unstructured meshes. To relate these localized blocks to the original
-  // mesh, where are the blocks formed a whole, we need to know the mapping
-  // from block-local ids to the original ids. This information can
-  // be derived from the GlobalNodeID arrays loaded onto point-data and
-  // cell-data. Again, this information is not read by default so we have to
-  // turn this on.
-  reader->SetGenerateGlobalNodeIdArray(true);
-  reader->SetGenerateGlobalElementIdArray(true);
-  reader->Update();
+  for (vtkIdType c = 0; c < num_cells; ++c)
+  {
+    auto vtk_cell = ugrid.GetCell(c);
+    auto vtk_celldim = vtk_cell->GetCellDimension();
+
+    if (vtk_celldim != dimension_to_copy)
+      continue;
+
+    UnpartitionedMesh::LightWeightCell* raw_cell;
+    if (vtk_celldim == 3)
+      raw_cell = CreateCellFromVTKPolyhedron(vtk_cell);
+    else if (vtk_celldim == 2)
+      raw_cell = CreateCellFromVTKPolygon(vtk_cell);
+    else if (vtk_celldim == 1)
+      raw_cell = CreateCellFromVTKLine(vtk_cell);
+    else if (vtk_celldim == 0)
+      raw_cell = CreateCellFromVTKVertex(vtk_cell);
+    else
+      throw std::logic_error(fname + ": Unsupported cell dimension ." +
+                             std::to_string(vtk_celldim));
+
+    // Copy the vertices and compute the centroid while the ids are still local
+    raw_cell->centroid = Vertex(0.0, 0.0, 0.0);
+    for (uint64_t& vid : raw_cell->vertex_ids)
+    {
+      auto point = ugrid.GetPoint(static_cast<vtkIdType>(vid));
+      const Vector3 vertex = Vector3(point[0], point[1], point[2]) * scale;
 
+      raw_cell->centroid += vertex;
+      vid = MapPointID(vid);
+      mesh_part.vertices.emplace(vid, vertex);
+    }
+    raw_cell->centroid =
+      raw_cell->centroid / static_cast<double>(raw_cell->vertex_ids.size());
+
+    for (auto& face : raw_cell->faces)
+      for (uint64_t& vid : face.vertex_ids)
+        vid = MapPointID(vid);
+
+    raw_cell->material_id = material_ids[c];
+
+    const auto cell_gid = static_cast<vtkIdType>(cell_gids->GetTuple1(c)) - id_offset;
+    mesh_part.cells.emplace(static_cast<uint64_t>(cell_gid), std::move(*raw_cell));
+    delete raw_cell;
+  } // for cell c
+}
+
+/**
+ * Adds the cells of a boundary block to a distributed mesh part as faces of sorted global
+ * vertex-ids.
+ */
+void
+AddBoundaryBlockToMeshPart(DistributedMeshPart& mesh_part,
+                           vtkUnstructuredGrid& ugrid,
+                           const std::string& block_name,
+                           vtkIdType id_offset)
+{
+  auto pnts_gids = GetPointGlobalIds(ugrid);
+  if (not pnts_gids)
+  {
+    log.Log0Warning() << "Boundary block " << block_name
+                      << " has no global node-ids and was therefore skipped.";
+    return;
+  }
+
+  std::vector<std::vector<uint64_t>> faces;
+  const vtkIdType num_cells = ugrid.GetNumberOfCells();
+  faces.reserve(num_cells);
+  for (vtkIdType c = 0; c < num_cells; ++c)
+  {
+    auto vtk_cell = ugrid.GetCell(c);
+    const vtkIdType num_points = vtk_cell->GetNumberOfPoints();
+
+    std::vector<uint64_t> face_vids;
+    face_vids.reserve(num_points);
+    for (vtkIdType p = 0; p < num_points; ++p)
+    {
+      const auto gid = static_cast<vtkIdType>(pnts_gids->GetTuple1(vtk_cell->GetPointId(p)));
+      face_vids.push_back(static_cast<uint64_t>(gid - id_offset));
+    }
+    std::sort(face_vids.begin(), face_vids.end());
+    faces.push_back(std::move(face_vids));
+  }
+
+  mesh_part.boundary_blocks.emplace_back(block_name, std::move(faces));
+}
+
+/**
+ * Collects the unstructured grid blocks of an ExodusII reader's output.
+ */
+std::vector<vtkUGridPtrAndName>
+GetExodusIIGridBlocks(vtkExodusIIReader& reader)
+{
   // Get all the grid blocks
   // This part was quite difficult. I eventually found how to do
   // this from this post:
@@ -605,7 +721,7 @@ MeshIO::FromExodusII(const UnpartitionedMesh::Options& options)
   // level 2 is also of type vtkMultiBlockDataSet. The level 2 block that has
   // the actual elements is also split into blocks but these, level 3,
   // blocks each contain a structure castable to vtkUnstructuredGrid.
-  auto multiblock = reader->GetOutput();
+  auto multiblock = reader.GetOutput();
 
   std::vector<vtkUGridPtrAndName> grid_blocks;
   auto iter_a = multiblock->NewIterator();
@@ -628,6 +744,104 @@ MeshIO::FromExodusII(const UnpartitionedMesh::Options& options)
 
     iter_a->GoToNextItem();
   }
+  iter_a->Delete();
+
+  return grid_blocks;
+}
+
+/**
+ * Finds the decomposed files `<file_name>.<n>.<i>` of an ExodusII mesh, ordered by `i`.
+ * Returns an empty list if there are none or if any of the `n` files is missing.
+ */
+std::vector<std::string>
+FindExodusIIPieceFiles(const std::string& file_name)
+{
+  const std::filesystem::path file_path(file_name);
+  std::filesystem::path dir_path = file_path.parent_path();
+  if (dir_path.empty())
+    dir_path = ".";
+  if (not std::filesystem::is_directory(dir_path))
+    return {};
+
+  const std::string prefix = file_path.filename().string() + ".";
+  const std::string digits = "0123456789";
+
+  size_t num_pieces = 0;
+  std::map<size_t, std::string> piece_files;
+  for (const auto& entry : std::filesystem::directory_iterator(dir_path))
+  {
+    const std::string entry_name = entry.path().filename().string();
+    if (entry_name.compare(0, prefix.size(), prefix) != 0)
+      continue;
+
+    const std::string suffix = entry_name.substr(prefix.size());
+    const size_t dot = suffix.find('.');
+    if (dot == std::string::npos or dot == 0 or dot + 1 == suffix.size())
+      continue;
+
+    const std::string n_str = suffix.substr(0, dot);
+    const std::string i_str = suffix.substr(dot + 1);
+    if (n_str.find_first_not_of(digits) != std::string::npos or
+        i_str.find_first_not_of(digits) != std::string::npos)
+      continue;
+
+    const size_t n = std::stoul(n_str);
+    OpenSnLogicalErrorIf(num_pieces != 0 and n != num_pieces,
+                         "Found more than one decomposition of " + file_name);
+    num_pieces = n;
+    piece_files[std::stoul(i_str)] = entry.path().string();
+  }
+
+  std::vector<std::string> ordered_files;
+  for (size_t i = 0; i < num_pieces; ++i)
+  {
+    auto it = piece_files.find(i);
+    if (it == piece_files.end())
+      return {};
+    ordered_files.push_back(it->second);
+  }
+
+  return ordered_files;
+}
+
+} // namespace
+
+std::shared_ptr<UnpartitionedMesh>
+MeshIO::FromExodusII(const UnpartitionedMesh::Options& options)
+{
+  log.Log() << "Reading ExodusII file: " << options.file_name << ".";
+
+  std::shared_ptr<UnpartitionedMesh> mesh = std::make_shared<UnpartitionedMesh>();
+
+  // Read the file
+  auto reader = vtkSmartPointer<vtkExodusIIReader>::New();
+  reader->SetFileName(options.file_name.c_str());
+
+  if (not reader->CanReadFile(options.file_name.c_str()))
+    throw std::logic_error("Unable to read file-type with this routine");
+
+  reader->UpdateInformation();
+  // Exodus ships boundary-ids via SideSets and NodeSets. This allows
+  // it to be read from the file. Here we have to enable the reader
+  // to process this because it does not do it by default.
+  reader->SetAllArrayStatus(reader->NODE_SET, 1);
+  reader->SetAllArrayStatus(reader->NODE_SET_CONN, 1);
+  reader->SetAllArrayStatus(reader->SIDE_SET, 1);
+  reader->SetAllArrayStatus(reader->SIDE_SET_CONN, 1);
+
+  // The exodusII file format ships blocks of elements
+  // together with their points/vertices as self-contained (localized)
+  // unstructured meshes. To relate these localized blocks to the original
+  // mesh, where are the blocks formed a whole, we need to know the mapping
+  // from block-local ids to the original ids. This information can
+  // be derived from the GlobalNodeID arrays loaded onto point-data and
+  // cell-data. Again, this information is not read by default so we have to
+  // turn this on.
+  reader->SetGenerateGlobalNodeIdArray(true);
+  reader->SetGenerateGlobalElementIdArray(true);
+  reader->Update();
+
+  std::vector<vtkUGridPtrAndName> grid_blocks = GetExodusIIGridBlocks(*reader);
 
   // Get the main + bndry blocks
   const int max_dimension = FindHighestDimension(grid_blocks);
@@ -652,7 +866,7 @@ MeshIO::FromExodusII(const UnpartitionedMesh::Options& options)
 
   mesh->ComputeCentroids();
   mesh->CheckQuality();
-  mesh->BuildMeshConnectivity();
+  mesh->BuildMeshConnectivity(options.connectivity_method);
 
   // Set boundary ids
   SetBoundaryIDsFromBlocks(mesh, bndry_grid_blocks);
@@ -710,7 +924,7 @@ MeshIO::FromVTU(const UnpartitionedMesh::Options& options)
 
   mesh->ComputeCentroids();
   mesh->CheckQuality();
-  mesh->BuildMeshConnectivity();
+  mesh->BuildMeshConnectivity(options.connectivity_method);
 
   log.Log() << "Done reading VTU file: " << options.file_name << ".";
 
@@ -765,13 +979,141 @@ MeshIO::FromPVTU(const UnpartitionedMesh::Options& options)
 
   mesh->ComputeCentroids();
   mesh->CheckQuality();
-  mesh->BuildMeshConnectivity();
+  mesh->BuildMeshConnectivity(options.connectivity_method);
 
   log.Log() << "Done reading PVTU file: " << options.file_name << ".";
 
   return mesh;
 }
 
+size_t
+MeshIO::GetNumberOfPieces(const UnpartitionedMesh::Options& options)
+{
+  const std::string extension = std::filesystem::path(options.file_name).extension().string();
+  if (extension == ".pvtu")
+  {
+    auto reader = vtkSmartPointer<vtkXMLPUnstructuredGridReader>::New();
+    reader->SetFileName(options.file_name.c_str());
+
+    if (not reader->CanReadFile(options.file_name.c_str()))
+      throw std::logic_error("Unable to read file-type with this routine");
+    reader->UpdateInformation();
+
+    return static_cast<size_t>(reader->GetNumberOfPieces());
+  }
+  else if (extension == ".e")
+    return FindExodusIIPieceFiles(options.file_name).size();
+
+  return 0;
+}
+
+DistributedMeshPart
+MeshIO::FromPVTUPieces(const UnpartitionedMesh::Options& options, int part, int num_parts)
+{
+  log.Log() << "Reading pieces of PVTU file: " << options.file_name << ".";
+
+  DistributedMeshPart mesh_part;
+
+  // Read the file
+  auto reader = vtkSmartPointer<vtkXMLPUnstructuredGridReader>::New();
+  reader->SetFileName(options.file_name.c_str());
+
+  if (not reader->CanReadFile(options.file_name.c_str()))
+    throw std::logic_error("Unable to read file-type with this routine");
+  reader->UpdateInformation();
+  mesh_part.num_pieces = static_cast<size_t>(reader->GetNumberOfPieces());
+
+  // The reader assigns the contiguous range of pieces
+  // [part * n / num_parts, (part + 1) * n / num_parts) to update-piece `part`
+  // and only reads those.
+  reader->UpdatePiece(part, num_parts, 0);
+
+  auto ugrid = vtkUGridPtr(reader->GetOutput());
+  std::vector<vtkUGridPtrAndName> grid_blocks = {{ugrid, ""}};
+
+  const int max_dimension = FindHighestDimension(grid_blocks);
+  mesh_part.dimension = max_dimension;
+
+  const auto material_ids =
+    BuildCellMaterialIDsFromField(ugrid, options.material_id_fieldname, options.file_name);
+  CopyUGridToMeshPart(mesh_part, *ugrid, options.scale, max_dimension, material_ids, 0);
+
+  log.LogAllVerbose1() << "Read " << mesh_part.cells.size() << " cells and "
+                       << mesh_part.vertices.size() << " vertices";
+
+  return mesh_part;
+}
+
+DistributedMeshPart
+MeshIO::FromExodusIIPieces(const UnpartitionedMesh::Options& options, int part, int num_parts)
+{
+  log.Log() << "Reading pieces of ExodusII file: " << options.file_name << ".";
+
+  DistributedMeshPart mesh_part;
+
+  const auto piece_files = FindExodusIIPieceFiles(options.file_name);
+  const size_t num_pieces = piece_files.size();
+  mesh_part.num_pieces = num_pieces;
+
+  const size_t first_piece = part * num_pieces / num_parts;
+  const size_t last_piece = (part + 1) * num_pieces / num_parts;
+  for (size_t i = first_piece; i < last_piece; ++i)
+  {
+    const std::string& piece_file = piece_files[i];
+
+    auto reader = vtkSmartPointer<vtkExodusIIReader>::New();
+    reader->SetFileName(piece_file.c_str());
+
+    if (not reader->CanReadFile(piece_file.c_str()))
+      throw std::logic_error("Unable to read file-type with this routine");
+
+    reader->UpdateInformation();
+    reader->SetAllArrayStatus(reader->SIDE_SET, 1);
+    reader->SetAllArrayStatus(reader->SIDE_SET_CONN, 1);
+
+    // The node and element number maps of a decomposed file hold the
+    // global ids. The object-id array identifies the element block of
+    // each cell, which is the same in all the files.
+    reader->SetGenerateGlobalNodeIdArray(true);
+    reader->SetGenerateGlobalElementIdArray(true);
+    reader->SetGenerateObjectIdCellArray(true);
+    reader->Update();
+
+    std::vector<vtkUGridPtrAndName> grid_blocks = GetExodusIIGridBlocks(*reader);
+
+    const int max_dimension = FindHighestDimension(grid_blocks);
+    mesh_part.dimension = std::max<unsigned int>(mesh_part.dimension, max_dimension);
+    std::vector<vtkUGridPtrAndName> domain_grid_blocks =
+      GetBlocksOfDesiredDimension(grid_blocks, max_dimension);
+    std::vector<vtkUGridPtrAndName> bndry_grid_blocks =
+      GetBlocksOfDesiredDimension(grid_blocks, max_dimension - 1);
+
+    for (auto& [ugrid, block_name] : domain_grid_blocks)
+    {
+      auto object_ids = ugrid->GetCellData()->GetArray("ObjectId");
+      OpenSnLogicalErrorIf(not object_ids, "Block " + block_name + " has no ObjectId array");
+
+      const vtkIdType num_cells = ugrid->GetNumberOfCells();
+      std::vector<int> material_ids(num_cells, -1);
+      for (vtkIdType c = 0; c < num_cells; ++c)
+        material_ids[c] = reader->GetObjectIndex(vtkExodusIIReader::ELEM_BLOCK,
+                                                 static_cast<int>(object_ids->GetTuple1(c)));
+
+      // ExodusII ids are 1-based
+      CopyUGridToMeshPart(mesh_part, *ugrid, options.scale, max_dimension, material_ids, 1);
+    }
+
+    for (auto& [ugrid, block_name] : bndry_grid_blocks)
+      AddBoundaryBlockToMeshPart(mesh_part, *ugrid, block_name, 1);
+  } // for piece i
+
+  log.LogAllVerbose1() << "Read " << mesh_part.cells.size() << " cells and "
+                       << mesh_part.vertices.size() << " vertices from "
+                       << last_piece - first_piece << " pieces";
+
+  return mesh_part;
+}
+
 std::shared_ptr<UnpartitionedMesh>
 MeshIO::FromEnsightGold(const UnpartitionedMesh::Options& options)
 {
@@ -838,7 +1180,7 @@ MeshIO::FromEnsightGold(const UnpartitionedMesh::Options& options)
 
   mesh->ComputeCentroids();
   mesh->CheckQuality();
-  mesh->BuildMeshConnectivity();
+  mesh->BuildMeshConnectivity(options.connectivity_method);
 
   // Set boundary ids
   SetBoundaryIDsFromBlocks(mesh, bndry_grid_blocks);
@@ -1036,8 +1378,14 @@ MeshIO::ToExodusII(const std::shared_ptr<MeshContinuum>& grid,
   const std::string fname = "MeshIO::ToExodusII";
   log.Log() << "Exporting mesh to ExodusII file with base " << file_name;
 
-  if (opensn::mpi_comm.size() != 1)
-    throw std::logic_error(fname + ": Currently this routine is only allowed in serial.");
+  // In parallel, every location writes its local cells to the decomposed file
+  // `<file_name>.<n>.<i>` of the same mesh. The node and element number maps
+  // hold the global ids.
+  const int num_locations = opensn::mpi_comm.size();
+  const std::string location_file_name =
+    num_locations == 1 ? file_name
+                       : file_name + "." + std::to_string(num_locations) + "." +
+                           std::to_string(opensn::mpi_comm.rank());
 
   // Check block consistency
   std::map<int, CellType> block_id_map;
@@ -1054,6 +1402,25 @@ MeshIO::ToExodusII(const std::shared_ptr<MeshContinuum>& grid,
     }
   }
 
+  // The element blocks are identified by their index, which must therefore be
+  // the same in all the decomposed files
+  if (num_locations > 1)
+  {
+    std::vector<int> block_ids;
+    for (const auto& [mat_id, cell_type] : block_id_map)
+      block_ids.push_back(mat_id);
+    std::vector<int> all_block_ids;
+    mpi_comm.all_gather(block_ids, all_block_ids);
+    const std::set<int> global_block_ids(all_block_ids.begin(), all_block_ids.end());
+
+    const int has_all_blocks = global_block_ids.size() == block_ids.size() ? 1 : 0;
+    int all_have_all_blocks = 0;
+    mpi_comm.all_reduce(has_all_blocks, all_have_all_blocks, mpi::op::min<int>());
+    if (all_have_all_blocks == 0)
+      throw std::logic_error(fname + ": Every location needs cells of every material id to "
+                                     "write a decomposed ExodusII mesh.");
+  }
+
   // Create unstructured meshes for each material-type pair
   vtkNew<vtkMultiBlockDataSet> grid_blocks;
   int max_dimension = 0;
@@ -1072,17 +1439,21 @@ MeshIO::ToExodusII(const std::shared_ptr<MeshContinuum>& grid,
     vtkNew<vtkIntArray> block_id_list;
     block_id_list->SetName("BlockID");
 
-    // Load vertices
+    // Load the vertices of the local cells
+    std::set<uint64_t> vid_set;
+    for (const auto& cell : grid->local_cells)
+      vid_set.insert(cell.vertex_ids_.begin(), cell.vertex_ids_.end());
+
     std::vector<uint64_t> vertex_map(grid->GetGlobalVertexCount(), 0);
-    const size_t num_verts = grid->GetGlobalVertexCount();
-    for (size_t v = 0; v < num_verts; ++v)
+    uint64_t mapped_id = 0;
+    for (uint64_t vid : vid_set)
     {
-      vertex_map[v] = v;
-      const auto& vertex = grid->vertices[v];
+      vertex_map[vid] = mapped_id++;
+      const auto& vertex = grid->vertices[vid];
       points->InsertNextPoint(vertex.x, vertex.y, vertex.z);
 
       // Exodus node- and cell indices are 1-based therefore we add a 1 here.
-      global_node_id_list->InsertNextValue(static_cast<vtkIdType>(v + 1));
+      global_node_id_list->InsertNextValue(static_cast<vtkIdType>(vid + 1));
     }
 
     // Load cells
@@ -1291,7 +1662,7 @@ MeshIO::ToExodusII(const std::shared_ptr<MeshContinuum>& grid,
   vtkNew<vtkExodusIIWriter> writer;
   writer->SetBlockIdArrayName("BlockID");
 
-  writer->SetFileName(file_name.c_str());
+  writer->SetFileName(location_file_name.c_str());
   writer->SetStoreDoubles(1);
 
   writer->SetInputData(main_block);
@@ -1320,6 +1691,21 @@ MeshIO::ToPVTU(const std::shared_ptr<MeshContinuum>& grid, const std::string& fi
 
   auto ugrid = PrepareVtkUnstructuredGrid(*grid, false);
 
+  // Global ids let the pieces be read back in parallel. The continuous grid
+  // has a point for every vertex of every local cell, in cell order.
+  vtkNew<vtkIdTypeArray> point_global_ids;
+  vtkNew<vtkIdTypeArray> cell_global_ids;
+  point_global_ids->SetName("GlobalIds");
+  cell_global_ids->SetName("GlobalIds");
+  for (const auto& cell : grid->local_cells)
+  {
+    for (uint64_t vid : cell.vertex_ids_)
+      point_global_ids->InsertNextValue(static_cast<vtkIdType>(vid));
+    cell_global_ids->InsertNextValue(static_cast<vtkIdType>(cell.global_id_));
+  }
+  ugrid->GetPointData()->SetGlobalIds(point_global_ids);
+  ugrid->GetCellData()->SetGlobalIds(cell_global_ids);
+
   WritePVTUFiles(ugrid, file_base_name);
 
   log.Log() << "Done exporting mesh to VTK.";
@@ -652,4 +652,34 @@ MeshContinuum::SetBoundaryIDFromLogical(const LogicalVolume& log_vol,
     grid_bndry_id_map[bndry_id] = boundary_name;
 }
 
+MemoryUsage
+MeshContinuum::ComputeMemoryUsage() const
+{
+  // Nominal size of the node links and color of a red-black tree node
+  const size_t map_node_overhead = 4 * sizeof(void*);
+
+  MemoryUsage usage;
+  for (const auto* cells : {&local_cells_, &ghost_cells_})
+  {
+    usage += GetMemoryUsage(*cells);
+    for (const auto& cell : *cells)
+    {
+      usage += {sizeof(Cell), 1};
+      usage += GetMemoryUsage(cell->vertex_ids_);
+      usage += GetMemoryUsage(cell->faces_);
+      for (const auto& face : cell->faces_)
+        usage += GetMemoryUsage(face.vertex_ids_);
+    }
+  }
+
+  const size_t num_vertices = vertices.NumLocallyStored();
+  usage += {num_vertices * (map_node_overhead + sizeof(uint64_t) + sizeof(Vector3)), num_vertices};
+
+  const size_t num_mapped_ids =
+    global_cell_id_to_local_id_map_.size() + global_cell_id_to_nonlocal_id_map_.size();
+  usage += {num_mapped_ids * (map_node_overhead + 2 * sizeof(uint64_t)), num_mapped_ids};
+
+  return usage;
+}
+
 } // namespace opensn
@@ -10,6 +10,7 @@
 #include "framework/mesh/mesh_continuum/mesh_continuum_local_cell_handler.h"
 #include "framework/mesh/mesh_continuum/mesh_continuum_global_cell_handler.h"
 #include "framework/mesh/mesh_continuum/mesh_continuum_vertex_handler.h"
+#include "framework/utils/memory_registry.h"
 
 namespace opensn
 {
@@ -188,6 +189,12 @@ public:
 
   void SetOrthoAttributes(const OrthoMeshAttributes& attrs) { ortho_attributes_ = attrs; }
 
+  /**
+   * Returns an estimate of the heap memory held by the local and ghost cells, the vertices and
+   * the cell id maps of this rank. Map nodes are counted with a nominal per-node overhead.
+   */
+  MemoryUsage ComputeMemoryUsage() const;
+
 public:
   VertexHandler vertices;
   LocalCellHandler local_cells;
@@ -3,16 +3,38 @@
 
 #include "framework/mesh/mesh_generator/from_file_mesh_generator.h"
 #include "framework/mesh/unpartitioned_mesh/unpartitioned_mesh.h"
+#include "framework/mesh/mesh_continuum/mesh_continuum.h"
+#include "framework/data_types/byte_array.h"
+#include "framework/mpi/mpi_utils.h"
 #include "framework/object_factory.h"
 #include "framework/runtime.h"
 #include "framework/logging/log.h"
 #include "framework/mesh/io/mesh_io.h"
 #include "framework/utils/utils.h"
+#include <algorithm>
 #include <filesystem>
+#include <unordered_map>
 
 namespace opensn
 {
 
+namespace
+{
+
+/// Hash of a face key, i.e. of the sorted vertex-ids of a face.
+struct FaceKeyHash
+{
+  size_t operator()(const std::vector<uint64_t>& key) const
+  {
+    size_t seed = key.size();
+    for (uint64_t vid : key)
+      seed ^= std::hash<uint64_t>{}(vid) + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2);
+    return seed;
+  }
+};
+
+} // namespace
+
 OpenSnRegisterObjectInNamespace(mesh, FromFileMeshGenerator);
 
 InputParameters
@@ -30,6 +52,21 @@ FromFileMeshGenerator::GetInputParameters()
                               "used for .vtu, .pvtu and .e files.");
   params.AddOptionalParameter(
     "boundary_id_fieldname", "", "The name of the field storing boundary-ids");
+  params.AddOptionalParameter("connectivity_method",
+                              "hash",
+                              "Algorithm used to match cell faces. \"hash\" uses a single pass "
+                              "over an open-addressing hash table, \"sort\" uses a threaded "
+                              "bucketed sort.");
+  params.ConstrainParameterRange("connectivity_method", AllowableRangeList::New({"hash", "sort"}));
+  params.AddOptionalParameter(
+    "distributed",
+    false,
+    "When set, and the generator is executed directly, each process reads only its own pieces "
+    "of a partitioned .pvtu file, or its own files \"<filename>.<n>.<i>\" of a decomposed "
+    "ExodusII mesh, and builds its local mesh without forming the global mesh. The pieces need "
+    "global ids. With more pieces than processes, contiguous pieces are merged. With fewer "
+    "pieces, or without global ids, the mesh is read globally and repartitioned. A distributed "
+    "generator can not be an input of another mesh generator.");
 
   return params;
 }
@@ -38,8 +75,24 @@ FromFileMeshGenerator::FromFileMeshGenerator(const InputParameters& params)
   : MeshGenerator(params),
     filename_(params.GetParamValue<std::string>("filename")),
     material_id_fieldname_(params.GetParamValue<std::string>("material_id_fieldname")),
-    boundary_id_fieldname_(params.GetParamValue<std::string>("boundary_id_fieldname"))
+    boundary_id_fieldname_(params.GetParamValue<std::string>("boundary_id_fieldname")),
+    connectivity_method_(params.GetParamValue<std::string>("connectivity_method")),
+    distributed_(params.GetParamValue<bool>("distributed"))
+{
+}
+
+UnpartitionedMesh::Options
+FromFileMeshGenerator::GetMeshOptions() const
 {
+  UnpartitionedMesh::Options options;
+  options.file_name = filename_;
+  options.scale = scale_;
+  options.material_id_fieldname = material_id_fieldname_;
+  options.boundary_id_fieldname = boundary_id_fieldname_;
+  options.connectivity_method = connectivity_method_ == "sort"
+                                  ? UnpartitionedMesh::ConnectivityMethod::PARALLEL_SORT
+                                  : UnpartitionedMesh::ConnectivityMethod::HASH_TABLE;
+  return options;
 }
 
 std::shared_ptr<UnpartitionedMesh>
@@ -48,12 +101,12 @@ FromFileMeshGenerator::GenerateUnpartitionedMesh(std::shared_ptr<UnpartitionedMe
   OpenSnInvalidArgumentIf(input_umesh != nullptr,
                           "FromFileMeshGenerator can not be preceded by another"
                           " mesh generator because it cannot process an input mesh");
+  OpenSnInvalidArgumentIf(distributed_ and not executing_,
+                          "FromFileMeshGenerator: \"distributed\" requires the generator to be "
+                          "executed directly. It can not be used as an input of another mesh "
+                          "generator.");
 
-  UnpartitionedMesh::Options options;
-  options.file_name = filename_;
-  options.scale = scale_;
-  options.material_id_fieldname = material_id_fieldname_;
-  options.boundary_id_fieldname = boundary_id_fieldname_;
+  const auto options = GetMeshOptions();
 
   const std::filesystem::path filepath(filename_);
   AssertReadableFile(filename_);
@@ -78,4 +131,308 @@ FromFileMeshGenerator::GenerateUnpartitionedMesh(std::shared_ptr<UnpartitionedMe
                           ".obj, .msh, .e, .vtu, .pvtu, .case.");
 }
 
+void
+FromFileMeshGenerator::Execute()
+{
+  if (distributed_)
+  {
+    auto grid_ptr = ReadDistributedMesh();
+    if (grid_ptr)
+    {
+      mesh_stack.push_back(grid_ptr);
+      opensn::mpi_comm.barrier();
+      return;
+    }
+  }
+
+  executing_ = true;
+  MeshGenerator::Execute();
+  executing_ = false;
+}
+
+std::shared_ptr<MeshContinuum>
+FromFileMeshGenerator::ReadDistributedMesh()
+{
+  const int location_id = opensn::mpi_comm.rank();
+  const int num_locations = opensn::mpi_comm.size();
+
+  if (replicated_)
+    return nullptr;
+
+  const std::string extension = std::filesystem::path(filename_).extension();
+  if (extension != ".pvtu" and extension != ".e")
+  {
+    log.Log0Warning() << "FromFileMeshGenerator: Distributed reading is only supported for .pvtu "
+                         "and .e files. "
+                      << filename_ << " will be read globally.";
+    return nullptr;
+  }
+
+  const auto options = GetMeshOptions();
+  const size_t num_pieces = MeshIO::GetNumberOfPieces(options);
+  if (num_pieces < static_cast<size_t>(num_locations))
+  {
+    log.Log0Warning() << "FromFileMeshGenerator: " << filename_ << " has " << num_pieces
+                      << " pieces, which is fewer than the " << num_locations
+                      << " processes. The mesh will be read globally and repartitioned.";
+    return nullptr;
+  }
+
+  auto mesh_part = extension == ".pvtu"
+                     ? MeshIO::FromPVTUPieces(options, location_id, num_locations)
+                     : MeshIO::FromExodusIIPieces(options, location_id, num_locations);
+
+  // All locations must agree on falling back
+  const int part_usable = (mesh_part.has_global_ids and not mesh_part.cells.empty()) ? 1 : 0;
+  int all_parts_usable = 0;
+  mpi_comm.all_reduce(part_usable, all_parts_usable, mpi::op::min<int>());
+  if (all_parts_usable == 0)
+  {
+    log.Log0Warning() << "FromFileMeshGenerator: The pieces of " << filename_
+                      << " lack global ids or leave a process without cells. The mesh will be "
+                         "read globally and repartitioned.";
+    return nullptr;
+  }
+
+  log.Log() << "FromFileMeshGenerator: Read " << num_pieces << " pieces on " << num_locations
+            << " processes";
+
+  return SetupDistributedMesh(mesh_part);
+}
+
+std::shared_ptr<MeshContinuum>
+FromFileMeshGenerator::SetupDistributedMesh(DistributedMeshPart& mesh_part) const
+{
+  typedef UnpartitionedMesh::LightWeightCell LightWeightCell;
+
+  const int location_id = opensn::mpi_comm.rank();
+  const int num_locations = opensn::mpi_comm.size();
+
+  auto& local_cells = mesh_part.cells;
+  auto& vertices = mesh_part.vertices;
+  std::map<uint64_t, LightWeightCell> ghost_cells;
+  std::map<uint64_t, int> ghost_cell_pids;
+
+  // Subscribe the vertices of the local cells at their home locations
+  std::map<int, std::vector<uint64_t>> home_vids;
+  for (const auto& [vid, vertex] : vertices)
+    home_vids[static_cast<int>(vid % num_locations)].push_back(vid);
+
+  const auto subscribed_vids = MapAllToAll(home_vids);
+  home_vids.clear();
+
+  // The home location of a vertex shared by more than one location sends each
+  // of these locations the list of the others as [vid, n, pid_0, ..., pid_n-1]
+  std::map<int, std::vector<uint64_t>> shared_vid_info;
+  {
+    std::map<uint64_t, std::vector<int>> vertex_pids;
+    for (const auto& [pid, vids] : subscribed_vids)
+      for (uint64_t vid : vids)
+        vertex_pids[vid].push_back(pid);
+
+    for (const auto& [vid, pids] : vertex_pids)
+    {
+      if (pids.size() < 2)
+        continue;
+      for (int pid : pids)
+      {
+        auto& info = shared_vid_info[pid];
+        info.push_back(vid);
+        info.push_back(pids.size() - 1);
+        for (int other_pid : pids)
+          if (other_pid != pid)
+            info.push_back(other_pid);
+      }
+    }
+  }
+
+  const auto received_vid_info = MapAllToAll(shared_vid_info);
+  shared_vid_info.clear();
+
+  std::map<uint64_t, std::vector<int>> shared_vertex_pids;
+  for (const auto& [home_pid, info] : received_vid_info)
+    for (size_t i = 0; i < info.size();)
+    {
+      const uint64_t vid = info[i++];
+      const size_t num_pids = info[i++];
+      auto& pids = shared_vertex_pids[vid];
+      for (size_t k = 0; k < num_pids; ++k)
+        pids.push_back(static_cast<int>(info[i++]));
+    }
+
+  // A local cell is a ghost on every other location that has a cell sharing
+  // one of its vertices
+  std::map<uint64_t, std::set<int>> cell_ghost_pids;
+  for (const auto& [cell_gid, cell] : local_cells)
+    for (uint64_t vid : cell.vertex_ids)
+    {
+      auto it = shared_vertex_pids.find(vid);
+      if (it != shared_vertex_pids.end())
+        cell_ghost_pids[cell_gid].insert(it->second.begin(), it->second.end());
+    }
+
+  // Sends the local cells, with their vertices, to the locations they are
+  // ghosts on and (re)places the received ghost cells
+  auto ExchangeGhostCells = [&]()
+  {
+    std::map<int, ByteArray> send_data;
+    for (const auto& [cell_gid, pids] : cell_ghost_pids)
+    {
+      const auto& cell = local_cells.at(cell_gid);
+
+      ByteArray serial_cell;
+      serial_cell.Write(cell_gid);
+      SerializeCell(cell, serial_cell);
+      for (uint64_t vid : cell.vertex_ids)
+        serial_cell.Write(vertices.at(vid));
+
+      for (int pid : pids)
+        send_data[pid].Append(serial_cell);
+    }
+
+    std::map<int, std::vector<std::byte>> send_bytes;
+    for (auto& [pid, serial_data] : send_data)
+      send_bytes[pid] = std::move(serial_data.Data());
+    send_data.clear();
+
+    const auto recv_bytes = MapAllToAll(send_bytes);
+
+    ghost_cells.clear();
+    for (const auto& [pid, bytes] : recv_bytes)
+    {
+      ByteArray serial_data(bytes);
+      while (not serial_data.EndOfBuffer())
+      {
+        const auto cell_gid = serial_data.Read<uint64_t>();
+        auto cell = DeSerializeCell(serial_data);
+        for (uint64_t vid : cell.vertex_ids)
+          vertices.emplace(vid, serial_data.Read<Vector3>());
+
+        ghost_cell_pids[cell_gid] = pid;
+        ghost_cells.emplace(cell_gid, std::move(cell));
+      }
+    }
+  };
+
+  ExchangeGhostCells();
+
+  // Match the faces of the local and ghost cells. Every face-neighbor of a
+  // local cell shares vertices with it and is therefore present here.
+  struct FaceReference
+  {
+    UnpartitionedMesh::LightWeightFace* face;
+    uint64_t cell_gid;
+  };
+  std::unordered_map<std::vector<uint64_t>, FaceReference, FaceKeyHash> open_faces;
+  auto MatchFaces = [&open_faces](std::map<uint64_t, LightWeightCell>& cells)
+  {
+    for (auto& [cell_gid, cell] : cells)
+      for (auto& face : cell.faces)
+      {
+        std::vector<uint64_t> key = face.vertex_ids;
+        std::sort(key.begin(), key.end());
+
+        const FaceReference face_ref{&face, cell_gid};
+        auto [it, inserted] = open_faces.try_emplace(std::move(key), face_ref);
+        if (inserted)
+          continue;
+
+        auto& other = it->second;
+        face.has_neighbor = true;
+        face.neighbor = other.cell_gid;
+        other.face->has_neighbor = true;
+        other.face->neighbor = cell_gid;
+        open_faces.erase(it);
+      }
+  };
+  MatchFaces(local_cells);
+  MatchFaces(ghost_cells);
+
+  // Boundary names in the order of first appearance over all locations
+  std::vector<char> local_names;
+  for (const auto& [block_name, faces] : mesh_part.boundary_blocks)
+  {
+    local_names.insert(local_names.end(), block_name.begin(), block_name.end());
+    local_names.push_back('\n');
+  }
+  std::vector<char> all_names;
+  mpi_comm.all_gather(local_names, all_names);
+
+  std::map<std::string, uint64_t> boundary_ids;
+  std::map<uint64_t, std::string> boundary_id_map;
+  {
+    std::string block_name;
+    for (char c : all_names)
+    {
+      if (c != '\n')
+      {
+        block_name += c;
+        continue;
+      }
+      if (boundary_ids.count(block_name) == 0)
+      {
+        const uint64_t bid = boundary_ids.size();
+        boundary_ids[block_name] = bid;
+        boundary_id_map[bid] = block_name;
+      }
+      block_name.clear();
+    }
+  }
+
+  // Assign boundary ids to the unmatched faces of local cells
+  if (not mesh_part.boundary_blocks.empty())
+  {
+    std::unordered_map<std::vector<uint64_t>, uint64_t, FaceKeyHash> boundary_faces;
+    for (const auto& [block_name, faces] : mesh_part.boundary_blocks)
+      for (const auto& face_vids : faces)
+        boundary_faces[face_vids] = boundary_ids.at(block_name);
+
+    for (auto& [key, face_ref] : open_faces)
+    {
+      if (local_cells.count(face_ref.cell_gid) == 0)
+        continue;
+      auto it = boundary_faces.find(key);
+      if (it != boundary_faces.end())
+        face_ref.face->neighbor = it->second;
+    }
+  }
+  open_faces.clear();
+
+  // The local cells are now complete. Resend them so that the ghost cells
+  // carry their full connectivity.
+  ExchangeGhostCells();
+
+  // Build the local mesh
+  auto grid_ptr = MeshContinuum::New();
+
+  grid_ptr->GetBoundaryIDMap() = boundary_id_map;
+
+  for (const auto& [vid, vertex] : vertices)
+    grid_ptr->vertices.Insert(vid, vertex);
+
+  const STLVertexListHelper<std::map<uint64_t, Vector3>> vertex_list(vertices);
+  for (const auto& [cell_gid, cell] : local_cells)
+    grid_ptr->cells.push_back(SetupCell(cell, cell_gid, location_id, vertex_list));
+  for (const auto& [cell_gid, cell] : ghost_cells)
+    grid_ptr->cells.push_back(
+      SetupCell(cell, cell_gid, ghost_cell_pids.at(cell_gid), vertex_list));
+
+  unsigned int dimension = 0;
+  mpi_comm.all_reduce(mesh_part.dimension, dimension, mpi::op::max<unsigned int>());
+
+  const uint64_t local_max_vid = vertices.empty() ? 0 : vertices.rbegin()->first;
+  uint64_t max_vid = 0;
+  mpi_comm.all_reduce(local_max_vid, max_vid, mpi::op::max<uint64_t>());
+
+  grid_ptr->SetDimension(dimension);
+  grid_ptr->SetType(UNSTRUCTURED);
+  grid_ptr->SetExtruded(false);
+
+  grid_ptr->SetGlobalVertexCount(max_vid + 1);
+
+  ComputeAndPrintStats(*grid_ptr);
+
+  return grid_ptr;
+}
+
 } // namespace opensn
@@ -7,6 +7,7 @@
 
 namespace opensn
 {
+struct DistributedMeshPart;
 
 class FromFileMeshGenerator : public MeshGenerator
 {
@@ -14,12 +15,39 @@ public:
   static InputParameters GetInputParameters();
   explicit FromFileMeshGenerator(const InputParameters& params);
 
+  /**
+   * When `distributed` is set, reads the pieces of a partitioned mesh on the locations they are
+   * assigned to and builds the local meshes directly. Falls back to the global read and
+   * partitioning of MeshGenerator::Execute otherwise.
+   */
+  void Execute() override;
+
 protected:
   std::shared_ptr<UnpartitionedMesh>
   GenerateUnpartitionedMesh(std::shared_ptr<UnpartitionedMesh> input_umesh) override;
+
+  /**
+   * Reads the pieces assigned to this location. Returns a null pointer, on all locations, if the
+   * file cannot be read in a distributed manner.
+   */
+  std::shared_ptr<MeshContinuum> ReadDistributedMesh();
+
+  /**
+   * Exchanges a (vertex-neighbor) ghost layer between locations, establishes the connectivity of
+   * the local cells and builds the local mesh. The cells read on this location become the local
+   * cells.
+   */
+  std::shared_ptr<MeshContinuum> SetupDistributedMesh(DistributedMeshPart& mesh_part) const;
+
+  UnpartitionedMesh::Options GetMeshOptions() const;
+
   const std::string filename_;
   const std::string material_id_fieldname_;
   const std::string boundary_id_fieldname_;
+  const std::string connectivity_method_;
+  const bool distributed_;
+  /// Set while Execute runs, to tell a direct execution from use as an input of another generator.
+  bool executing_ = false;
 };
 
 } // namespace opensn
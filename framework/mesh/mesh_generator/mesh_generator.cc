@@ -9,6 +9,7 @@
 #include "framework/runtime.h"
 #include "framework/logging/log.h"
 #include "framework/mesh/cell/cell.h"
+#include "framework/data_types/byte_array.h"
 
 namespace opensn
 {
@@ -124,6 +125,61 @@ MeshGenerator::Execute()
   opensn::mpi_comm.barrier();
 }
 
+void
+MeshGenerator::SerializeCell(const UnpartitionedMesh::LightWeightCell& cell,
+                             ByteArray& serial_buffer)
+{
+  serial_buffer.Write(cell.type);
+  serial_buffer.Write(cell.sub_type);
+  serial_buffer.Write(cell.centroid);
+  serial_buffer.Write(cell.material_id);
+  serial_buffer.Write(cell.vertex_ids.size());
+  for (uint64_t vid : cell.vertex_ids)
+    serial_buffer.Write(vid);
+  serial_buffer.Write(cell.faces.size());
+  for (const auto& face : cell.faces)
+  {
+    serial_buffer.Write(face.vertex_ids.size());
+    for (uint64_t vid : face.vertex_ids)
+      serial_buffer.Write(vid);
+    serial_buffer.Write(face.has_neighbor);
+    serial_buffer.Write(face.neighbor);
+  }
+}
+
+UnpartitionedMesh::LightWeightCell
+MeshGenerator::DeSerializeCell(ByteArray& serial_buffer)
+{
+  const auto cell_type = serial_buffer.Read<CellType>();
+  const auto cell_sub_type = serial_buffer.Read<CellType>();
+
+  UnpartitionedMesh::LightWeightCell cell(cell_type, cell_sub_type);
+  cell.centroid = serial_buffer.Read<Vector3>();
+  cell.material_id = serial_buffer.Read<int>();
+
+  const auto num_vids = serial_buffer.Read<size_t>();
+  cell.vertex_ids.reserve(num_vids);
+  for (size_t v = 0; v < num_vids; ++v)
+    cell.vertex_ids.push_back(serial_buffer.Read<uint64_t>());
+
+  const auto num_faces = serial_buffer.Read<size_t>();
+  cell.faces.reserve(num_faces);
+  for (size_t f = 0; f < num_faces; ++f)
+  {
+    UnpartitionedMesh::LightWeightFace face;
+    const auto num_face_vids = serial_buffer.Read<size_t>();
+    face.vertex_ids.reserve(num_face_vids);
+    for (size_t v = 0; v < num_face_vids; ++v)
+      face.vertex_ids.push_back(serial_buffer.Read<uint64_t>());
+    face.has_neighbor = serial_buffer.Read<bool>();
+    face.neighbor = serial_buffer.Read<uint64_t>();
+
+    cell.faces.push_back(std::move(face));
+  }
+
+  return cell;
+}
+
 void
 MeshGenerator::ComputeAndPrintStats(const MeshContinuum& grid)
 {
@@ -255,11 +311,12 @@ MeshGenerator::BroadcastPIDs(std::vector<int64_t>& cell_pids,
 }
 
 bool
-MeshGenerator::CellHasLocalScope(int location_id,
-                                 const UnpartitionedMesh::LightWeightCell& lwcell,
-                                 uint64_t cell_global_id,
-                                 const std::vector<std::set<uint64_t>>& vertex_subscriptions,
-                                 const std::vector<int64_t>& cell_partition_ids) const
+MeshGenerator::CellHasLocalScope(
+  int location_id,
+  const UnpartitionedMesh::LightWeightCell& lwcell,
+  uint64_t cell_global_id,
+  const UnpartitionedMesh::VertexCellSubscriptions& vertex_subscriptions,
+  const std::vector<int64_t>& cell_partition_ids) const
 {
   if (replicated_)
     return true;
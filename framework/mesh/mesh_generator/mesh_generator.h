@@ -13,6 +13,7 @@ namespace opensn
 {
 class GraphPartitioner;
 class MeshContinuum;
+class ByteArray;
 
 /**
  * Mesh generation can be very complicated in parallel. Some mesh formats
@@ -88,7 +89,7 @@ protected:
   bool CellHasLocalScope(int location_id,
                          const UnpartitionedMesh::LightWeightCell& lwcell,
                          uint64_t cell_global_id,
-                         const std::vector<std::set<uint64_t>>& vertex_subscriptions,
+                         const UnpartitionedMesh::VertexCellSubscriptions& vertex_subscriptions,
                          const std::vector<int64_t>& cell_partition_ids) const;
 
   /**
@@ -99,6 +100,18 @@ protected:
                                          uint64_t partition_id,
                                          const VertexListHelper& vertices);
 
+  /**
+   * Appends a light-weight cell to a byte array.
+   */
+  static void SerializeCell(const UnpartitionedMesh::LightWeightCell& cell,
+                            ByteArray& serial_buffer);
+
+  /**
+   * Reads a light-weight cell, written by `SerializeCell`, from the current offset of a byte
+   * array.
+   */
+  static UnpartitionedMesh::LightWeightCell DeSerializeCell(ByteArray& serial_buffer);
+
   static void ComputeAndPrintStats(const MeshContinuum& grid);
 
   const double scale_;
@@ -176,7 +176,8 @@ OrthogonalMeshGenerator::CreateUnpartitioned1DOrthoMesh(const std::vector<double
 
   umesh->ComputeCentroids();
   umesh->CheckQuality();
-  umesh->BuildMeshConnectivity();
+  // Connectivity is implied by the i-j-k structure and was set above
+  umesh->BuildVertexCellSubscriptions();
 
   return umesh;
 }
@@ -252,7 +253,7 @@ OrthogonalMeshGenerator::CreateUnpartitioned2DOrthoMesh(const std::vector<double
         else
           face.vertex_ids = std::vector<uint64_t>{cell->vertex_ids[v], cell->vertex_ids[0]};
 
-        face.neighbor = true;
+        face.has_neighbor = true;
         if (v == 1 and j != max_j)
           face.neighbor = cmap[i][j + 1]; /*XMAX*/
         if (v == 3 and j != 0)
@@ -293,7 +294,8 @@ OrthogonalMeshGenerator::CreateUnpartitioned2DOrthoMesh(const std::vector<double
 
   umesh->ComputeCentroids();
   umesh->CheckQuality();
-  umesh->BuildMeshConnectivity();
+  // Connectivity is implied by the i-j-k structure and was set above
+  umesh->BuildVertexCellSubscriptions();
 
   return umesh;
 }
@@ -458,7 +460,8 @@ OrthogonalMeshGenerator::CreateUnpartitioned3DOrthoMesh(const std::vector<double
 
   umesh->ComputeCentroids();
   umesh->CheckQuality();
-  umesh->BuildMeshConnectivity();
+  // Connectivity is implied by the i-j-k structure and was set above
+  umesh->BuildVertexCellSubscriptions();
 
   return umesh;
 }
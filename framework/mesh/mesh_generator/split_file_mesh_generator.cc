@@ -270,28 +270,6 @@ SplitFileMeshGenerator::WriteSplitMesh(const std::vector<int64_t>& cell_pids,
   } // for p
 }
 
-void
-SplitFileMeshGenerator::SerializeCell(const UnpartitionedMesh::LightWeightCell& cell,
-                                      ByteArray& serial_buffer)
-{
-  serial_buffer.Write(cell.type);
-  serial_buffer.Write(cell.sub_type);
-  serial_buffer.Write(cell.centroid);
-  serial_buffer.Write(cell.material_id);
-  serial_buffer.Write(cell.vertex_ids.size());
-  for (uint64_t vid : cell.vertex_ids)
-    serial_buffer.Write(vid);
-  serial_buffer.Write(cell.faces.size());
-  for (const auto& face : cell.faces)
-  {
-    serial_buffer.Write(face.vertex_ids.size());
-    for (uint64_t vid : face.vertex_ids)
-      serial_buffer.Write(vid);
-    serial_buffer.Write(face.has_neighbor);
-    serial_buffer.Write(face.neighbor);
-  }
-}
-
 SplitFileMeshGenerator::SplitMeshInfo
 SplitFileMeshGenerator::ReadSplitMesh()
 {
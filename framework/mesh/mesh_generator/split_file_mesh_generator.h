@@ -7,7 +7,6 @@
 
 namespace opensn
 {
-class ByteArray;
 
 /**Generates the mesh only on location 0, thereafter partitions the mesh
  * but instead of broadcasting the mesh to other locations it creates binary
@@ -24,8 +23,6 @@ protected:
   void WriteSplitMesh(const std::vector<int64_t>& cell_pids,
                       const UnpartitionedMesh& umesh,
                       int num_parts);
-  static void SerializeCell(const UnpartitionedMesh::LightWeightCell& cell,
-                            ByteArray& serial_buffer);
   typedef std::pair<int, uint64_t> CellPIDGID;
   struct SplitMeshInfo
   {
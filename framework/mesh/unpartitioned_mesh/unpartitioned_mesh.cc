@@ -8,6 +8,8 @@
 #include "framework/logging/log.h"
 #include "framework/utils/timer.h"
 #include <algorithm>
+#include <limits>
+#include <thread>
 
 namespace opensn
 {
@@ -206,10 +208,112 @@ UnpartitionedMesh::SetOrthoAttributes(size_t nx, size_t ny, size_t nz)
 }
 
 void
-UnpartitionedMesh::BuildMeshConnectivity()
+UnpartitionedMesh::BuildVertexCellSubscriptions()
+{
+  auto& subs = vertex_cell_subscriptions_;
+  subs.offsets.assign(vertices_.size() + 1, 0);
+  for (const auto& cell : raw_cells_)
+    for (auto vid : cell->vertex_ids)
+      ++subs.offsets.at(vid + 1);
+
+  for (size_t v = 0; v < vertices_.size(); ++v)
+    subs.offsets[v + 1] += subs.offsets[v];
+
+  // Cells are visited in ascending order so each vertex's list comes out sorted
+  subs.cell_ids.resize(subs.offsets.back());
+  std::vector<uint64_t> next(subs.offsets.begin(), subs.offsets.end() - 1);
+  uint64_t cur_cell_id = 0;
+  for (const auto& cell : raw_cells_)
+  {
+    for (auto vid : cell->vertex_ids)
+      subs.cell_ids[next[vid]++] = cur_cell_id;
+    ++cur_cell_id;
+  }
+}
+
+namespace
+{
+
+constexpr uint64_t EMPTY_SLOT = std::numeric_limits<uint64_t>::max();
+constexpr uint64_t USED_SLOT = std::numeric_limits<uint64_t>::max() - 1;
+
+uint64_t
+HashKey(const uint64_t* vids, size_t num_vids)
+{
+  // splitmix64 finalizer folded over the sorted vertex ids
+  uint64_t h = 0x9e3779b97f4a7c15ULL ^ num_vids;
+  for (size_t i = 0; i < num_vids; ++i)
+  {
+    h ^= vids[i] + 0x9e3779b97f4a7c15ULL + (h << 6) + (h >> 2);
+    h ^= h >> 30;
+    h *= 0xbf58476d1ce4e5b9ULL;
+    h ^= h >> 27;
+    h *= 0x94d049bb133111ebULL;
+    h ^= h >> 31;
+  }
+  return h;
+}
+
+/**
+ * Faces (or boundary cells) keyed on their sorted vertex ids. The keys are stored flat so
+ * that key comparisons stay cache friendly for large meshes.
+ */
+struct FaceKeys
+{
+  std::vector<uint64_t> owner;
+  std::vector<uint32_t> face;
+  std::vector<uint64_t> hash;
+  std::vector<uint64_t> key_offsets = {0};
+  std::vector<uint64_t> key_vids;
+
+  size_t Size() const { return owner.size(); }
+
+  const uint64_t* Key(size_t i) const { return key_vids.data() + key_offsets[i]; }
+
+  size_t KeySize(size_t i) const { return key_offsets[i + 1] - key_offsets[i]; }
+
+  void Add(uint64_t cell_id, uint32_t face_index, const std::vector<uint64_t>& vertex_ids)
+  {
+    const size_t begin = key_vids.size();
+    key_vids.insert(key_vids.end(), vertex_ids.begin(), vertex_ids.end());
+    std::sort(key_vids.begin() + static_cast<std::ptrdiff_t>(begin), key_vids.end());
+    key_offsets.push_back(key_vids.size());
+    owner.push_back(cell_id);
+    face.push_back(face_index);
+    hash.push_back(HashKey(key_vids.data() + begin, vertex_ids.size()));
+  }
+
+  bool KeyEquals(size_t i, uint64_t key_hash, const uint64_t* key, size_t key_size) const
+  {
+    return hash[i] == key_hash and KeySize(i) == key_size and
+           std::equal(key, key + key_size, Key(i));
+  }
+
+  /// Strict weak ordering on (hash, key) used by the sort-based matcher.
+  bool KeyLess(size_t i, size_t j) const
+  {
+    if (hash[i] != hash[j])
+      return hash[i] < hash[j];
+    return std::lexicographical_compare(Key(i), Key(i) + KeySize(i), Key(j), Key(j) + KeySize(j));
+  }
+};
+
+/// Open-addressing (linear probing) table of indices into a FaceKeys list.
+std::vector<uint64_t>
+MakeSlotTable(size_t num_entries)
+{
+  size_t capacity = 16;
+  while (capacity < 2 * num_entries)
+    capacity <<= 1;
+  return std::vector<uint64_t>(capacity, EMPTY_SLOT);
+}
+
+} // namespace
+
+void
+UnpartitionedMesh::BuildMeshConnectivity(ConnectivityMethod method)
 {
   const size_t num_raw_cells = raw_cells_.size();
-  const size_t num_raw_vertices = vertices_.size();
 
   // Reset all cell neighbors
   int num_bndry_faces = 0;
@@ -225,135 +329,175 @@ UnpartitionedMesh::BuildMeshConnectivity()
 
   log.Log() << program_timer.GetTimeString() << " Establishing cell connectivity.";
 
-  // Establish internal connectivity
   // Populate vertex subscriptions to internal cells
-  vertex_cell_subscriptions_.resize(num_raw_vertices);
+  BuildVertexCellSubscriptions();
+
+  log.Log() << program_timer.GetTimeString() << " Vertex cell subscriptions complete.";
+
+  // Key all unconnected faces
+  FaceKeys face_keys;
+  face_keys.owner.reserve(num_bndry_faces);
+  face_keys.face.reserve(num_bndry_faces);
+  face_keys.hash.reserve(num_bndry_faces);
+  face_keys.key_offsets.reserve(num_bndry_faces + 1);
+  for (uint64_t c = 0; c < num_raw_cells; ++c)
   {
-    uint64_t cur_cell_id = 0;
-    for (const auto& cell : raw_cells_)
-    {
-      for (auto vid : cell->vertex_ids)
-        vertex_cell_subscriptions_.at(vid).insert(cur_cell_id);
-      ++cur_cell_id;
-    }
+    const auto& faces = raw_cells_[c]->faces;
+    for (uint32_t f = 0; f < faces.size(); ++f)
+      if (not faces[f].has_neighbor)
+        face_keys.Add(c, f, faces[f].vertex_ids);
   }
 
-  log.Log() << program_timer.GetTimeString() << " Vertex cell subscriptions complete.";
+  auto Connect = [this, &face_keys](size_t i, size_t j)
+  {
+    auto& face_i = raw_cells_[face_keys.owner[i]]->faces[face_keys.face[i]];
+    auto& face_j = raw_cells_[face_keys.owner[j]]->faces[face_keys.face[j]];
+
+    face_i.neighbor = face_keys.owner[j];
+    face_j.neighbor = face_keys.owner[i];
 
-  // Process raw cells
+    face_i.has_neighbor = true;
+    face_j.has_neighbor = true;
+  };
+
+  // Establish internal connectivity
+  const size_t num_face_keys = face_keys.Size();
+  if (method == ConnectivityMethod::HASH_TABLE)
   {
-    uint64_t aux_counter = 0;
-    uint64_t cur_cell_id = 0;
-    for (auto& cell : raw_cells_)
+    // Each face either finds its unmatched twin in the table, which then gets retired, or is
+    // inserted to wait for it.
+    auto table = MakeSlotTable(num_face_keys);
+    const uint64_t mask = table.size() - 1;
+    for (size_t i = 0; i < num_face_keys; ++i)
     {
-      for (auto& cur_cell_face : cell->faces)
+      const uint64_t* key = face_keys.Key(i);
+      const size_t key_size = face_keys.KeySize(i);
+      uint64_t slot = face_keys.hash[i] & mask;
+      bool matched = false;
+      for (; table[slot] != EMPTY_SLOT; slot = (slot + 1) & mask)
       {
-        if (cur_cell_face.has_neighbor)
+        const uint64_t j = table[slot];
+        if (j == USED_SLOT or face_keys.owner[j] == face_keys.owner[i])
           continue;
-        const std::set<uint64_t> cfvids(cur_cell_face.vertex_ids.begin(),
-                                        cur_cell_face.vertex_ids.end());
-
-        std::set<size_t> cells_to_search;
-        for (uint64_t vid : cfvids)
-          for (uint64_t cell_id : vertex_cell_subscriptions_.at(vid))
-            if (cell_id != cur_cell_id)
-              cells_to_search.insert(cell_id);
-
-        for (uint64_t adj_cell_id : cells_to_search)
+        if (face_keys.KeyEquals(j, face_keys.hash[i], key, key_size))
         {
-          auto adj_cell = raw_cells_.at(adj_cell_id);
-
-          for (auto& adj_cell_face : adj_cell->faces)
-          {
-            if (adj_cell_face.has_neighbor)
-              continue;
-            const std::set<uint64_t> afvids(adj_cell_face.vertex_ids.begin(),
-                                            adj_cell_face.vertex_ids.end());
-
-            if (cfvids == afvids)
-            {
-              cur_cell_face.neighbor = adj_cell_id;
-              adj_cell_face.neighbor = cur_cell_id;
-
-              cur_cell_face.has_neighbor = true;
-              adj_cell_face.has_neighbor = true;
-
-              goto face_neighbor_found;
-            }
-          } // for adjacent cell face
+          Connect(i, j);
+          table[slot] = USED_SLOT;
+          matched = true;
+          break;
         }
-      face_neighbor_found:;
-      } // for face
-
-      ++cur_cell_id;
-      const double fraction_complete =
-        static_cast<double>(cur_cell_id) / static_cast<double>(num_raw_cells);
-      if (fraction_complete >= static_cast<double>(aux_counter + 1) * 0.1)
+      }
+      if (not matched)
+        table[slot] = i;
+    }
+  }
+  else if (method == ConnectivityMethod::PARALLEL_SORT)
+  {
+    // Faces sharing a key always land in the same bucket, so buckets can be sorted and matched
+    // concurrently without touching the same faces. Every rank reads the mesh, so each one only
+    // uses its share of the cores of its node.
+    const size_t max_threads = std::max<size_t>(
+      1, std::thread::hardware_concurrency() / std::max(1, num_ranks_on_node));
+    const size_t num_buckets = std::max<size_t>(1, std::min(max_threads, num_face_keys / 4096));
+
+    std::vector<std::vector<uint64_t>> buckets(num_buckets);
+    for (auto& bucket : buckets)
+      bucket.reserve(num_face_keys / num_buckets + 1);
+    for (size_t i = 0; i < num_face_keys; ++i)
+      buckets[face_keys.hash[i] % num_buckets].push_back(i);
+
+    auto MatchBucket = [&face_keys, &Connect](std::vector<uint64_t>& bucket)
+    {
+      std::sort(bucket.begin(),
+                bucket.end(),
+                [&face_keys](uint64_t i, uint64_t j)
+                {
+                  if (face_keys.KeyLess(i, j))
+                    return true;
+                  if (face_keys.KeyLess(j, i))
+                    return false;
+                  return face_keys.owner[i] < face_keys.owner[j];
+                });
+
+      std::vector<uint64_t> pending;
+      for (size_t run_begin = 0; run_begin < bucket.size();)
       {
-        log.Log() << program_timer.GetTimeString() << " Surpassing cell " << cur_cell_id << " of "
-                  << num_raw_cells << " (" << (aux_counter + 1) * 10 << "%)";
-        ++aux_counter;
+        const uint64_t first = bucket[run_begin];
+        size_t run_end = run_begin + 1;
+        while (run_end < bucket.size() and
+               face_keys.KeyEquals(bucket[run_end],
+                                   face_keys.hash[first],
+                                   face_keys.Key(first),
+                                   face_keys.KeySize(first)))
+          ++run_end;
+
+        pending.clear();
+        for (size_t k = run_begin; k < run_end; ++k)
+        {
+          const uint64_t i = bucket[k];
+          if (not pending.empty() and face_keys.owner[pending.back()] != face_keys.owner[i])
+          {
+            Connect(pending.back(), i);
+            pending.pop_back();
+          }
+          else
+            pending.push_back(i);
+        }
+        run_begin = run_end;
       }
-    } // for cell
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(num_buckets - 1);
+    for (size_t b = 1; b < num_buckets; ++b)
+      workers.emplace_back(MatchBucket, std::ref(buckets[b]));
+    MatchBucket(buckets[0]);
+    for (auto& worker : workers)
+      worker.join();
   }
+  else
+    OpenSnInvalidArgument("Unsupported connectivity method.");
 
   log.Log() << program_timer.GetTimeString() << " Establishing cell boundary connectivity.";
 
   // Establish boundary connectivity
-  // Make list of internal cells on the boundary
-  std::vector<LightWeightCell*> internal_cells_on_boundary;
-  for (auto& cell : raw_cells_)
+  if (not raw_boundary_cells_.empty())
   {
-    bool cell_on_boundary = false;
-    for (auto& face : cell->faces)
-      if (not face.has_neighbor)
-      {
-        cell_on_boundary = true;
-        break;
-      }
+    FaceKeys bndry_keys;
+    for (uint64_t bc = 0; bc < raw_boundary_cells_.size(); ++bc)
+      bndry_keys.Add(bc, 0, raw_boundary_cells_[bc]->vertex_ids);
 
-    if (cell_on_boundary)
-      internal_cells_on_boundary.push_back(cell);
-  }
-
-  // Populate vertex subscriptions to boundary cells
-  std::vector<std::set<uint64_t>> vertex_bndry_cell_subscriptions(vertices_.size());
-  {
-    uint64_t cur_cell_id = 0;
-    for (auto& cell : raw_boundary_cells_)
+    auto table = MakeSlotTable(bndry_keys.Size());
+    const uint64_t mask = table.size() - 1;
+    for (size_t i = 0; i < bndry_keys.Size(); ++i)
     {
-      for (auto vid : cell->vertex_ids)
-        vertex_bndry_cell_subscriptions.at(vid).insert(cur_cell_id);
-      ++cur_cell_id;
+      uint64_t slot = bndry_keys.hash[i] & mask;
+      while (table[slot] != EMPTY_SLOT)
+        slot = (slot + 1) & mask;
+      table[slot] = i;
     }
-  }
 
-  // Process boundary cells
-  for (auto& cell : internal_cells_on_boundary)
-    for (auto& face : cell->faces)
-    {
-      if (face.has_neighbor)
-        continue;
-      std::set<uint64_t> cfvids(face.vertex_ids.begin(), face.vertex_ids.end());
-
-      std::set<size_t> cells_to_search;
-      for (uint64_t vid : face.vertex_ids)
-        for (uint64_t cell_id : vertex_bndry_cell_subscriptions[vid])
-          cells_to_search.insert(cell_id);
-
-      for (uint64_t adj_cell_id : cells_to_search)
+    std::vector<uint64_t> key;
+    for (auto& cell : raw_cells_)
+      for (auto& face : cell->faces)
       {
-        auto& adj_cell = raw_boundary_cells_[adj_cell_id];
-
-        std::set<uint64_t> afvids(adj_cell->vertex_ids.begin(), adj_cell->vertex_ids.end());
+        if (face.has_neighbor)
+          continue;
+        key.assign(face.vertex_ids.begin(), face.vertex_ids.end());
+        std::sort(key.begin(), key.end());
+        const uint64_t key_hash = HashKey(key.data(), key.size());
 
-        if (cfvids == afvids)
+        for (uint64_t slot = key_hash & mask; table[slot] != EMPTY_SLOT; slot = (slot + 1) & mask)
         {
-          face.neighbor = adj_cell->material_id;
-          break;
+          const uint64_t j = table[slot];
+          if (bndry_keys.KeyEquals(j, key_hash, key.data(), key.size()))
+          {
+            face.neighbor = raw_boundary_cells_[j]->material_id;
+            break;
+          }
         }
-      } // for adj_cell_id
-    }   // for face
+      } // for face
+  }
 
   num_bndry_faces = 0;
   for (auto cell : raw_cells_)
@@ -451,7 +595,6 @@ UnpartitionedMesh::CleanUp()
   raw_boundary_cells_.clear();
   raw_boundary_cells_.shrink_to_fit();
   vertex_cell_subscriptions_.clear();
-  vertex_cell_subscriptions_.shrink_to_fit();
 }
 
 } // namespace opensn
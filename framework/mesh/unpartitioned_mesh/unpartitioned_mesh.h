@@ -41,12 +41,59 @@ public:
     explicit LightWeightCell(CellType type, CellType sub_type) : type(type), sub_type(sub_type) {}
   };
 
+  /// Algorithm used to match faces when establishing connectivity.
+  enum class ConnectivityMethod : int
+  {
+    /// Single pass over all faces using an open-addressing hash table keyed on the
+    /// sorted face vertex ids.
+    HASH_TABLE = 0,
+    /// Faces are bucketed by key hash and each bucket is sorted and matched
+    /// independently on a pool of threads.
+    PARALLEL_SORT = 1
+  };
+
   struct Options
   {
     std::string file_name;
     std::string material_id_fieldname = "BlockID";
     std::string boundary_id_fieldname;
     double scale = 1.0;
+    ConnectivityMethod connectivity_method = ConnectivityMethod::HASH_TABLE;
+  };
+
+  /**
+   * Flat (compressed-row) storage of the cells subscribing to each vertex. The cell ids of
+   * vertex `vid` are stored contiguously, in ascending order, in
+   * `cell_ids[offsets[vid]:offsets[vid+1]]`.
+   */
+  struct VertexCellSubscriptions
+  {
+    struct Range
+    {
+      const uint64_t* begin_;
+      const uint64_t* end_;
+
+      const uint64_t* begin() const { return begin_; }
+      const uint64_t* end() const { return end_; }
+      size_t size() const { return end_ - begin_; }
+      bool empty() const { return begin_ == end_; }
+    };
+
+    std::vector<uint64_t> offsets;
+    std::vector<uint64_t> cell_ids;
+
+    Range operator[](uint64_t vid) const
+    {
+      return {cell_ids.data() + offsets[vid], cell_ids.data() + offsets[vid + 1]};
+    }
+    size_t size() const { return offsets.empty() ? 0 : offsets.size() - 1; }
+    void clear()
+    {
+      offsets.clear();
+      offsets.shrink_to_fit();
+      cell_ids.clear();
+      cell_ids.shrink_to_fit();
+    }
   };
 
   struct BoundBox
@@ -73,7 +120,7 @@ public:
   void SetExtruded(bool extruded) { extruded_ = extruded; }
   bool Extruded() const { return extruded_; }
 
-  const std::vector<std::set<uint64_t>>& GetVertextCellSubscriptions() const
+  const VertexCellSubscriptions& GetVertextCellSubscriptions() const
   {
     return vertex_cell_subscriptions_;
   }
@@ -92,8 +139,12 @@ public:
 
   /**
    * Establishes neighbor connectivity for the light-weight mesh.
+   *
+   * Every unconnected face is keyed on its sorted vertex ids and matched against the faces of
+   * other cells (and against the raw boundary cells) with the requested method. Both methods
+   * also build the flat vertex-to-cell subscriptions used by the mesh generators.
    */
-  void BuildMeshConnectivity();
+  void BuildMeshConnectivity(ConnectivityMethod method = ConnectivityMethod::HASH_TABLE);
 
   /**
    * Compute centroids for all cells.
@@ -127,6 +178,12 @@ public:
 
   void CleanUp();
 
+  /**
+   * Builds the flat vertex-to-cell subscriptions of the raw cells. This is all that is needed by
+   * generators that already set every face neighbor, e.g. structured (orthogonal) generators.
+   */
+  void BuildVertexCellSubscriptions();
+
 protected:
   /// Spatial mesh dimension
   unsigned int dim_;
@@ -140,7 +197,7 @@ protected:
   std::vector<Vertex> vertices_;
   std::vector<LightWeightCell*> raw_cells_;
   std::vector<LightWeightCell*> raw_boundary_cells_;
-  std::vector<std::set<uint64_t>> vertex_cell_subscriptions_;
+  VertexCellSubscriptions vertex_cell_subscriptions_;
 };
 
 } // namespace opensn
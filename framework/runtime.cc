@@ -9,6 +9,7 @@
 #include "framework/object_factory.h"
 #include "framework/logging/log.h"
 #include "framework/utils/timer.h"
+#include "framework/utils/event_trace.h"
 #include "config.h"
 #include "caliper/cali.h"
 #include "hdf5.h"
@@ -27,6 +28,7 @@ Timer program_timer;
 int current_mesh_handler = -1;
 bool suppress_color = false;
 std::filesystem::path input_path;
+int num_ranks_on_node = 1;
 
 std::vector<std::shared_ptr<MeshContinuum>> mesh_stack;
 std::vector<std::shared_ptr<SurfaceMesh>> surface_mesh_stack;
@@ -56,6 +58,12 @@ Initialize()
 
   SystemWideEventPublisher::GetInstance().PublishEvent(Event("ProgramStart"));
 
+  // Count the ranks sharing this rank's node, which split the node's cores between them
+  MPI_Comm node_comm;
+  MPI_Comm_split_type(mpi_comm, MPI_COMM_TYPE_SHARED, mpi_comm.rank(), MPI_INFO_NULL, &node_comm);
+  MPI_Comm_size(node_comm, &num_ranks_on_node);
+  MPI_Comm_free(&node_comm);
+
   // Disable internal HDF error reporting
   H5Eset_auto2(H5E_DEFAULT, NULL, NULL);
 
@@ -66,6 +74,8 @@ void
 Finalize()
 {
   SystemWideEventPublisher::GetInstance().PublishEvent(Event("ProgramExecuted"));
+  EventTrace::GetInstance().Finalize();
+  log.Flush();
   mesh_stack.clear();
   surface_mesh_stack.clear();
   field_func_interpolation_stack.clear();
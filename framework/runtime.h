@@ -67,6 +67,9 @@ const size_t SIZE_T_INVALID = ((size_t)-1);
 extern bool suppress_color;
 extern std::filesystem::path input_path;
 
+/** Number of ranks sharing the node of this rank. Set by Initialize. */
+extern int num_ranks_on_node;
+
 /**Customized exceptions.*/
 class RecoverableException : public std::runtime_error
 {
@@ -0,0 +1,168 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#include "framework/utils/event_trace.h"
+#include "framework/logging/log.h"
+#include "framework/runtime.h"
+#include <fstream>
+#include <iomanip>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+
+namespace opensn
+{
+
+EventTrace&
+EventTrace::GetInstance() noexcept
+{
+  static EventTrace instance;
+  return instance;
+}
+
+void
+EventTrace::Enable(size_t capacity, const std::string& file_name)
+{
+  if (capacity == 0)
+    throw std::invalid_argument("EventTrace: The buffer capacity must be positive.");
+
+  buffer_.assign(capacity, Event{});
+  next_ = 0;
+  num_events_ = 0;
+  num_dropped_ = 0;
+  file_name_ = file_name;
+
+  // Align the epochs of all ranks as closely as a barrier allows
+  mpi_comm.barrier();
+  epoch_ = std::chrono::steady_clock::now();
+  enabled_ = true;
+}
+
+void
+EventTrace::Disable()
+{
+  enabled_ = false;
+}
+
+double
+EventTrace::Now() const
+{
+  return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - epoch_)
+    .count();
+}
+
+void
+EventTrace::Record(const char* name,
+                   const char* category,
+                   double start,
+                   double duration,
+                   int64_t id)
+{
+  if (enabled_)
+    Push({name, category, start, duration, id, false});
+}
+
+void
+EventTrace::RecordAsync(const char* name,
+                        const char* category,
+                        double start,
+                        double duration,
+                        int64_t id)
+{
+  if (enabled_)
+    Push({name, category, start, duration, id, true});
+}
+
+void
+EventTrace::Push(const Event& event)
+{
+  buffer_[next_] = event;
+  next_ = (next_ + 1) % buffer_.size();
+  if (num_events_ < buffer_.size())
+    ++num_events_;
+  else
+    ++num_dropped_;
+}
+
+void
+EventTrace::Write(const std::string& file_name)
+{
+  const int rank = mpi_comm.rank();
+
+  // Serialize the local events, oldest first
+  std::stringstream outs;
+  outs << std::fixed << std::setprecision(3);
+  outs << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << rank
+       << ",\"args\":{\"name\":\"rank " << rank << "\"}}";
+  const size_t capacity = buffer_.size();
+  const size_t first = num_events_ < capacity ? 0 : next_;
+  for (size_t e = 0; e < num_events_; ++e)
+  {
+    const auto& event = buffer_[(first + e) % capacity];
+    const std::string prefix = ",\n{\"name\":\"" + std::string(event.name) + "\",\"cat\":\"" +
+                               std::string(event.category) + "\",\"ph\":\"";
+    if (event.async)
+    {
+      // Async events with the same category, name and id form one track
+      outs << prefix << "b\",\"ts\":" << event.start << ",\"pid\":" << rank
+           << ",\"tid\":0,\"id\":" << event.id << "}";
+      outs << prefix << "e\",\"ts\":" << event.start + event.duration << ",\"pid\":" << rank
+           << ",\"tid\":0,\"id\":" << event.id << "}";
+      continue;
+    }
+    outs << prefix << "X\",\"ts\":" << event.start << ",\"dur\":" << event.duration
+         << ",\"pid\":" << rank << ",\"tid\":0";
+    if (event.id >= 0)
+      outs << ",\"args\":{\"id\":" << event.id << "}";
+    outs << "}";
+  }
+  const std::string local_str = outs.str();
+  const std::vector<char> local_chars(local_str.begin(), local_str.end());
+
+  // Gather on rank 0
+  std::vector<int> counts;
+  mpi_comm.all_gather(static_cast<int>(local_chars.size()), counts);
+  std::vector<int> offsets(counts.size(), 0);
+  std::partial_sum(counts.begin(), counts.end() - 1, offsets.begin() + 1);
+  std::vector<char> all_chars;
+  mpi_comm.gather(local_chars, all_chars, counts, offsets, 0);
+
+  size_t total_dropped = 0;
+  mpi_comm.all_reduce(num_dropped_, total_dropped, mpi::op::sum<size_t>());
+
+  if (rank == 0)
+  {
+    std::ofstream file(file_name);
+    if (not file.is_open())
+      throw std::runtime_error("EventTrace: Failed to open \"" + file_name + "\" for writing.");
+
+    file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    for (int r = 0; r < mpi_comm.size(); ++r)
+    {
+      if (r > 0)
+        file << ",\n";
+      file.write(all_chars.data() + offsets[r], counts[r]);
+    }
+    file << "\n]}\n";
+  }
+
+  log.Log() << "Event trace written to \"" << file_name << "\"."
+            << (total_dropped > 0
+                  ? " " + std::to_string(total_dropped) +
+                      " events were dropped because the buffers were full."
+                  : "");
+
+  next_ = 0;
+  num_events_ = 0;
+  num_dropped_ = 0;
+}
+
+void
+EventTrace::Finalize()
+{
+  if (not file_name_.empty() and not buffer_.empty())
+    Write(file_name_);
+  enabled_ = false;
+}
+
+} // namespace opensn
@@ -0,0 +1,132 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace opensn
+{
+
+/**
+ * Low-overhead recorder of timestamped events for timeline analysis.
+ *
+ * Every rank records events into a fixed-capacity ring buffer. When the buffer is full the oldest
+ * events are overwritten. Recording is a no-op unless the trace is enabled. The events of all
+ * ranks can be merged into a Chrome trace (JSON) file, viewable with Perfetto or
+ * chrome://tracing, in which every rank is shown as a separate process. Events recorded with
+ * Record must nest properly on a rank. Intervals that overlap other events, such as the wait of
+ * one angle set while others execute, are recorded with RecordAsync and shown on their own tracks.
+ */
+class EventTrace
+{
+public:
+  struct Event
+  {
+    const char* name;     ///< Event name. Must be a string literal.
+    const char* category; ///< Event category. Must be a string literal.
+    double start;         ///< Start time in microseconds since the trace epoch
+    double duration;      ///< Duration in microseconds
+    int64_t id;           ///< Optional argument, e.g. an angle set id, or -1
+    bool async;           ///< Written as an async begin/end pair keyed by the id
+  };
+
+  /**Access to the singleton.*/
+  static EventTrace& GetInstance() noexcept;
+
+  /**
+   * Clears the buffers, resets the epoch and enables recording with a ring buffer of `capacity`
+   * events per rank. When a file name is given the trace is written to it when the program
+   * finalizes. Must be called on all ranks.
+   */
+  void Enable(size_t capacity, const std::string& file_name = "");
+
+  /**Disables recording. Recorded events are kept.*/
+  void Disable();
+
+  bool IsEnabled() const { return enabled_; }
+
+  /**Returns the time in microseconds since the trace epoch.*/
+  double Now() const;
+
+  /**Records an event if the trace is enabled.*/
+  void Record(const char* name,
+              const char* category,
+              double start,
+              double duration,
+              int64_t id = -1);
+
+  /**Records an interval that may overlap other events on this rank if the trace is enabled. It
+   * is written as an async begin/end pair keyed by `id`.*/
+  void RecordAsync(const char* name,
+                   const char* category,
+                   double start,
+                   double duration,
+                   int64_t id);
+
+  /**Returns the number of events currently held on this rank.*/
+  size_t NumEvents() const { return num_events_; }
+
+  /**Returns the number of events on this rank that were overwritten because the buffer was
+   * full.*/
+  size_t NumDropped() const { return num_dropped_; }
+
+  /**
+   * Merges the events of all ranks into a Chrome trace file written by rank 0 and clears the
+   * buffers. Must be called on all ranks.
+   */
+  void Write(const std::string& file_name);
+
+  /**Writes the trace to the file name given to Enable, if any. Called at program finalization.*/
+  void Finalize();
+
+private:
+  EventTrace() = default;
+
+  void Push(const Event& event);
+
+  bool enabled_ = false;
+  std::string file_name_;
+  std::chrono::steady_clock::time_point epoch_;
+  std::vector<Event> buffer_;
+  size_t next_ = 0;
+  size_t num_events_ = 0;
+  size_t num_dropped_ = 0;
+};
+
+/**Records an event spanning the lifetime of the object if the trace is enabled.*/
+class EventTraceScope
+{
+public:
+  EventTraceScope(const char* name, const char* category, int64_t id = -1)
+    : name_(name),
+      category_(category),
+      id_(id),
+      start_(EventTrace::GetInstance().IsEnabled() ? EventTrace::GetInstance().Now() : -1.0)
+  {
+  }
+
+  ~EventTraceScope()
+  {
+    if (start_ >= 0.0)
+    {
+      auto& trace = EventTrace::GetInstance();
+      trace.Record(name_, category_, start_, trace.Now() - start_, id_);
+    }
+  }
+
+  EventTraceScope(const EventTraceScope&) = delete;
+  EventTraceScope& operator=(const EventTraceScope&) = delete;
+
+private:
+  const char* name_;
+  const char* category_;
+  const int64_t id_;
+  const double start_;
+};
+
+} // namespace opensn
@@ -0,0 +1,169 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#include "framework/utils/memory_registry.h"
+#include "framework/logging/log.h"
+#include "framework/runtime.h"
+#include <sys/resource.h>
+#include <unistd.h>
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <set>
+#include <sstream>
+
+namespace opensn
+{
+
+namespace
+{
+
+constexpr double BYTES_PER_MB = 1024.0 * 1024.0;
+
+} // namespace
+
+MemoryRegistry&
+MemoryRegistry::GetInstance() noexcept
+{
+  static MemoryRegistry instance;
+  return instance;
+}
+
+void
+MemoryRegistry::Set(const std::string& category, const MemoryUsage& usage)
+{
+  auto& entry = entries_[category];
+  entry.usage = usage;
+  entry.peak_bytes = std::max(entry.peak_bytes, usage.bytes);
+}
+
+void
+MemoryRegistry::Add(const std::string& category, const MemoryUsage& usage)
+{
+  auto& entry = entries_[category];
+  entry.usage += usage;
+  entry.peak_bytes = std::max(entry.peak_bytes, entry.usage.bytes);
+}
+
+void
+MemoryRegistry::Release(const std::string& category)
+{
+  auto it = entries_.find(category);
+  if (it != entries_.end())
+    it->second.usage = MemoryUsage{};
+}
+
+size_t
+MemoryRegistry::TotalBytes() const
+{
+  size_t total = 0;
+  for (const auto& [category, entry] : entries_)
+    total += entry.usage.bytes;
+  return total;
+}
+
+void
+MemoryRegistry::PrintReport(const std::string& title) const
+{
+  // Per-rank usage
+  std::stringstream outs;
+  outs << "Memory usage on this rank" << (title.empty() ? "" : " (" + title + ")") << ":\n";
+  for (const auto& [category, entry] : entries_)
+    outs << "  " << std::left << std::setw(40) << category << std::right << std::fixed
+         << std::setprecision(3) << std::setw(12) << entry.usage.bytes / BYTES_PER_MB << " MB  "
+         << std::setw(8) << entry.usage.num_allocations << " allocations  peak " << std::setw(12)
+         << entry.peak_bytes / BYTES_PER_MB << " MB\n";
+  log.LogAllVerbose1() << outs.str();
+
+  // Summary over all ranks
+  std::vector<std::pair<std::string, size_t>> bytes;
+  for (const auto& [category, entry] : entries_)
+    bytes.emplace_back(category, entry.usage.bytes);
+  bytes.emplace_back("Registered total", TotalBytes());
+  bytes.emplace_back("Resident set size high-water mark", PeakResidentSetSize());
+  PrintSummary(title, bytes);
+}
+
+void
+MemoryRegistry::PrintSummary(const std::string& title,
+                             const std::vector<std::pair<std::string, size_t>>& bytes)
+{
+  // Gather the categories of all ranks
+  std::vector<char> local_names;
+  for (const auto& [category, value] : bytes)
+  {
+    local_names.insert(local_names.end(), category.begin(), category.end());
+    local_names.push_back('\0');
+  }
+  std::vector<char> all_names;
+  mpi_comm.all_gather(local_names, all_names);
+
+  // Categories are ordered by first appearance in rank order, which is identical on all ranks
+  std::vector<std::string> categories;
+  {
+    std::set<std::string> unique_names;
+    size_t begin = 0;
+    for (size_t i = 0; i < all_names.size(); ++i)
+      if (all_names[i] == '\0')
+      {
+        std::string name(&all_names[begin], i - begin);
+        if (unique_names.insert(name).second)
+          categories.push_back(name);
+        begin = i + 1;
+      }
+  }
+
+  // Reduce
+  const size_t num_categories = categories.size();
+  std::vector<double> local_values(num_categories, 0.0);
+  for (const auto& [category, value] : bytes)
+  {
+    const auto c = std::find(categories.begin(), categories.end(), category) - categories.begin();
+    local_values[c] = static_cast<double>(value) / BYTES_PER_MB;
+  }
+  std::vector<double> min_values(num_categories, 0.0);
+  std::vector<double> max_values(num_categories, 0.0);
+  std::vector<double> sum_values(num_categories, 0.0);
+  const int n = static_cast<int>(num_categories);
+  mpi_comm.all_reduce(local_values.data(), n, min_values.data(), mpi::op::min<double>());
+  mpi_comm.all_reduce(local_values.data(), n, max_values.data(), mpi::op::max<double>());
+  mpi_comm.all_reduce(local_values.data(), n, sum_values.data(), mpi::op::sum<double>());
+
+  std::stringstream outs;
+  outs << "Memory summary over " << mpi_comm.size() << " ranks"
+       << (title.empty() ? "" : " (" + title + ")") << ":\n"
+       << "  " << std::left << std::setw(40) << "Category" << std::right << std::setw(14)
+       << "Min (MB)" << std::setw(14) << "Max (MB)" << std::setw(14) << "Avg (MB)" << "\n";
+  for (size_t c = 0; c < num_categories; ++c)
+    outs << "  " << std::left << std::setw(40) << categories[c] << std::right << std::fixed
+         << std::setprecision(3) << std::setw(14) << min_values[c] << std::setw(14)
+         << max_values[c] << std::setw(14) << sum_values[c] / mpi_comm.size() << "\n";
+  log.Log() << outs.str();
+}
+
+size_t
+MemoryRegistry::CurrentResidentSetSize()
+{
+  // The second field of statm is the number of resident pages
+  std::ifstream statm("/proc/self/statm");
+  size_t total_pages = 0;
+  size_t resident_pages = 0;
+  if (statm >> total_pages >> resident_pages)
+    return resident_pages * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  return 0;
+}
+
+size_t
+MemoryRegistry::PeakResidentSetSize()
+{
+  rusage usage{};
+  if (getrusage(RUSAGE_SELF, &usage) != 0)
+    return 0;
+#ifdef __APPLE__
+  return static_cast<size_t>(usage.ru_maxrss);
+#else
+  return static_cast<size_t>(usage.ru_maxrss) * 1024;
+#endif
+}
+
+} // namespace opensn
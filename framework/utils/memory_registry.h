@@ -0,0 +1,110 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace opensn
+{
+
+/**Byte and allocation counts of a block of memory.*/
+struct MemoryUsage
+{
+  size_t bytes = 0;
+  size_t num_allocations = 0;
+
+  MemoryUsage& operator+=(const MemoryUsage& other)
+  {
+    bytes += other.bytes;
+    num_allocations += other.num_allocations;
+    return *this;
+  }
+};
+
+/**Returns the heap memory held by a vector.*/
+template <typename T>
+MemoryUsage
+GetMemoryUsage(const std::vector<T>& vec)
+{
+  return {vec.capacity() * sizeof(T), vec.capacity() > 0 ? size_t{1} : size_t{0}};
+}
+
+/**Returns the heap memory held by a nested vector, including the inner vectors.*/
+template <typename T>
+MemoryUsage
+GetMemoryUsage(const std::vector<std::vector<T>>& vec)
+{
+  MemoryUsage usage = {vec.capacity() * sizeof(std::vector<T>),
+                       vec.capacity() > 0 ? size_t{1} : size_t{0}};
+  for (const auto& inner : vec)
+    usage += GetMemoryUsage(inner);
+  return usage;
+}
+
+/**
+ * Registry of the memory held by the subsystems of a simulation.
+ *
+ * Subsystems report byte and allocation counts under a category name, for example
+ * "solver_name/psi". The registry keeps a high-water mark per category and produces a per-rank
+ * report and a parallel min/max/avg summary.
+ */
+class MemoryRegistry
+{
+public:
+  struct Entry
+  {
+    MemoryUsage usage;
+    size_t peak_bytes = 0; ///< High-water mark of the bytes of the category
+  };
+
+  /**Access to the singleton.*/
+  static MemoryRegistry& GetInstance() noexcept;
+
+  /**Sets the usage of a category, replacing any previously reported usage.*/
+  void Set(const std::string& category, const MemoryUsage& usage);
+
+  /**Adds to the usage of a category.*/
+  void Add(const std::string& category, const MemoryUsage& usage);
+
+  /**Resets the usage of a category to zero. The high-water mark is kept.*/
+  void Release(const std::string& category);
+
+  /**Returns the registered categories.*/
+  const std::map<std::string, Entry>& Entries() const { return entries_; }
+
+  /**Returns the total bytes currently registered on this rank.*/
+  size_t TotalBytes() const;
+
+  /**
+   * Prints the registered usage of each category. The usage of every rank is printed at
+   * verbosity level 1, followed by a min/max/avg summary over all ranks together with the
+   * registered total and the resident set size high-water mark. Must be called on all ranks.
+   */
+  void PrintReport(const std::string& title = "") const;
+
+  /**
+   * Prints a min/max/avg summary over all ranks of per-rank byte counts, for example memory
+   * estimates, in the given order. Categories may differ between ranks. Must be called on all
+   * ranks.
+   */
+  static void PrintSummary(const std::string& title,
+                           const std::vector<std::pair<std::string, size_t>>& bytes);
+
+  /**Returns the current resident set size of this process in bytes, or 0 if unavailable.*/
+  static size_t CurrentResidentSetSize();
+
+  /**Returns the peak resident set size of this process in bytes, or 0 if unavailable.*/
+  static size_t PeakResidentSetSize();
+
+private:
+  MemoryRegistry() = default;
+
+  std::map<std::string, Entry> entries_;
+};
+
+} // namespace opensn
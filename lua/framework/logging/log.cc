@@ -13,6 +13,7 @@ namespace opensnlua
 {
 RegisterLuaFunctionInNamespace(LogSetVerbosity, log, SetVerbosity);
 RegisterLuaFunctionInNamespace(LogLog, log, Log);
+RegisterLuaFunctionInNamespace(LogSetFileSink, log, SetFileSink);
 
 RegisterLuaConstant(LOG_0, Varying(1));
 RegisterLuaConstant(LOG_0WARNING, Varying(2));
@@ -40,6 +41,16 @@ LogSetVerbosity(lua_State* L)
   return LuaReturn(L);
 }
 
+int
+LogSetFileSink(lua_State* L)
+{
+  const std::string fname = "log.SetFileSink";
+  LuaCheckArgs<std::string>(L, fname);
+  auto file_prefix = LuaArg<std::string>(L, 1);
+  opensn::log.SetFileSink(file_prefix);
+  return LuaReturn(L);
+}
+
 int
 LogLog(lua_State* L)
 {
@@ -18,6 +18,19 @@ namespace opensnlua
  */
 int LogSetVerbosity(lua_State* L);
 
+/**
+ * Writes the logs of all locations (LOG_ALL, LOG_ALLWARNING and
+ * LOG_ALLVERBOSE_x) to the file `<file_prefix>_<location>.log` of each
+ * location instead of the console. The files are written by a background
+ * thread. Errors are still written to the console.
+ *
+ * \param file_prefix string Prefix of the log files. An empty string closes
+ *                    the files and restores console output.
+ *
+ * \ingroup LuaLogging
+ */
+int LogSetFileSink(lua_State* L);
+
 /**
  * Logs a message depending on the log type specified.
  *
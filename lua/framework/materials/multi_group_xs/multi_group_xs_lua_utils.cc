@@ -18,6 +18,7 @@ RegisterLuaFunctionInNamespace(XSCreate, xs, Create);
 RegisterLuaFunctionInNamespace(XSSet, xs, Set);
 RegisterLuaFunctionInNamespace(XSMakeCombined, xs, MakeCombined);
 RegisterLuaFunctionInNamespace(XSSetCombined, xs, SetCombined);
+RegisterLuaFunctionInNamespace(XSMakeTabulated, xs, MakeTabulated);
 RegisterLuaFunctionInNamespace(XSMakeScaled, xs, MakeScaled);
 RegisterLuaFunctionInNamespace(XSSetScalingFactor, xs, SetScalingFactor);
 RegisterLuaFunctionInNamespace(XSGet, xs, Get);
@@ -179,9 +180,17 @@ XSSet(lua_State* L)
   {
     LuaCheckArgs<int, int, std::string, std::string>(L, fname);
     auto file_name = LuaArg<std::string>(L, 3);
-    auto temperature = LuaArg<double>(L, 4);
     const auto xs_data_name = LuaArgOptional<std::string>(L, 5, "set1");
-    xs->Initialize(file_name, xs_data_name, temperature);
+    if (lua_istable(L, 4))
+    {
+      auto temperatures = LuaArg<std::vector<double>>(L, 4);
+      xs->Initialize(file_name, xs_data_name, temperatures);
+    }
+    else
+    {
+      auto temperature = LuaArg<double>(L, 4);
+      xs->Initialize(file_name, xs_data_name, temperature);
+    }
   }
   else
   {
@@ -335,6 +344,36 @@ XSSetCombined(lua_State* L)
   return LuaReturn(L);
 }
 
+int
+XSMakeTabulated(lua_State* L)
+{
+  const std::string fname = "xs.MakeTabulated";
+  LuaCheckArgs<std::vector<double>, std::vector<int>>(L, fname);
+
+  const auto temperatures = LuaArg<std::vector<double>>(L, 1);
+  const auto handles = LuaArg<std::vector<int>>(L, 2);
+
+  std::vector<std::shared_ptr<MultiGroupXS>> xsecs;
+  for (const auto& handle : handles)
+  {
+    try
+    {
+      xsecs.push_back(opensn::GetStackItemPtr(opensn::multigroup_xs_stack, handle));
+    }
+    catch (const std::out_of_range& o)
+    {
+      OpenSnInvalidArgument("Invalid handle for cross sections in call to " + fname + ".");
+    }
+  }
+
+  auto new_xs = std::make_shared<MultiGroupXS>();
+  new_xs->Initialize(temperatures, xsecs);
+
+  opensn::multigroup_xs_stack.push_back(new_xs);
+  auto num_xs = opensn::multigroup_xs_stack.size();
+  return LuaReturn(L, num_xs - 1);
+}
+
 int
 XSMakeScaled(lua_State* L)
 {
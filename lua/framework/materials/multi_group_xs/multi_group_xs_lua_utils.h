@@ -57,6 +57,12 @@ int XSCreate(lua_State* L);
  * Loads transport cross sections from OpenSn cross-section files. Expects
  * to be followed by a filepath specifying the xs-file.
  *
+ * OPENMC_XSLIB\n
+ * Loads transport cross sections from an OpenMC multigroup library. Expects
+ * a filepath, a temperature and optionally the dataset name. When the
+ * temperature is a table of temperatures, a temperature-tabulated cross
+ * section is created.
+ *
  *
  * ##_
  * ### Example
@@ -143,6 +149,33 @@ int XSMakeCombined(lua_State* L);
  */
 int XSSetCombined(lua_State* L);
 
+/**
+ * Makes a temperature-tabulated cross section from cross sections evaluated at different
+ * temperatures. Transport solvers interpolate tabulated cross sections at the cell temperatures
+ * set with `lbs.SetCellTemperatures`.
+ *
+ *  \param Temperatures table Strictly increasing table temperatures.
+ *  \param Handles table Handles to the cross sections at each of the temperatures.
+ *
+ *  ## _
+ *
+ * ###Example:
+ * Example lua code:
+ * \code
+ * xs_cold = xs.Create()
+ * xs_hot = xs.Create()
+ * xs.Set(xs_cold, OPENSN_XSFILE, "fuel_300K.xs")
+ * xs.Set(xs_hot, OPENSN_XSFILE, "fuel_900K.xs")
+ *
+ * fuel = xs.MakeTabulated({ 300.0, 900.0 }, { xs_cold, xs_hot })
+ * \endcode
+ *
+ *  \return Returns a handle to the tabulated cross section.
+ *
+ * \ingroup LuaTransportXSs
+ */
+int XSMakeTabulated(lua_State* L);
+
 /**
  * Creates cross sections by scaling other cross sections.
  *
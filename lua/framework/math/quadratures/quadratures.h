@@ -150,4 +150,21 @@ int GetProductQuadrature(lua_State* L);
  */
 int OptimizeAngularQuadratureForPolarSymmetry(lua_State* L);
 
+/** Sets the directory of the persistent cache of the spherical harmonics evaluations the
+ * discrete-to-moment and moment-to-discrete operators of angular quadratures are built from.
+ * Repeated runs with the same quadrature and scattering order read the values from the cache
+ * instead of recomputing them. An empty string disables the cache, which is the default.
+ * Every lookup logs whether the cache file was a hit or a miss.
+ *
+ * \param directory string Path of the cache directory. Created if it does not exist.
+ *
+ *  ###Example:
+ * \code
+ * aquad.SetOperatorCacheDirectory("aquad_cache")
+ * \endcode
+ *
+ * \ingroup LuaQuadrature
+ */
+int SetAngularQuadratureOperatorCacheDirectory(lua_State* L);
+
 } // namespace opensnlua
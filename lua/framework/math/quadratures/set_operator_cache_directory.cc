@@ -0,0 +1,30 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#include "lua/framework/lua.h"
+#include "framework/math/quadratures/angular/angular_quadrature.h"
+#include "lua/framework/console/console.h"
+#include "lua/framework/math/quadratures/quadratures.h"
+
+using namespace opensn;
+
+namespace opensnlua
+{
+
+RegisterLuaFunctionInNamespace(SetAngularQuadratureOperatorCacheDirectory,
+                               aquad,
+                               SetOperatorCacheDirectory);
+
+int
+SetAngularQuadratureOperatorCacheDirectory(lua_State* L)
+{
+  const std::string fname = "aquad.SetOperatorCacheDirectory";
+  LuaCheckArgs<std::string>(L, fname);
+
+  const auto directory = LuaArg<std::string>(L, 1);
+  AngularQuadrature::SetOperatorCacheDirectory(directory);
+
+  return LuaReturn(L);
+}
+
+} // namespace opensnlua
@@ -19,7 +19,8 @@ int MeshExportToOBJ(lua_State* L);
 int MeshExportToPVTU(lua_State* L);
 
 /**
- * Exports the mesh to ExodusII format.
+ * Exports the mesh to ExodusII format. In parallel, every process writes its
+ * local cells to the decomposed file `<file_name>.<n>.<i>`.
  */
 int MeshExportToExodusII(lua_State* L);
 
@@ -0,0 +1,73 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#include "lua/framework/console/console.h"
+#include "lua/framework/lua.h"
+#include "framework/utils/event_trace.h"
+
+using namespace opensn;
+
+namespace opensnlua
+{
+
+/**Enables the event trace. Sweeps record the start and end of angle sets,
+ * the intervals during which angle sets wait on upstream data, the posting of
+ * sends, the receives, the intervals during which the location is blocked
+ * polling for receives and the sweep chunk computations into a ring buffer on
+ * every rank. Must be called on all ranks.
+ *
+ * \param Capacity int Optional. Number of events kept per rank. When the buffer
+ *                     is full the oldest events are overwritten.
+ *                     Default: 1000000.
+ * \param FileName string Optional. When supplied, the trace is written to this
+ *                        file when the program ends.
+ */
+int EnableEventTrace(lua_State* L);
+
+/**Disables the event trace. Recorded events are kept.*/
+int DisableEventTrace(lua_State* L);
+
+/**Merges the recorded events of all ranks into a Chrome trace JSON file, which
+ * can be viewed with Perfetto (ui.perfetto.dev) or chrome://tracing, and
+ * clears the buffers. Must be called on all ranks.
+ *
+ * \param FileName string Name of the file to write.
+ */
+int WriteEventTrace(lua_State* L);
+
+RegisterLuaFunction(EnableEventTrace);
+RegisterLuaFunction(DisableEventTrace);
+RegisterLuaFunction(WriteEventTrace);
+
+int
+EnableEventTrace(lua_State* L)
+{
+  const auto capacity = LuaArgOptional<size_t>(L, 1, 1000000);
+  const auto file_name = LuaArgOptional<std::string>(L, 2, "");
+
+  EventTrace::GetInstance().Enable(capacity, file_name);
+
+  return LuaReturn(L);
+}
+
+int
+DisableEventTrace(lua_State* L)
+{
+  EventTrace::GetInstance().Disable();
+
+  return LuaReturn(L);
+}
+
+int
+WriteEventTrace(lua_State* L)
+{
+  const std::string fname = "WriteEventTrace";
+  LuaCheckArgs<std::string>(L, fname);
+
+  const auto file_name = LuaArg<std::string>(L, 1);
+  EventTrace::GetInstance().Write(file_name);
+
+  return LuaReturn(L);
+}
+
+} // namespace opensnlua
@@ -145,4 +145,28 @@ int LBSComputeFissionRate(lua_State* L);
  */
 int LBSInitializeMaterials(lua_State* L);
 
+/**Sets the temperature of cells. Cells with temperature-tabulated cross
+ * sections are assigned cross sections interpolated at the new temperature.
+ *
+ * \param SolverIndex int Handle to the solver maintaining the information.
+ * \param Temperature double The temperature to set.
+ * \param LogicalVolumeHandle int Optional. Handle to a logical volume. When
+ *                             supplied, only cells with their centroid
+ *                             inside the volume are modified.
+ *
+ * \ingroup LBSLuaFunctions
+ */
+int LBSSetCellTemperatures(lua_State* L);
+
+/**Prints the memory used by the subsystems of the solver (flux moments, angular
+ * fluxes, sweep data structures, unit cell matrices, mesh, boundaries and
+ * acceleration matrices) on each rank, followed by a min/max/avg summary over
+ * all ranks and the resident set size high-water mark.
+ *
+ * \param SolverIndex int Handle to the solver.
+ *
+ * \ingroup LBSLuaFunctions
+ */
+int LBSPrintMemoryReport(lua_State* L);
+
 } // namespace opensnlua::lbs
@@ -3,6 +3,8 @@
 
 #include "lua/modules/linear_bolzmann_solvers/lbs_solver/lbs_common_lua_functions.h"
 #include "modules/linear_boltzmann_solvers/lbs_solver/lbs_solver.h"
+#include "framework/mesh/logical_volume/logical_volume.h"
+#include "framework/mesh/mesh_continuum/mesh_continuum.h"
 #include "framework/runtime.h"
 #include "lua/framework/lua.h"
 #include "lua/framework/console/console.h"
@@ -13,6 +15,7 @@ namespace opensnlua::lbs
 {
 
 RegisterLuaFunctionInNamespace(LBSInitializeMaterials, lbs, InitializeMaterials);
+RegisterLuaFunctionInNamespace(LBSSetCellTemperatures, lbs, SetCellTemperatures);
 
 int
 LBSInitializeMaterials(lua_State* L)
@@ -30,4 +33,45 @@ LBSInitializeMaterials(lua_State* L)
   return LuaReturn(L);
 }
 
+int
+LBSSetCellTemperatures(lua_State* L)
+{
+  const std::string fname = "lbs.SetCellTemperatures";
+  LuaCheckArgs<size_t, double>(L, fname);
+
+  // Get pointer to solver
+  const auto solver_handle = LuaArg<size_t>(L, 1);
+  auto& lbs_solver =
+    opensn::GetStackItem<opensn::lbs::LBSSolver>(opensn::object_stack, solver_handle, fname);
+
+  const auto temperature = LuaArg<double>(L, 2);
+
+  const auto& grid = lbs_solver.Grid();
+  // Cells without a temperature start at the temperature of their cross sections
+  auto temperatures = lbs_solver.CellTemperaturesLocal();
+  if (temperatures.empty())
+  {
+    const auto& matid_to_xs_map = lbs_solver.GetMatID2XSMap();
+    temperatures.resize(grid.local_cells.size());
+    for (const auto& cell : grid.local_cells)
+      temperatures[cell.local_id_] = matid_to_xs_map.at(cell.material_id_)->Temperature();
+  }
+
+  if (lua_gettop(L) >= 3)
+  {
+    const auto volume_handle = LuaArg<size_t>(L, 3);
+    const auto& lv =
+      opensn::GetStackItem<LogicalVolume>(opensn::object_stack, volume_handle, fname);
+    for (const auto& cell : grid.local_cells)
+      if (lv.Inside(cell.centroid_))
+        temperatures[cell.local_id_] = temperature;
+  }
+  else
+    temperatures.assign(grid.local_cells.size(), temperature);
+
+  lbs_solver.SetCellTemperatures(temperatures);
+
+  return LuaReturn(L);
+}
+
 } // namespace opensnlua::lbs
@@ -0,0 +1,31 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#include "lua/modules/linear_bolzmann_solvers/lbs_solver/lbs_common_lua_functions.h"
+#include "modules/linear_boltzmann_solvers/lbs_solver/lbs_solver.h"
+#include "framework/runtime.h"
+#include "lua/framework/lua.h"
+#include "lua/framework/console/console.h"
+
+using namespace opensn;
+
+namespace opensnlua::lbs
+{
+
+RegisterLuaFunctionInNamespace(LBSPrintMemoryReport, lbs, PrintMemoryReport);
+
+int
+LBSPrintMemoryReport(lua_State* L)
+{
+  const std::string fname = "lbs.PrintMemoryReport";
+  LuaCheckArgs<size_t>(L, fname);
+
+  const auto solver_handle = LuaArg<size_t>(L, 1);
+  const auto& lbs_solver =
+    opensn::GetStackItem<opensn::lbs::LBSSolver>(opensn::object_stack, solver_handle, fname);
+
+  lbs_solver.PrintMemoryReport();
+  return 0;
+}
+
+} // namespace opensnlua::lbs
@@ -4,7 +4,9 @@
 #include "lua/modules/linear_bolzmann_solvers/lbs_solver/tools/lbs_bndry_func.h"
 #include "lua/framework/lua.h"
 #include "framework/runtime.h"
+#include "framework/object_factory.h"
 #include "framework/logging/log.h"
+#include "framework/logging/log_exceptions.h"
 #include "lua/framework/console/console.h"
 
 using namespace opensn;
@@ -14,8 +16,59 @@ namespace opensnlua
 namespace lbs
 {
 
+OpenSnRegisterObjectInNamespace(lbs, LuaBoundaryFunction);
+
+InputParameters
+LuaBoundaryFunction::GetInputParameters()
+{
+  InputParameters params = Object::GetInputParameters();
+
+  params.SetGeneralDescription(
+    "Incident angular fluxes of an arbitrary boundary given by lua functions. Either "
+    "\"function_name\" or both \"angular_function_name\" and \"group_function_name\" must be "
+    "supplied.");
+  params.SetDocGroup("LBSUtilities");
+
+  params.AddOptionalParameter("function_name",
+                              "",
+                              "Name of the lua function returning the incident angular fluxes "
+                              "of a face node, angle-major.");
+  params.AddOptionalParameter("angular_function_name",
+                              "",
+                              "Name of the lua function returning the angular factors of a "
+                              "separable boundary, one per quadrature angle.");
+  params.AddOptionalParameter("group_function_name",
+                              "",
+                              "Name of the lua function returning the group factors of a "
+                              "separable boundary, one per group.");
+  params.AddOptionalParameter("time_dependent",
+                              true,
+                              "Flag indicating whether the functions depend on time. The "
+                              "incident fluxes of time-independent functions are evaluated "
+                              "once.");
+
+  return params;
+}
+
+LuaBoundaryFunction::LuaBoundaryFunction(const InputParameters& params)
+  : BoundaryFunction(params),
+    function_name_(params.GetParamValue<std::string>("function_name")),
+    angular_function_name_(params.GetParamValue<std::string>("angular_function_name")),
+    group_function_name_(params.GetParamValue<std::string>("group_function_name")),
+    time_dependent_(params.GetParamValue<bool>("time_dependent"))
+{
+  const bool separable = not angular_function_name_.empty() or not group_function_name_.empty();
+  OpenSnInvalidArgumentIf(function_name_.empty() == not separable,
+                          "Either \"function_name\" or the separable \"angular_function_name\" "
+                          "and \"group_function_name\" must be supplied.");
+  OpenSnInvalidArgumentIf(separable and
+                            (angular_function_name_.empty() or group_function_name_.empty()),
+                          "A separable boundary function requires both "
+                          "\"angular_function_name\" and \"group_function_name\".");
+}
+
 std::vector<double>
-BoundaryFunctionToLua::Evaluate(
+LuaBoundaryFunction::Evaluate(
   size_t cell_global_id,
   int cell_material_id,
   unsigned int face_index,
@@ -28,12 +81,12 @@ BoundaryFunctionToLua::Evaluate(
   const std::vector<int>& group_indices,
   double time)
 {
-  const std::string fname = "LinearBoltzmann::BoundaryFunctionToLua";
+  const std::string fname = "LinearBoltzmann::LuaBoundaryFunction";
 
   // Get lua function
   lua_State* L = console.GetConsoleState();
   auto psi = LuaCall<std::vector<double>>(L,
-                                          m_lua_function_name,
+                                          function_name_,
                                           cell_global_id,
                                           cell_material_id,
                                           face_node_location,
@@ -49,8 +102,8 @@ BoundaryFunctionToLua::Evaluate(
   size_t num_groups = group_indices.size();
 
   if (psi.size() != (num_angles * num_groups))
-    throw std::logic_error(fname + " the returned vector from lua-function, " +
-                           m_lua_function_name + ", did not produce the required size vector. " +
+    throw std::logic_error(fname + " the returned vector from lua-function, " + function_name_ +
+                           ", did not produce the required size vector. " +
                            "The size must equal num_angles*num_groups, " +
                            std::to_string(num_angles * num_groups) + ", but the size is " +
                            std::to_string(psi.size()) + ".");
@@ -58,5 +111,38 @@ BoundaryFunctionToLua::Evaluate(
   return psi;
 }
 
+void
+LuaBoundaryFunction::EvaluateSeparable(
+  size_t cell_global_id,
+  int cell_material_id,
+  unsigned int face_index,
+  unsigned int face_node_index,
+  const Vector3& face_node_location,
+  const Vector3& face_node_normal,
+  const std::vector<Vector3>& quadrature_angle_vectors,
+  const std::vector<std::pair<double, double>>& quadrature_phi_theta_angles,
+  double time,
+  std::vector<double>& angle_factors,
+  std::vector<double>& group_factors)
+{
+  lua_State* L = console.GetConsoleState();
+  angle_factors = LuaCall<std::vector<double>>(L,
+                                               angular_function_name_,
+                                               cell_global_id,
+                                               cell_material_id,
+                                               face_node_location,
+                                               face_node_normal,
+                                               quadrature_angle_vectors,
+                                               quadrature_phi_theta_angles,
+                                               time);
+  group_factors = LuaCall<std::vector<double>>(L,
+                                               group_function_name_,
+                                               cell_global_id,
+                                               cell_material_id,
+                                               face_node_location,
+                                               face_node_normal,
+                                               time);
+}
+
 } // namespace lbs
 } // namespace opensnlua
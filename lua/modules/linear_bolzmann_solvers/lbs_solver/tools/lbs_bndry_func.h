@@ -12,16 +12,23 @@ namespace opensnlua
 namespace lbs
 {
 
-class BoundaryFunctionToLua : public opensn::lbs::BoundaryFunction
+/**
+ * Boundary function calling lua functions for the incident angular fluxes. Either one lua
+ * function returns all angle-group values of a face node, or a separable boundary is given by
+ * an angular function, returning one factor per angle, and a group function, returning one
+ * factor per group.
+ */
+class LuaBoundaryFunction : public opensn::lbs::BoundaryFunction
 {
 private:
-  const std::string m_lua_function_name;
+  const std::string function_name_;
+  const std::string angular_function_name_;
+  const std::string group_function_name_;
+  const bool time_dependent_;
 
 public:
-  explicit BoundaryFunctionToLua(std::string lua_function_name)
-    : m_lua_function_name(std::move(lua_function_name))
-  {
-  }
+  static opensn::InputParameters GetInputParameters();
+  explicit LuaBoundaryFunction(const opensn::InputParameters& params);
 
   std::vector<double>
   Evaluate(size_t cell_global_id,
@@ -35,6 +42,22 @@ public:
            const std::vector<std::pair<double, double>>& quadrature_phi_theta_angles,
            const std::vector<int>& group_indices,
            double time) override;
+
+  bool IsTimeDependent() const override { return time_dependent_; }
+
+  bool IsSeparable() const override { return function_name_.empty(); }
+
+  void EvaluateSeparable(size_t cell_global_id,
+                         int cell_material_id,
+                         unsigned int face_index,
+                         unsigned int face_node_index,
+                         const opensn::Vector3& face_node_location,
+                         const opensn::Vector3& face_node_normal,
+                         const std::vector<opensn::Vector3>& quadrature_angle_vectors,
+                         const std::vector<std::pair<double, double>>& quadrature_phi_theta_angles,
+                         double time,
+                         std::vector<double>& angle_factors,
+                         std::vector<double>& group_factors) override;
 };
 
 } // namespace lbs
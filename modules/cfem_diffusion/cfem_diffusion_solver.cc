@@ -8,6 +8,7 @@
 #include "framework/utils/timer.h"
 #include "framework/math/functions/scalar_spatial_material_function.h"
 #include "framework/mesh/mesh_continuum/mesh_continuum.h"
+#include "framework/math/spatial_discretization/finite_element/finite_element_data.h"
 #include "modules/common/diffusion_bndry.h"
 #include "framework/field_functions/field_function_grid_based.h"
 #include "framework/math/spatial_discretization/finite_element/piecewise_linear/piecewise_linear_continuous.h"
@@ -67,6 +68,8 @@ CFEMSolver::CFEMSolver(const InputParameters& params) : opensn::Solver(params)
 
 CFEMSolver::~CFEMSolver()
 {
+  if (system_assembled_)
+    KSPDestroy(&petsc_solver_.ksp);
   VecDestroy(&x_);
   VecDestroy(&b_);
   MatDestroy(&A_);
@@ -316,175 +319,267 @@ CFEMSolver::Execute()
 {
   log.Log() << "\nExecuting CFEM Diffusion solver";
 
+  // Assemble the system
+  log.Log() << "Assembling system: ";
+  const bool first_assembly = not system_assembled_;
+  const bool matrix_changed = AssembleSystem();
+
+  log.Log() << "Done global assembly";
+
+  // Create Krylov Solver. It is kept across executions so that the preconditioner is only
+  // rebuilt when the matrix changed.
+  log.Log() << "Solving: ";
+  if (first_assembly)
+    petsc_solver_ =
+      CreateCommonKrylovSolverSetup(A_,
+                                    TextName(),
+                                    KSPCG,
+                                    PCGAMG,
+                                    0.0,
+                                    basic_options_("residual_tolerance").FloatValue(),
+                                    basic_options_("max_iters").IntegerValue());
+  else if (matrix_changed)
+    KSPSetOperators(petsc_solver_.ksp, A_, A_);
+
+  // Solve
+  KSPSolve(petsc_solver_.ksp, b_, x_);
+
+  UpdateFieldFunctions();
+
+  log.Log() << "Done solving";
+}
+
+bool
+CFEMSolver::AssembleSystem()
+{
   const auto& grid = *grid_ptr_;
   const auto& sdm = *sdm_ptr_;
 
-  // Assemble the system
-  log.Log() << "Assembling system: ";
+  const bool full_assembly = not system_assembled_;
+  if (full_assembly)
+    cell_coefficients_.assign(grid.local_cells.size(), CellCoefficients{});
+
+  bool local_matrix_changed = false;
+  bool local_rhs_changed = false;
   for (const auto& cell : grid.local_cells)
   {
     const auto& cell_mapping = sdm.GetCellMapping(cell);
-    const auto fe_vol_data = cell_mapping.MakeVolumetricFiniteElementData();
-
     const auto imat = cell.material_id_;
-    const size_t num_nodes = cell_mapping.NumNodes();
-    MatDbl Acell(num_nodes, std::vector<double>(num_nodes, 0.0));
-    std::vector<double> cell_rhs(num_nodes, 0.0);
+    auto& coeffs = cell_coefficients_[cell.local_id_];
 
-    for (size_t i = 0; i < num_nodes; ++i)
+    if (full_assembly)
     {
-      for (size_t j = 0; j < num_nodes; ++j)
+      const auto fe_vol_data = cell_mapping.MakeVolumetricFiniteElementData();
+      coeffs.qp_xyz = fe_vol_data.QPointsXYZ();
+      for (const auto& qp_xyz : coeffs.qp_xyz)
       {
-        double entry_aij = 0.0;
-        for (size_t qp : fe_vol_data.QuadraturePointIndices())
-        {
-          entry_aij += (d_coef_function_->Evaluate(imat, fe_vol_data.QPointXYZ(qp)) *
-                          fe_vol_data.ShapeGrad(i, qp).Dot(fe_vol_data.ShapeGrad(j, qp)) +
-                        sigma_a_function_->Evaluate(imat, fe_vol_data.QPointXYZ(qp)) *
-                          fe_vol_data.ShapeValue(i, qp) * fe_vol_data.ShapeValue(j, qp)) *
-                       fe_vol_data.JxW(qp);
-        } // for qp
-        Acell[i][j] = entry_aij;
-      } // for j
-      for (size_t qp : fe_vol_data.QuadraturePointIndices())
-        cell_rhs[i] += q_ext_function_->Evaluate(imat, fe_vol_data.QPointXYZ(qp)) *
-                       fe_vol_data.ShapeValue(i, qp) * fe_vol_data.JxW(qp);
-    } // for i
-
-    // Flag nodes for being on a boundary
-    std::vector<int> dirichlet_count(num_nodes, 0);
-    std::vector<double> dirichlet_value(num_nodes, 0.0);
+        coeffs.d_coef.push_back(d_coef_function_->Evaluate(imat, qp_xyz));
+        coeffs.sigma_a.push_back(sigma_a_function_->Evaluate(imat, qp_xyz));
+        coeffs.q_ext.push_back(q_ext_function_->Evaluate(imat, qp_xyz));
+      }
+      AssembleCell(cell, fe_vol_data, coeffs.d_coef, coeffs.sigma_a, coeffs.q_ext, true);
+      continue;
+    }
 
-    const size_t num_faces = cell.faces_.size();
-    for (size_t f = 0; f < num_faces; ++f)
+    // Resample the coefficients and form the change since the last assembly. All terms are
+    // linear in the coefficients, so assembling the change updates the system exactly.
+    const size_t num_qps = coeffs.qp_xyz.size();
+    std::vector<double> delta_d(num_qps), delta_sigma(num_qps), delta_q(num_qps);
+    bool cell_matrix_changed = false;
+    bool cell_rhs_changed = false;
+    for (size_t qp = 0; qp < num_qps; ++qp)
     {
-      const auto& face = cell.faces_[f];
-      // not a boundary face
-      if (face.has_neighbor_)
-        continue;
-
-      const auto& bndry = boundaries_[face.neighbor_id_];
+      const auto& qp_xyz = coeffs.qp_xyz[qp];
+      const double d = d_coef_function_->Evaluate(imat, qp_xyz);
+      const double sigma = sigma_a_function_->Evaluate(imat, qp_xyz);
+      const double q = q_ext_function_->Evaluate(imat, qp_xyz);
+      delta_d[qp] = d - coeffs.d_coef[qp];
+      delta_sigma[qp] = sigma - coeffs.sigma_a[qp];
+      delta_q[qp] = q - coeffs.q_ext[qp];
+      cell_matrix_changed |= (delta_d[qp] != 0.0) or (delta_sigma[qp] != 0.0);
+      cell_rhs_changed |= (delta_q[qp] != 0.0);
+      coeffs.d_coef[qp] = d;
+      coeffs.sigma_a[qp] = sigma;
+      coeffs.q_ext[qp] = q;
+    }
+    if (not(cell_matrix_changed or cell_rhs_changed))
+      continue;
 
-      // Robin boundary
-      if (bndry.type_ == BoundaryType::Robin)
-      {
-        const auto fe_srf_data = cell_mapping.MakeSurfaceFiniteElementData(f);
-        const size_t num_face_nodes = face.vertex_ids_.size();
-
-        const auto& aval = bndry.values_[0];
-        const auto& bval = bndry.values_[1];
-        const auto& fval = bndry.values_[2];
-
-        log.Log0Verbose1() << "Boundary  set as Robin with a,b,f = (" << aval << "," << bval << ","
-                           << fval << ") ";
-        // true Robin when a!=0, otherwise, it is a Neumann:
-        // Assert if b=0
-        if (std::fabs(bval) < 1e-8)
-          throw std::logic_error("if b=0, this is a Dirichlet BC, not a Robin BC");
-
-        // loop over nodes of that face
-        for (size_t fi = 0; fi < num_face_nodes; ++fi)
-        {
-          const uint i = cell_mapping.MapFaceNode(f, fi);
+    local_matrix_changed |= cell_matrix_changed;
+    local_rhs_changed = true;
+    const auto fe_vol_data = cell_mapping.MakeVolumetricFiniteElementData();
+    AssembleCell(cell, fe_vol_data, delta_d, delta_sigma, delta_q, false);
+  } // for cell
 
-          double entry_rhsi = 0.0;
-          for (size_t qp : fe_srf_data.QuadraturePointIndices())
-            entry_rhsi += fe_srf_data.ShapeValue(i, qp) * fe_srf_data.JxW(qp);
-          cell_rhs[i] += fval / bval * entry_rhsi;
+  bool global_matrix_changed = true;
+  bool global_rhs_changed = true;
+  if (not full_assembly)
+  {
+    mpi_comm.all_reduce(local_matrix_changed, global_matrix_changed, mpi::op::logical_or<bool>());
+    mpi_comm.all_reduce(local_rhs_changed, global_rhs_changed, mpi::op::logical_or<bool>());
+  }
 
-          // only do this part if true Robin (i.e., a!=0)
-          if (std::fabs(aval) > 1.0e-8)
-          {
-            for (size_t fj = 0; fj < num_face_nodes; ++fj)
-            {
-              const uint j = cell_mapping.MapFaceNode(f, fj);
-
-              double entry_aij = 0.0;
-              for (size_t qp : fe_srf_data.QuadraturePointIndices())
-                entry_aij += fe_srf_data.ShapeValue(i, qp) * fe_srf_data.ShapeValue(j, qp) *
-                             fe_srf_data.JxW(qp);
-              Acell[i][j] += aval / bval * entry_aij;
-            } // for fj
-          }   // end true Robin
-        }     // for fi
-      }       // if Robin
-
-      // Dirichlet boundary
-      if (bndry.type_ == BoundaryType::Dirichlet)
-      {
-        const size_t num_face_nodes = face.vertex_ids_.size();
+  log.Log() << "Global assembly";
 
-        const auto& boundary_value = bndry.values_[0];
+  if (global_matrix_changed)
+  {
+    MatAssemblyBegin(A_, MAT_FINAL_ASSEMBLY);
+    MatAssemblyEnd(A_, MAT_FINAL_ASSEMBLY);
+  }
+  if (global_rhs_changed)
+  {
+    VecAssemblyBegin(b_);
+    VecAssemblyEnd(b_);
+  }
 
-        // loop over nodes of that face
-        for (size_t fi = 0; fi < num_face_nodes; ++fi)
-        {
-          const uint i = cell_mapping.MapFaceNode(f, fi);
-          dirichlet_count[i] += 1;
-          dirichlet_value[i] += boundary_value;
-        } // for fi
-      }   // if Dirichlet
+  system_assembled_ = true;
+  return global_matrix_changed;
+}
 
-    } // for face f
+void
+CFEMSolver::AssembleCell(const Cell& cell,
+                         const VolumetricFiniteElementData& fe_vol_data,
+                         const std::vector<double>& d_coef,
+                         const std::vector<double>& sigma_a,
+                         const std::vector<double>& q_ext,
+                         const bool with_boundary_terms)
+{
+  const auto& sdm = *sdm_ptr_;
+  const auto& cell_mapping = sdm.GetCellMapping(cell);
+  const size_t num_nodes = cell_mapping.NumNodes();
 
-    // Develop node mapping
-    std::vector<int64_t> imap(num_nodes, 0); // node-mapping
-    for (size_t i = 0; i < num_nodes; ++i)
-      imap[i] = sdm.MapDOF(cell, i);
+  // Element matrix and source, stored row-major for blocked insertion
+  std::vector<double> Acell(num_nodes * num_nodes, 0.0);
+  std::vector<double> cell_rhs(num_nodes, 0.0);
 
-    // Assembly into system
+  for (size_t qp : fe_vol_data.QuadraturePointIndices())
+  {
+    const double JxW = fe_vol_data.JxW(qp);
     for (size_t i = 0; i < num_nodes; ++i)
     {
-      if (dirichlet_count[i] > 0) // if Dirichlet boundary node
-      {
-        MatSetValue(A_, imap[i], imap[i], 1.0, ADD_VALUES);
-        // because we use CFEM, a given node is common to several faces
-        const double aux = dirichlet_value[i] / dirichlet_count[i];
-        VecSetValue(b_, imap[i], aux, ADD_VALUES);
-      }
-      else
-      {
-        for (size_t j = 0; j < num_nodes; ++j)
-        {
-          if (dirichlet_count[j] == 0) // not related to a dirichlet node
-            MatSetValue(A_, imap[i], imap[j], Acell[i][j], ADD_VALUES);
-          else
-          {
-            const double aux = dirichlet_value[j] / dirichlet_count[j];
-            cell_rhs[i] -= Acell[i][j] * aux;
-          }
-        } // for j
-        VecSetValue(b_, imap[i], cell_rhs[i], ADD_VALUES);
-      }
+      const double shape_i = fe_vol_data.ShapeValue(i, qp);
+      const auto grad_i = fe_vol_data.ShapeGrad(i, qp);
+      for (size_t j = 0; j < num_nodes; ++j)
+        Acell[i * num_nodes + j] +=
+          (d_coef[qp] * grad_i.Dot(fe_vol_data.ShapeGrad(j, qp)) +
+           sigma_a[qp] * shape_i * fe_vol_data.ShapeValue(j, qp)) *
+          JxW;
+      cell_rhs[i] += q_ext[qp] * shape_i * JxW;
     } // for i
-  }   // for cell
+  }   // for qp
 
-  log.Log() << "Global assembly";
+  // Flag nodes for being on a boundary
+  std::vector<int> dirichlet_count(num_nodes, 0);
+  std::vector<double> dirichlet_value(num_nodes, 0.0);
 
-  MatAssemblyBegin(A_, MAT_FINAL_ASSEMBLY);
-  MatAssemblyEnd(A_, MAT_FINAL_ASSEMBLY);
-  VecAssemblyBegin(b_);
-  VecAssemblyEnd(b_);
+  const size_t num_faces = cell.faces_.size();
+  for (size_t f = 0; f < num_faces; ++f)
+  {
+    const auto& face = cell.faces_[f];
+    // not a boundary face
+    if (face.has_neighbor_)
+      continue;
 
-  log.Log() << "Done global assembly";
+    const auto& bndry = boundaries_[face.neighbor_id_];
 
-  // Create Krylov Solver
-  log.Log() << "Solving: ";
-  auto petsc_solver =
-    CreateCommonKrylovSolverSetup(A_,
-                                  TextName(),
-                                  KSPCG,
-                                  PCGAMG,
-                                  0.0,
-                                  basic_options_("residual_tolerance").FloatValue(),
-                                  basic_options_("max_iters").IntegerValue());
+    // Robin boundary
+    if (bndry.type_ == BoundaryType::Robin and with_boundary_terms)
+    {
+      const auto fe_srf_data = cell_mapping.MakeSurfaceFiniteElementData(f);
+      const size_t num_face_nodes = face.vertex_ids_.size();
+
+      const auto& aval = bndry.values_[0];
+      const auto& bval = bndry.values_[1];
+      const auto& fval = bndry.values_[2];
+
+      log.Log0Verbose1() << "Boundary  set as Robin with a,b,f = (" << aval << "," << bval << ","
+                         << fval << ") ";
+      // true Robin when a!=0, otherwise, it is a Neumann:
+      // Assert if b=0
+      if (std::fabs(bval) < 1e-8)
+        throw std::logic_error("if b=0, this is a Dirichlet BC, not a Robin BC");
+
+      // loop over nodes of that face
+      for (size_t fi = 0; fi < num_face_nodes; ++fi)
+      {
+        const uint i = cell_mapping.MapFaceNode(f, fi);
 
-  // Solve
-  KSPSolve(petsc_solver.ksp, b_, x_);
+        double entry_rhsi = 0.0;
+        for (size_t qp : fe_srf_data.QuadraturePointIndices())
+          entry_rhsi += fe_srf_data.ShapeValue(i, qp) * fe_srf_data.JxW(qp);
+        cell_rhs[i] += fval / bval * entry_rhsi;
 
-  UpdateFieldFunctions();
+        // only do this part if true Robin (i.e., a!=0)
+        if (std::fabs(aval) > 1.0e-8)
+        {
+          for (size_t fj = 0; fj < num_face_nodes; ++fj)
+          {
+            const uint j = cell_mapping.MapFaceNode(f, fj);
+
+            double entry_aij = 0.0;
+            for (size_t qp : fe_srf_data.QuadraturePointIndices())
+              entry_aij += fe_srf_data.ShapeValue(i, qp) * fe_srf_data.ShapeValue(j, qp) *
+                           fe_srf_data.JxW(qp);
+            Acell[i * num_nodes + j] += aval / bval * entry_aij;
+          } // for fj
+        }   // end true Robin
+      }     // for fi
+    }       // if Robin
+
+    // Dirichlet boundary
+    if (bndry.type_ == BoundaryType::Dirichlet)
+    {
+      const size_t num_face_nodes = face.vertex_ids_.size();
 
-  log.Log() << "Done solving";
+      const auto& boundary_value = bndry.values_[0];
+
+      // loop over nodes of that face
+      for (size_t fi = 0; fi < num_face_nodes; ++fi)
+      {
+        const uint i = cell_mapping.MapFaceNode(f, fi);
+        dirichlet_count[i] += 1;
+        dirichlet_value[i] += boundary_value;
+      } // for fi
+    }   // if Dirichlet
+
+  } // for face f
+
+  // Develop node mapping
+  std::vector<int64_t> imap(num_nodes, 0); // node-mapping
+  for (size_t i = 0; i < num_nodes; ++i)
+    imap[i] = sdm.MapDOF(cell, i);
+
+  // Impose Dirichlet nodes: their rows become identity rows and their columns are lifted to the
+  // right-hand side
+  for (size_t i = 0; i < num_nodes; ++i)
+  {
+    if (dirichlet_count[i] > 0) // if Dirichlet boundary node
+    {
+      std::fill_n(Acell.begin() + i * num_nodes, num_nodes, 0.0);
+      // because we use CFEM, a given node is common to several faces
+      if (with_boundary_terms)
+      {
+        Acell[i * num_nodes + i] = 1.0;
+        cell_rhs[i] = dirichlet_value[i] / dirichlet_count[i];
+      }
+      else
+        cell_rhs[i] = 0.0;
+      continue;
+    }
+    for (size_t j = 0; j < num_nodes; ++j)
+    {
+      if (dirichlet_count[j] == 0) // not related to a dirichlet node
+        continue;
+      const double aux = dirichlet_value[j] / dirichlet_count[j];
+      cell_rhs[i] -= Acell[i * num_nodes + j] * aux;
+      Acell[i * num_nodes + j] = 0.0;
+    } // for j
+  }   // for i
+
+  // Assembly into system
+  const auto n = static_cast<int64_t>(num_nodes);
+  MatSetValues(A_, n, imap.data(), n, imap.data(), Acell.data(), ADD_VALUES);
+  VecSetValues(b_, n, imap.data(), cell_rhs.data(), ADD_VALUES);
 }
 
 void
@@ -10,12 +10,14 @@
 #include <map>
 
 #include "framework/mesh/mesh.h"
+#include "framework/mesh/mesh_vector.h"
 
 namespace opensn
 {
 class MeshContinuum;
 class SpatialDiscretization;
 class ScalarSpatialMaterialFunction;
+class VolumetricFiniteElementData;
 
 namespace diffusion
 {
@@ -51,6 +53,34 @@ private:
   typedef std::pair<opensn::diffusion::BoundaryType, std::vector<double>> BoundaryInfo;
   typedef std::map<std::string, BoundaryInfo> BoundaryPreferences;
 
+  /// Coefficient samples at the quadrature points of a local cell, as last assembled.
+  struct CellCoefficients
+  {
+    std::vector<Vector3> qp_xyz;
+    std::vector<double> d_coef;
+    std::vector<double> sigma_a;
+    std::vector<double> q_ext;
+  };
+
+  /**
+   * Assembles the system. The first call assembles all cell contributions. Subsequent calls
+   * resample the coefficient functions and only add the change in the coefficient-dependent
+   * terms of cells whose samples differ. Returns true if the matrix changed.
+   */
+  bool AssembleSystem();
+
+  /**
+   * Adds the contributions of a cell, weighted by the given coefficient samples, to the system.
+   * The boundary condition terms do not depend on the coefficients and are only added when
+   * `with_boundary_terms` is true.
+   */
+  void AssembleCell(const Cell& cell,
+                    const VolumetricFiniteElementData& fe_vol_data,
+                    const std::vector<double>& d_coef,
+                    const std::vector<double>& sigma_a,
+                    const std::vector<double>& q_ext,
+                    bool with_boundary_terms);
+
   std::shared_ptr<MeshContinuum> grid_ptr_ = nullptr;
 
   std::shared_ptr<SpatialDiscretization> sdm_ptr_ = nullptr;
@@ -73,6 +103,10 @@ private:
   std::shared_ptr<ScalarSpatialMaterialFunction> sigma_a_function_;
   std::shared_ptr<ScalarSpatialMaterialFunction> q_ext_function_;
 
+  std::vector<CellCoefficients> cell_coefficients_;
+  bool system_assembled_ = false;
+  PETScSolverSetup petsc_solver_;
+
 public:
   static InputParameters GetInputParameters();
   static InputParameters OptionsBlock();
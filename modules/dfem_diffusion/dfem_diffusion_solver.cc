@@ -7,6 +7,7 @@
 #include "framework/logging/log.h"
 #include "framework/utils/timer.h"
 #include "framework/mesh/mesh_continuum/mesh_continuum.h"
+#include "framework/math/spatial_discretization/finite_element/finite_element_data.h"
 #include "modules/common/diffusion_bndry.h"
 #include "framework/field_functions/field_function_grid_based.h"
 #include "framework/math/spatial_discretization/finite_element/piecewise_linear/piecewise_linear_discontinuous.h"
@@ -67,6 +68,8 @@ DFEMSolver::DFEMSolver(const InputParameters& params) : opensn::Solver(params)
 
 DFEMSolver::~DFEMSolver()
 {
+  if (system_assembled_)
+    KSPDestroy(&petsc_solver_.ksp);
   VecDestroy(&x_);
   VecDestroy(&b_);
   MatDestroy(&A_);
@@ -292,7 +295,7 @@ DFEMSolver::Initialize()
 
   std::vector<int64_t> nodal_nnz_in_diag;
   std::vector<int64_t> nodal_nnz_off_diag;
-  sdm.BuildSparsityPattern(nodal_nnz_in_diag, nodal_nnz_off_diag, OneDofPerNode);
+  BuildSparsityPattern(nodal_nnz_in_diag, nodal_nnz_off_diag);
 
   InitMatrixSparsity(A_, nodal_nnz_in_diag, nodal_nnz_off_diag);
 
@@ -317,332 +320,521 @@ DFEMSolver::Execute()
 {
   log.Log() << "\nExecuting DFEM IP Diffusion solver";
 
-  const auto& grid = *grid_ptr_;
   const auto& sdm = *sdm_ptr_;
 
   // Assemble the system
-  // is this needed?
-  VecSet(b_, 0.0);
-
   log.Log() << "Assembling system: ";
+  const bool first_assembly = not system_assembled_;
+  const bool matrix_changed = AssembleSystem();
+
+  log.Log() << "Done global assembly";
+
+  // Create Krylov Solver. It is kept across executions so that the preconditioner is only
+  // rebuilt when the matrix changed.
+  log.Log() << "Solving: ";
+  if (first_assembly)
+    petsc_solver_ =
+      CreateCommonKrylovSolverSetup(A_,
+                                    TextName(),
+                                    KSPCG,
+                                    PCGAMG,
+                                    0.0,
+                                    basic_options_("residual_tolerance").FloatValue(),
+                                    basic_options_("max_iters").IntegerValue());
+  else if (matrix_changed)
+    KSPSetOperators(petsc_solver_.ksp, A_, A_);
+
+  // Solve
+  KSPSolve(petsc_solver_.ksp, b_, x_);
+
+  log.Log() << "Done solving";
+
+  const auto& OneDofPerNode = sdm.UNITARY_UNKNOWN_MANAGER;
+  sdm.LocalizePETScVector(x_, field_, OneDofPerNode);
+
+  field_functions_.front()->UpdateFieldVector(field_);
+}
+
+void
+DFEMSolver::BuildSparsityPattern(std::vector<int64_t>& nodal_nnz_in_diag,
+                                 std::vector<int64_t>& nodal_nnz_off_diag) const
+{
+  const auto& grid = *grid_ptr_;
+  const auto& sdm = *sdm_ptr_;
+
+  nodal_nnz_in_diag.assign(num_local_dofs_, 0);
+  nodal_nnz_off_diag.assign(num_local_dofs_, 0);
 
   for (const auto& cell : grid.local_cells)
   {
     const auto& cell_mapping = sdm.GetCellMapping(cell);
     const size_t num_nodes = cell_mapping.NumNodes();
-    const auto cc_nodes = cell_mapping.GetNodeLocations();
-    const auto fe_vol_data = cell_mapping.MakeVolumetricFiniteElementData();
 
-    const auto imat = cell.material_id_;
-    MatDbl Acell(num_nodes, std::vector<double>(num_nodes, 0.0));
-    std::vector<double> cell_rhs(num_nodes, 0.0);
+    // All nodes of the cell
+    std::vector<int64_t> node_nnz_in(num_nodes, static_cast<int64_t>(num_nodes));
+    std::vector<int64_t> node_nnz_off(num_nodes, 0);
 
-    // Assemble volumetric terms
-    for (size_t i = 0; i < num_nodes; ++i)
+    // Nodes on a face couple to all nodes of the neighbor through the gradient terms of the
+    // neighbor, the other nodes only to the face nodes of the neighbor.
+    for (size_t f = 0; f < cell.faces_.size(); ++f)
     {
-      const int64_t imap = sdm.MapDOF(cell, i);
+      const auto& face = cell.faces_[f];
+      if (not face.has_neighbor_)
+        continue;
 
-      for (size_t j = 0; j < num_nodes; ++j)
-      {
-        const int64_t jmap = sdm.MapDOF(cell, j);
-        double entry_aij = 0.0;
-        for (size_t qp : fe_vol_data.QuadraturePointIndices())
-        {
-          entry_aij += (d_coef_function_->Evaluate(imat, fe_vol_data.QPointXYZ(qp)) *
-                          fe_vol_data.ShapeGrad(i, qp).Dot(fe_vol_data.ShapeGrad(j, qp)) +
-                        sigma_a_function_->Evaluate(imat, fe_vol_data.QPointXYZ(qp)) *
-                          fe_vol_data.ShapeValue(i, qp) * fe_vol_data.ShapeValue(j, qp)) *
-                       fe_vol_data.JxW(qp);
-        } // for qp
-        MatSetValue(A_, imap, jmap, entry_aij, ADD_VALUES);
-      } // for j
-      double entry_rhs_i = 0.0;
-      for (size_t qp : fe_vol_data.QuadraturePointIndices())
-        entry_rhs_i += q_ext_function_->Evaluate(imat, fe_vol_data.QPointXYZ(qp)) *
-                       fe_vol_data.ShapeValue(i, qp) * fe_vol_data.JxW(qp);
-      VecSetValue(b_, imap, entry_rhs_i, ADD_VALUES);
-    } // for i
+      const auto& adj_cell = grid.cells[face.neighbor_id_];
+      const auto& adj_cell_mapping = sdm.GetCellMapping(adj_cell);
+      const size_t acf = MeshContinuum::MapCellFace(cell, adj_cell, f);
+      const auto adj_num_nodes = static_cast<int64_t>(adj_cell_mapping.NumNodes());
+      const auto adj_num_face_nodes = static_cast<int64_t>(adj_cell_mapping.NumFaceNodes(acf));
 
-    // Assemble face terms
-    const size_t num_faces = cell.faces_.size();
-    for (size_t f = 0; f < num_faces; ++f)
+      auto& node_nnz = face.IsNeighborLocal(grid) ? node_nnz_in : node_nnz_off;
+      std::vector<bool> on_face(num_nodes, false);
+      for (size_t fi = 0; fi < cell_mapping.NumFaceNodes(f); ++fi)
+        on_face[cell_mapping.MapFaceNode(f, fi)] = true;
+
+      for (size_t i = 0; i < num_nodes; ++i)
+        node_nnz[i] += on_face[i] ? adj_num_nodes : adj_num_face_nodes;
+    } // for f
+
+    for (size_t i = 0; i < num_nodes; ++i)
     {
-      const auto& face = cell.faces_[f];
-      const auto& n_f = face.normal_;
-      const size_t num_face_nodes = cell_mapping.NumFaceNodes(f);
-      const auto fe_srf_data = cell_mapping.MakeSurfaceFiniteElementData(f);
+      const int64_t ir = sdm.MapDOFLocal(cell, i);
+      nodal_nnz_in_diag[ir] = node_nnz_in[i];
+      nodal_nnz_off_diag[ir] = node_nnz_off[i];
+    }
+  } // for cell
+}
 
-      const double hm = HPerpendicular(cell, f);
+void
+DFEMSolver::ComputeCellAssemblyData(const Cell& cell,
+                                    const VolumetricFiniteElementData& fe_vol_data,
+                                    const std::vector<SurfaceFiniteElementData>& fe_srf_data,
+                                    CellAssemblyData& data)
+{
+  const auto& grid = *grid_ptr_;
+  const auto& sdm = *sdm_ptr_;
 
-      typedef MeshContinuum Grid;
+  const auto& cell_mapping = sdm.GetCellMapping(cell);
+  const auto cc_nodes = cell_mapping.GetNodeLocations();
+  const size_t num_faces = cell.faces_.size();
 
-      // interior face
-      if (face.has_neighbor_)
-      {
-        const auto& adj_cell = grid.cells[face.neighbor_id_];
-        const auto& adj_cell_mapping = sdm.GetCellMapping(adj_cell);
-        const auto ac_nodes = adj_cell_mapping.GetNodeLocations();
-        const size_t acf = Grid::MapCellFace(cell, adj_cell, f);
-        const double hp_neigh = HPerpendicular(adj_cell, acf);
+  data.qp_xyz = fe_vol_data.QPointsXYZ();
+  data.face_qp_xyz.resize(num_faces);
+  data.hm.resize(num_faces);
+  data.hp.assign(num_faces, 0.0);
+  data.adj_face_nodes.resize(num_faces);
 
-        const auto imat_neigh = adj_cell.material_id_;
+  for (size_t f = 0; f < num_faces; ++f)
+  {
+    const auto& face = cell.faces_[f];
+    data.face_qp_xyz[f] = fe_srf_data[f].QPointsXYZ();
+    data.hm[f] = HPerpendicular(cell, f);
+
+    if (not face.has_neighbor_)
+      continue;
+
+    const auto& adj_cell = grid.cells[face.neighbor_id_];
+    const auto ac_nodes = sdm.GetCellMapping(adj_cell).GetNodeLocations();
+    const size_t acf = MeshContinuum::MapCellFace(cell, adj_cell, f);
+    data.hp[f] = HPerpendicular(adj_cell, acf);
+
+    const size_t num_face_nodes = cell_mapping.NumFaceNodes(f);
+    for (size_t fi = 0; fi < num_face_nodes; ++fi)
+      data.adj_face_nodes[f].push_back(
+        MapFaceNodeDisc(cell, adj_cell, cc_nodes, ac_nodes, f, acf, fi));
+  } // for f
+}
 
-        // Compute Ckappa IP
-        double Ckappa = 1.0;
-        if (cell.Type() == CellType::SLAB)
-          Ckappa = 2.0;
-        if (cell.Type() == CellType::POLYGON)
-          Ckappa = 2.0;
-        if (cell.Type() == CellType::POLYHEDRON)
-          Ckappa = 4.0;
+DFEMSolver::CellCoefficients
+DFEMSolver::SampleCoefficients(const Cell& cell, const CellAssemblyData& data) const
+{
+  const auto& grid = *grid_ptr_;
+  const auto imat = cell.material_id_;
+  const size_t num_faces = cell.faces_.size();
 
-        // Assembly penalty terms
-        for (size_t fi = 0; fi < num_face_nodes; ++fi)
-        {
-          const int i = cell_mapping.MapFaceNode(f, fi);
-          const int64_t imap = sdm.MapDOF(cell, i);
+  CellCoefficients samples;
+  for (const auto& qp_xyz : data.qp_xyz)
+  {
+    samples.d_coef.push_back(d_coef_function_->Evaluate(imat, qp_xyz));
+    samples.sigma_a.push_back(sigma_a_function_->Evaluate(imat, qp_xyz));
+    samples.q_ext.push_back(q_ext_function_->Evaluate(imat, qp_xyz));
+  }
 
-          for (size_t fj = 0; fj < num_face_nodes; ++fj)
-          {
-            const int jm = cell_mapping.MapFaceNode(f, fj); // j-minus
-            const int64_t jmmap = sdm.MapDOF(cell, jm);
+  samples.face_d_coef.resize(num_faces);
+  samples.face_adj_d_coef.resize(num_faces);
+  for (size_t f = 0; f < num_faces; ++f)
+  {
+    const auto& face = cell.faces_[f];
+    for (const auto& qp_xyz : data.face_qp_xyz[f])
+      samples.face_d_coef[f].push_back(d_coef_function_->Evaluate(imat, qp_xyz));
 
-            const int jp =
-              MapFaceNodeDisc(cell, adj_cell, cc_nodes, ac_nodes, f, acf, fj); // j-plus
-            const int64_t jpmap = sdm.MapDOF(adj_cell, jp);
+    if (not face.has_neighbor_)
+      continue;
 
-            double aij = 0.0;
-            for (size_t qp : fe_srf_data.QuadraturePointIndices())
-              aij +=
-                Ckappa *
-                (d_coef_function_->Evaluate(imat, fe_srf_data.QPointXYZ(qp)) / hm +
-                 d_coef_function_->Evaluate(imat_neigh, fe_srf_data.QPointXYZ(qp)) / hp_neigh) /
-                2.0 * fe_srf_data.ShapeValue(i, qp) * fe_srf_data.ShapeValue(jm, qp) *
-                fe_srf_data.JxW(qp);
-
-            MatSetValue(A_, imap, jmmap, aij, ADD_VALUES);
-            MatSetValue(A_, imap, jpmap, -aij, ADD_VALUES);
-          } // for fj
-        }   // for fi
+    const auto imat_neigh = grid.cells[face.neighbor_id_].material_id_;
+    for (const auto& qp_xyz : data.face_qp_xyz[f])
+      samples.face_adj_d_coef[f].push_back(d_coef_function_->Evaluate(imat_neigh, qp_xyz));
+  } // for f
 
-        // Assemble gradient terms
-        // For the following comments we use the notation:
-        // Dk = 0.5* n dot nabla bk
+  return samples;
+}
 
-        // {{D d_n b_i}}[[Phi]]
-        // 0.5*D* n dot (b_j^+ - b_j^-)*nabla b_i^-
+bool
+DFEMSolver::AssembleSystem()
+{
+  const auto& grid = *grid_ptr_;
+  const auto& sdm = *sdm_ptr_;
 
-        // loop over node of current cell (gradient of b_i)
-        for (int i = 0; i < num_nodes; ++i)
-        {
-          const int64_t imap = sdm.MapDOF(cell, i);
+  const bool full_assembly = not system_assembled_;
+  if (full_assembly)
+  {
+    cell_assembly_data_.assign(grid.local_cells.size(), CellAssemblyData{});
+    VecSet(b_, 0.0);
+  }
 
-          // loop over faces
-          for (int fj = 0; fj < num_face_nodes; ++fj)
-          {
-            const int jm = cell_mapping.MapFaceNode(f, fj); // j-minus
-            const int64_t jmmap = sdm.MapDOF(cell, jm);
-            const int jp =
-              MapFaceNodeDisc(cell, adj_cell, cc_nodes, ac_nodes, f, acf, fj); // j-plus
-            const int64_t jpmap = sdm.MapDOF(adj_cell, jp);
+  /**Lambda to turn samples into the change relative to the previous samples.*/
+  auto SubtractPrevious = [](std::vector<double>& samples, const std::vector<double>& previous)
+  {
+    bool changed = false;
+    for (size_t k = 0; k < samples.size(); ++k)
+    {
+      samples[k] -= previous[k];
+      changed |= (samples[k] != 0.0);
+    }
+    return changed;
+  };
 
-            Vector3 vec_aij;
-            for (size_t qp : fe_srf_data.QuadraturePointIndices())
-              vec_aij += d_coef_function_->Evaluate(imat, fe_srf_data.QPointXYZ(qp)) *
-                         fe_srf_data.ShapeValue(jm, qp) * fe_srf_data.ShapeGrad(i, qp) *
-                         fe_srf_data.JxW(qp);
-            const double aij = -0.5 * n_f.Dot(vec_aij);
-
-            MatSetValue(A_, imap, jmmap, aij, ADD_VALUES);
-            MatSetValue(A_, imap, jpmap, -aij, ADD_VALUES);
-          } // for fj
-        }   // for i
+  bool local_matrix_changed = false;
+  bool local_rhs_changed = false;
+  std::vector<SurfaceFiniteElementData> fe_srf_data;
+  for (const auto& cell : grid.local_cells)
+  {
+    const auto& cell_mapping = sdm.GetCellMapping(cell);
+    const size_t num_faces = cell.faces_.size();
+    auto& data = cell_assembly_data_[cell.local_id_];
 
-        // {{D d_n Phi}}[[b_i]]
-        // 0.5*D* n dot (b_i^+ - b_i^-)*nabla b_j^-
-        for (int fi = 0; fi < num_face_nodes; ++fi)
-        {
-          const int im = cell_mapping.MapFaceNode(f, fi); // i-minus
-          const int64_t immap = sdm.MapDOF(cell, im);
+    if (full_assembly)
+    {
+      const auto fe_vol_data = cell_mapping.MakeVolumetricFiniteElementData();
+      fe_srf_data.clear();
+      for (size_t f = 0; f < num_faces; ++f)
+        fe_srf_data.push_back(cell_mapping.MakeSurfaceFiniteElementData(f));
+
+      ComputeCellAssemblyData(cell, fe_vol_data, fe_srf_data, data);
+      data.coefficients = SampleCoefficients(cell, data);
+      AssembleCell(cell, fe_vol_data, fe_srf_data, data, data.coefficients, true);
+      continue;
+    }
 
-          const int ip = MapFaceNodeDisc(cell, adj_cell, cc_nodes, ac_nodes, f, acf, fi); // i-plus
-          const int64_t ipmap = sdm.MapDOF(adj_cell, ip);
+    // Resample the coefficients and form the change since the last assembly. All terms are
+    // linear in the coefficients, so assembling the change updates the system exactly.
+    auto samples = SampleCoefficients(cell, data);
+    auto delta = samples;
+    bool cell_matrix_changed = SubtractPrevious(delta.d_coef, data.coefficients.d_coef);
+    cell_matrix_changed |= SubtractPrevious(delta.sigma_a, data.coefficients.sigma_a);
+    for (size_t f = 0; f < num_faces; ++f)
+    {
+      cell_matrix_changed |=
+        SubtractPrevious(delta.face_d_coef[f], data.coefficients.face_d_coef[f]);
+      cell_matrix_changed |=
+        SubtractPrevious(delta.face_adj_d_coef[f], data.coefficients.face_adj_d_coef[f]);
+    }
+    const bool cell_rhs_changed = SubtractPrevious(delta.q_ext, data.coefficients.q_ext);
+    if (not(cell_matrix_changed or cell_rhs_changed))
+      continue;
 
-          for (int j = 0; j < num_nodes; ++j)
-          {
-            const int64_t jmap = sdm.MapDOF(cell, j);
+    // The Dirichlet source depends on the diffusion coefficient as well
+    local_matrix_changed |= cell_matrix_changed;
+    local_rhs_changed = true;
+    data.coefficients = std::move(samples);
 
-            Vector3 vec_aij;
-            for (size_t qp : fe_srf_data.QuadraturePointIndices())
-              vec_aij += d_coef_function_->Evaluate(imat, fe_srf_data.QPointXYZ(qp)) *
-                         fe_srf_data.ShapeValue(im, qp) * fe_srf_data.ShapeGrad(j, qp) *
-                         fe_srf_data.JxW(qp);
-            const double aij = -0.5 * n_f.Dot(vec_aij);
-
-            MatSetValue(A_, immap, jmap, aij, ADD_VALUES);
-            MatSetValue(A_, ipmap, jmap, -aij, ADD_VALUES);
-          } // for j
-        }   // for fi
+    const auto fe_vol_data = cell_mapping.MakeVolumetricFiniteElementData();
+    fe_srf_data.clear();
+    for (size_t f = 0; f < num_faces; ++f)
+      fe_srf_data.push_back(cell_mapping.MakeSurfaceFiniteElementData(f));
+    AssembleCell(cell, fe_vol_data, fe_srf_data, data, delta, false);
+  } // for cell
 
-      } // internal face
-      else
-      { // boundary face
-        const auto& bndry = boundaries_[face.neighbor_id_];
-        // Robin boundary
-        if (bndry.type_ == BoundaryType::Robin)
+  bool global_matrix_changed = true;
+  bool global_rhs_changed = true;
+  if (not full_assembly)
+  {
+    mpi_comm.all_reduce(local_matrix_changed, global_matrix_changed, mpi::op::logical_or<bool>());
+    mpi_comm.all_reduce(local_rhs_changed, global_rhs_changed, mpi::op::logical_or<bool>());
+  }
+
+  log.Log() << "Global assembly";
+
+  if (global_matrix_changed)
+  {
+    MatAssemblyBegin(A_, MAT_FINAL_ASSEMBLY);
+    MatAssemblyEnd(A_, MAT_FINAL_ASSEMBLY);
+  }
+  if (global_rhs_changed)
+  {
+    VecAssemblyBegin(b_);
+    VecAssemblyEnd(b_);
+  }
+
+  system_assembled_ = true;
+  return global_matrix_changed;
+}
+
+void
+DFEMSolver::AssembleCell(const Cell& cell,
+                         const VolumetricFiniteElementData& fe_vol_data,
+                         const std::vector<SurfaceFiniteElementData>& fe_srf_data,
+                         const CellAssemblyData& data,
+                         const CellCoefficients& coefficients,
+                         const bool with_boundary_terms)
+{
+  const auto& grid = *grid_ptr_;
+  const auto& sdm = *sdm_ptr_;
+
+  const auto& cell_mapping = sdm.GetCellMapping(cell);
+  const size_t num_nodes = cell_mapping.NumNodes();
+  const auto n = static_cast<int64_t>(num_nodes);
+
+  std::vector<int64_t> imap(num_nodes, 0);
+  for (size_t i = 0; i < num_nodes; ++i)
+    imap[i] = sdm.MapDOF(cell, i);
+
+  // Element matrix and source, stored row-major for blocked insertion
+  std::vector<double> Acell(num_nodes * num_nodes, 0.0);
+  std::vector<double> cell_rhs(num_nodes, 0.0);
+
+  // Assemble volumetric terms
+  const auto& d_coef = coefficients.d_coef;
+  const auto& sigma_a = coefficients.sigma_a;
+  const auto& q_ext = coefficients.q_ext;
+  for (size_t qp : fe_vol_data.QuadraturePointIndices())
+  {
+    const double JxW = fe_vol_data.JxW(qp);
+    for (size_t i = 0; i < num_nodes; ++i)
+    {
+      const double shape_i = fe_vol_data.ShapeValue(i, qp);
+      const auto grad_i = fe_vol_data.ShapeGrad(i, qp);
+      for (size_t j = 0; j < num_nodes; ++j)
+        Acell[i * num_nodes + j] +=
+          (d_coef[qp] * grad_i.Dot(fe_vol_data.ShapeGrad(j, qp)) +
+           sigma_a[qp] * shape_i * fe_vol_data.ShapeValue(j, qp)) *
+          JxW;
+      cell_rhs[i] += q_ext[qp] * shape_i * JxW;
+    } // for i
+  }   // for qp
+
+  // Assemble face terms
+  const size_t num_faces = cell.faces_.size();
+  for (size_t f = 0; f < num_faces; ++f)
+  {
+    const auto& face = cell.faces_[f];
+    const auto& n_f = face.normal_;
+    const size_t num_face_nodes = cell_mapping.NumFaceNodes(f);
+    const auto& srf_data = fe_srf_data[f];
+    const auto& face_d_coef = coefficients.face_d_coef[f];
+
+    const double hm = data.hm[f];
+
+    // interior face
+    if (face.has_neighbor_)
+    {
+      const auto& adj_cell = grid.cells[face.neighbor_id_];
+      const auto& adj_face_nodes = data.adj_face_nodes[f];
+      const auto& face_adj_d_coef = coefficients.face_adj_d_coef[f];
+      const double hp_neigh = data.hp[f];
+
+      // Compute Ckappa IP
+      double Ckappa = 1.0;
+      if (cell.Type() == CellType::SLAB)
+        Ckappa = 2.0;
+      if (cell.Type() == CellType::POLYGON)
+        Ckappa = 2.0;
+      if (cell.Type() == CellType::POLYHEDRON)
+        Ckappa = 4.0;
+
+      // Neighbor face node (j-plus) columns and (i-plus) rows
+      std::vector<int64_t> pmap(num_face_nodes, 0);
+      for (size_t fj = 0; fj < num_face_nodes; ++fj)
+        pmap[fj] = sdm.MapDOF(adj_cell, adj_face_nodes[fj]);
+
+      // Cell rows and neighbor face node columns, and the transpose coupling
+      std::vector<double> Acn(num_nodes * num_face_nodes, 0.0);
+      std::vector<double> Anc(num_face_nodes * num_nodes, 0.0);
+
+      // Assembly penalty terms
+      for (size_t fi = 0; fi < num_face_nodes; ++fi)
+      {
+        const int i = cell_mapping.MapFaceNode(f, fi);
+
+        for (size_t fj = 0; fj < num_face_nodes; ++fj)
         {
-          const auto fe_srf_data = cell_mapping.MakeSurfaceFiniteElementData(f);
+          const int jm = cell_mapping.MapFaceNode(f, fj); // j-minus
 
-          const auto& aval = bndry.values_[0];
-          const auto& bval = bndry.values_[1];
-          const auto& fval = bndry.values_[2];
+          double aij = 0.0;
+          for (size_t qp : srf_data.QuadraturePointIndices())
+            aij += Ckappa * (face_d_coef[qp] / hm + face_adj_d_coef[qp] / hp_neigh) / 2.0 *
+                   srf_data.ShapeValue(i, qp) * srf_data.ShapeValue(jm, qp) * srf_data.JxW(qp);
 
-          log.Log0Verbose1() << "Boundary  set as Robin with a,b,f = (" << aval << "," << bval
-                             << "," << fval << ") ";
-          // true Robin when a!=0, otherwise, it is a Neumann:
-          // Assert if b=0
-          if (std::fabs(bval) < 1e-8)
-            throw std::logic_error("if b=0, this is a Dirichlet BC, not a Robin BC");
+          Acell[i * num_nodes + jm] += aij;
+          Acn[i * num_face_nodes + fj] -= aij;
+        } // for fj
+      }   // for fi
 
-          for (size_t fi = 0; fi < num_face_nodes; fi++)
-          {
-            const uint i = cell_mapping.MapFaceNode(f, fi);
-            const int64_t ir = sdm.MapDOF(cell, i);
+      // Assemble gradient terms
+      // For the following comments we use the notation:
+      // Dk = 0.5* n dot nabla bk
 
-            if (std::fabs(aval) >= 1.0e-12)
-            {
-              for (size_t fj = 0; fj < num_face_nodes; fj++)
-              {
-                const uint j = cell_mapping.MapFaceNode(f, fj);
-                const int64_t jr = sdm.MapDOF(cell, j);
-
-                double aij = 0.0;
-                for (size_t qp : fe_srf_data.QuadraturePointIndices())
-                  aij += fe_srf_data.ShapeValue(i, qp) * fe_srf_data.ShapeValue(j, qp) *
-                         fe_srf_data.JxW(qp);
-                aij *= (aval / bval);
-
-                MatSetValue(A_, ir, jr, aij, ADD_VALUES);
-              } // for fj
-            }   // if a nonzero
-
-            if (std::fabs(fval) >= 1.0e-12)
-            {
-              double rhs_val = 0.0;
-              for (size_t qp : fe_srf_data.QuadraturePointIndices())
-                rhs_val += fe_srf_data.ShapeValue(i, qp) * fe_srf_data.JxW(qp);
-              rhs_val *= (fval / bval);
-
-              VecSetValue(b_, ir, rhs_val, ADD_VALUES);
-            } // if f nonzero
-          }   // for fi
-        }     // Robin BC
-        else if (bndry.type_ == BoundaryType::Dirichlet)
+      // {{D d_n b_i}}[[Phi]]
+      // 0.5*D* n dot (b_j^+ - b_j^-)*nabla b_i^-
+
+      // loop over node of current cell (gradient of b_i)
+      for (size_t i = 0; i < num_nodes; ++i)
+      {
+        // loop over faces
+        for (size_t fj = 0; fj < num_face_nodes; ++fj)
         {
-          const double bc_value = bndry.values_[0];
-          // Compute kappa
-          double Ckappa = 2.0;
-          if (cell.Type() == CellType::SLAB)
-            Ckappa = 4.0; // fmax(4.0*Dg/hm,0.25);
-          if (cell.Type() == CellType::POLYGON)
-            Ckappa = 4.0;
-          if (cell.Type() == CellType::POLYHEDRON)
-            Ckappa = 8.0;
-
-          // Assembly penalty terms
-          for (size_t fi = 0; fi < num_face_nodes; ++fi)
-          {
-            const uint i = cell_mapping.MapFaceNode(f, fi);
-            const int64_t imap = sdm.MapDOF(cell, i);
+          const int jm = cell_mapping.MapFaceNode(f, fj); // j-minus
+
+          Vector3 vec_aij;
+          for (size_t qp : srf_data.QuadraturePointIndices())
+            vec_aij += face_d_coef[qp] * srf_data.ShapeValue(jm, qp) * srf_data.ShapeGrad(i, qp) *
+                       srf_data.JxW(qp);
+          const double aij = -0.5 * n_f.Dot(vec_aij);
+
+          Acell[i * num_nodes + jm] += aij;
+          Acn[i * num_face_nodes + fj] -= aij;
+        } // for fj
+      }   // for i
+
+      // {{D d_n Phi}}[[b_i]]
+      // 0.5*D* n dot (b_i^+ - b_i^-)*nabla b_j^-
+      for (size_t fi = 0; fi < num_face_nodes; ++fi)
+      {
+        const int im = cell_mapping.MapFaceNode(f, fi); // i-minus
 
-            for (size_t fj = 0; fj < num_face_nodes; ++fj)
+        for (size_t j = 0; j < num_nodes; ++j)
+        {
+          Vector3 vec_aij;
+          for (size_t qp : srf_data.QuadraturePointIndices())
+            vec_aij += face_d_coef[qp] * srf_data.ShapeValue(im, qp) * srf_data.ShapeGrad(j, qp) *
+                       srf_data.JxW(qp);
+          const double aij = -0.5 * n_f.Dot(vec_aij);
+
+          Acell[im * num_nodes + j] += aij;
+          Anc[fi * num_nodes + j] -= aij;
+        } // for j
+      }   // for fi
+
+      const auto nf = static_cast<int64_t>(num_face_nodes);
+      MatSetValues(A_, n, imap.data(), nf, pmap.data(), Acn.data(), ADD_VALUES);
+      MatSetValues(A_, nf, pmap.data(), n, imap.data(), Anc.data(), ADD_VALUES);
+    } // internal face
+    else
+    { // boundary face
+      const auto& bndry = boundaries_[face.neighbor_id_];
+      // Robin boundary
+      if (bndry.type_ == BoundaryType::Robin and with_boundary_terms)
+      {
+        const auto& aval = bndry.values_[0];
+        const auto& bval = bndry.values_[1];
+        const auto& fval = bndry.values_[2];
+
+        log.Log0Verbose1() << "Boundary  set as Robin with a,b,f = (" << aval << "," << bval
+                           << "," << fval << ") ";
+        // true Robin when a!=0, otherwise, it is a Neumann:
+        // Assert if b=0
+        if (std::fabs(bval) < 1e-8)
+          throw std::logic_error("if b=0, this is a Dirichlet BC, not a Robin BC");
+
+        for (size_t fi = 0; fi < num_face_nodes; fi++)
+        {
+          const uint i = cell_mapping.MapFaceNode(f, fi);
+
+          if (std::fabs(aval) >= 1.0e-12)
+          {
+            for (size_t fj = 0; fj < num_face_nodes; fj++)
             {
-              const uint jm = cell_mapping.MapFaceNode(f, fj);
-              const int64_t jmmap = sdm.MapDOF(cell, jm);
+              const uint j = cell_mapping.MapFaceNode(f, fj);
 
               double aij = 0.0;
-              for (size_t qp : fe_srf_data.QuadraturePointIndices())
-                aij += Ckappa * d_coef_function_->Evaluate(imat, fe_srf_data.QPointXYZ(qp)) / hm *
-                       fe_srf_data.ShapeValue(i, qp) * fe_srf_data.ShapeValue(jm, qp) *
-                       fe_srf_data.JxW(qp);
-              double aij_bc_value = aij * bc_value;
-
-              MatSetValue(A_, imap, jmmap, aij, ADD_VALUES);
-              VecSetValue(b_, imap, aij_bc_value, ADD_VALUES);
-            } // for fj
-          }   // for fi
+              for (size_t qp : srf_data.QuadraturePointIndices())
+                aij += srf_data.ShapeValue(i, qp) * srf_data.ShapeValue(j, qp) * srf_data.JxW(qp);
+              aij *= (aval / bval);
 
-          // Assemble gradient terms
-          // For the following comments we use the notation:
-          // Dk = 0.5* n dot nabla bk
+              Acell[i * num_nodes + j] += aij;
+            } // for fj
+          }   // if a nonzero
 
-          // 0.5*D* n dot (b_j^+ - b_j^-)*nabla b_i^-
-          for (size_t i = 0; i < num_nodes; i++)
+          if (std::fabs(fval) >= 1.0e-12)
           {
-            const int64_t imap = sdm.MapDOF(cell, i);
+            double rhs_val = 0.0;
+            for (size_t qp : srf_data.QuadraturePointIndices())
+              rhs_val += srf_data.ShapeValue(i, qp) * srf_data.JxW(qp);
+            rhs_val *= (fval / bval);
 
-            for (size_t j = 0; j < num_nodes; j++)
-            {
-              const int64_t jmap = sdm.MapDOF(cell, j);
-
-              Vector3 vec_aij;
-              for (size_t qp : fe_srf_data.QuadraturePointIndices())
-                vec_aij += (fe_srf_data.ShapeValue(j, qp) * fe_srf_data.ShapeGrad(i, qp) +
-                            fe_srf_data.ShapeValue(i, qp) * fe_srf_data.ShapeGrad(j, qp)) *
-                           fe_srf_data.JxW(qp) *
-                           d_coef_function_->Evaluate(imat, fe_srf_data.QPointXYZ(qp));
-
-              const double aij = -n_f.Dot(vec_aij);
-              double aij_bc_value = aij * bc_value;
-
-              MatSetValue(A_, imap, jmap, aij, ADD_VALUES);
-              VecSetValue(b_, imap, aij_bc_value, ADD_VALUES);
-            }   // for fj
-          }     // for i
-        }       // Dirichlet BC
-        else {} // else BC
-      }         // boundary face
-    }           // for face f
-  }             // for cell
+            cell_rhs[i] += rhs_val;
+          } // if f nonzero
+        }   // for fi
+      }     // Robin BC
+      else if (bndry.type_ == BoundaryType::Dirichlet)
+      {
+        const double bc_value = bndry.values_[0];
+        // Compute kappa
+        double Ckappa = 2.0;
+        if (cell.Type() == CellType::SLAB)
+          Ckappa = 4.0; // fmax(4.0*Dg/hm,0.25);
+        if (cell.Type() == CellType::POLYGON)
+          Ckappa = 4.0;
+        if (cell.Type() == CellType::POLYHEDRON)
+          Ckappa = 8.0;
 
-  log.Log() << "Global assembly";
+        // Assembly penalty terms
+        for (size_t fi = 0; fi < num_face_nodes; ++fi)
+        {
+          const uint i = cell_mapping.MapFaceNode(f, fi);
 
-  MatAssemblyBegin(A_, MAT_FINAL_ASSEMBLY);
-  MatAssemblyEnd(A_, MAT_FINAL_ASSEMBLY);
-  VecAssemblyBegin(b_);
-  VecAssemblyEnd(b_);
+          for (size_t fj = 0; fj < num_face_nodes; ++fj)
+          {
+            const uint jm = cell_mapping.MapFaceNode(f, fj);
 
-  //  MatView(A, PETSC_VIEWER_STDERR_WORLD);
-  //
-  //  PetscViewer viewer;
-  //  PetscViewerASCIIOpen(opensn::mpi_comm,"A.m",&viewer);
-  //  PetscViewerPushFormat(viewer, PETSC_VIEWER_ASCII_MATLAB);
-  //  MatView(A,viewer);
-  //  PetscViewerPopFormat(viewer);
-  //  PetscViewerDestroy(&viewer);
+            double aij = 0.0;
+            for (size_t qp : srf_data.QuadraturePointIndices())
+              aij += Ckappa * face_d_coef[qp] / hm * srf_data.ShapeValue(i, qp) *
+                     srf_data.ShapeValue(jm, qp) * srf_data.JxW(qp);
 
-  log.Log() << "Done global assembly";
+            Acell[i * num_nodes + jm] += aij;
+            cell_rhs[i] += aij * bc_value;
+          } // for fj
+        }   // for fi
 
-  // Create Krylov Solver
-  log.Log() << "Solving: ";
-  auto petsc_solver =
-    CreateCommonKrylovSolverSetup(A_,
-                                  TextName(),
-                                  KSPCG,
-                                  PCGAMG,
-                                  0.0,
-                                  basic_options_("residual_tolerance").FloatValue(),
-                                  basic_options_("max_iters").IntegerValue());
+        // Assemble gradient terms
+        // For the following comments we use the notation:
+        // Dk = 0.5* n dot nabla bk
 
-  // Solve
-  KSPSolve(petsc_solver.ksp, b_, x_);
+        // 0.5*D* n dot (b_j^+ - b_j^-)*nabla b_i^-
+        for (size_t i = 0; i < num_nodes; i++)
+        {
+          for (size_t j = 0; j < num_nodes; j++)
+          {
+            Vector3 vec_aij;
+            for (size_t qp : srf_data.QuadraturePointIndices())
+              vec_aij += (srf_data.ShapeValue(j, qp) * srf_data.ShapeGrad(i, qp) +
+                          srf_data.ShapeValue(i, qp) * srf_data.ShapeGrad(j, qp)) *
+                         srf_data.JxW(qp) * face_d_coef[qp];
 
-  log.Log() << "Done solving";
+            const double aij = -n_f.Dot(vec_aij);
 
-  const auto& OneDofPerNode = sdm.UNITARY_UNKNOWN_MANAGER;
-  sdm.LocalizePETScVector(x_, field_, OneDofPerNode);
+            Acell[i * num_nodes + j] += aij;
+            cell_rhs[i] += aij * bc_value;
+          } // for j
+        }   // for i
+      }     // Dirichlet BC
+    }       // boundary face
+  }         // for face f
 
-  field_functions_.front()->UpdateFieldVector(field_);
+  MatSetValues(A_, n, imap.data(), n, imap.data(), Acell.data(), ADD_VALUES);
+  VecSetValues(b_, n, imap.data(), cell_rhs.data(), ADD_VALUES);
 }
 
 double
@@ -9,6 +9,7 @@
 #include "framework/utils/timer.h"
 #include "framework/math/unknown_manager/unknown_manager.h"
 #include "framework/mesh/mesh.h"
+#include "framework/mesh/mesh_vector.h"
 #include <map>
 
 namespace opensn
@@ -16,6 +17,8 @@ namespace opensn
 class MeshContinuum;
 class SpatialDiscretization;
 class ScalarSpatialMaterialFunction;
+class VolumetricFiniteElementData;
+class SurfaceFiniteElementData;
 
 namespace diffusion
 {
@@ -73,6 +76,68 @@ private:
   typedef std::pair<opensn::diffusion::BoundaryType, std::vector<double>> BoundaryInfo;
   typedef std::map<std::string, BoundaryInfo> BoundaryPreferences;
 
+  /// Coefficient samples at the volumetric and surface quadrature points of a cell.
+  struct CellCoefficients
+  {
+    std::vector<double> d_coef;
+    std::vector<double> sigma_a;
+    std::vector<double> q_ext;
+    /// Diffusion coefficient of the cell at the quadrature points of each face
+    std::vector<std::vector<double>> face_d_coef;
+    /// Diffusion coefficient of the neighbor at the quadrature points of each interior face
+    std::vector<std::vector<double>> face_adj_d_coef;
+  };
+
+  /// Geometry and coefficient samples of a local cell, as last assembled.
+  struct CellAssemblyData
+  {
+    std::vector<Vector3> qp_xyz;
+    std::vector<std::vector<Vector3>> face_qp_xyz;
+    /// Perpendicular length of each face
+    std::vector<double> hm;
+    /// Perpendicular length of the neighbor face of each interior face
+    std::vector<double> hp;
+    /// Neighbor node index of each face node of each interior face
+    std::vector<std::vector<int>> adj_face_nodes;
+    CellCoefficients coefficients;
+  };
+
+  /**
+   * Computes the exact interior penalty sparsity pattern. Nodes on an interior face couple to all
+   * nodes of the neighbor, all other nodes only to the nodes of the neighbor face.
+   */
+  void BuildSparsityPattern(std::vector<int64_t>& nodal_nnz_in_diag,
+                            std::vector<int64_t>& nodal_nnz_off_diag) const;
+
+  /**Computes the face geometry of a cell and the quadrature points at which coefficients are
+   * sampled.*/
+  void ComputeCellAssemblyData(const Cell& cell,
+                               const VolumetricFiniteElementData& fe_vol_data,
+                               const std::vector<SurfaceFiniteElementData>& fe_srf_data,
+                               CellAssemblyData& data);
+
+  /**Samples the coefficient functions at the quadrature points of a cell.*/
+  CellCoefficients SampleCoefficients(const Cell& cell, const CellAssemblyData& data) const;
+
+  /**
+   * Assembles the system. The first call assembles all cell contributions. Subsequent calls
+   * resample the coefficient functions and only add the change in the coefficient-dependent
+   * terms of cells whose samples differ. Returns true if the matrix changed.
+   */
+  bool AssembleSystem();
+
+  /**
+   * Adds the contributions of a cell, weighted by the given coefficient samples, to the system.
+   * The Robin terms do not depend on the coefficients and are only added when
+   * `with_boundary_terms` is true.
+   */
+  void AssembleCell(const Cell& cell,
+                    const VolumetricFiniteElementData& fe_vol_data,
+                    const std::vector<SurfaceFiniteElementData>& fe_srf_data,
+                    const CellAssemblyData& data,
+                    const CellCoefficients& coefficients,
+                    bool with_boundary_terms);
+
   std::shared_ptr<MeshContinuum> grid_ptr_ = nullptr;
 
   std::shared_ptr<SpatialDiscretization> sdm_ptr_ = nullptr;
@@ -97,6 +162,10 @@ private:
   std::shared_ptr<ScalarSpatialMaterialFunction> sigma_a_function_;
   std::shared_ptr<ScalarSpatialMaterialFunction> q_ext_function_;
 
+  std::vector<CellAssemblyData> cell_assembly_data_;
+  bool system_assembled_ = false;
+  PETScSolverSetup petsc_solver_;
+
 public:
   static InputParameters GetInputParameters();
   static InputParameters OptionsBlock();
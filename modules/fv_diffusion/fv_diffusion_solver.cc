@@ -24,6 +24,8 @@ Solver::Solver(const std::string& name)
 
 fv_diffusion::Solver::~Solver()
 {
+  if (system_assembled_)
+    KSPDestroy(&petsc_solver_.ksp);
   VecDestroy(&x_);
   VecDestroy(&b_);
   MatDestroy(&A_);
@@ -185,118 +187,215 @@ fv_diffusion::Solver::Execute()
 {
   log.Log() << "\nExecuting CFEM Diffusion solver";
 
-  const auto& grid = *grid_ptr_;
-  const auto& sdm = *sdm_ptr_;
-
   // Assemble the system
-  // P ~ Present cell
-  // N ~ Neighbor cell
   log.Log() << "Assembling system: ";
-  for (const auto& cell_P : grid.local_cells)
+  const bool first_assembly = not system_assembled_;
+  const bool matrix_changed = AssembleSystem();
+
+  log.Log() << "Done global assembly";
+
+  // Create Krylov Solver. It is kept across executions so that the preconditioner is only
+  // rebuilt when the matrix changed.
+  log.Log() << "Solving: ";
+  if (first_assembly)
+    petsc_solver_ =
+      CreateCommonKrylovSolverSetup(A_,
+                                    TextName(),
+                                    KSPCG,
+                                    PCGAMG,
+                                    0.0,
+                                    basic_options_("residual_tolerance").FloatValue(),
+                                    basic_options_("max_iters").IntegerValue());
+  else if (matrix_changed)
+    KSPSetOperators(petsc_solver_.ksp, A_, A_);
+
+  // Solve
+  KSPSolve(petsc_solver_.ksp, b_, x_);
+
+  UpdateFieldFunctions();
+
+  log.Log() << "Done solving";
+}
+
+Solver::CellCoefficients
+Solver::SampleCoefficients(const Cell& cell) const
+{
+  const auto& grid = *grid_ptr_;
+  const auto imat = cell.material_id_;
+  const auto& x_cc = cell.centroid_;
+
+  CellCoefficients samples;
+  samples.d_coef = d_coef_function_->Evaluate(imat, x_cc);
+  samples.sigma_a = sigma_a_function_->Evaluate(imat, x_cc);
+  samples.q_ext = q_ext_function_->Evaluate(imat, x_cc);
+
+  for (const auto& face : cell.faces_)
   {
-    const auto& cell_mapping = sdm.GetCellMapping(cell_P);
-    const double volume_P = cell_mapping.CellVolume(); // Volume of present cell
-    const auto& x_cc_P = cell_P.centroid_;
+    if (not face.has_neighbor_)
+      continue;
+    const auto& cell_N = grid.cells[face.neighbor_id_];
+    samples.face_adj_d_coef.push_back(
+      d_coef_function_->Evaluate(cell_N.material_id_, cell_N.centroid_));
+  }
+
+  return samples;
+}
 
-    const auto imat = cell_P.material_id_;
+bool
+Solver::AssembleSystem()
+{
+  const auto& grid = *grid_ptr_;
 
-    const double sigma_a = sigma_a_function_->Evaluate(imat, x_cc_P);
-    const double q_ext = q_ext_function_->Evaluate(imat, x_cc_P);
-    const double D_P = d_coef_function_->Evaluate(imat, x_cc_P);
+  const bool full_assembly = not system_assembled_;
+  if (full_assembly)
+    cell_coefficients_.resize(grid.local_cells.size());
 
-    const int64_t imap = sdm.MapDOF(cell_P, 0);
-    MatSetValue(A_, imap, imap, sigma_a * volume_P, ADD_VALUES);
-    VecSetValue(b_, imap, q_ext * volume_P, ADD_VALUES);
+  bool local_matrix_changed = false;
+  bool local_rhs_changed = false;
+  for (const auto& cell_P : grid.local_cells)
+  {
+    auto& coefficients = cell_coefficients_[cell_P.local_id_];
+    auto samples = SampleCoefficients(cell_P);
 
-    for (size_t f = 0; f < cell_P.faces_.size(); ++f)
+    if (full_assembly)
     {
-      const auto& face = cell_P.faces_[f];
-      const auto& x_fc = face.centroid_;
-      const auto x_PF = x_fc - x_cc_P;
-      const auto A_f = cell_mapping.FaceArea(f);
-      const auto A_f_n = A_f * face.normal_;
+      AssembleCell(cell_P, samples, 1.0, true);
+      coefficients = std::move(samples);
+      continue;
+    }
 
-      if (face.has_neighbor_)
-      {
-        const auto& cell_N = grid.cells[face.neighbor_id_];
-        const int jmat = cell_N.material_id_;
-        const auto& x_cc_N = cell_N.centroid_;
-        const auto x_PN = x_cc_N - x_cc_P;
+    // The face diffusion coefficients are harmonic averages, so the rows of changed cells are
+    // replaced by removing the previous coefficient-dependent terms and adding the new ones.
+    const bool cell_matrix_changed = samples.d_coef != coefficients.d_coef or
+                                     samples.sigma_a != coefficients.sigma_a or
+                                     samples.face_adj_d_coef != coefficients.face_adj_d_coef;
+    const bool cell_rhs_changed = samples.q_ext != coefficients.q_ext;
+    if (not(cell_matrix_changed or cell_rhs_changed))
+      continue;
+
+    // The Dirichlet source depends on the diffusion coefficient as well
+    local_matrix_changed |= cell_matrix_changed;
+    local_rhs_changed = true;
+    AssembleCell(cell_P, coefficients, -1.0, false);
+    AssembleCell(cell_P, samples, 1.0, false);
+    coefficients = std::move(samples);
+  } // for cell
+
+  bool global_matrix_changed = true;
+  bool global_rhs_changed = true;
+  if (not full_assembly)
+  {
+    mpi_comm.all_reduce(local_matrix_changed, global_matrix_changed, mpi::op::logical_or<bool>());
+    mpi_comm.all_reduce(local_rhs_changed, global_rhs_changed, mpi::op::logical_or<bool>());
+  }
 
-        const double D_N = d_coef_function_->Evaluate(jmat, x_cc_N);
+  log.Log() << "Global assembly";
 
-        const double w = x_PF.Norm() / x_PN.Norm();
-        const double D_f = 1.0 / (w / D_P + (1.0 - w) / D_N);
+  if (global_matrix_changed)
+  {
+    MatAssemblyBegin(A_, MAT_FINAL_ASSEMBLY);
+    MatAssemblyEnd(A_, MAT_FINAL_ASSEMBLY);
+  }
+  if (global_rhs_changed)
+  {
+    VecAssemblyBegin(b_);
+    VecAssemblyEnd(b_);
+  }
 
-        const double entry_ii = A_f_n.Dot(D_f * x_PN / x_PN.NormSquare());
-        const double entry_ij = -entry_ii;
+  system_assembled_ = true;
+  return global_matrix_changed;
+}
 
-        const int64_t jmap = sdm.MapDOF(cell_N, 0);
-        MatSetValue(A_, imap, imap, entry_ii, ADD_VALUES);
-        MatSetValue(A_, imap, jmap, entry_ij, ADD_VALUES);
-      } // internal face
-      else
-      {
-        const auto& bndry = boundaries_[face.neighbor_id_];
+void
+Solver::AssembleCell(const Cell& cell_P,
+                     const CellCoefficients& coefficients,
+                     const double weight,
+                     const bool with_boundary_terms)
+{
+  // P ~ Present cell
+  // N ~ Neighbor cell
+  const auto& grid = *grid_ptr_;
+  const auto& sdm = *sdm_ptr_;
 
-        if (bndry.type_ == BoundaryType::Robin)
-        {
-          const auto& aval = bndry.values_[0];
-          const auto& bval = bndry.values_[1];
-          const auto& fval = bndry.values_[2];
+  const auto& cell_mapping = sdm.GetCellMapping(cell_P);
+  const double volume_P = cell_mapping.CellVolume(); // Volume of present cell
+  const auto& x_cc_P = cell_P.centroid_;
 
-          if (std::fabs(bval) < 1e-8)
-            throw std::logic_error("if b=0, this is a Dirichlet BC, not a Robin BC");
+  const double sigma_a = coefficients.sigma_a;
+  const double q_ext = coefficients.q_ext;
+  const double D_P = coefficients.d_coef;
 
-          if (std::fabs(aval) > 1.0e-8)
-            MatSetValue(A_, imap, imap, A_f * aval / bval, ADD_VALUES);
-          if (std::fabs(fval) > 1.0e-8)
-            VecSetValue(b_, imap, A_f * fval / bval, ADD_VALUES);
-        } // if Robin
+  // The row of the cell: the diagonal first, followed by one entry per interior face
+  const int64_t imap = sdm.MapDOF(cell_P, 0);
+  std::vector<int64_t> cols(1, imap);
+  std::vector<double> vals(1, weight * sigma_a * volume_P);
+  double rhs = weight * q_ext * volume_P;
 
-        if (bndry.type_ == BoundaryType::Dirichlet)
-        {
-          const auto& boundary_value = bndry.values_[0];
+  size_t interior_face = 0;
+  for (size_t f = 0; f < cell_P.faces_.size(); ++f)
+  {
+    const auto& face = cell_P.faces_[f];
+    const auto& x_fc = face.centroid_;
+    const auto x_PF = x_fc - x_cc_P;
+    const auto A_f = cell_mapping.FaceArea(f);
+    const auto A_f_n = A_f * face.normal_;
 
-          const auto& x_cc_N = x_cc_P + 2.0 * x_PF;
-          const auto x_PN = x_cc_N - x_cc_P;
+    if (face.has_neighbor_)
+    {
+      const auto& cell_N = grid.cells[face.neighbor_id_];
+      const auto& x_cc_N = cell_N.centroid_;
+      const auto x_PN = x_cc_N - x_cc_P;
 
-          const double D_f = D_P;
-          const double entry_ii = A_f_n.Dot(D_f * x_PN / x_PN.NormSquare());
+      const double D_N = coefficients.face_adj_d_coef[interior_face++];
 
-          MatSetValue(A_, imap, imap, entry_ii, ADD_VALUES);
-          VecSetValue(b_, imap, entry_ii * boundary_value, ADD_VALUES);
-        } // if Dirichlet
-      }   // bndry face
-    }     // for f
-  }       // for cell
+      const double w = x_PF.Norm() / x_PN.Norm();
+      const double D_f = 1.0 / (w / D_P + (1.0 - w) / D_N);
 
-  log.Log() << "Global assembly";
+      const double entry_ii = weight * A_f_n.Dot(D_f * x_PN / x_PN.NormSquare());
+      const double entry_ij = -entry_ii;
 
-  MatAssemblyBegin(A_, MAT_FINAL_ASSEMBLY);
-  MatAssemblyEnd(A_, MAT_FINAL_ASSEMBLY);
-  VecAssemblyBegin(b_);
-  VecAssemblyEnd(b_);
+      vals[0] += entry_ii;
+      cols.push_back(sdm.MapDOF(cell_N, 0));
+      vals.push_back(entry_ij);
+    } // internal face
+    else
+    {
+      const auto& bndry = boundaries_[face.neighbor_id_];
 
-  log.Log() << "Done global assembly";
+      if (bndry.type_ == BoundaryType::Robin and with_boundary_terms)
+      {
+        const auto& aval = bndry.values_[0];
+        const auto& bval = bndry.values_[1];
+        const auto& fval = bndry.values_[2];
 
-  // Create Krylov Solver
-  log.Log() << "Solving: ";
-  auto petsc_solver =
-    CreateCommonKrylovSolverSetup(A_,
-                                  TextName(),
-                                  KSPCG,
-                                  PCGAMG,
-                                  0.0,
-                                  basic_options_("residual_tolerance").FloatValue(),
-                                  basic_options_("max_iters").IntegerValue());
+        if (std::fabs(bval) < 1e-8)
+          throw std::logic_error("if b=0, this is a Dirichlet BC, not a Robin BC");
 
-  // Solve
-  KSPSolve(petsc_solver.ksp, b_, x_);
+        if (std::fabs(aval) > 1.0e-8)
+          vals[0] += A_f * aval / bval;
+        if (std::fabs(fval) > 1.0e-8)
+          rhs += A_f * fval / bval;
+      } // if Robin
 
-  UpdateFieldFunctions();
+      if (bndry.type_ == BoundaryType::Dirichlet)
+      {
+        const auto& boundary_value = bndry.values_[0];
 
-  log.Log() << "Done solving";
+        const auto& x_cc_N = x_cc_P + 2.0 * x_PF;
+        const auto x_PN = x_cc_N - x_cc_P;
+
+        const double D_f = D_P;
+        const double entry_ii = weight * A_f_n.Dot(D_f * x_PN / x_PN.NormSquare());
+
+        vals[0] += entry_ii;
+        rhs += entry_ii * boundary_value;
+      } // if Dirichlet
+    }   // bndry face
+  }     // for f
+
+  const auto num_cols = static_cast<int64_t>(cols.size());
+  MatSetValues(A_, 1, &imap, num_cols, cols.data(), vals.data(), ADD_VALUES);
+  VecSetValues(b_, 1, &imap, &rhs, ADD_VALUES);
 }
 
 void
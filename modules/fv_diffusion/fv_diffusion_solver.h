@@ -62,9 +62,43 @@ public:
   void UpdateFieldFunctions();
 
 private:
+  /// Coefficient samples of a local cell, as last assembled.
+  struct CellCoefficients
+  {
+    double d_coef = 0.0;
+    double sigma_a = 0.0;
+    double q_ext = 0.0;
+    /// Diffusion coefficient of the neighbor of each interior face
+    std::vector<double> face_adj_d_coef;
+  };
+
+  /**Samples the coefficient functions at the centroids of a cell and its neighbors.*/
+  CellCoefficients SampleCoefficients(const Cell& cell) const;
+
+  /**
+   * Assembles the system. The first call assembles all cell contributions. Subsequent calls
+   * resample the coefficient functions and only replace the coefficient-dependent terms of
+   * cells whose samples differ. Returns true if the matrix changed.
+   */
+  bool AssembleSystem();
+
+  /**
+   * Adds the row of a cell, computed from the given coefficient samples and scaled by `weight`,
+   * to the system. The Robin terms do not depend on the coefficients and are only added when
+   * `with_boundary_terms` is true.
+   */
+  void AssembleCell(const Cell& cell,
+                    const CellCoefficients& coefficients,
+                    double weight,
+                    bool with_boundary_terms);
+
   std::shared_ptr<ScalarSpatialMaterialFunction> d_coef_function_;
   std::shared_ptr<ScalarSpatialMaterialFunction> sigma_a_function_;
   std::shared_ptr<ScalarSpatialMaterialFunction> q_ext_function_;
+
+  std::vector<CellCoefficients> cell_coefficients_;
+  bool system_assembled_ = false;
+  PETScSolverSetup petsc_solver_;
 };
 
 } // namespace fv_diffusion
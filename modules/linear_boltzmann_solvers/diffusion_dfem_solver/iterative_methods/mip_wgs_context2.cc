@@ -37,26 +37,9 @@ void
 MIPWGSContext2::PreSetupCallback()
 {
   if (log_info_)
-  {
-    std::string method_name;
-    switch (groupset_.iterative_method_)
-    {
-      case IterativeMethod::KRYLOV_RICHARDSON:
-        method_name = "KRYLOV_RICHARDSON";
-        break;
-      case IterativeMethod::KRYLOV_GMRES:
-        method_name = "KRYLOV_GMRES";
-        break;
-      case IterativeMethod::KRYLOV_BICGSTAB:
-        method_name = "KRYLOV_BICGSTAB";
-        break;
-      default:
-        method_name = "KRYLOV_GMRES";
-    }
     log.Log() << "\n\n"
-              << "********** Solving groupset " << groupset_.id_ << " with " << method_name
-              << ".\n\n";
-  }
+              << "********** Solving groupset " << groupset_.id_ << " with "
+              << IterativeMethodName() << ".\n\n";
 }
 
 void
@@ -74,7 +57,15 @@ MIPWGSContext2::SetPreconditioner(KSP& solver)
     PCShellSetContext(pc, &(*this));
   }
 
-  KSPSetPCSide(ksp, PC_LEFT);
+  // Pipelined BiCGStab only supports right preconditioning. The residual it tests is then not
+  // preconditioned and is scaled with the plain rhs norm.
+  if (groupset_.iterative_method_ == IterativeMethod::KRYLOV_PIPEBICGSTAB)
+  {
+    KSPSetPCSide(ksp, PC_RIGHT);
+    residual_scale_type = ResidualScaleType::RHS_NORM;
+  }
+  else
+    KSPSetPCSide(ksp, PC_LEFT);
   KSPSetUp(ksp);
 }
 
@@ -6,6 +6,8 @@
 #include "modules/linear_boltzmann_solvers/lbs_solver/acceleration/diffusion_mip_solver.h"
 #include "modules/linear_boltzmann_solvers/lbs_solver/iterative_methods/wgs_linear_solver.h"
 #include "modules/linear_boltzmann_solvers/diffusion_dfem_solver/iterative_methods/mip_wgs_context2.h"
+#include "framework/logging/log_exceptions.h"
+#include "framework/utils/memory_registry.h"
 #include "framework/object_factory.h"
 
 namespace opensn
@@ -56,6 +58,20 @@ DiffusionDFEMSolver::Initialize()
     InitTGDSA(groupset);
 
   LBSSolver::InitializeSolverSchemes();
+
+  PrintMemoryReport();
+}
+
+void
+DiffusionDFEMSolver::ReportMemoryUsage() const
+{
+  LBSSolver::ReportMemoryUsage();
+
+  MemoryUsage mip;
+  for (const auto& mip_solver : gs_mip_solvers_)
+    if (mip_solver)
+      mip += mip_solver->ComputeMemoryUsage();
+  MemoryRegistry::GetInstance().Set(TextName() + "/mip_matrices", mip);
 }
 
 void
@@ -151,6 +167,8 @@ DiffusionDFEMSolver::InitializeWGSSolvers()
   wgs_solvers_.clear(); // this is required
   for (auto& groupset : groupsets_)
   {
+    OpenSnInvalidArgumentIf(groupset.iterative_method_ == IterativeMethod::CLASSICRICHARDSON,
+                            "The diffusion solver does not support classic_richardson.");
 
     auto mip_wgs_context_ptr = std::make_shared<MIPWGSContext2>(
       *this,
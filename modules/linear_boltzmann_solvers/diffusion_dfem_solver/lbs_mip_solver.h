@@ -21,6 +21,9 @@ public:
   void Initialize() override;
   void InitializeWGSSolvers() override;
 
+protected:
+  void ReportMemoryUsage() const override;
+
 public:
   static InputParameters GetInputParameters();
 };
@@ -32,11 +32,22 @@ DiscreteOrdinatesAdjointSolver::GetInputParameters()
 
   params.ChangeExistingParamToOptional("name", "DiscreteOrdinatesAdjointSolver");
 
+  params.AddOptionalParameter<size_t>(
+    "forward_solver",
+    0,
+    "Handle to an initialized forward DiscreteOrdinatesSolver on the same grid. If given, its "
+    "spatial discretization, sweep orderings, flux data structure templates and matching WGDSA "
+    "solvers are shared instead of being rebuilt.");
+
   return params;
 }
 
 DiscreteOrdinatesAdjointSolver::DiscreteOrdinatesAdjointSolver(const InputParameters& params)
-  : lbs::DiscreteOrdinatesSolver(params)
+  : lbs::DiscreteOrdinatesSolver(params),
+    forward_solver_(params.ParametersAtAssignment().Has("forward_solver")
+                      ? GetStackItemPtrAsType<DiscreteOrdinatesSolver>(
+                          object_stack, params.GetParamValue<size_t>("forward_solver"))
+                      : nullptr)
 {
   log.Log0Warning() << "The lbs::DiscreteOrdinatesAdjointSolver is deprecated and may be "
                        "removed in the future.\n"
@@ -62,15 +73,32 @@ DiscreteOrdinatesAdjointSolver::Initialize()
     std::bind(&SourceFunction::operator(), src_function, _1, _2, _3, _4, _5);
 
   // Initialize groupsets for sweeping
-  InitializeSweepDataStructures();
+  if (forward_solver_)
+    ShareSweepDataStructures(*forward_solver_);
+  else
+    InitializeSweepDataStructures();
   for (auto& groupset : groupsets_)
   {
     InitFluxDataStructures(groupset);
 
-    InitWGDSA(groupset);
+    // The within-group operators do not change under transposition. The two-grid operators are
+    // built from the up-scattering, which the transposition turns into down-scattering.
+    if (not forward_solver_ or not ShareWGDSA(groupset, *forward_solver_))
+      InitWGDSA(groupset);
     InitTGDSA(groupset);
   }
   InitializeSolverSchemes();
+
+  PrintMemoryReport();
+}
+
+void
+DiscreteOrdinatesAdjointSolver::InitializeSpatialDiscretization()
+{
+  if (forward_solver_)
+    ShareSpatialDiscretization(*forward_solver_);
+  else
+    LBSSolver::InitializeSpatialDiscretization();
 }
 
 void
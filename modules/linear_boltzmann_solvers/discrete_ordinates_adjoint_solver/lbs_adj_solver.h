@@ -26,6 +26,13 @@ namespace lbs
  * @note In general, distributed sources should be used for volumetric QoIs.
  *       The user is responsible for ensuring that only the appropriate
  *       sources are active in the problem.
+ *
+ * @note Given a `forward_solver`, this solver shares the spatial
+ *       discretization, unit cell matrices, sweep orderings, FLUDS common data
+ *       and, where the operators coincide, the WGDSA solvers of that solver
+ *       instead of building its own. The adjoint is swept along the forward
+ *       directions and reoriented afterwards, so the forward sweep orderings
+ *       serve the reversed directions.
  */
 class DiscreteOrdinatesAdjointSolver : public DiscreteOrdinatesSolver
 {
@@ -49,9 +56,19 @@ public:
    */
   void ExportImportanceMap(const std::string& file_name);
 
+protected:
+  /**
+   * Shares the discretization and unit cell matrices of the forward solver, if one was given.
+   */
+  void InitializeSpatialDiscretization() override;
+
 public:
   std::vector<std::vector<double>> flux_moment_buffers_;
 
+private:
+  /// Forward solver whose discretization, sweep structures and WGDSA solvers are shared.
+  std::shared_ptr<DiscreteOrdinatesSolver> forward_solver_;
+
 public:
   /**
    * Returns the input parameters.
@@ -7,16 +7,73 @@
 #include "framework/math/spatial_discretization/spatial_discretization.h"
 #include "framework/math/quadratures/angular/curvilinear_quadrature.h"
 #include "framework/mesh/mesh_continuum/mesh_continuum.h"
+#include "caliper/cali.h"
+#include <algorithm>
 
 namespace opensn
 {
 namespace lbs
 {
 
+namespace
+{
+
+/**Solves the systems A_g x_g = b_g of all groups of a group subset with Gaussian elimination
+ * without pivoting, performing the same operations per group as GaussElimination. The matrices
+ * are indexed [(i * n + j) * num_groups + g] and the right-hand sides [i * num_groups + g], so
+ * the innermost loops run over contiguous groups. The solutions overwrite the right-hand sides.
+ * The scratch must hold 2 * num_groups values.*/
+void
+BatchedGaussElimination(double* A, double* b, size_t n, size_t num_groups, double* scratch)
+{
+  const size_t G = num_groups;
+  const size_t row_stride = n * G;
+  double* inv_pivot = scratch;
+  double* factor = scratch + G;
+
+  // Forward elimination
+  for (size_t i = 0; i + 1 < n; ++i)
+  {
+    const double* a_i = &A[i * row_stride];
+    const double* b_i = &b[i * G];
+    for (size_t g = 0; g < G; ++g)
+      inv_pivot[g] = 1.0 / a_i[i * G + g];
+
+    for (size_t j = i + 1; j < n; ++j)
+    {
+      double* a_j = &A[j * row_stride];
+      double* b_j = &b[j * G];
+      for (size_t g = 0; g < G; ++g)
+      {
+        factor[g] = a_j[i * G + g] * inv_pivot[g];
+        b_j[g] -= factor[g] * b_i[g];
+      }
+      for (size_t k = i + 1; k < n; ++k)
+        for (size_t g = 0; g < G; ++g)
+          a_j[k * G + g] -= factor[g] * a_i[k * G + g];
+    }
+  }
+
+  // Back substitution
+  for (size_t ii = n; ii > 0; --ii)
+  {
+    const size_t i = ii - 1;
+    const double* a_i = &A[i * row_stride];
+    double* b_i = &b[i * G];
+    for (size_t j = i + 1; j < n; ++j)
+      for (size_t g = 0; g < G; ++g)
+        b_i[g] -= a_i[j * G + g] * b[j * G + g];
+    for (size_t g = 0; g < G; ++g)
+      b_i[g] /= a_i[i * G + g];
+  }
+}
+
+} // namespace
+
 SweepChunkPwlrz::SweepChunkPwlrz(
   const MeshContinuum& grid,
   const SpatialDiscretization& discretization_primary,
-  const std::vector<lbs::UnitCellMatrices>& unit_cell_matrices,
+  const lbs::UnitCellMatricesList& unit_cell_matrices,
   const std::vector<lbs::UnitCellMatrices>& secondary_unit_cell_matrices,
   std::vector<lbs::CellLBSView>& cell_transport_views,
   const std::vector<double>& densities,
@@ -40,7 +97,7 @@ SweepChunkPwlrz::SweepChunkPwlrz(
                num_moments,
                max_num_cell_dofs),
     secondary_unit_cell_matrices_(secondary_unit_cell_matrices),
-    unknown_manager_(),
+    num_polar_levels_(0),
     psi_sweep_(),
     normal_vector_boundary_()
 {
@@ -51,19 +108,38 @@ SweepChunkPwlrz::SweepChunkPwlrz(
     throw std::invalid_argument("D_DO_RZ_SteadyState::SweepChunkPWL::SweepChunkPWL : "
                                 "invalid angular quadrature");
 
-  //  configure unknown manager for quantities that depend on polar level
-  const size_t dir_map_size = curvilinear_product_quadrature->GetDirectionMap().size();
-  for (size_t m = 0; m < dir_map_size; ++m)
-    unknown_manager_.AddUnknown(UnknownType::VECTOR_N, groupset_.groups_.size());
-
-  //  allocate storage for sweeping dependency
-  const unsigned int n_dof = discretization_primary.GetNumLocalDOFs(unknown_manager_);
-  psi_sweep_.resize(n_dof);
-
-  //  initialise mappings from direction linear index
+  //  tabulate the polar level and the curvilinear factors of each direction
+  const size_t num_directions = groupset_.quadrature_->omegas_.size();
+  polar_levels_.assign(num_directions, 0);
   for (const auto& dir_set : curvilinear_product_quadrature->GetDirectionMap())
     for (const auto& dir_idx : dir_set.second)
-      map_polar_level_.emplace(dir_idx, dir_set.first);
+      polar_levels_[dir_idx] = dir_set.first;
+  fac_diamond_difference_ = curvilinear_product_quadrature->GetDiamondDifferenceFactor();
+  fac_streaming_operator_ = curvilinear_product_quadrature->GetStreamingOperatorFactor();
+
+  //  allocate storage for sweeping dependency, node-major with the polar
+  //  levels and groups of a node contiguous
+  num_polar_levels_ = curvilinear_product_quadrature->GetDirectionMap().size();
+  const size_t num_groups = groupset_.groups_.size();
+  size_t max_num_faces = 0;
+  size_t num_local_nodes = 0;
+  cell_node_offsets_.resize(grid_.local_cells.size());
+  for (const auto& cell : grid_.local_cells)
+  {
+    cell_node_offsets_[cell.local_id_] = num_local_nodes;
+    num_local_nodes += discretization_.GetCellMapping(cell).NumNodes();
+    max_num_faces = std::max(max_num_faces, cell.faces_.size());
+  }
+  psi_sweep_.assign(num_local_nodes * num_polar_levels_ * num_groups, 0.0);
+
+  //  allocate scratch
+  const size_t n = max_num_cell_dofs_;
+  Amat_.resize(n * n);
+  Atemp_.resize(n * n * num_groups);
+  b_.resize(n * num_groups);
+  pivot_scratch_.resize(2 * num_groups);
+  face_mu_values_.resize(max_num_faces);
+  psi_sweep_map_.resize(n);
 
   //  set normal vector for symmetric boundary condition
   const auto d = (grid_.Dimension() == 1) ? 2 : 0;
@@ -74,29 +150,26 @@ SweepChunkPwlrz::SweepChunkPwlrz(
 void
 SweepChunkPwlrz::Sweep(AngleSet& angle_set)
 {
+  CALI_CXX_MARK_SCOPE("SweepChunkPwlrz::Sweep");
+
   const SubSetInfo& grp_ss_info = groupset_.grp_subset_infos_[angle_set.GetGroupSubset()];
 
-  auto gs_ss_size = grp_ss_info.ss_size;
-  auto gs_ss_begin = grp_ss_info.ss_begin;
-  auto gs_gi = groupset_.groups_[gs_ss_begin].id_;
+  const size_t gs_ss_size = grp_ss_info.ss_size;
+  const size_t gs_ss_begin = grp_ss_info.ss_begin;
+  const auto gs_gi = groupset_.groups_[gs_ss_begin].id_;
+  const size_t num_groups = groupset_.groups_.size();
 
   int deploc_face_counter = -1;
   int preloc_face_counter = -1;
 
   auto& fluds = dynamic_cast<AAH_FLUDS&>(angle_set.GetFLUDS());
-  const auto& m2d_op = groupset_.quadrature_->GetMomentToDiscreteOperator();
-  const auto& d2m_op = groupset_.quadrature_->GetDiscreteToMomentOperator();
+  GatherAngleSetOperators(angle_set);
+  const size_t as_num_angles = angle_set.GetNumAngles();
+  as_psi_.resize(max_num_cell_dofs_ * as_num_angles * gs_ss_size);
 
-  std::vector<std::vector<double>> Amat(max_num_cell_dofs_,
-                                        std::vector<double>(max_num_cell_dofs_));
-  std::vector<std::vector<double>> Atemp(max_num_cell_dofs_,
-                                         std::vector<double>(max_num_cell_dofs_));
-  std::vector<std::vector<double>> b(groupset_.groups_.size(),
-                                     std::vector<double>(max_num_cell_dofs_));
-  std::vector<double> source(max_num_cell_dofs_);
-
-  const auto curvilinear_product_quadrature =
-    std::dynamic_pointer_cast<opensn::CurvilinearQuadrature>(groupset_.quadrature_);
+  double* Amat = Amat_.data();
+  double* Atemp = Atemp_.data();
+  double* b = b_.data();
 
   // Loop over each cell
   const auto& spds = angle_set.GetSPDS();
@@ -108,14 +181,13 @@ SweepChunkPwlrz::Sweep(AngleSet& angle_set)
     auto& cell = grid_.local_cells[cell_local_id];
     auto& cell_mapping = discretization_.GetCellMapping(cell);
     auto& cell_transport_view = cell_transport_views_[cell_local_id];
-    auto cell_num_faces = cell.faces_.size();
-    auto cell_num_nodes = cell_mapping.NumNodes();
+    const size_t cell_num_faces = cell.faces_.size();
+    const size_t n = cell_mapping.NumNodes();
 
     const auto& face_orientations = spds.CellFaceOrientations()[cell_local_id];
-    std::vector<double> face_mu_values(cell_num_faces);
 
     const auto& rho = densities_[cell.local_id_];
-    const auto& sigma_t = xs_.at(cell.material_id_)->SigmaTotal();
+    const auto& sigma_t = cell_transport_view.XS().SigmaTotal();
 
     // Get cell matrices
     const auto& G = unit_cell_matrices_[cell_local_id].intV_shapeI_gradshapeJ;
@@ -123,6 +195,9 @@ SweepChunkPwlrz::Sweep(AngleSet& angle_set)
     const auto& M_surf = unit_cell_matrices_[cell_local_id].intS_shapeI_shapeJ;
     const auto& Maux = secondary_unit_cell_matrices_[cell_local_id].intV_shapeI_shapeJ;
 
+    // Discrete sources of all directions in the set, q = M2D * q_moms
+    ComputeAngleSetSource(cell_transport_view, n, gs_gi, gs_ss_size, as_source_);
+
     // Loop over angles in set (as = angleset, ss = subset)
     const int ni_deploc_face_counter = deploc_face_counter;
     const int ni_preloc_face_counter = preloc_face_counter;
@@ -130,44 +205,49 @@ SweepChunkPwlrz::Sweep(AngleSet& angle_set)
     for (size_t as_ss_idx = 0; as_ss_idx < as_angle_indices.size(); ++as_ss_idx)
     {
       auto direction_num = as_angle_indices[as_ss_idx];
-      auto omega = groupset_.quadrature_->omegas_[direction_num];
+      const auto& omega = groupset_.quadrature_->omegas_[direction_num];
       auto wt = groupset_.quadrature_->weights_[direction_num];
 
-      const auto polar_level = map_polar_level_[direction_num];
-      const auto fac_diamond_difference =
-        curvilinear_product_quadrature->GetDiamondDifferenceFactor()[direction_num];
-      const auto fac_streaming_operator =
-        curvilinear_product_quadrature->GetStreamingOperatorFactor()[direction_num];
+      const auto polar_level = polar_levels_[direction_num];
+      const double fac_diamond_difference = fac_diamond_difference_[direction_num];
+      const double fac_streaming_operator = fac_streaming_operator_[direction_num];
 
       deploc_face_counter = ni_deploc_face_counter;
       preloc_face_counter = ni_preloc_face_counter;
 
-      // Reset right-hand side
-      for (int gsg = 0; gsg < gs_ss_size; ++gsg)
-        b[gsg].assign(cell_num_nodes, 0.0);
+      // Sweeping dependency of the nodes at this polar level
+      for (size_t j = 0; j < n; ++j)
+        psi_sweep_map_[j] =
+          ((cell_node_offsets_[cell_local_id] + j) * num_polar_levels_ + polar_level) *
+            num_groups +
+          gs_ss_begin;
 
-      for (size_t i = 0; i < cell_num_nodes; ++i)
+      // Streaming and angular redistribution, shared by all groups, and the right-hand side
+      // contribution of the angular redistribution
+      for (size_t i = 0; i < n; ++i)
       {
-        for (size_t j = 0; j < cell_num_nodes; ++j)
+        double* b_i = &b[i * gs_ss_size];
+        for (size_t gsg = 0; gsg < gs_ss_size; ++gsg)
+          b_i[gsg] = 0.0;
+
+        for (size_t j = 0; j < n; ++j)
         {
-          const auto jr =
-            discretization_.MapDOFLocal(cell, j, unknown_manager_, polar_level, gs_gi);
-          for (int gsg = 0; gsg < gs_ss_size; ++gsg)
-            b[gsg][i] += fac_streaming_operator * Maux[i][j] * psi_sweep_[jr + gsg];
+          const double fac_Maux_ij = fac_streaming_operator * Maux[i][j];
+          Amat[i * n + j] = omega.Dot(G[i][j]) + fac_Maux_ij;
+
+          const double* psi_sweep_j = &psi_sweep_[psi_sweep_map_[j]];
+          for (size_t gsg = 0; gsg < gs_ss_size; ++gsg)
+            b_i[gsg] += fac_Maux_ij * psi_sweep_j[gsg];
         }
       }
 
-      for (int i = 0; i < cell_num_nodes; ++i)
-        for (int j = 0; j < cell_num_nodes; ++j)
-          Amat[i][j] = omega.Dot(G[i][j]) + fac_streaming_operator * Maux[i][j];
-
       // Update face orientations
-      for (int f = 0; f < cell_num_faces; ++f)
-        face_mu_values[f] = omega.Dot(cell.faces_[f].normal_);
+      for (size_t f = 0; f < cell_num_faces; ++f)
+        face_mu_values_[f] = omega.Dot(cell.faces_[f].normal_);
 
       // Surface integrals
       int in_face_counter = -1;
-      for (int f = 0; f < cell_num_faces; ++f)
+      for (size_t f = 0; f < cell_num_faces; ++f)
       {
         if (face_orientations[f] != FaceOrientation::INCOMING)
           continue;
@@ -181,119 +261,86 @@ SweepChunkPwlrz::Sweep(AngleSet& angle_set)
         else if (not is_boundary_face)
           ++preloc_face_counter;
 
+        //  Determine whether incoming direction is incident on the point
+        //  of symmetry or on the axis of symmetry.
+        //  N.B.: A face is considered to be on the point/axis of symmetry
+        //  if all are true:
+        //    1. The face normal is antiparallel to $\vec{e}_{d}$.
+        //    2. All vertices of the face exhibit $v_{d} = 0$
+        //       with $d = 2$ for 1D geometries and $d = 0$ for 2D geometries.
+        //  Thanks to the verifications performed during initialisation,
+        //  at this point it is necessary to confirm only the orientation.
+        const bool incident_on_symmetric_boundary =
+          is_boundary_face and (cell_face.normal_.Dot(normal_vector_boundary_) < -0.999999);
+
         // IntSf_mu_psi_Mij_dA
         const size_t num_face_nodes = cell_mapping.NumFaceNodes(f);
-        for (int fi = 0; fi < num_face_nodes; ++fi)
+        for (size_t fi = 0; fi < num_face_nodes; ++fi)
         {
           const int i = cell_mapping.MapFaceNode(f, fi);
 
-          for (int fj = 0; fj < num_face_nodes; ++fj)
+          for (size_t fj = 0; fj < num_face_nodes; ++fj)
           {
             const int j = cell_mapping.MapFaceNode(f, fj);
 
-            const double mu_Nij = -face_mu_values[f] * M_surf[f][i][j];
-            Amat[i][j] += mu_Nij;
+            const double mu_Nij = -face_mu_values_[f] * M_surf[f][i][j];
+            Amat[i * n + j] += mu_Nij;
 
             const double* psi;
             if (is_local_face)
               psi = fluds.UpwindPsi(spls_index, in_face_counter, fj, 0, as_ss_idx);
             else if (not is_boundary_face)
               psi = fluds.NLUpwindPsi(preloc_face_counter, fj, 0, as_ss_idx);
+            else if (not incident_on_symmetric_boundary)
+              psi = angle_set.PsiBoundary(cell_face.neighbor_id_,
+                                          direction_num,
+                                          cell_local_id,
+                                          f,
+                                          fj,
+                                          gs_gi,
+                                          gs_ss_begin,
+                                          IsSurfaceSourceActive());
             else
-            {
-              //  Determine whether incoming direction is incident on the point
-              //  of symmetry or on the axis of symmetry.
-              //  N.B.: A face is considered to be on the point/axis of symmetry
-              //  if all are true:
-              //    1. The face normal is antiparallel to $\vec{e}_{d}$.
-              //    2. All vertices of the face exhibit $v_{d} = 0$
-              //       with $d = 2$ for 1D geometries and $d = 0$ for 2D geometries.
-              //  Thanks to the verifications performed during initialisation,
-              //  at this point it is necessary to confirm only the orientation.
-              const bool incident_on_symmetric_boundary =
-                (cell_face.normal_.Dot(normal_vector_boundary_) < -0.999999);
-              if (!incident_on_symmetric_boundary)
-              {
-                for (int fi = 0; fi < num_face_nodes; ++fi)
-                {
-                  const int i = cell_mapping.MapFaceNode(f, fi);
-
-                  for (int fj = 0; fj < num_face_nodes; ++fj)
-                  {
-                    const int j = cell_mapping.MapFaceNode(f, fj);
-
-                    psi = angle_set.PsiBoundary(cell_face.neighbor_id_,
-                                                direction_num,
-                                                cell_local_id,
-                                                f,
-                                                fj,
-                                                gs_gi,
-                                                gs_ss_begin,
-                                                IsSurfaceSourceActive());
-                  }
-                }
-              }
-              else
-                psi = nullptr;
-            }
+              psi = nullptr;
 
             if (not psi)
               continue;
 
-            for (int gsg = 0; gsg < gs_ss_size; ++gsg)
-              b[gsg][i] += psi[gsg] * mu_Nij;
+            double* b_i = &b[i * gs_ss_size];
+            for (size_t gsg = 0; gsg < gs_ss_size; ++gsg)
+              b_i[gsg] += psi[gsg] * mu_Nij;
           } // for face node j
         }   // for face node i
       }     // for f
 
-      // Looping over groups, assembling mass terms
-      for (int gsg = 0; gsg < gs_ss_size; ++gsg)
+      // Mass terms of all groups
+      // Atemp_g = Amat + sigma_tg * M
+      // b_g += M * q_g
+      for (size_t i = 0; i < n; ++i)
       {
-        double sigma_tg = rho * sigma_t[gs_gi + gsg];
-
-        // Contribute source moments q = M_n^T * q_moms
-        for (int i = 0; i < cell_num_nodes; ++i)
+        double* b_i = &b[i * gs_ss_size];
+        for (size_t j = 0; j < n; ++j)
         {
-          double temp_src = 0.0;
-          for (int m = 0; m < num_moments_; ++m)
+          const double Mij = M[i][j];
+          const double Amat_ij = Amat[i * n + j];
+          double* Atemp_ij = &Atemp[(i * n + j) * gs_ss_size];
+          const double* q_j = &as_source_[(j * as_num_angles + as_ss_idx) * gs_ss_size];
+          for (size_t gsg = 0; gsg < gs_ss_size; ++gsg)
           {
-            const size_t ir = cell_transport_view.MapDOF(i, m, static_cast<int>(gs_gi + gsg));
-            temp_src += m2d_op[m][direction_num] * source_moments_[ir];
+            Atemp_ij[gsg] = Amat_ij + Mij * rho * sigma_t[gs_gi + gsg];
+            b_i[gsg] += Mij * q_j[gsg];
           }
-          source[i] = temp_src;
-        }
-
-        // Mass matrix and source
-        // Atemp = Amat + sigma_tgr * M
-        // b += M * q
-        for (int i = 0; i < cell_num_nodes; ++i)
-        {
-          double temp = 0.0;
-          for (int j = 0; j < cell_num_nodes; ++j)
-          {
-            const double Mij = M[i][j];
-            Atemp[i][j] = Amat[i][j] + Mij * sigma_tg;
-            temp += Mij * source[j];
-          }
-          b[gsg][i] += temp;
         }
+      }
 
-        // Solve system
-        GaussElimination(Atemp, b[gsg], static_cast<int>(cell_num_nodes));
-      } // for gsg
+      // Solve the systems of all groups
+      BatchedGaussElimination(Atemp, b, n, gs_ss_size, pivot_scratch_.data());
 
-      // Update phi
-      auto& output_phi = GetDestinationPhi();
-      for (int m = 0; m < num_moments_; ++m)
-      {
-        const double wn_d2m = d2m_op[m][direction_num];
-        for (int i = 0; i < cell_num_nodes; ++i)
-        {
-          const size_t ir = cell_transport_view.MapDOF(i, m, gs_gi);
-          for (int gsg = 0; gsg < gs_ss_size; ++gsg)
-            output_phi[ir + gsg] += wn_d2m * b[gsg][i];
-        }
-      }
+      // Keep the solution for the flux moment update
+      for (size_t i = 0; i < n; ++i)
+        std::copy_n(&b[i * gs_ss_size],
+                    gs_ss_size,
+                    &as_psi_[(i * as_num_angles + as_ss_idx) * gs_ss_size]);
 
       // Save angular flux during sweep
       if (save_angular_flux_)
@@ -302,19 +349,18 @@ SweepChunkPwlrz::Sweep(AngleSet& angle_set)
         double* cell_psi_data =
           &output_psi[discretization_.MapDOFLocal(cell, 0, groupset_.psi_uk_man_, 0, 0)];
 
-        for (size_t i = 0; i < cell_num_nodes; ++i)
+        for (size_t i = 0; i < n; ++i)
         {
           const size_t imap =
             i * groupset_angle_group_stride_ + direction_num * groupset_group_stride_ + gs_ss_begin;
-          for (int gsg = 0; gsg < gs_ss_size; ++gsg)
-            cell_psi_data[imap + gsg] = b[gsg][i];
+          std::copy_n(&b[i * gs_ss_size], gs_ss_size, &cell_psi_data[imap]);
         }
       }
 
       // For outgoing, non-boundary faces, copy angular flux to fluds and
       // accumulate outflow
       int out_face_counter = -1;
-      for (int f = 0; f < cell_num_faces; ++f)
+      for (size_t f = 0; f < cell_num_faces; ++f)
       {
         if (face_orientations[f] != FaceOrientation::OUTGOING)
           continue;
@@ -331,15 +377,16 @@ SweepChunkPwlrz::Sweep(AngleSet& angle_set)
           ++deploc_face_counter;
 
         const size_t num_face_nodes = cell_mapping.NumFaceNodes(f);
-        for (int fi = 0; fi < num_face_nodes; ++fi)
+        for (size_t fi = 0; fi < num_face_nodes; ++fi)
         {
           const int i = cell_mapping.MapFaceNode(f, fi);
+          const double* b_i = &b[i * gs_ss_size];
 
           if (is_boundary_face and not is_reflecting_boundary_face)
           {
-            for (int gsg = 0; gsg < gs_ss_size; ++gsg)
+            for (size_t gsg = 0; gsg < gs_ss_size; ++gsg)
               cell_transport_view.AddOutflow(
-                f, gs_gi + gsg, wt * face_mu_values[f] * b[gsg][i] * IntF_shapeI[i]);
+                f, gs_gi + gsg, wt * face_mu_values_[f] * b_i[gsg] * IntF_shapeI[i]);
           }
 
           double* psi = nullptr;
@@ -354,10 +401,7 @@ SweepChunkPwlrz::Sweep(AngleSet& angle_set)
             continue;
 
           if (not is_boundary_face or is_reflecting_boundary_face)
-          {
-            for (int gsg = 0; gsg < gs_ss_size; ++gsg)
-              psi[gsg] = b[gsg][i];
-          }
+            std::copy_n(b_i, gs_ss_size, psi);
         } // for fi
       }   // for face
 
@@ -365,14 +409,18 @@ SweepChunkPwlrz::Sweep(AngleSet& angle_set)
       // interval)
       const auto f0 = 1 / fac_diamond_difference;
       const auto f1 = f0 - 1;
-      for (size_t i = 0; i < cell_num_nodes; ++i)
+      for (size_t i = 0; i < n; ++i)
       {
-        const auto ir = discretization_.MapDOFLocal(cell, i, unknown_manager_, polar_level, gs_gi);
-        for (int gsg = 0; gsg < gs_ss_size; ++gsg)
-          psi_sweep_[ir + gsg] = f0 * b[gsg][i] - f1 * psi_sweep_[ir + gsg];
+        const double* b_i = &b[i * gs_ss_size];
+        double* psi_sweep_i = &psi_sweep_[psi_sweep_map_[i]];
+        for (size_t gsg = 0; gsg < gs_ss_size; ++gsg)
+          psi_sweep_i[gsg] = f0 * b_i[gsg] - f1 * psi_sweep_i[gsg];
       }
     } // for angleset/subset
-  }   // for cell
+
+    // Update phi, phi_moms += D2M * psi
+    AccumulateAngleSetMoments(cell_transport_view, n, gs_gi, gs_ss_size, as_psi_);
+  } // for cell
 }
 
 } // namespace lbs
@@ -12,13 +12,17 @@ namespace lbs
 class LBSGroupset;
 
 /** A sweep-chunk in point-symmetric and axial-symmetric
- *  curvilinear coordinates. */
+ *  curvilinear coordinates.
+ *
+ *  All scratch is flat and allocated at construction, the per-direction
+ *  curvilinear factors and polar levels are tabulated once, and the cell
+ *  systems of all groups of a group subset are solved together. */
 class SweepChunkPwlrz : public SweepChunk
 {
 public:
   SweepChunkPwlrz(const MeshContinuum& grid,
                   const SpatialDiscretization& discretization_primary,
-                  const std::vector<lbs::UnitCellMatrices>& unit_cell_matrices,
+                  const lbs::UnitCellMatricesList& unit_cell_matrices,
                   const std::vector<lbs::UnitCellMatrices>& secondary_unit_cell_matrices,
                   std::vector<lbs::CellLBSView>& cell_transport_views,
                   const std::vector<double>& densities,
@@ -35,14 +39,33 @@ public:
 private:
   /** Secondary spatial discretization cell matrices */
   const std::vector<lbs::UnitCellMatrices>& secondary_unit_cell_matrices_;
-  /** Unknown manager. */
-  UnknownManager unknown_manager_;
-  /** Sweeping dependency angular intensity (for each polar level). */
+  /** Number of polar levels of the quadrature. */
+  size_t num_polar_levels_;
+  /** Offset of the first node of each local cell in the node-major storage. */
+  std::vector<size_t> cell_node_offsets_;
+  /** Sweeping dependency angular intensity, indexed
+   *  [((cell_node_offset + i) * num_polar_levels + polar_level) * num_groups + g]. */
   std::vector<double> psi_sweep_;
-  /** Mapping from direction linear index to direction polar level. */
-  std::map<unsigned int, unsigned int> map_polar_level_;
+  /** Polar level of each direction. */
+  std::vector<unsigned int> polar_levels_;
+  /** Diamond difference factor of each direction. */
+  std::vector<double> fac_diamond_difference_;
+  /** Streaming operator factor of each direction. */
+  std::vector<double> fac_streaming_operator_;
   /** Normal vector to determine symmetric boundary condition. */
   Vector3 normal_vector_boundary_;
+
+  /** Scratch. Matrices are indexed [i * n + j], group-batched matrices
+   *  [(i * n + j) * num_groups + g] and group-batched vectors
+   *  [i * num_groups + g]. */
+  std::vector<double> Amat_;
+  std::vector<double> Atemp_;
+  std::vector<double> b_;
+  std::vector<double> pivot_scratch_;
+  std::vector<double> face_mu_values_;
+  std::vector<size_t> psi_sweep_map_;
+  std::vector<double> as_source_;
+  std::vector<double> as_psi_;
 };
 
 } // namespace lbs
@@ -3,7 +3,6 @@
 
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/iterative_methods/sweep_wgs_context.h"
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/lbs_discrete_ordinates_solver.h"
-#include "modules/linear_boltzmann_solvers/lbs_solver/preconditioning/lbs_shell_operations.h"
 #include "framework/runtime.h"
 #include "framework/logging/log.h"
 #include <petscksp.h>
@@ -15,8 +14,6 @@ namespace opensn
 namespace lbs
 {
 
-typedef PetscErrorCode (*PCShellPtr)(PC, Vec, Vec);
-
 SweepWGSContext::SweepWGSContext(DiscreteOrdinatesSolver& lbs_solver,
                                  LBSGroupset& groupset,
                                  const SetSourceFunction& set_source_function,
@@ -40,50 +37,7 @@ SweepWGSContext::PreSetupCallback()
   CALI_CXX_MARK_SCOPE("SweepWGSContext::PreSetupCallback");
 
   if (log_info_)
-  {
-    std::string method_name;
-    switch (groupset_.iterative_method_)
-    {
-      case IterativeMethod::KRYLOV_RICHARDSON:
-        method_name = "KRYLOV_RICHARDSON";
-        break;
-      case IterativeMethod::KRYLOV_GMRES:
-        method_name = "KRYLOV_GMRES";
-        break;
-      case IterativeMethod::KRYLOV_BICGSTAB:
-        method_name = "KRYLOV_BICGSTAB";
-        break;
-      default:
-        method_name = "KRYLOV_GMRES";
-    }
-    log.Log() << "\n\n"
-              << "********** Solving groupset " << groupset_.id_ << " with " << method_name
-              << ".\n\n"
-              << "Quadrature number of angles: " << groupset_.quadrature_->abscissae_.size() << "\n"
-              << "Groups " << groupset_.groups_.front().id_ << " " << groupset_.groups_.back().id_
-              << "\n\n";
-  }
-}
-
-void
-SweepWGSContext::SetPreconditioner(KSP& solver)
-{
-  CALI_CXX_MARK_SCOPE("SweepWGSContext::SetPreconditioner");
-
-  auto& ksp = solver;
-
-  PC pc;
-  KSPGetPC(ksp, &pc);
-
-  if (groupset_.apply_wgdsa_ or groupset_.apply_tgdsa_)
-  {
-    PCSetType(pc, PCSHELL);
-    PCShellSetApply(pc, (PCShellPtr)WGDSA_TGDSA_PreConditionerMult);
-    PCShellSetContext(pc, &(*this));
-  }
-
-  KSPSetPCSide(ksp, PC_LEFT);
-  KSPSetUp(ksp);
+    LogSolveHeader();
 }
 
 std::pair<int64_t, int64_t>
@@ -128,10 +82,15 @@ SweepWGSContext::ApplyInverseTransportOperator(SourceFlags scope)
     (scope & APPLY_FIXED_SOURCES) and (not lbs_solver_.Options().use_src_moments);
 
   sweep_scheduler_.SetBoundarySourceActiveFlag(use_bndry_source_flag);
+  sweep_scheduler_.SetFixedSourceActiveFlag(scope & APPLY_FIXED_SOURCES);
 
   if (scope & ZERO_INCOMING_DELAYED_PSI)
     sweep_scheduler_.ZeroIncomingDelayedPsi();
 
+  // Every classic Richardson iteration is a complete sweep, the outflow of the last one is kept
+  if (groupset_.iterative_method_ == IterativeMethod::CLASSICRICHARDSON)
+    lbs_ss_solver_.ZeroOutflowBalanceVars(groupset_);
+
   // Sweep
   sweep_scheduler_.ZeroOutputFluxDataStructures();
   std::chrono::high_resolution_clock::time_point sweep_start =
@@ -152,7 +111,9 @@ SweepWGSContext::PostSolveCallback()
 
   // Perform final sweep with converged phi and delayed psi dofs. This step is necessary for
   // Krylov methods to recover the actual solution (this includes all of the PETSc methods
-  // currently used in OpenSn). This step will not be necessary for classic Richardson.
+  // currently used in OpenSn). It is not necessary for classic Richardson, whose last sweep
+  // already is the solution.
+  if (groupset_.iterative_method_ != IterativeMethod::CLASSICRICHARDSON)
   {
     lbs_ss_solver_.ZeroOutflowBalanceVars(groupset_);
     const auto scope = lhs_src_scope_ | rhs_src_scope_;
@@ -31,8 +31,6 @@ struct SweepWGSContext : public WGSContext
 
   void PreSetupCallback() override;
 
-  void SetPreconditioner(KSP& solver) override;
-
   std::pair<int64_t, int64_t> SystemSize() override;
 
   void ApplyInverseTransportOperator(SourceFlags scope) override;
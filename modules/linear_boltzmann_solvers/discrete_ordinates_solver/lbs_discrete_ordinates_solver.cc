@@ -10,9 +10,11 @@
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/fluds/aah_fluds.h"
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/angle_set/aah_angle_set.h"
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep_chunks/aah_sweep_chunk.h"
+#include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep_chunks/aah_batched_sweep_chunk.h"
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep_chunks/cbc_sweep_chunk.h"
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/iterative_methods/sweep_wgs_context.h"
 #include "modules/linear_boltzmann_solvers/lbs_solver/iterative_methods/wgs_linear_solver.h"
+#include "modules/linear_boltzmann_solvers/lbs_solver/iterative_methods/classic_richardson.h"
 #include "modules/linear_boltzmann_solvers/lbs_solver/source_functions/source_function.h"
 #include "modules/linear_boltzmann_solvers/lbs_solver/groupset/lbs_groupset.h"
 #include "framework/mesh/mesh_continuum/mesh_continuum.h"
@@ -20,11 +22,14 @@
 #include "framework/logging/log.h"
 #include "framework/logging/log_exceptions.h"
 #include "framework/utils/timer.h"
+#include "framework/utils/memory_registry.h"
 #include "framework/utils/utils.h"
 #include "framework/object_factory.h"
 #include "framework/runtime.h"
 #include "caliper/cali.h"
 #include <iomanip>
+#include <algorithm>
+#include <limits>
 
 namespace opensn
 {
@@ -129,6 +134,31 @@ DiscreteOrdinatesSolver::Initialize()
     InitTGDSA(groupset);
   }
   InitializeSolverSchemes();
+
+  PrintMemoryReport();
+}
+
+void
+DiscreteOrdinatesSolver::ReportMemoryUsage() const
+{
+  LBSSolver::ReportMemoryUsage();
+
+  auto& registry = MemoryRegistry::GetInstance();
+  const std::string prefix = TextName() + "/";
+
+  MemoryUsage spds;
+  for (const auto& [quadrature, spds_list] : quadrature_spds_map_)
+    for (const auto& sweep_ordering : spds_list)
+      spds += sweep_ordering->ComputeMemoryUsage();
+  registry.Set(prefix + "spds", spds);
+
+  MemoryUsage fluds;
+  for (const auto& groupset : groupsets_)
+    if (groupset.angle_agg_)
+      for (auto& angle_set_group : groupset.angle_agg_->angle_set_groups)
+        for (const auto& angle_set : angle_set_group.AngleSets())
+          fluds += angle_set->GetFLUDS().ComputeMemoryUsage();
+  registry.Set(prefix + "fluds", fluds);
 }
 
 void
@@ -140,6 +170,7 @@ DiscreteOrdinatesSolver::InitializeWGSSolvers()
   for (auto& groupset : groupsets_)
   {
     std::shared_ptr<SweepChunk> sweep_chunk = SetSweepChunk(groupset);
+    sweep_chunk->SetTimeDependentTerms(&time_dependent_terms_);
 
     auto sweep_wgs_context_ptr = std::make_shared<SweepWGSContext>(
       *this,
@@ -150,7 +181,11 @@ DiscreteOrdinatesSolver::InitializeWGSSolvers()
       options_.verbose_inner_iterations,
       sweep_chunk);
 
-    auto wgs_solver = std::make_shared<WGSLinearSolver>(sweep_wgs_context_ptr);
+    std::shared_ptr<LinearSolver> wgs_solver;
+    if (groupset.iterative_method_ == IterativeMethod::CLASSICRICHARDSON)
+      wgs_solver = std::make_shared<ClassicRichardson>(sweep_wgs_context_ptr);
+    else
+      wgs_solver = std::make_shared<WGSLinearSolver>(sweep_wgs_context_ptr);
 
     wgs_solvers_.push_back(wgs_solver);
   } // for groupset
@@ -933,6 +968,14 @@ DiscreteOrdinatesSolver::InitializeSweepDataStructures()
 
   log.Log() << program_timer.GetTimeString() << " Initializing sweep datastructures.\n";
 
+  // The sweep structures store local cell indices in 32 bits, global ids are only used for
+  // communication with other locations
+  OpenSnLogicalErrorIf(grid_ptr_->local_cells.size() >
+                         static_cast<size_t>(std::numeric_limits<int32_t>::max()),
+                       "The number of local cells (" +
+                         std::to_string(grid_ptr_->local_cells.size()) +
+                         ") exceeds the 32-bit local indices of the sweep data structures.");
+
   // Define sweep ordering groups
   quadrature_unq_so_grouping_map_.clear();
   std::map<std::shared_ptr<AngularQuadrature>, bool> quadrature_allow_cycles_map_;
@@ -995,13 +1038,13 @@ DiscreteOrdinatesSolver::InitializeSweepDataStructures()
       if (sweep_type_ == "AAH")
       {
         quadrature_fluds_commondata_map_[quadrature].push_back(
-          std::make_unique<AAH_FLUDSCommonData>(
+          std::make_shared<AAH_FLUDSCommonData>(
             grid_nodal_mappings_, *spds, *grid_face_histogram_));
       }
       else if (sweep_type_ == "CBC")
       {
         quadrature_fluds_commondata_map_[quadrature].push_back(
-          std::make_unique<CBC_FLUDSCommonData>(*spds, grid_nodal_mappings_));
+          std::make_shared<CBC_FLUDSCommonData>(*spds, grid_nodal_mappings_));
       }
       else
         OpenSnInvalidArgument("Unsupported sweeptype \"" + sweep_type_ + "\"");
@@ -1011,6 +1054,51 @@ DiscreteOrdinatesSolver::InitializeSweepDataStructures()
   log.Log() << program_timer.GetTimeString() << " Done initializing sweep datastructures.\n";
 }
 
+void
+DiscreteOrdinatesSolver::ShareSweepDataStructures(const DiscreteOrdinatesSolver& other)
+{
+  CALI_CXX_MARK_SCOPE("DiscreteOrdinatesSolver::ShareSweepDataStructures");
+
+  OpenSnInvalidArgumentIf(other.grid_ptr_ != grid_ptr_,
+                          "Solver " + other.TextName() + " is defined on a different grid.");
+  OpenSnInvalidArgumentIf(other.sweep_type_ != sweep_type_,
+                          "Solver " + other.TextName() + " uses sweep type \"" +
+                            other.sweep_type_ + "\" instead of \"" + sweep_type_ + "\".");
+
+  quadrature_unq_so_grouping_map_.clear();
+  quadrature_spds_map_.clear();
+  quadrature_fluds_commondata_map_.clear();
+  for (const auto& groupset : groupsets_)
+  {
+    const auto& quadrature = groupset.quadrature_;
+    if (quadrature_spds_map_.count(quadrature) > 0)
+      continue;
+
+    const auto other_groupset =
+      std::find_if(other.groupsets_.begin(),
+                   other.groupsets_.end(),
+                   [&quadrature](const LBSGroupset& gs) { return gs.quadrature_ == quadrature; });
+    OpenSnInvalidArgumentIf(other_groupset == other.groupsets_.end() or
+                              other.quadrature_spds_map_.count(quadrature) == 0,
+                            "Solver " + other.TextName() + " has no sweep orderings for the "
+                              "quadrature of groupset " + std::to_string(groupset.id_) + ".");
+    OpenSnInvalidArgumentIf(other_groupset->angleagg_method_ != groupset.angleagg_method_ or
+                              other_groupset->allow_cycles_ != groupset.allow_cycles_,
+                            "Groupset " + std::to_string(groupset.id_) + " and the groupset of "
+                              "solver " + other.TextName() + " with the same quadrature differ "
+                              "in angle aggregation type or cycle handling.");
+
+    quadrature_unq_so_grouping_map_[quadrature] =
+      other.quadrature_unq_so_grouping_map_.at(quadrature);
+    quadrature_spds_map_[quadrature] = other.quadrature_spds_map_.at(quadrature);
+    quadrature_fluds_commondata_map_[quadrature] =
+      other.quadrature_fluds_commondata_map_.at(quadrature);
+  }
+
+  log.Log() << program_timer.GetTimeString() << " Sharing the sweep datastructures of solver "
+            << other.TextName() << ".\n";
+}
+
 std::pair<UniqueSOGroupings, DirIDToSOMap>
 DiscreteOrdinatesSolver::AssociateSOsAndDirections(const MeshContinuum& grid,
                                                    const AngularQuadrature& quadrature,
@@ -1184,6 +1272,23 @@ DiscreteOrdinatesSolver::InitFluxDataStructures(LBSGroupset& groupset)
 {
   CALI_CXX_MARK_SCOPE("DiscreteOrdinatesSolver::InitFluxDataStructures");
 
+  groupset.angle_agg_ = MakeAngleAggregation(groupset);
+
+  if (options_.verbose_inner_iterations)
+    log.Log() << program_timer.GetTimeString() << " Initialized angle aggregation.";
+
+  opensn::mpi_comm.barrier();
+}
+
+std::shared_ptr<AngleAggregation>
+DiscreteOrdinatesSolver::MakeAngleAggregation(LBSGroupset& groupset, size_t num_rhs)
+{
+  CALI_CXX_MARK_SCOPE("DiscreteOrdinatesSolver::MakeAngleAggregation");
+
+  OpenSnInvalidArgumentIf(num_rhs > 1 and sweep_type_ != "AAH",
+                          "Sweeping several right-hand sides at once requires sweep_type "
+                          "\"AAH\".");
+
   const auto& quadrature_sweep_info = quadrature_unq_so_grouping_map_[groupset.quadrature_];
 
   const auto& unique_so_groupings = quadrature_sweep_info.first;
@@ -1195,7 +1300,7 @@ DiscreteOrdinatesSolver::InitFluxDataStructures(LBSGroupset& groupset)
   // Passing the sweep boundaries
   //                                            to the angle aggregation
   typedef AngleAggregation AngleAgg;
-  groupset.angle_agg_ = std::make_shared<AngleAgg>(
+  auto angle_agg = std::make_shared<AngleAgg>(
     sweep_boundaries_, gs_num_grps, gs_num_ss, groupset.quadrature_, grid_ptr_);
 
   AngleSetGroup angle_set_group;
@@ -1213,7 +1318,8 @@ DiscreteOrdinatesSolver::InitFluxDataStructures(LBSGroupset& groupset)
 
     for (size_t gs_ss = 0; gs_ss < gs_num_ss; gs_ss++)
     {
-      const size_t gs_ss_size = groupset.grp_subset_infos_[gs_ss].ss_size;
+      // Right-hand sides swept together are an inner dimension of the groups of an angle set
+      const size_t gs_ss_size = groupset.grp_subset_infos_[gs_ss].ss_size * num_rhs;
       for (const auto& dir_ss_info : dir_subsets)
       {
         const auto& dir_ss_begin = dir_ss_info.ss_begin;
@@ -1276,12 +1382,9 @@ DiscreteOrdinatesSolver::InitFluxDataStructures(LBSGroupset& groupset)
     }   // for gs_ss
   }     // for so_grouping
 
-  groupset.angle_agg_->angle_set_groups.push_back(std::move(angle_set_group));
-
-  if (options_.verbose_inner_iterations)
-    log.Log() << program_timer.GetTimeString() << " Initialized angle aggregation.";
+  angle_agg->angle_set_groups.push_back(std::move(angle_set_group));
 
-  opensn::mpi_comm.barrier();
+  return angle_agg;
 }
 
 std::shared_ptr<SweepChunk>
@@ -1327,5 +1430,31 @@ DiscreteOrdinatesSolver::SetSweepChunk(LBSGroupset& groupset)
     OpenSnLogicalError("Unsupported sweep_type_ \"" + sweep_type_ + "\"");
 }
 
+std::shared_ptr<SweepChunk>
+DiscreteOrdinatesSolver::MakeBatchedSweepChunk(LBSGroupset& groupset,
+                                               std::vector<double>& destination_phi,
+                                               const std::vector<double>& source_moments,
+                                               size_t num_rhs)
+{
+  CALI_CXX_MARK_SCOPE("DiscreteOrdinatesSolver::MakeBatchedSweepChunk");
+
+  OpenSnInvalidArgumentIf(sweep_type_ != "AAH",
+                          "Sweeping several right-hand sides at once requires sweep_type "
+                          "\"AAH\".");
+
+  return std::make_shared<AahBatchedSweepChunk>(*grid_ptr_,
+                                                *discretization_,
+                                                unit_cell_matrices_,
+                                                cell_transport_views_,
+                                                densities_local_,
+                                                destination_phi,
+                                                source_moments,
+                                                groupset,
+                                                matid_to_xs_map_,
+                                                num_moments_,
+                                                max_cell_dof_count_,
+                                                num_rhs);
+}
+
 } // namespace lbs
 } // namespace opensn
@@ -83,6 +83,32 @@ public:
   std::map<uint64_t, std::vector<double>>
   ComputeLeakage(const std::vector<uint64_t>& boundary_ids) const;
 
+  /**
+   * Returns the time-dependent terms applied by the sweep chunks of all groupsets. Transient
+   * executors set the terms of a time step through this reference.
+   */
+  TimeDependentSweepTerms& GetTimeDependentSweepTerms() { return time_dependent_terms_; }
+
+  /**
+   * Builds the angle sets of a groupset from the sweep orderings of its quadrature. With more
+   * than one right-hand side the FLUDS and sweep messages of every angle set are sized for
+   * num_rhs values per group, so a batched sweep chunk can sweep that many sources at once.
+   * Batched angle aggregations are only supported by the AAH sweep type.
+   */
+  std::shared_ptr<AngleAggregation> MakeAngleAggregation(LBSGroupset& groupset,
+                                                         size_t num_rhs = 1);
+
+  /**
+   * Makes a sweep chunk that sweeps num_rhs right-hand sides of a groupset at once. The source
+   * and destination flux moments are indexed [dof * num_rhs + k], where dof is the index in the
+   * primary STL vectors. The chunk must be used with an angle aggregation made for the same
+   * number of right-hand sides.
+   */
+  std::shared_ptr<SweepChunk> MakeBatchedSweepChunk(LBSGroupset& groupset,
+                                                    std::vector<double>& destination_phi,
+                                                    const std::vector<double>& source_moments,
+                                                    size_t num_rhs);
+
 protected:
   explicit DiscreteOrdinatesSolver(const std::string& text_name);
 
@@ -91,6 +117,12 @@ protected:
    */
   void InitializeWGSSolvers() override;
 
+  /**
+   * Additionally registers the memory of the sweep plane data structures and the flux buffers
+   * of the angle sets.
+   */
+  void ReportMemoryUsage() const override;
+
   /**
    * This routine initializes basic sweep datastructures that are agnostic of
    * the number of groups and essentially the groupsets. The routine rebuilds
@@ -108,6 +140,14 @@ protected:
    */
   void InitializeSweepDataStructures();
 
+  /**
+   * Uses the sweep orderings, SPDSs and FLUDS common data of another, initialized solver on the
+   * same grid instead of building them with InitializeSweepDataStructures. Every quadrature of
+   * this solver must be used by a groupset of the other solver with the same angle aggregation
+   * type and cycle handling, and both solvers must use the same sweep type.
+   */
+  void ShareSweepDataStructures(const DiscreteOrdinatesSolver& other);
+
   /**
    * Initializes fluds_ data structures.
    */
@@ -127,12 +167,14 @@ protected:
     quadrature_unq_so_grouping_map_;
   std::map<std::shared_ptr<AngularQuadrature>, std::vector<std::shared_ptr<SPDS>>>
     quadrature_spds_map_;
-  std::map<std::shared_ptr<AngularQuadrature>, std::vector<std::unique_ptr<FLUDSCommonData>>>
+  std::map<std::shared_ptr<AngularQuadrature>, std::vector<std::shared_ptr<FLUDSCommonData>>>
     quadrature_fluds_commondata_map_;
 
   std::vector<size_t> verbose_sweep_angles_;
   const std::string sweep_type_;
 
+  TimeDependentSweepTerms time_dependent_terms_;
+
 public:
   static InputParameters GetInputParameters();
 
@@ -4,6 +4,7 @@
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/angle_set/aah_angle_set.h"
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep_chunks/sweep_chunk.h"
 #include "framework/logging/log.h"
+#include "framework/utils/event_trace.h"
 #include "framework/runtime.h"
 #include "caliper/cali.h"
 
@@ -55,16 +56,43 @@ AAH_AngleSet::AngleSetAdvance(SweepChunk& sweep_chunk, AngleSetStatus permission
       break;
     }
 
+  // Trace the interval during which the angle set waits on upstream data. The scheduler advances
+  // other angle sets in the meantime, so this is not time the location is blocked, and the
+  // interval is recorded as an async event because it overlaps their events.
+  auto& trace = EventTrace::GetInstance();
+  if (trace.IsEnabled())
+  {
+    if (status == AngleSetStatus::RECEIVING and trace_start_ < 0.0)
+      trace_start_ = trace.Now();
+    else if (status != AngleSetStatus::RECEIVING and trace_start_ >= 0.0)
+    {
+      trace.RecordAsync("upstream_pending",
+                        "sweep",
+                        trace_start_,
+                        trace.Now() - trace_start_,
+                        static_cast<int64_t>(id_));
+      trace_start_ = -1.0;
+    }
+  }
+
   if (status == AngleSetStatus::RECEIVING)
     return status;
   else if (status == AngleSetStatus::READY_TO_EXECUTE and permission == AngleSetStatus::EXECUTE)
   {
+    EventTraceScope angle_set_scope("angle_set", "sweep", static_cast<int64_t>(id_));
+
     async_comm_.InitializeLocalAndDownstreamBuffers();
 
-    sweep_chunk.Sweep(*this); // Execute chunk
+    {
+      EventTraceScope chunk_scope("sweep_chunk", "sweep", static_cast<int64_t>(id_));
+      sweep_chunk.Sweep(*this); // Execute chunk
+    }
 
     // Send outgoing psi and clear local and receive buffers
-    async_comm_.SendDownstreamPsi(static_cast<int>(this->GetID()));
+    {
+      EventTraceScope send_scope("send_post", "sweep", static_cast<int64_t>(id_));
+      async_comm_.SendDownstreamPsi(static_cast<int>(this->GetID()));
+    }
     async_comm_.ClearLocalAndReceiveBuffers();
 
     // Update boundary readiness
@@ -72,6 +100,7 @@ AAH_AngleSet::AngleSetAdvance(SweepChunk& sweep_chunk, AngleSetStatus permission
       boundary->UpdateAnglesReadyStatus(angles_, group_subset_);
 
     executed_ = true;
+    ++num_working_advances_;
     return AngleSetStatus::FINISHED;
   }
   else
@@ -107,6 +136,7 @@ AAH_AngleSet::ResetSweepBuffers()
 {
   async_comm_.Reset();
   executed_ = false;
+  trace_start_ = -1.0;
 }
 
 bool
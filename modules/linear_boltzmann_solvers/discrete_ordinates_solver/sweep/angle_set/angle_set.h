@@ -29,6 +29,10 @@ protected:
   std::map<uint64_t, std::shared_ptr<SweepBoundary>>& boundaries_;
   const size_t group_subset_;
   bool executed_ = false;
+  /// Start time of the currently traced wait or activity, or negative if none
+  double trace_start_ = -1.0;
+  /// Number of advances in which the angle set swept cells
+  size_t num_working_advances_ = 0;
 
 public:
   AngleSet(size_t id,
@@ -70,6 +74,10 @@ public:
 
   size_t GetNumAngles() const { return angles_.size(); }
 
+  /**Returns the number of advances in which this angle set swept cells. Schedulers use it to
+   * detect passes in which the location only polls for upstream data.*/
+  size_t GetNumWorkingAdvances() const { return num_working_advances_; }
+
   virtual AsynchronousCommunicator* GetCommunicator()
   {
     OpenSnLogicalError("Method not implemented");
@@ -8,6 +8,7 @@
 #include "framework/mesh/mesh_continuum/mesh_continuum.h"
 #include "framework/math/math_range.h"
 #include "framework/logging/log.h"
+#include "framework/utils/event_trace.h"
 #include "framework/runtime.h"
 #include "caliper/cali.h"
 
@@ -53,7 +54,7 @@ CBC_AngleSet::AngleSetAdvance(SweepChunk& sweep_chunk, AngleSetStatus permission
 
   auto tasks_who_received_data = async_comm_.ReceiveData();
 
-  for (const uint64_t task_number : tasks_who_received_data)
+  for (const uint32_t task_number : tasks_who_received_data)
     --current_task_list_[task_number].num_dependencies_;
 
   async_comm_.SendData();
@@ -63,6 +64,10 @@ CBC_AngleSet::AngleSetAdvance(SweepChunk& sweep_chunk, AngleSetStatus permission
     if (not boundary->CheckAnglesReadyStatus(angles_, group_subset_))
       return Status::NOT_FINISHED;
 
+  auto& trace = EventTrace::GetInstance();
+  const double chunk_start = trace.IsEnabled() ? trace.Now() : -1.0;
+  size_t num_tasks_executed = 0;
+
   bool all_tasks_completed = true;
   bool a_task_executed = true;
   while (a_task_executed)
@@ -77,17 +82,39 @@ CBC_AngleSet::AngleSetAdvance(SweepChunk& sweep_chunk, AngleSetStatus permission
         sweep_chunk.SetCell(cell_task.cell_ptr_, *this);
         sweep_chunk.Sweep(*this);
 
-        for (uint64_t local_task_num : cell_task.successors_)
+        for (const uint32_t local_task_num : cell_task.successors_)
           --current_task_list_[local_task_num].num_dependencies_;
 
         cell_task.completed_ = true;
         a_task_executed = true;
+        ++num_tasks_executed;
         async_comm_.SendData();
       }
     } // for cell_task
     async_comm_.SendData();
   }
 
+  if (num_tasks_executed > 0)
+    ++num_working_advances_;
+
+  // Trace the cells swept in this advance and the interval since the previous advance that swept
+  // cells, during which the angle set was waiting on upstream data. Other angle sets advance in
+  // that interval, so it is not time the location is blocked, and it is recorded as an async
+  // event because it overlaps their events.
+  if (chunk_start >= 0.0 and num_tasks_executed > 0)
+  {
+    if (trace_start_ >= 0.0)
+      trace.RecordAsync("upstream_pending",
+                        "sweep",
+                        trace_start_,
+                        chunk_start - trace_start_,
+                        static_cast<int64_t>(id_));
+    const double chunk_end = trace.Now();
+    trace.Record(
+      "sweep_chunk", "sweep", chunk_start, chunk_end - chunk_start, static_cast<int64_t>(id_));
+    trace_start_ = chunk_end;
+  }
+
   const bool all_messages_sent = async_comm_.SendData();
 
   if (all_tasks_completed and all_messages_sent)
@@ -109,6 +136,7 @@ CBC_AngleSet::ResetSweepBuffers()
   async_comm_.Reset();
   fluds_->ClearLocalAndReceivePsi();
   executed_ = false;
+  trace_start_ = -1.0;
 }
 
 const double*
@@ -21,16 +21,33 @@ ArbitraryBoundary::PsiIncoming(uint64_t cell_local_id,
                                int group_num,
                                size_t gs_ss_begin)
 {
-  if (local_cell_data_.empty())
+  if (not is_setup_)
   {
     log.LogAllError() << "PsiIncoming call made to an arbitrary boundary "
                          "with that information not yet set up.";
     exit(EXIT_FAILURE);
   }
 
-  const size_t dof_offset = num_groups_ * angle_num + group_num;
+  // A cell has at most a handful of faces on a boundary
+  const uint64_t bface_end = cell_bface_offsets_[cell_local_id + 1];
+  for (uint64_t bf = cell_bface_offsets_[cell_local_id]; bf < bface_end; ++bf)
+    if (bface_face_indices_[bf] == face_num)
+    {
+      const size_t node = bface_node_offsets_[bf] + fi;
+      const size_t num_angles = angle_indices_.size();
+      return &psi_[(node * num_angles + angle_num) * num_groups_ + group_num];
+    }
 
-  return &local_cell_data_[cell_local_id][face_num][fi][dof_offset];
+  return ZeroFlux(group_num);
+}
+
+void
+ArbitraryBoundary::SetEvaluationTime(double time)
+{
+  SweepBoundary::SetEvaluationTime(time);
+
+  if (is_setup_ and boundary_function_->IsTimeDependent() and time != evaluated_time_)
+    EvaluateBoundaryValues(time);
 }
 
 void
@@ -38,93 +55,151 @@ ArbitraryBoundary::Setup(const MeshContinuum& grid, const AngularQuadrature& qua
 {
   CALI_CXX_MARK_SCOPE("ArbitraryBoundary::Setup");
 
+  // Build the compressed-row structure of the faces on this boundary
   const size_t num_local_cells = grid.local_cells.size();
-  local_cell_data_.clear();
-  local_cell_data_.reserve(num_local_cells);
+  cell_bface_offsets_.assign(num_local_cells + 1, 0);
+  bface_face_indices_.clear();
+  bface_cell_global_ids_.clear();
+  bface_cell_material_ids_.clear();
+  bface_normals_.clear();
+  bface_node_offsets_.assign(1, 0);
+  node_locations_.clear();
 
-  std::vector<bool> cell_bndry_flags(num_local_cells, false);
   for (const auto& cell : grid.local_cells)
-    for (const auto& face : cell.faces_)
-      if (not face.has_neighbor_)
-      {
-        cell_bndry_flags[cell.local_id_] = true;
-        break;
-      }
-
-  size_t num_angles = quadrature.omegas_.size();
+  {
+    for (size_t f = 0; f < cell.faces_.size(); ++f)
+    {
+      const auto& face = cell.faces_[f];
+      if (face.has_neighbor_ or face.neighbor_id_ != boundary_id_)
+        continue;
+
+      bface_face_indices_.push_back(static_cast<unsigned int>(f));
+      bface_cell_global_ids_.push_back(cell.global_id_);
+      bface_cell_material_ids_.push_back(cell.material_id_);
+      bface_normals_.push_back(face.normal_);
+      for (uint64_t vid : face.vertex_ids_)
+        node_locations_.push_back(grid.vertices[vid]);
+      bface_node_offsets_.push_back(node_locations_.size());
+    }
+    cell_bface_offsets_[cell.local_id_ + 1] = bface_face_indices_.size();
+  }
 
-  typedef std::pair<double, double> PhiTheta;
+  // Quadrature and group data
+  const size_t num_angles = quadrature.omegas_.size();
 
-  std::vector<int> angle_indices;
-  std::vector<Vector3> angle_vectors;
-  std::vector<PhiTheta> phi_theta_angles;
-  std::vector<int> group_indices;
+  angle_indices_.clear();
+  angle_vectors_.clear();
+  phi_theta_angles_.clear();
+  group_indices_.clear();
 
-  angle_indices.reserve(num_angles);
-  angle_vectors.reserve(num_angles);
-  phi_theta_angles.reserve(num_angles);
-  group_indices.reserve(num_groups_);
+  angle_indices_.reserve(num_angles);
+  angle_vectors_.reserve(num_angles);
+  phi_theta_angles_.reserve(num_angles);
+  group_indices_.reserve(num_groups_);
 
-  int num_angles_int = static_cast<int>(num_angles);
-  for (int n = 0; n < num_angles_int; ++n)
-    angle_indices.emplace_back(n);
-  for (int n = 0; n < num_angles_int; ++n)
-    angle_vectors.emplace_back(quadrature.omegas_[n]);
-  for (int n = 0; n < num_angles_int; ++n)
+  for (size_t n = 0; n < num_angles; ++n)
   {
-    auto& abscissae = quadrature.abscissae_[n];
-    double phi = abscissae.phi;
-    double theta = abscissae.theta;
-    phi_theta_angles.emplace_back(std::make_pair(phi, theta));
+    const auto& abscissae = quadrature.abscissae_[n];
+    angle_indices_.push_back(static_cast<int>(n));
+    angle_vectors_.push_back(quadrature.omegas_[n]);
+    phi_theta_angles_.emplace_back(abscissae.phi, abscissae.theta);
   }
-  for (int g = 0; g < static_cast<int>(num_groups_); ++g)
-    group_indices.emplace_back(g);
+  for (size_t g = 0; g < num_groups_; ++g)
+    group_indices_.push_back(static_cast<int>(g));
 
-  const double eval_time = GetEvaluationTime();
+  psi_.assign(node_locations_.size() * num_angles * num_groups_, 0.0);
 
-  for (const auto& cell : grid.local_cells)
+  EvaluateBoundaryValues(GetEvaluationTime());
+  is_setup_ = true;
+}
+
+void
+ArbitraryBoundary::EvaluateBoundaryValues(double time)
+{
+  CALI_CXX_MARK_SCOPE("ArbitraryBoundary::EvaluateBoundaryValues");
+
+  const size_t num_angles = angle_indices_.size();
+  const size_t block_size = num_angles * num_groups_;
+  const bool separable = boundary_function_->IsSeparable();
+
+  std::vector<double> angle_factors;
+  std::vector<double> group_factors;
+
+  const size_t num_bfaces = bface_face_indices_.size();
+  for (size_t bf = 0; bf < num_bfaces; ++bf)
   {
-    if (cell_bndry_flags[cell.local_id_])
+    const uint64_t node_begin = bface_node_offsets_[bf];
+    const uint64_t node_end = bface_node_offsets_[bf + 1];
+    for (uint64_t node = node_begin; node < node_end; ++node)
     {
-      CellData cell_data(cell.faces_.size());
+      const auto fi = static_cast<unsigned int>(node - node_begin);
+      double* psi_block = &psi_[node * block_size];
 
-      for (size_t f = 0; f < cell.faces_.size(); ++f)
+      if (separable)
       {
-        auto& face = cell.faces_[f];
-        size_t face_num_nodes = face.vertex_ids_.size();
-        FaceData face_data;
-
-        if (not face.has_neighbor_ and face.neighbor_id_ == boundary_id_)
-        {
-          face_data.reserve(face_num_nodes);
-          for (size_t i = 0; i < face_num_nodes; ++i)
-          {
-            std::vector<double> face_node_data =
-              boundary_function_->Evaluate(cell.global_id_,
-                                           cell.material_id_,
-                                           f,
-                                           i,
-                                           grid.vertices[face.vertex_ids_[i]],
-                                           face.normal_,
-                                           angle_indices,
-                                           angle_vectors,
-                                           phi_theta_angles,
-                                           group_indices,
-                                           eval_time);
-
-            face_data.push_back(std::move(face_node_data));
-          } // for face node-i
-        }   // bndry face
-
-        cell_data[f] = std::move(face_data);
-      } // for face f
-
-      local_cell_data_.push_back(std::move(cell_data));
-    } // if bndry cell
-    else
-      local_cell_data_.emplace_back();
-
-  } // for cell
+        boundary_function_->EvaluateSeparable(bface_cell_global_ids_[bf],
+                                              bface_cell_material_ids_[bf],
+                                              bface_face_indices_[bf],
+                                              fi,
+                                              node_locations_[node],
+                                              bface_normals_[bf],
+                                              angle_vectors_,
+                                              phi_theta_angles_,
+                                              time,
+                                              angle_factors,
+                                              group_factors);
+
+        OpenSnLogicalErrorIf(angle_factors.size() != num_angles or
+                               group_factors.size() != num_groups_,
+                             "Separable boundary function returned factors of the wrong size.");
+
+        for (size_t n = 0; n < num_angles; ++n)
+          for (size_t g = 0; g < num_groups_; ++g)
+            psi_block[n * num_groups_ + g] = angle_factors[n] * group_factors[g];
+      }
+      else
+      {
+        const auto values = boundary_function_->Evaluate(bface_cell_global_ids_[bf],
+                                                         bface_cell_material_ids_[bf],
+                                                         bface_face_indices_[bf],
+                                                         fi,
+                                                         node_locations_[node],
+                                                         bface_normals_[bf],
+                                                         angle_indices_,
+                                                         angle_vectors_,
+                                                         phi_theta_angles_,
+                                                         group_indices_,
+                                                         time);
+
+        OpenSnLogicalErrorIf(values.size() != block_size,
+                             "Boundary function returned " + std::to_string(values.size()) +
+                               " values but " + std::to_string(block_size) + " are required.");
+
+        std::copy(values.begin(), values.end(), psi_block);
+      }
+    } // for node
+  }   // for boundary face
+
+  evaluated_time_ = time;
+}
+
+MemoryUsage
+ArbitraryBoundary::ComputeMemoryUsage() const
+{
+  MemoryUsage usage = SweepBoundary::ComputeMemoryUsage();
+  usage += GetMemoryUsage(cell_bface_offsets_);
+  usage += GetMemoryUsage(bface_face_indices_);
+  usage += GetMemoryUsage(bface_cell_global_ids_);
+  usage += GetMemoryUsage(bface_cell_material_ids_);
+  usage += GetMemoryUsage(bface_normals_);
+  usage += GetMemoryUsage(bface_node_offsets_);
+  usage += GetMemoryUsage(node_locations_);
+  usage += GetMemoryUsage(angle_indices_);
+  usage += GetMemoryUsage(angle_vectors_);
+  usage += GetMemoryUsage(phi_theta_angles_);
+  usage += GetMemoryUsage(group_indices_);
+  usage += GetMemoryUsage(psi_);
+  return usage;
 }
 
 } // namespace lbs
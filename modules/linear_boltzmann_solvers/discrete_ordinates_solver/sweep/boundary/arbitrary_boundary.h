@@ -16,22 +16,48 @@ namespace lbs
 
 /**
  * Specified incident fluxes on a boundary.
+ *
+ * The incident fluxes are only stored for the local faces on this boundary. Boundary faces are
+ * numbered in local-cell order and the data is stored in compressed-row form: the nodes of
+ * boundary face `bf` are `[bface_node_offsets_[bf], bface_node_offsets_[bf + 1])` and each node
+ * holds a contiguous angle-major block of `num_angles * num_groups` values. The geometry passed to
+ * the boundary function is cached so that time-dependent functions can be re-evaluated, in place,
+ * without visiting the mesh.
  */
 class ArbitraryBoundary : public SweepBoundary
 {
 private:
-  std::unique_ptr<BoundaryFunction> boundary_function_;
+  std::shared_ptr<BoundaryFunction> boundary_function_;
   const uint64_t boundary_id_;
 
-  typedef std::vector<double> FaceNodeData;
-  typedef std::vector<FaceNodeData> FaceData;
-  typedef std::vector<FaceData> CellData;
+  /// Boundary faces of local cell c are [cell_bface_offsets_[c], cell_bface_offsets_[c + 1])
+  std::vector<uint64_t> cell_bface_offsets_;
+  /// Per boundary face: the face index within its cell, the cell global id and material id
+  std::vector<unsigned int> bface_face_indices_;
+  std::vector<uint64_t> bface_cell_global_ids_;
+  std::vector<int> bface_cell_material_ids_;
+  std::vector<Vector3> bface_normals_;
+  /// Nodes of boundary face bf are [bface_node_offsets_[bf], bface_node_offsets_[bf + 1])
+  std::vector<uint64_t> bface_node_offsets_;
+  std::vector<Vector3> node_locations_;
 
-  std::vector<CellData> local_cell_data_;
+  /// Quadrature and group data passed to the boundary function
+  std::vector<int> angle_indices_;
+  std::vector<Vector3> angle_vectors_;
+  std::vector<std::pair<double, double>> phi_theta_angles_;
+  std::vector<int> group_indices_;
+
+  /// Incident fluxes, indexed [(node * num_angles + angle) * num_groups + group]
+  std::vector<double> psi_;
+  double evaluated_time_ = 0.0;
+  bool is_setup_ = false;
+
+  /// Evaluates the boundary function at all boundary face nodes.
+  void EvaluateBoundaryValues(double time);
 
 public:
   explicit ArbitraryBoundary(size_t num_groups,
-                             std::unique_ptr<BoundaryFunction> bndry_function,
+                             std::shared_ptr<BoundaryFunction> bndry_function,
                              uint64_t boundary_id,
                              CoordinateSystemType coord_type = CoordinateSystemType::CARTESIAN)
     : SweepBoundary(BoundaryType::ARBITRARY, num_groups, coord_type),
@@ -47,7 +73,15 @@ public:
                       int group_num,
                       size_t gs_ss_begin) override;
 
+  /**
+   * Sets the evaluation time and, for time-dependent boundary functions, re-evaluates the
+   * incident fluxes if the time changed.
+   */
+  void SetEvaluationTime(double time) override;
+
   void Setup(const MeshContinuum& grid, const AngularQuadrature& quadrature) override;
+
+  MemoryUsage ComputeMemoryUsage() const override;
 };
 
 } // namespace lbs
@@ -75,5 +75,15 @@ ReflectingBoundary::ResetAnglesReadyStatus()
       flags[gs_ss] = false;
 }
 
+MemoryUsage
+ReflectingBoundary::ComputeMemoryUsage() const
+{
+  MemoryUsage usage = SweepBoundary::ComputeMemoryUsage();
+  usage += GetMemoryUsage(boundary_flux_);
+  usage += GetMemoryUsage(boundary_flux_old_);
+  usage += GetMemoryUsage(reflected_anglenum_);
+  return usage;
+}
+
 } // namespace lbs
 } // namespace opensn
@@ -81,6 +81,8 @@ public:
    * Resets angle ready flags to false.
    */
   void ResetAnglesReadyStatus();
+
+  MemoryUsage ComputeMemoryUsage() const override;
 };
 
 } // namespace lbs
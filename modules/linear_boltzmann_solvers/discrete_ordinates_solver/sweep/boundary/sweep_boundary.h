@@ -4,7 +4,9 @@
 #pragma once
 
 #include "modules/linear_boltzmann_solvers/lbs_solver/lbs_structs.h"
+#include "framework/object.h"
 #include <vector>
+#include <stdexcept>
 
 namespace opensn
 {
@@ -44,7 +46,11 @@ public:
 
   double GetEvaluationTime() const { return evaluation_time_; }
 
-  void SetEvaluationTime(double time) { evaluation_time_ = time; }
+  /**
+   * Sets the time value passed to boundary functions. Boundaries with time-dependent data
+   * re-evaluate it here.
+   */
+  virtual void SetEvaluationTime(double time) { evaluation_time_ = time; }
 
   /**
    * Returns a pointer to the location of the incoming flux.
@@ -74,17 +80,28 @@ public:
 
   virtual void Setup(const MeshContinuum& grid, const AngularQuadrature& quadrature) {}
 
+  /**
+   * Returns the heap memory held by the boundary.
+   */
+  virtual MemoryUsage ComputeMemoryUsage() const { return GetMemoryUsage(zero_boundary_flux_); }
+
   double* ZeroFlux(int group_num) { return &zero_boundary_flux_[group_num]; }
 };
 
 /**
  * This boundary function class can be derived from to
  * provide a much more custom experience. This function
- * is called during Setup.
+ * is called during Setup. Boundary functions are objects so that
+ * input languages can create them and pass their handle to the
+ * boundary options.
  */
-class BoundaryFunction
+class BoundaryFunction : public Object
 {
 public:
+  BoundaryFunction() = default;
+
+  explicit BoundaryFunction(const InputParameters& params) : Object(params) {}
+
   /**Customized boundary function by calling a lua routine.*/
   virtual std::vector<double>
   Evaluate(size_t cell_global_id,
@@ -99,6 +116,38 @@ public:
            const std::vector<int>& group_indices,
            double time) = 0;
 
+  /**
+   * Functions that do not depend on time return false. Their values are then evaluated once and
+   * not re-evaluated when the evaluation time changes.
+   */
+  virtual bool IsTimeDependent() const { return true; }
+
+  /**
+   * Functions whose values at a face node factor into an energy and an angular part,
+   * psi(n, g) = a(n) s(g), return true and implement `EvaluateSeparable`.
+   */
+  virtual bool IsSeparable() const { return false; }
+
+  /**
+   * Evaluates the angular factors, one per quadrature angle, and the group factors, one per
+   * group, of a separable function at a face node.
+   */
+  virtual void
+  EvaluateSeparable(size_t cell_global_id,
+                    int cell_material_id,
+                    unsigned int face_index,
+                    unsigned int face_node_index,
+                    const Vector3& face_node_location,
+                    const Vector3& face_node_normal,
+                    const std::vector<Vector3>& quadrature_angle_vectors,
+                    const std::vector<std::pair<double, double>>& quadrature_phi_theta_angles,
+                    double time,
+                    std::vector<double>& angle_factors,
+                    std::vector<double>& group_factors)
+  {
+    throw std::logic_error("BoundaryFunction::EvaluateSeparable: Function is not separable.");
+  }
+
   virtual ~BoundaryFunction() = default;
 };
 
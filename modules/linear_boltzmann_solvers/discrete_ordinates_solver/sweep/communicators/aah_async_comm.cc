@@ -7,6 +7,7 @@
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/fluds/aah_fluds.h"
 #include "framework/mpi/mpi_comm_set.h"
 #include "framework/logging/log.h"
+#include "framework/utils/event_trace.h"
 #include "framework/runtime.h"
 #include "caliper/cali.h"
 
@@ -215,6 +216,7 @@ AAH_ASynchronousCommunicator::ReceiveDelayedData(int angle_set_num)
           all_messages_received = false;
           continue;
         }
+        EventTraceScope receive_scope("receive", "sweep", angle_set_num);
         if (not comm.recv<double>(source, tag, &upstream_psi[block_pos], size).error())
           delayed_preloc_msg_received_[i][m] = true;
       }
@@ -259,6 +261,7 @@ AAH_ASynchronousCommunicator::ReceiveUpstreamPsi(int angle_set_num)
           all_messages_received = false;
           continue;
         }
+        EventTraceScope receive_scope("receive", "sweep", angle_set_num);
         if (not comm.recv(source, tag, &upstream_psi[block_pos], size).error())
           preloc_msg_received_[i][m] = true;
       }
@@ -92,7 +92,7 @@ CBC_ASynchronousCommunicator::SendData()
   return all_messages_sent;
 }
 
-std::vector<uint64_t>
+std::vector<uint32_t>
 CBC_ASynchronousCommunicator::ReceiveData()
 {
   CALI_CXX_MARK_SCOPE("CBC_ASynchronousCommunicator::ReceiveData");
@@ -100,7 +100,7 @@ CBC_ASynchronousCommunicator::ReceiveData()
   typedef std::pair<uint64_t, unsigned int> CellFaceKey; // cell_gid + face_id
 
   std::map<CellFaceKey, std::vector<double>> received_messages;
-  std::vector<uint64_t> cells_who_received_data;
+  std::vector<uint32_t> cells_who_received_data;
   auto& location_dependencies = fluds_.GetSPDS().GetLocationDependencies();
   for (int locJ : location_dependencies)
   {
@@ -127,8 +127,8 @@ CBC_ASynchronousCommunicator::ReceiveData()
           psi_data.push_back(data_array.Read<double>());
 
         received_messages[{cell_global_id, face_id}] = std::move(psi_data);
-        cells_who_received_data.push_back(
-          fluds_.GetSPDS().Grid().MapCellGlobalID2LocalID(cell_global_id));
+        cells_who_received_data.push_back(static_cast<uint32_t>(
+          fluds_.GetSPDS().Grid().MapCellGlobalID2LocalID(cell_global_id)));
       } // while not at end of buffer
     }   // Process each message embedded in buffer
   }
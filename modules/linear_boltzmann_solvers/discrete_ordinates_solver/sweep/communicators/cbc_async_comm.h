@@ -45,7 +45,9 @@ public:
 
   bool SendData();
 
-  std::vector<uint64_t> ReceiveData();
+  /**Receives the upwind data of this angle set and returns the local ids of the cells that
+   * received data. Global cell ids are only used in the messages.*/
+  std::vector<uint32_t> ReceiveData();
 
   void Reset()
   {
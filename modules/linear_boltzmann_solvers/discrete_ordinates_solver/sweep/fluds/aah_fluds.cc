@@ -286,5 +286,19 @@ AAH_FLUDS::DelayedPrelocIOutgoingPsiOld()
   return delayed_prelocI_outgoing_psi_old_;
 }
 
+MemoryUsage
+AAH_FLUDS::ComputeMemoryUsage() const
+{
+  MemoryUsage usage = GetMemoryUsage(local_psi_);
+  usage += GetMemoryUsage(delayed_local_psi_);
+  usage += GetMemoryUsage(delayed_local_psi_old_);
+  usage += GetMemoryUsage(deplocI_outgoing_psi_);
+  usage += GetMemoryUsage(prelocI_outgoing_psi_);
+  usage += GetMemoryUsage(boundryI_incoming_psi_);
+  usage += GetMemoryUsage(delayed_prelocI_outgoing_psi_);
+  usage += GetMemoryUsage(delayed_prelocI_outgoing_psi_old_);
+  return usage;
+}
+
 } // namespace lbs
 } // namespace opensn
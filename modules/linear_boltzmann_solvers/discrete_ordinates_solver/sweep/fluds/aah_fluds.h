@@ -86,6 +86,8 @@ public:
 
   std::vector<std::vector<double>>& DelayedPrelocIOutgoingPsi() override;
   std::vector<std::vector<double>>& DelayedPrelocIOutgoingPsiOld() override;
+
+  MemoryUsage ComputeMemoryUsage() const override;
 };
 
 } // namespace lbs
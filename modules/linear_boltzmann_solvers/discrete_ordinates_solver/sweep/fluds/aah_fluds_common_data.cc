@@ -9,6 +9,7 @@
 #include "framework/runtime.h"
 #include "caliper/cali.h"
 #include <algorithm>
+#include <limits>
 
 namespace opensn
 {
@@ -100,16 +101,27 @@ AAH_FLUDSCommonData::InitializeAlphaElements(const SPDS& spds,
 
   } // for csoi
 
+  // The slot tables index the category buffers with 32-bit face-dof offsets
+  const auto CheckBlockStride = [](size_t block_stride)
+  {
+    OpenSnLogicalErrorIf(block_stride > std::numeric_limits<uint32_t>::max(),
+                         "The number of face dofs in a FLUDS face category (" +
+                           std::to_string(block_stride) +
+                           ") exceeds the 32-bit face-map indices of the sweep data structures.");
+  };
   for (size_t fc = 0; fc < num_face_categories; ++fc)
   {
-    local_psi_stride[fc] = grid_face_histogram.GetFaceHistogramBinDOFSize(fc);
+    const size_t stride = grid_face_histogram.GetFaceHistogramBinDOFSize(fc);
+    CheckBlockStride(stride * lock_boxes[fc].size());
+    local_psi_stride[fc] = stride;
     local_psi_max_elements[fc] = lock_boxes[fc].size();
-    local_psi_n_block_stride[fc] = local_psi_stride[fc] * lock_boxes[fc].size();
+    local_psi_n_block_stride[fc] = local_psi_stride[fc] * local_psi_max_elements[fc];
     local_psi_Gn_block_strideG[fc] = local_psi_n_block_stride[fc] * /*G=*/1;
   }
+  CheckBlockStride(static_cast<size_t>(largest_face) * delayed_lock_box.size());
   delayed_local_psi_stride = largest_face;
   delayed_local_psi_max_elements = delayed_lock_box.size();
-  delayed_local_psi_Gn_block_stride = largest_face * delayed_lock_box.size();
+  delayed_local_psi_Gn_block_stride = delayed_local_psi_stride * delayed_local_psi_max_elements;
   delayed_local_psi_Gn_block_strideG = delayed_local_psi_Gn_block_stride * /*G=*/1;
 
   log.Log(Logger::LOG_LVL::LOG_0VERBOSE_2) << "Done with Local Incidence mapping.";
@@ -54,20 +54,20 @@ protected:
   /// Number of face categories
   size_t num_face_categories = 0;
   /// Group-angle-faceDOF stride per cat
-  std::vector<size_t> local_psi_stride;
+  std::vector<uint32_t> local_psi_stride;
   /// Number of faces in each cat
-  std::vector<size_t> local_psi_max_elements;
+  std::vector<uint32_t> local_psi_max_elements;
   /// Group-angle-faceDOF stride delayed cat
-  size_t delayed_local_psi_stride = 0;
+  uint32_t delayed_local_psi_stride = 0;
   /// Number of faces in delayed cat
-  size_t delayed_local_psi_max_elements = 0;
+  uint32_t delayed_local_psi_max_elements = 0;
 
   /// local_psi_n_block_stride[fc]. Given face category fc, the value is
   /// total number of faces that store information in this category's buffer
   /// per angle
-  std::vector<size_t> local_psi_n_block_stride;
+  std::vector<uint32_t> local_psi_n_block_stride;
   std::vector<size_t> local_psi_Gn_block_strideG;
-  size_t delayed_local_psi_Gn_block_stride = 0;
+  uint32_t delayed_local_psi_Gn_block_stride = 0;
   size_t delayed_local_psi_Gn_block_strideG = 0;
 
   /// Very small vector listing the boundaries this location depends on
@@ -59,5 +59,20 @@ CBC_FLUDS::GetNonLocalUpwindPsi(const std::vector<double>& psi_data,
   return &psi_data[dof_map];
 }
 
+MemoryUsage
+CBC_FLUDS::ComputeMemoryUsage() const
+{
+  MemoryUsage usage = GetMemoryUsage(delayed_local_psi_);
+  usage += GetMemoryUsage(delayed_local_psi_old_);
+  usage += GetMemoryUsage(deplocI_outgoing_psi_);
+  usage += GetMemoryUsage(prelocI_outgoing_psi_);
+  usage += GetMemoryUsage(boundryI_incoming_psi_);
+  usage += GetMemoryUsage(delayed_prelocI_outgoing_psi_);
+  usage += GetMemoryUsage(delayed_prelocI_outgoing_psi_old_);
+  for (const auto& [key, message] : deplocs_outgoing_messages_)
+    usage += GetMemoryUsage(message);
+  return usage;
+}
+
 } // namespace lbs
 } // namespace opensn
@@ -72,6 +72,9 @@ public:
     return delayed_prelocI_outgoing_psi_old_;
   }
 
+  /**The local angular fluxes are stored in the solver's psi vector and are not counted.*/
+  MemoryUsage ComputeMemoryUsage() const override;
+
   // cell_global_id
   // face_id
   typedef std::pair<uint64_t, unsigned int> CellFaceKey;
@@ -4,6 +4,7 @@
 #pragma once
 
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/fluds/fluds_common_data.h"
+#include "framework/utils/memory_registry.h"
 #include <vector>
 #include <set>
 #include <cstddef>
@@ -55,6 +56,9 @@ public:
 
   virtual std::vector<std::vector<double>>& DelayedPrelocIOutgoingPsiOld() = 0;
 
+  /**Returns the heap memory currently held by the flux buffers.*/
+  virtual MemoryUsage ComputeMemoryUsage() const { return {}; }
+
   virtual ~FLUDS() = default;
 
 protected:
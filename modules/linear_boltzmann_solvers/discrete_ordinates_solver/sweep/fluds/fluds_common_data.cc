@@ -21,7 +21,7 @@ FLUDSCommonData::GetSPDS() const
 }
 
 const FaceNodalMapping&
-FLUDSCommonData::GetFaceNodalMapping(uint64_t cell_local_id, unsigned int face_id) const
+FLUDSCommonData::GetFaceNodalMapping(uint32_t cell_local_id, unsigned int face_id) const
 {
   return grid_nodal_mappings_[cell_local_id][face_id];
 }
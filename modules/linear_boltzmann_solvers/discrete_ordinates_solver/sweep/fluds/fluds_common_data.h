@@ -42,7 +42,7 @@ public:
   virtual ~FLUDSCommonData() = default;
 
   const SPDS& GetSPDS() const;
-  const FaceNodalMapping& GetFaceNodalMapping(uint64_t cell_local_id, unsigned int face_id) const;
+  const FaceNodalMapping& GetFaceNodalMapping(uint32_t cell_local_id, unsigned int face_id) const;
 
 protected:
   const SPDS& spds_;
@@ -5,6 +5,7 @@
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/spds/spds_adams_adams_hawkins.h"
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/boundary/reflecting_boundary.h"
 #include "framework/logging/log.h"
+#include "framework/utils/event_trace.h"
 #include "framework/runtime.h"
 #include "caliper/cali.h"
 #include <sstream>
@@ -15,6 +16,63 @@ namespace opensn
 namespace lbs
 {
 
+namespace
+{
+
+/**Traces the runs of scheduler passes in which no angle set swept cells. In such passes the
+ * location only polls for upstream data, i.e., it is blocked on receives.*/
+class ReceiveWaitTrace
+{
+public:
+  explicit ReceiveWaitTrace(AngleAggregation& angle_agg)
+    : angle_agg_(angle_agg), trace_(EventTrace::GetInstance())
+  {
+  }
+
+  /**Marks the start of a scheduler pass.*/
+  void BeginPass()
+  {
+    if (not trace_.IsEnabled())
+      return;
+    pass_start_ = trace_.Now();
+    num_working_advances_ = CountWorkingAdvances();
+  }
+
+  /**Marks the end of a scheduler pass. The final pass, in which all angle sets are finished,
+   * ends a wait.*/
+  void EndPass(bool finished)
+  {
+    if (not trace_.IsEnabled())
+      return;
+    const bool idle = not finished and CountWorkingAdvances() == num_working_advances_;
+    if (idle and wait_start_ < 0.0)
+      wait_start_ = pass_start_;
+    else if (not idle and wait_start_ >= 0.0)
+    {
+      trace_.Record("receive_wait", "sweep", wait_start_, pass_start_ - wait_start_);
+      wait_start_ = -1.0;
+    }
+  }
+
+private:
+  size_t CountWorkingAdvances() const
+  {
+    size_t count = 0;
+    for (auto& angle_set_group : angle_agg_.angle_set_groups)
+      for (auto& angle_set : angle_set_group.AngleSets())
+        count += angle_set->GetNumWorkingAdvances();
+    return count;
+  }
+
+  AngleAggregation& angle_agg_;
+  EventTrace& trace_;
+  double pass_start_ = -1.0;
+  double wait_start_ = -1.0;
+  size_t num_working_advances_ = 0;
+};
+
+} // namespace
+
 SweepScheduler::SweepScheduler(SchedulingAlgorithm scheduler_type,
                                AngleAggregation& angle_agg,
                                SweepChunk& sweep_chunk)
@@ -161,8 +219,10 @@ SweepScheduler::ScheduleAlgoDOG(SweepChunk& sweep_chunk)
   // Loop till done
   bool finished = false;
   size_t scheduled_angleset = 0;
+  ReceiveWaitTrace receive_wait_trace(angle_agg_);
   while (not finished)
   {
+    receive_wait_trace.BeginPass();
     finished = true;
     for (auto& rule_value : rule_values_)
     {
@@ -184,25 +244,18 @@ SweepScheduler::ScheduleAlgoDOG(SweepChunk& sweep_chunk)
       // and it is ready then it will be given permission
       if (status == AngleSetStatus::READY_TO_EXECUTE)
       {
-        std::stringstream message_i;
-        message_i << "Angleset " << angleset->GetID() << " executed on location "
-                  << opensn::mpi_comm.rank();
-
         status = angleset->AngleSetAdvance(sweep_chunk, AngleSetStatus::EXECUTE);
-
-        std::stringstream message_f;
-        message_f << "Angleset " << angleset->GetID() << " finished on location "
-                  << opensn::mpi_comm.rank();
-
         scheduled_angleset++; // Schedule the next angleset
       }
 
       if (status != AngleSetStatus::FINISHED)
         finished = false;
     } // for each angleset rule
-  }   // while not finished
+    receive_wait_trace.EndPass(finished);
+  } // while not finished
 
   // Receive delayed data
+  EventTraceScope delayed_data_scope("delayed_data_exchange", "sweep");
   opensn::mpi_comm.barrier();
   bool received_delayed_data = false;
   while (not received_delayed_data)
@@ -242,8 +295,10 @@ SweepScheduler::ScheduleAlgoFIFO(SweepChunk& sweep_chunk)
 
   // Loop over AngleSetGroups
   AngleSetStatus completion_status = AngleSetStatus::NOT_FINISHED;
+  ReceiveWaitTrace receive_wait_trace(angle_agg_);
   while (completion_status == AngleSetStatus::NOT_FINISHED)
   {
+    receive_wait_trace.BeginPass();
     completion_status = AngleSetStatus::FINISHED;
 
     for (auto& angle_set_group : angle_agg_.angle_set_groups)
@@ -254,9 +309,11 @@ SweepScheduler::ScheduleAlgoFIFO(SweepChunk& sweep_chunk)
         if (angle_set_status == AngleSetStatus::NOT_FINISHED)
           completion_status = AngleSetStatus::NOT_FINISHED;
       } // for angleset
-  }     // while not finished
+    receive_wait_trace.EndPass(completion_status == AngleSetStatus::FINISHED);
+  } // while not finished
 
   // Receive delayed data
+  EventTraceScope delayed_data_scope("delayed_data_exchange", "sweep");
   opensn::mpi_comm.barrier();
   bool received_delayed_data = false;
   while (not received_delayed_data)
@@ -293,6 +350,7 @@ void
 SweepScheduler::Sweep()
 {
   CALI_CXX_MARK_SCOPE("SweepScheduler::Sweep");
+  EventTraceScope sweep_scope("sweep", "sweep");
 
   if (scheduler_type_ == SchedulingAlgorithm::FIRST_IN_FIRST_OUT)
     ScheduleAlgoFIFO(sweep_chunk_);
@@ -364,5 +422,11 @@ SweepScheduler::SetBoundarySourceActiveFlag(bool flag_value)
   sweep_chunk_.SetBoundarySourceActiveFlag(flag_value);
 }
 
+void
+SweepScheduler::SetFixedSourceActiveFlag(bool flag_value)
+{
+  sweep_chunk_.SetFixedSourceActiveFlag(flag_value);
+}
+
 } // namespace lbs
 } // namespace opensn
@@ -136,6 +136,11 @@ public:
    * Activates or deactives the surface src flag.
    */
   void SetBoundarySourceActiveFlag(bool flag_value);
+
+  /**
+   * Activates or deactives the fixed src flag.
+   */
+  void SetFixedSourceActiveFlag(bool flag_value);
 };
 
 } // namespace lbs
@@ -3,7 +3,6 @@
 
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/spds/cbc_spds.h"
 #include "framework/mesh/mesh_continuum/mesh_continuum.h"
-#include "framework/graphs/directed_graph.h"
 #include "framework/logging/log.h"
 #include "framework/utils/timer.h"
 #include "framework/runtime.h"
@@ -27,9 +26,14 @@ CBC_SPDS::CBC_SPDS(const Vector3& omega,
 
   size_t num_loc_cells = grid.local_cells.size();
 
+  // Orthogonal meshes admit an analytic local ordering. The cell graph is only needed when
+  // that ordering is unavailable or when the graph is to be printed.
+  const bool try_orthogonal = grid.Type() == MeshType::ORTHOGONAL and not verbose_;
+
   // Populate Cell Relationships
   log.Log0Verbose1() << "Populating cell relationships";
-  std::vector<std::set<std::pair<int, double>>> cell_successors(num_loc_cells);
+  std::vector<std::set<std::pair<int, double>>> cell_successors(try_orthogonal ? 0
+                                                                               : num_loc_cells);
   std::set<int> location_successors;
   std::set<int> location_dependencies;
 
@@ -44,48 +48,18 @@ CBC_SPDS::CBC_SPDS(const Vector3& omega,
   for (auto v : location_dependencies)
     location_dependencies_.push_back(v);
 
-  // Build graph
-  DirectedGraph local_DG;
-
-  // Add vertex for each local cell
-  for (int c = 0; c < num_loc_cells; ++c)
-    local_DG.AddVertex();
-
-  // Create graph edges
-  for (int c = 0; c < num_loc_cells; c++)
-    for (auto& successor : cell_successors[c])
-      local_DG.AddEdge(c, successor.first, successor.second);
-
-  // Remove local cycles if allowed
-  if (verbose_)
-    PrintedGhostedGraph();
-
-  if (cycle_allowance_flag)
+  if (try_orthogonal and BuildOrthogonalLocalSweepOrder())
+    log.Log0Verbose1() << program_timer.GetTimeString()
+                       << " Local sweep ordering computed from orthogonal structure";
+  else
   {
-    log.Log0Verbose1() << program_timer.GetTimeString() << " Removing inter-cell cycles.";
-
-    auto edges_to_remove = local_DG.RemoveCyclicDependencies();
-
-    for (auto& edge_to_remove : edges_to_remove)
+    if (try_orthogonal)
     {
-      local_cyclic_dependencies_.emplace_back(edge_to_remove.first, edge_to_remove.second);
+      cell_successors.resize(num_loc_cells);
+      PopulateCellRelationships(
+        omega, location_dependencies, location_successors, cell_successors);
     }
-  }
-
-  // Generate topological sorting
-  log.Log0Verbose1() << program_timer.GetTimeString()
-                     << " Generating topological sorting for local sweep ordering";
-  auto so_temp = local_DG.GenerateTopologicalSort();
-  spls_.item_id.clear();
-  for (auto v : so_temp)
-    spls_.item_id.emplace_back(v);
-
-  if (spls_.item_id.empty())
-  {
-    log.LogAllError() << "Topological sorting for local sweep-ordering failed. "
-                      << "Cyclic dependencies detected. Cycles need to be allowed"
-                      << " by calling application.";
-    Exit(EXIT_FAILURE);
+    BuildLocalSweepOrder(cell_successors, cycle_allowance_flag);
   }
 
   //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%% Create Task
@@ -114,7 +88,7 @@ CBC_SPDS::CBC_SPDS(const Vector3& omega,
   {
     const size_t num_faces = cell.faces_.size();
     unsigned int num_dependencies = 0;
-    std::vector<uint64_t> succesors;
+    std::vector<uint32_t> succesors;
 
     for (size_t f = 0; f < num_faces; ++f)
       if (cell_face_orientations_[cell.local_id_][f] == INCOMING)
@@ -126,10 +100,11 @@ CBC_SPDS::CBC_SPDS(const Vector3& omega,
       {
         const auto& face = cell.faces_[f];
         if (face.has_neighbor_ and grid.IsCellLocal(face.neighbor_id_))
-          succesors.push_back(grid.cells[face.neighbor_id_].local_id_);
+          succesors.push_back(static_cast<uint32_t>(grid.cells[face.neighbor_id_].local_id_));
       }
 
-    task_list_.push_back({num_dependencies, succesors, cell.local_id_, &cell, false});
+    task_list_.push_back(
+      {num_dependencies, static_cast<uint32_t>(cell.local_id_), succesors, &cell, false});
   } // for cell in SPLS
 
   opensn::mpi_comm.barrier();
@@ -143,5 +118,15 @@ CBC_SPDS::TaskList() const
   return task_list_;
 }
 
+MemoryUsage
+CBC_SPDS::ComputeMemoryUsage() const
+{
+  MemoryUsage usage = SPDS::ComputeMemoryUsage();
+  usage += GetMemoryUsage(task_list_);
+  for (const auto& task : task_list_)
+    usage += GetMemoryUsage(task.successors_);
+  return usage;
+}
+
 } // namespace lbs
 } // namespace opensn
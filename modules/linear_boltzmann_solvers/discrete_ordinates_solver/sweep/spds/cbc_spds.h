@@ -22,6 +22,8 @@ public:
 
   const std::vector<Task>& TaskList() const;
 
+  MemoryUsage ComputeMemoryUsage() const override;
+
 protected:
   std::vector<Task> task_list_;
 };
@@ -3,6 +3,7 @@
 
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/spds/spds.h"
 #include "framework/mesh/mesh_continuum/mesh_continuum.h"
+#include "framework/graphs/directed_graph.h"
 #include "framework/logging/log.h"
 #include "framework/utils/timer.h"
 #include "framework/runtime.h"
@@ -167,8 +168,11 @@ SPDS::PopulateCellRelationships(const Vector3& omega,
           // If it is in the current location
           if (face.IsNeighborLocal(grid_))
           {
-            double weight = mu * face.ComputeFaceArea(grid_);
-            cell_successors[c].insert(std::make_pair(face.GetNeighborLocalID(grid_), weight));
+            if (not cell_successors.empty())
+            {
+              double weight = mu * face.ComputeFaceArea(grid_);
+              cell_successors[c].insert(std::make_pair(face.GetNeighborLocalID(grid_), weight));
+            }
           }
           else
             location_successors.insert(face.GetNeighborPartitionID(grid_));
@@ -186,6 +190,110 @@ SPDS::PopulateCellRelationships(const Vector3& omega,
   }   // for cell
 }
 
+void
+SPDS::BuildLocalSweepOrder(const std::vector<std::set<std::pair<int, double>>>& cell_successors,
+                           bool cycle_allowance_flag)
+{
+  CALI_CXX_MARK_SCOPE("SPDS::BuildLocalSweepOrder");
+
+  const size_t num_loc_cells = grid_.local_cells.size();
+
+  // Build graph
+  DirectedGraph local_DG;
+
+  // Add vertex for each local cell
+  for (int c = 0; c < num_loc_cells; ++c)
+    local_DG.AddVertex();
+
+  // Create graph edges
+  for (int c = 0; c < num_loc_cells; c++)
+    for (auto& successor : cell_successors[c])
+      local_DG.AddEdge(c, successor.first, successor.second);
+
+  // Remove local cycles if allowed
+  if (verbose_)
+    PrintedGhostedGraph();
+
+  if (cycle_allowance_flag)
+  {
+    log.Log0Verbose1() << program_timer.GetTimeString() << " Removing inter-cell cycles.";
+
+    auto edges_to_remove = local_DG.RemoveCyclicDependencies();
+
+    for (auto& edge_to_remove : edges_to_remove)
+    {
+      local_cyclic_dependencies_.emplace_back(edge_to_remove.first, edge_to_remove.second);
+    }
+  }
+
+  // Generate topological sorting
+  log.Log0Verbose1() << program_timer.GetTimeString()
+                     << " Generating topological sorting for local sweep ordering";
+  auto so_temp = local_DG.GenerateTopologicalSort();
+  spls_.item_id.clear();
+  for (auto v : so_temp)
+    spls_.item_id.emplace_back(v);
+
+  if (spls_.item_id.empty())
+  {
+    log.LogAllError() << "Topological sorting for local sweep-ordering failed. "
+                      << "Cyclic dependencies detected. Cycles need to be allowed"
+                      << " by calling application.";
+    Exit(EXIT_FAILURE);
+  }
+}
+
+bool
+SPDS::BuildOrthogonalLocalSweepOrder()
+{
+  CALI_CXX_MARK_SCOPE("SPDS::BuildOrthogonalLocalSweepOrder");
+
+  constexpr double tolerance = 1.0e-16;
+
+  const size_t num_loc_cells = grid_.local_cells.size();
+
+  // Consistent with the face orientations, cells are swept in ascending coordinate order
+  // along an axis when the direction component along it is positive, and in descending
+  // order otherwise. An upwind neighbor therefore always has a strictly smaller key.
+  const Vector3 sign(omega_.x > tolerance ? 1.0 : -1.0,
+                     omega_.y > tolerance ? 1.0 : -1.0,
+                     omega_.z > tolerance ? 1.0 : -1.0);
+
+  std::vector<double> key(num_loc_cells);
+  for (const auto& cell : grid_.local_cells)
+    key[cell.local_id_] = sign.Dot(cell.centroid_);
+
+  std::vector<int> order(num_loc_cells);
+  for (int c = 0; c < num_loc_cells; ++c)
+    order[c] = c;
+  std::stable_sort(
+    order.begin(), order.end(), [&key](int a, int b) { return key[a] < key[b]; });
+
+  // Verify that every local upwind neighbor precedes its downwind cell
+  std::vector<int> position(num_loc_cells);
+  for (int i = 0; i < num_loc_cells; ++i)
+    position[order[i]] = i;
+
+  for (const auto& cell : grid_.local_cells)
+  {
+    const auto& face_orientations = cell_face_orientations_[cell.local_id_];
+    for (size_t f = 0; f < cell.faces_.size(); ++f)
+    {
+      const auto& face = cell.faces_[f];
+      if (face_orientations[f] != FaceOrientation::INCOMING or not face.has_neighbor_ or
+          not grid_.IsCellLocal(face.neighbor_id_))
+        continue;
+
+      const auto& adj_cell = grid_.cells[face.neighbor_id_];
+      if (position[adj_cell.local_id_] >= position[cell.local_id_])
+        return false;
+    }
+  }
+
+  spls_.item_id = std::move(order);
+  return true;
+}
+
 void
 SPDS::PrintedGhostedGraph() const
 {
@@ -254,5 +362,18 @@ SPDS::PrintedGhostedGraph() const
   } // for p
 }
 
+MemoryUsage
+SPDS::ComputeMemoryUsage() const
+{
+  MemoryUsage usage = GetMemoryUsage(spls_.item_id);
+  usage += GetMemoryUsage(location_dependencies_);
+  usage += GetMemoryUsage(location_successors_);
+  usage += GetMemoryUsage(delayed_location_dependencies_);
+  usage += GetMemoryUsage(delayed_location_successors_);
+  usage += GetMemoryUsage(local_cyclic_dependencies_);
+  usage += GetMemoryUsage(cell_face_orientations_);
+  return usage;
+}
+
 } // namespace lbs
 } // namespace opensn
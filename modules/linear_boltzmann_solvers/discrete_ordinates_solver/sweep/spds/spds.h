@@ -4,6 +4,7 @@
 #pragma once
 
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/sweep.h"
+#include "framework/utils/memory_registry.h"
 #include <memory>
 
 namespace opensn
@@ -43,6 +44,9 @@ public:
   /** Given a location J index, maps to a dependent location.*/
   int MapLocJToDeplocI(int locJ) const;
 
+  /**Returns the heap memory held by the sweep ordering and dependency data.*/
+  virtual MemoryUsage ComputeMemoryUsage() const;
+
   virtual ~SPDS() = default;
 
 protected:
@@ -63,12 +67,26 @@ protected:
 
   bool verbose_ = false;
 
-  /**Populates cell relationships and cell_face_orientations.*/
+  /**Populates cell relationships and cell_face_orientations. Local cell successors are
+   * only collected when `cell_successors` is sized to the number of local cells; passing an
+   * empty vector skips them.*/
   void PopulateCellRelationships(const Vector3& omega,
                                  std::set<int>& location_dependencies,
                                  std::set<int>& location_successors,
                                  std::vector<std::set<std::pair<int, double>>>& cell_successors);
 
+  /**Builds the local sweep ordering, spls_, from a directed graph of the local cell
+   * successors. Local cycles are removed (and recorded in local_cyclic_dependencies_) when
+   * allowed.*/
+  void BuildLocalSweepOrder(const std::vector<std::set<std::pair<int, double>>>& cell_successors,
+                            bool cycle_allowance_flag);
+
+  /**Builds the local sweep ordering, spls_, of an orthogonal mesh analytically by sorting
+   * the cells along the wavefronts of the sweep direction. No graph is constructed.
+   * cell_face_orientations_ must already be populated. Returns false, leaving spls_ empty,
+   * if the ordering does not satisfy every local dependency.*/
+  bool BuildOrthogonalLocalSweepOrder();
+
   void PrintedGhostedGraph() const;
 };
 
@@ -28,9 +28,14 @@ SPDS_AdamsAdamsHawkins::SPDS_AdamsAdamsHawkins(const Vector3& omega,
 
   size_t num_loc_cells = grid.local_cells.size();
 
+  // Orthogonal meshes admit an analytic local ordering. The cell graph is only needed when
+  // that ordering is unavailable or when the graph is to be printed.
+  const bool try_orthogonal = grid.Type() == MeshType::ORTHOGONAL and not verbose_;
+
   // Populate Cell Relationships
   log.Log0Verbose1() << "Populating cell relationships";
-  std::vector<std::set<std::pair<int, double>>> cell_successors(num_loc_cells);
+  std::vector<std::set<std::pair<int, double>>> cell_successors(try_orthogonal ? 0
+                                                                               : num_loc_cells);
   std::set<int> location_successors;
   std::set<int> location_dependencies;
 
@@ -45,48 +50,18 @@ SPDS_AdamsAdamsHawkins::SPDS_AdamsAdamsHawkins(const Vector3& omega,
   for (auto v : location_dependencies)
     location_dependencies_.push_back(v);
 
-  // Build graph
-  DirectedGraph local_DG;
-
-  // Add vertex for each local cell
-  for (int c = 0; c < num_loc_cells; ++c)
-    local_DG.AddVertex();
-
-  // Create graph edges
-  for (int c = 0; c < num_loc_cells; c++)
-    for (auto& successor : cell_successors[c])
-      local_DG.AddEdge(c, successor.first, successor.second);
-
-  // Remove local cycles if allowed
-  if (verbose_)
-    PrintedGhostedGraph();
-
-  if (cycle_allowance_flag)
+  if (try_orthogonal and BuildOrthogonalLocalSweepOrder())
+    log.Log0Verbose1() << program_timer.GetTimeString()
+                       << " Local sweep ordering computed from orthogonal structure";
+  else
   {
-    log.Log0Verbose1() << program_timer.GetTimeString() << " Removing inter-cell cycles.";
-
-    auto edges_to_remove = local_DG.RemoveCyclicDependencies();
-
-    for (auto& edge_to_remove : edges_to_remove)
+    if (try_orthogonal)
     {
-      local_cyclic_dependencies_.emplace_back(edge_to_remove.first, edge_to_remove.second);
+      cell_successors.resize(num_loc_cells);
+      PopulateCellRelationships(
+        omega, location_dependencies, location_successors, cell_successors);
     }
-  }
-
-  // Generate topological sorting
-  log.Log0Verbose1() << program_timer.GetTimeString()
-                     << " Generating topological sorting for local sweep ordering";
-  auto so_temp = local_DG.GenerateTopologicalSort();
-  spls_.item_id.clear();
-  for (auto v : so_temp)
-    spls_.item_id.emplace_back(v);
-
-  if (spls_.item_id.empty())
-  {
-    log.LogAllError() << "Topological sorting for local sweep-ordering failed. "
-                      << "Cyclic dependencies detected. Cycles need to be allowed"
-                      << " by calling application.";
-    Exit(EXIT_FAILURE);
+    BuildLocalSweepOrder(cell_successors, cycle_allowance_flag);
   }
 
   //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%% Create Task
@@ -269,5 +244,15 @@ SPDS_AdamsAdamsHawkins::BuildTaskDependencyGraph(
   }
 }
 
+MemoryUsage
+SPDS_AdamsAdamsHawkins::ComputeMemoryUsage() const
+{
+  MemoryUsage usage = SPDS::ComputeMemoryUsage();
+  usage += GetMemoryUsage(global_sweep_planes_);
+  for (const auto& plane : global_sweep_planes_)
+    usage += GetMemoryUsage(plane.item_id);
+  return usage;
+}
+
 } // namespace lbs
 } // namespace opensn
@@ -19,6 +19,8 @@ public:
                          bool verbose);
   const std::vector<STDG>& GetGlobalSweepPlanes() const { return global_sweep_planes_; }
 
+  MemoryUsage ComputeMemoryUsage() const override;
+
 private:
   /**Builds the task dependency graph.*/
   void BuildTaskDependencyGraph(const std::vector<std::vector<int>>& global_dependencies,
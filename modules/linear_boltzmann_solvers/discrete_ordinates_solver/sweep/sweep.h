@@ -31,11 +31,13 @@ enum class AngleSetStatus
   MESSAGES_PENDING = 7
 };
 
+/**A cell of a cell-by-cell sweep. Successors and the reference id are local cell ids, which the
+ * sweep structures store in 32 bits.*/
 struct Task
 {
   unsigned int num_dependencies_;
-  std::vector<uint64_t> successors_;
-  uint64_t reference_id_;
+  uint32_t reference_id_;
+  std::vector<uint32_t> successors_;
   const Cell* cell_ptr_;
   bool completed_ = false;
 };
@@ -0,0 +1,298 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep_chunks/aah_batched_sweep_chunk.h"
+#include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/fluds/aah_fluds.h"
+#include "framework/mesh/mesh_continuum/mesh_continuum.h"
+#include "caliper/cali.h"
+#include <algorithm>
+
+namespace opensn
+{
+namespace lbs
+{
+
+namespace
+{
+
+/// Destination of the angular fluxes, which the batched chunk never stores
+std::vector<double> no_angular_flux;
+
+/**
+ * Solves A x = b for num_rhs right-hand sides with Gauss elimination without pivoting, the same
+ * elimination as GaussElimination. The right-hand sides are indexed [i * num_rhs + k] and are
+ * overwritten with the solutions. A is overwritten by the elimination.
+ */
+void
+GaussEliminationMultipleRHS(std::vector<std::vector<double>>& A,
+                            double* b,
+                            int n,
+                            size_t num_rhs)
+{
+  // Forward elimination
+  for (int i = 0; i < n - 1; ++i)
+  {
+    const std::vector<double>& ai = A[i];
+    const double* bi = &b[i * num_rhs];
+    const double factor = 1.0 / ai[i];
+    for (int j = i + 1; j < n; ++j)
+    {
+      std::vector<double>& aj = A[j];
+      const double val = aj[i] * factor;
+      double* bj = &b[j * num_rhs];
+      for (size_t k = 0; k < num_rhs; ++k)
+        bj[k] -= val * bi[k];
+      for (int c = i + 1; c < n; ++c)
+        aj[c] -= val * ai[c];
+    }
+  }
+
+  // Back substitution
+  for (int i = n - 1; i >= 0; --i)
+  {
+    const std::vector<double>& ai = A[i];
+    double* bi = &b[i * num_rhs];
+    for (int j = i + 1; j < n; ++j)
+    {
+      const double aij = ai[j];
+      const double* bj = &b[j * num_rhs];
+      for (size_t k = 0; k < num_rhs; ++k)
+        bi[k] -= aij * bj[k];
+    }
+    const double inv_aii = 1.0 / ai[i];
+    for (size_t k = 0; k < num_rhs; ++k)
+      bi[k] *= inv_aii;
+  }
+}
+
+} // namespace
+
+AahBatchedSweepChunk::AahBatchedSweepChunk(const MeshContinuum& grid,
+                                           const SpatialDiscretization& discretization,
+                                           const UnitCellMatricesList& unit_cell_matrices,
+                                           std::vector<lbs::CellLBSView>& cell_transport_views,
+                                           const std::vector<double>& densities,
+                                           std::vector<double>& destination_phi,
+                                           const std::vector<double>& source_moments,
+                                           const LBSGroupset& groupset,
+                                           const std::map<int, std::shared_ptr<MultiGroupXS>>& xs,
+                                           int num_moments,
+                                           int max_num_cell_dofs,
+                                           size_t num_rhs)
+  : SweepChunk(destination_phi,
+               no_angular_flux,
+               grid,
+               discretization,
+               unit_cell_matrices,
+               cell_transport_views,
+               densities,
+               source_moments,
+               groupset,
+               xs,
+               num_moments,
+               max_num_cell_dofs)
+{
+  num_rhs_ = num_rhs;
+}
+
+void
+AahBatchedSweepChunk::Sweep(AngleSet& angle_set)
+{
+  CALI_CXX_MARK_SCOPE("AahBatchedSweepChunk::Sweep");
+
+  const SubSetInfo& grp_ss_info = groupset_.grp_subset_infos_[angle_set.GetGroupSubset()];
+
+  const size_t gs_ss_size = grp_ss_info.ss_size;
+  const auto gs_gi = groupset_.groups_[grp_ss_info.ss_begin].id_;
+  const size_t num_rhs = num_rhs_;
+  const size_t width = gs_ss_size * num_rhs;
+
+  int deploc_face_counter = -1;
+  int preloc_face_counter = -1;
+
+  auto& fluds = dynamic_cast<AAH_FLUDS&>(angle_set.GetFLUDS());
+  GatherAngleSetOperators(angle_set);
+  const size_t as_num_angles = angle_set.GetNumAngles();
+
+  std::vector<std::vector<double>> Amat(max_num_cell_dofs_,
+                                        std::vector<double>(max_num_cell_dofs_));
+  std::vector<std::vector<double>> Atemp(max_num_cell_dofs_,
+                                         std::vector<double>(max_num_cell_dofs_));
+  // Right-hand sides of a group, indexed [i * num_rhs + k]
+  const size_t b_stride = max_num_cell_dofs_ * num_rhs;
+  std::vector<double> b(gs_ss_size * b_stride);
+  std::vector<double> as_source;
+  std::vector<double> as_psi(max_num_cell_dofs_ * as_num_angles * width);
+
+  // Loop over each cell
+  const auto& spds = angle_set.GetSPDS();
+  const auto& spls = spds.GetSPLS().item_id;
+  const size_t num_spls = spls.size();
+  for (size_t spls_index = 0; spls_index < num_spls; ++spls_index)
+  {
+    auto cell_local_id = spls[spls_index];
+    auto& cell = grid_.local_cells[cell_local_id];
+    auto& cell_mapping = discretization_.GetCellMapping(cell);
+    auto& cell_transport_view = cell_transport_views_[cell_local_id];
+    auto cell_num_faces = cell.faces_.size();
+    auto cell_num_nodes = cell_mapping.NumNodes();
+
+    const auto& face_orientations = spds.CellFaceOrientations()[cell_local_id];
+    std::vector<double> face_mu_values(cell_num_faces);
+
+    const auto& rho = densities_[cell.local_id_];
+    const auto& sigma_t = cell_transport_view.XS().SigmaTotal();
+
+    // Get cell matrices
+    const auto& G = unit_cell_matrices_[cell_local_id].intV_shapeI_gradshapeJ;
+    const auto& M = unit_cell_matrices_[cell_local_id].intV_shapeI_shapeJ;
+    const auto& M_surf = unit_cell_matrices_[cell_local_id].intS_shapeI_shapeJ;
+
+    // Discrete sources of all directions and right-hand sides, q = M2D * q_moms
+    ComputeAngleSetSource(cell_transport_view, cell_num_nodes, gs_gi, gs_ss_size, as_source);
+
+    // Loop over angles in set (as = angleset, ss = subset)
+    const int ni_deploc_face_counter = deploc_face_counter;
+    const int ni_preloc_face_counter = preloc_face_counter;
+    const std::vector<size_t>& as_angle_indices = angle_set.GetAngleIndices();
+    for (size_t as_ss_idx = 0; as_ss_idx < as_angle_indices.size(); ++as_ss_idx)
+    {
+      auto direction_num = as_angle_indices[as_ss_idx];
+      auto omega = groupset_.quadrature_->omegas_[direction_num];
+
+      deploc_face_counter = ni_deploc_face_counter;
+      preloc_face_counter = ni_preloc_face_counter;
+
+      // Reset right-hand sides
+      std::fill(b.begin(), b.end(), 0.0);
+
+      for (int i = 0; i < cell_num_nodes; ++i)
+        for (int j = 0; j < cell_num_nodes; ++j)
+          Amat[i][j] = omega.Dot(G[i][j]);
+
+      // Update face orientations
+      for (int f = 0; f < cell_num_faces; ++f)
+        face_mu_values[f] = omega.Dot(cell.faces_[f].normal_);
+
+      // Surface integrals. The incoming flux on boundary faces is zero.
+      int in_face_counter = -1;
+      for (int f = 0; f < cell_num_faces; ++f)
+      {
+        if (face_orientations[f] != FaceOrientation::INCOMING)
+          continue;
+
+        auto& cell_face = cell.faces_[f];
+        const bool is_local_face = cell_transport_view.IsFaceLocal(f);
+        const bool is_boundary_face = not cell_face.has_neighbor_;
+
+        if (is_local_face)
+          ++in_face_counter;
+        else if (not is_boundary_face)
+          ++preloc_face_counter;
+
+        // IntSf_mu_psi_Mij_dA
+        const size_t num_face_nodes = cell_mapping.NumFaceNodes(f);
+        for (int fi = 0; fi < num_face_nodes; ++fi)
+        {
+          const int i = cell_mapping.MapFaceNode(f, fi);
+
+          for (int fj = 0; fj < num_face_nodes; ++fj)
+          {
+            const int j = cell_mapping.MapFaceNode(f, fj);
+
+            const double mu_Nij = -face_mu_values[f] * M_surf[f][i][j];
+            Amat[i][j] += mu_Nij;
+
+            if (is_boundary_face)
+              continue;
+
+            const double* psi;
+            if (is_local_face)
+              psi = fluds.UpwindPsi(spls_index, in_face_counter, fj, 0, as_ss_idx);
+            else
+              psi = fluds.NLUpwindPsi(preloc_face_counter, fj, 0, as_ss_idx);
+
+            for (size_t gsg = 0; gsg < gs_ss_size; ++gsg)
+            {
+              double* b_i = &b[gsg * b_stride + i * num_rhs];
+              const double* psi_g = &psi[gsg * num_rhs];
+              for (size_t k = 0; k < num_rhs; ++k)
+                b_i[k] += psi_g[k] * mu_Nij;
+            }
+          } // for face node j
+        }   // for face node i
+      }     // for f
+
+      // Looping over groups, assembling mass terms
+      for (size_t gsg = 0; gsg < gs_ss_size; ++gsg)
+      {
+        const double sigma_tg = rho * sigma_t[gs_gi + gsg];
+        double* b_g = &b[gsg * b_stride];
+
+        // Mass matrix and source
+        // Atemp = Amat + sigma_tgr * M
+        // b += M * q
+        for (int i = 0; i < cell_num_nodes; ++i)
+        {
+          double* b_i = &b_g[i * num_rhs];
+          for (int j = 0; j < cell_num_nodes; ++j)
+          {
+            const double Mij = M[i][j];
+            Atemp[i][j] = Amat[i][j] + Mij * sigma_tg;
+            const double* q_j = &as_source[(j * as_num_angles + as_ss_idx) * width + gsg * num_rhs];
+            for (size_t k = 0; k < num_rhs; ++k)
+              b_i[k] += Mij * q_j[k];
+          }
+        }
+
+        // One elimination of the system for all right-hand sides
+        GaussEliminationMultipleRHS(Atemp, b_g, static_cast<int>(cell_num_nodes), num_rhs);
+
+        // Keep the solution for the flux moment update
+        for (int i = 0; i < cell_num_nodes; ++i)
+          std::copy_n(&b_g[i * num_rhs],
+                      num_rhs,
+                      &as_psi[(i * as_num_angles + as_ss_idx) * width + gsg * num_rhs]);
+      } // for gsg
+
+      // For outgoing, non-boundary faces, copy angular flux to fluds
+      int out_face_counter = -1;
+      for (int f = 0; f < cell_num_faces; ++f)
+      {
+        if (face_orientations[f] != FaceOrientation::OUTGOING)
+          continue;
+
+        out_face_counter++;
+        const auto& face = cell.faces_[f];
+        const bool is_local_face = cell_transport_view.IsFaceLocal(f);
+        const bool is_boundary_face = not face.has_neighbor_;
+
+        if (is_boundary_face)
+          continue;
+        if (not is_local_face)
+          ++deploc_face_counter;
+
+        const size_t num_face_nodes = cell_mapping.NumFaceNodes(f);
+        for (int fi = 0; fi < num_face_nodes; ++fi)
+        {
+          const int i = cell_mapping.MapFaceNode(f, fi);
+
+          double* psi;
+          if (is_local_face)
+            psi = fluds.OutgoingPsi(spls_index, out_face_counter, fi, as_ss_idx);
+          else
+            psi = fluds.NLOutgoingPsi(deploc_face_counter, fi, as_ss_idx);
+
+          for (size_t gsg = 0; gsg < gs_ss_size; ++gsg)
+            std::copy_n(&b[gsg * b_stride + i * num_rhs], num_rhs, &psi[gsg * num_rhs]);
+        } // for fi
+      }   // for face
+    }     // for angleset/subset
+
+    // Update phi, phi_moms += D2M * psi
+    AccumulateAngleSetMoments(cell_transport_view, cell_num_nodes, gs_gi, gs_ss_size, as_psi);
+  } // for cell
+}
+
+} // namespace lbs
+} // namespace opensn
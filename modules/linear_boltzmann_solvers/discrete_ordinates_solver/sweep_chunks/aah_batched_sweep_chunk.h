@@ -0,0 +1,45 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep_chunks/sweep_chunk.h"
+#include "framework/math/spatial_discretization/spatial_discretization.h"
+#include "modules/linear_boltzmann_solvers/lbs_solver/groupset/lbs_groupset.h"
+
+namespace opensn
+{
+namespace lbs
+{
+
+/**
+ * AAH sweep chunk that sweeps several right-hand sides at once. The right-hand sides are the
+ * innermost index of the source and flux moment vectors, [dof * num_rhs + k], and of the angular
+ * fluxes exchanged through the FLUDS, [g * num_rhs + k], so the angle sets of the chunk must be
+ * built with gs_ss_size * num_rhs groups. The streaming and mass matrix of a cell, direction and
+ * group is factored once and the factorization is applied to all right-hand sides.
+ *
+ * Incoming boundary fluxes are zero, so boundary sources, reflecting boundaries, angular flux
+ * storage, outflow tallies and time-dependent terms are not supported.
+ */
+class AahBatchedSweepChunk : public SweepChunk
+{
+public:
+  AahBatchedSweepChunk(const MeshContinuum& grid,
+                       const SpatialDiscretization& discretization,
+                       const UnitCellMatricesList& unit_cell_matrices,
+                       std::vector<lbs::CellLBSView>& cell_transport_views,
+                       const std::vector<double>& densities,
+                       std::vector<double>& destination_phi,
+                       const std::vector<double>& source_moments,
+                       const LBSGroupset& groupset,
+                       const std::map<int, std::shared_ptr<MultiGroupXS>>& xs,
+                       int num_moments,
+                       int max_num_cell_dofs,
+                       size_t num_rhs);
+
+  void Sweep(AngleSet& angle_set) override;
+};
+
+} // namespace lbs
+} // namespace opensn
@@ -13,7 +13,7 @@ namespace lbs
 
 AahSweepChunk::AahSweepChunk(const MeshContinuum& grid,
                              const SpatialDiscretization& discretization,
-                             const std::vector<UnitCellMatrices>& unit_cell_matrices,
+                             const UnitCellMatricesList& unit_cell_matrices,
                              std::vector<lbs::CellLBSView>& cell_transport_views,
                              const std::vector<double>& densities,
                              std::vector<double>& destination_phi,
@@ -53,8 +53,8 @@ AahSweepChunk::Sweep(AngleSet& angle_set)
   int preloc_face_counter = -1;
 
   auto& fluds = dynamic_cast<AAH_FLUDS&>(angle_set.GetFLUDS());
-  const auto& m2d_op = groupset_.quadrature_->GetMomentToDiscreteOperator();
-  const auto& d2m_op = groupset_.quadrature_->GetDiscreteToMomentOperator();
+  GatherAngleSetOperators(angle_set);
+  const size_t as_num_angles = angle_set.GetNumAngles();
 
   std::vector<std::vector<double>> Amat(max_num_cell_dofs_,
                                         std::vector<double>(max_num_cell_dofs_));
@@ -63,6 +63,11 @@ AahSweepChunk::Sweep(AngleSet& angle_set)
   std::vector<std::vector<double>> b(groupset_.groups_.size(),
                                      std::vector<double>(max_num_cell_dofs_));
   std::vector<double> source(max_num_cell_dofs_);
+  std::vector<double> as_source;
+  std::vector<double> as_psi(max_num_cell_dofs_ * as_num_angles * gs_ss_size);
+
+  const auto* time_terms = ActiveTimeDependentTerms();
+  const bool apply_time_source = time_terms and IsFixedSourceActive();
 
   // Loop over each cell
   const auto& spds = angle_set.GetSPDS();
@@ -81,13 +86,25 @@ AahSweepChunk::Sweep(AngleSet& angle_set)
     std::vector<double> face_mu_values(cell_num_faces);
 
     const auto& rho = densities_[cell.local_id_];
-    const auto& sigma_t = xs_.at(cell.material_id_)->SigmaTotal();
+    const auto& sigma_t = cell_transport_view.XS().SigmaTotal();
+
+    // Time-dependent shift of sigma_t and the start-of-step angular flux of the cell
+    const double* sigma_t_shift = nullptr;
+    size_t cell_psi_prev_offset = 0;
+    if (time_terms)
+    {
+      sigma_t_shift = &time_terms->sigma_t_shift[cell_local_id * time_terms->num_groups];
+      cell_psi_prev_offset = discretization_.MapDOFLocal(cell, 0, groupset_.psi_uk_man_, 0, 0);
+    }
 
     // Get cell matrices
     const auto& G = unit_cell_matrices_[cell_local_id].intV_shapeI_gradshapeJ;
     const auto& M = unit_cell_matrices_[cell_local_id].intV_shapeI_shapeJ;
     const auto& M_surf = unit_cell_matrices_[cell_local_id].intS_shapeI_shapeJ;
 
+    // Discrete sources of all directions in the set, q = M2D * q_moms
+    ComputeAngleSetSource(cell_transport_view, cell_num_nodes, gs_gi, gs_ss_size, as_source);
+
     // Loop over angles in set (as = angleset, ss = subset)
     const int ni_deploc_face_counter = deploc_face_counter;
     const int ni_preloc_face_counter = preloc_face_counter;
@@ -171,16 +188,23 @@ AahSweepChunk::Sweep(AngleSet& angle_set)
       {
         double sigma_tg = rho * sigma_t[gs_gi + gsg];
 
-        // Contribute source moments q = M_n^T * q_moms
+        // Discrete source of this direction and group
         for (int i = 0; i < cell_num_nodes; ++i)
+          source[i] = as_source[(i * as_num_angles + as_ss_idx) * gs_ss_size + gsg];
+
+        // Time-dependent terms, sigma_t + tau and q + tau * psi^n
+        if (time_terms)
         {
-          double temp_src = 0.0;
-          for (int m = 0; m < num_moments_; ++m)
+          const double tau = sigma_t_shift[gs_gi + gsg];
+          sigma_tg += tau;
+          if (apply_time_source)
           {
-            const size_t ir = cell_transport_view.MapDOF(i, m, static_cast<int>(gs_gi + gsg));
-            temp_src += m2d_op[m][direction_num] * source_moments_[ir];
+            const auto& psi_prev = time_terms->psi_prev[groupset_.id_];
+            const size_t dir_offset = cell_psi_prev_offset +
+                                      direction_num * groupset_group_stride_ + gs_ss_begin + gsg;
+            for (int i = 0; i < cell_num_nodes; ++i)
+              source[i] += tau * psi_prev[dir_offset + i * groupset_angle_group_stride_];
           }
-          source[i] = temp_src;
         }
 
         // Mass matrix and source
@@ -200,20 +224,11 @@ AahSweepChunk::Sweep(AngleSet& angle_set)
 
         // Solve system
         GaussElimination(Atemp, b[gsg], static_cast<int>(cell_num_nodes));
-      } // for gsg
 
-      // Update phi
-      auto& output_phi = GetDestinationPhi();
-      for (int m = 0; m < num_moments_; ++m)
-      {
-        const double wn_d2m = d2m_op[m][direction_num];
+        // Keep the solution for the flux moment update
         for (int i = 0; i < cell_num_nodes; ++i)
-        {
-          const size_t ir = cell_transport_view.MapDOF(i, m, gs_gi);
-          for (int gsg = 0; gsg < gs_ss_size; ++gsg)
-            output_phi[ir + gsg] += wn_d2m * b[gsg][i];
-        }
-      }
+          as_psi[(i * as_num_angles + as_ss_idx) * gs_ss_size + gsg] = b[gsg][i];
+      } // for gsg
 
       // Save angular flux during sweep
       if (save_angular_flux_)
@@ -281,7 +296,10 @@ AahSweepChunk::Sweep(AngleSet& angle_set)
         } // for fi
       }   // for face
     }     // for angleset/subset
-  }       // for cell
+
+    // Update phi, phi_moms += D2M * psi
+    AccumulateAngleSetMoments(cell_transport_view, cell_num_nodes, gs_gi, gs_ss_size, as_psi);
+  } // for cell
 }
 
 } // namespace lbs
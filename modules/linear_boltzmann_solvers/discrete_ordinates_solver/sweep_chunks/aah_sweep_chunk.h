@@ -17,7 +17,7 @@ class AahSweepChunk : public SweepChunk
 public:
   AahSweepChunk(const MeshContinuum& grid,
                 const SpatialDiscretization& discretization,
-                const std::vector<UnitCellMatrices>& unit_cell_matrices,
+                const UnitCellMatricesList& unit_cell_matrices,
                 std::vector<lbs::CellLBSView>& cell_transport_views,
                 const std::vector<double>& densities,
                 std::vector<double>& destination_phi,
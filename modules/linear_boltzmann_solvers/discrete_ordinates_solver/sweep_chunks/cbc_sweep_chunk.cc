@@ -18,7 +18,7 @@ CbcSweepChunk::CbcSweepChunk(std::vector<double>& destination_phi,
                              std::vector<double>& destination_psi,
                              const MeshContinuum& grid,
                              const SpatialDiscretization& discretization,
-                             const std::vector<UnitCellMatrices>& unit_cell_matrices,
+                             const UnitCellMatricesList& unit_cell_matrices,
                              std::vector<lbs::CellLBSView>& cell_transport_views,
                              const std::vector<double>& densities,
                              const std::vector<double>& source_moments,
@@ -70,6 +70,8 @@ CbcSweepChunk::SetAngleSet(AngleSet& angle_set)
   surface_source_active_ = IsSurfaceSourceActive();
   group_stride_ = angle_set.GetNumGroups();
   group_angle_stride_ = angle_set.GetNumGroups() * angle_set.GetNumAngles();
+
+  GatherAngleSetOperators(angle_set);
 }
 
 void
@@ -92,8 +94,7 @@ CbcSweepChunk::SetCell(const Cell* cell_ptr, AngleSet& angle_set)
 void
 CbcSweepChunk::Sweep(AngleSet& angle_set)
 {
-  const auto& m2d_op = groupset_.quadrature_->GetMomentToDiscreteOperator();
-  const auto& d2m_op = groupset_.quadrature_->GetDiscreteToMomentOperator();
+  const size_t as_num_angles = angle_set.GetNumAngles();
 
   std::vector<std::vector<double>> Amat(max_num_cell_dofs_,
                                         std::vector<double>(max_num_cell_dofs_));
@@ -103,11 +104,26 @@ CbcSweepChunk::Sweep(AngleSet& angle_set)
                                      std::vector<double>(max_num_cell_dofs_));
   std::vector<double> source(max_num_cell_dofs_);
 
+  // Discrete sources of all directions in the set, q = M2D * q_moms
+  ComputeAngleSetSource(*cell_transport_view_, cell_num_nodes_, gs_gi_, gs_ss_size_, as_source_);
+  as_psi_.resize(cell_num_nodes_ * as_num_angles * gs_ss_size_);
+
   const auto& face_orientations = angle_set.GetSPDS().CellFaceOrientations()[cell_local_id_];
   std::vector<double> face_mu_values(cell_num_faces_);
 
   const auto& rho = densities_[cell_local_id_];
-  const auto& sigma_t = xs_.at(cell_->material_id_)->SigmaTotal();
+  const auto& sigma_t = cell_transport_view_->XS().SigmaTotal();
+
+  // Time-dependent shift of sigma_t and the start-of-step angular flux of the cell
+  const auto* time_terms = ActiveTimeDependentTerms();
+  const bool apply_time_source = time_terms and IsFixedSourceActive();
+  const double* sigma_t_shift = nullptr;
+  size_t cell_psi_prev_offset = 0;
+  if (time_terms)
+  {
+    sigma_t_shift = &time_terms->sigma_t_shift[cell_local_id_ * time_terms->num_groups];
+    cell_psi_prev_offset = discretization_.MapDOFLocal(*cell_, 0, groupset_.psi_uk_man_, 0, 0);
+  }
 
   // as = angle set
   // ss = subset
@@ -205,16 +221,23 @@ CbcSweepChunk::Sweep(AngleSet& angle_set)
     {
       double sigma_tg = rho * sigma_t[gs_gi_ + gsg];
 
-      // Contribute source moments q = M_n^T * q_moms
+      // Discrete source of this direction and group
       for (int i = 0; i < cell_num_nodes_; ++i)
+        source[i] = as_source_[(i * as_num_angles + as_ss_idx) * gs_ss_size_ + gsg];
+
+      // Time-dependent terms, sigma_t + tau and q + tau * psi^n
+      if (time_terms)
       {
-        double temp_src = 0.0;
-        for (int m = 0; m < num_moments_; ++m)
+        const double tau = sigma_t_shift[gs_gi_ + gsg];
+        sigma_tg += tau;
+        if (apply_time_source)
         {
-          const size_t ir = cell_transport_view_->MapDOF(i, m, static_cast<int>(gs_gi_ + gsg));
-          temp_src += m2d_op[m][direction_num] * source_moments_[ir];
+          const auto& psi_prev = time_terms->psi_prev[groupset_.id_];
+          const size_t dir_offset = cell_psi_prev_offset + direction_num * groupset_group_stride_ +
+                                    gs_ss_begin_ + gsg;
+          for (int i = 0; i < cell_num_nodes_; ++i)
+            source[i] += tau * psi_prev[dir_offset + i * groupset_angle_group_stride_];
         }
-        source[i] = temp_src;
       }
 
       // Mass matrix and source
@@ -234,20 +257,11 @@ CbcSweepChunk::Sweep(AngleSet& angle_set)
 
       // Solve system
       GaussElimination(Atemp, b[gsg], static_cast<int>(cell_num_nodes_));
-    } // for gsg
 
-    // Update phi
-    auto& output_phi = GetDestinationPhi();
-    for (int m = 0; m < num_moments_; ++m)
-    {
-      const double wn_d2m = d2m_op[m][direction_num];
+      // Keep the solution for the flux moment update
       for (int i = 0; i < cell_num_nodes_; ++i)
-      {
-        const size_t ir = cell_transport_view_->MapDOF(i, m, gs_gi_);
-        for (int gsg = 0; gsg < gs_ss_size_; ++gsg)
-          output_phi[ir + gsg] += wn_d2m * b[gsg][i];
-      }
-    }
+        as_psi_[(i * as_num_angles + as_ss_idx) * gs_ss_size_ + gsg] = b[gsg][i];
+    } // for gsg
 
     // Save angular flux during sweep
     if (save_angular_flux_)
@@ -327,6 +341,9 @@ CbcSweepChunk::Sweep(AngleSet& angle_set)
       } // for fi
     }   // for face
   }     // for angleset/subset
+
+  // Update phi, phi_moms += D2M * psi
+  AccumulateAngleSetMoments(*cell_transport_view_, cell_num_nodes_, gs_gi_, gs_ss_size_, as_psi_);
 }
 
 } // namespace lbs
@@ -20,7 +20,7 @@ public:
                 std::vector<double>& destination_psi,
                 const MeshContinuum& grid,
                 const SpatialDiscretization& discretization,
-                const std::vector<UnitCellMatrices>& unit_cell_matrices,
+                const UnitCellMatricesList& unit_cell_matrices,
                 std::vector<lbs::CellLBSView>& cell_transport_views,
                 const std::vector<double>& densities,
                 const std::vector<double>& source_moments,
@@ -55,6 +55,10 @@ private:
   MatDbl M_;
   std::vector<MatDbl> M_surf_;
   std::vector<std::vector<double>> IntS_shapeI_;
+
+  // Per-cell work vectors, indexed [(i * num_angles + a) * gs_ss_size + g]
+  std::vector<double> as_source_;
+  std::vector<double> as_psi_;
 };
 
 } // namespace lbs
@@ -0,0 +1,91 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep_chunks/sweep_chunk.h"
+#include <algorithm>
+
+namespace opensn
+{
+namespace lbs
+{
+
+void
+SweepChunk::GatherAngleSetOperators(const AngleSet& angle_set)
+{
+  const auto& m2d_op = groupset_.quadrature_->GetMomentToDiscreteOperatorByDirection();
+  const auto& d2m_op = groupset_.quadrature_->GetDiscreteToMomentOperatorByDirection();
+  const auto& angle_indices = angle_set.GetAngleIndices();
+
+  angle_set_num_angles_ = angle_indices.size();
+  angle_set_m2d_op_.resize(angle_set_num_angles_ * num_moments_);
+  angle_set_d2m_op_.resize(angle_set_num_angles_ * num_moments_);
+  for (size_t a = 0; a < angle_set_num_angles_; ++a)
+  {
+    const size_t offset = angle_indices[a] * num_moments_;
+    std::copy_n(&m2d_op[offset], num_moments_, &angle_set_m2d_op_[a * num_moments_]);
+    std::copy_n(&d2m_op[offset], num_moments_, &angle_set_d2m_op_[a * num_moments_]);
+  }
+}
+
+void
+SweepChunk::ComputeAngleSetSource(const CellLBSView& cell_transport_view,
+                                  size_t num_nodes,
+                                  int gs_gi,
+                                  size_t gs_ss_size,
+                                  std::vector<double>& source) const
+{
+  const size_t num_angles = angle_set_num_angles_;
+  const size_t width = gs_ss_size * num_rhs_;
+  const size_t node_stride = num_angles * width;
+  source.assign(num_nodes * node_stride, 0.0);
+
+  // The moment rows of a node are streamed once while the node's (angle x group) block of the
+  // source stays in cache
+  for (size_t i = 0; i < num_nodes; ++i)
+  {
+    double* q_i = &source[i * node_stride];
+    for (int m = 0; m < num_moments_; ++m)
+    {
+      const double* q_mom = &source_moments_[cell_transport_view.MapDOF(i, m, gs_gi) * num_rhs_];
+      for (size_t a = 0; a < num_angles; ++a)
+      {
+        const double w = angle_set_m2d_op_[a * num_moments_ + m];
+        double* q_ia = &q_i[a * width];
+        for (size_t j = 0; j < width; ++j)
+          q_ia[j] += w * q_mom[j];
+      }
+    }
+  }
+}
+
+void
+SweepChunk::AccumulateAngleSetMoments(const CellLBSView& cell_transport_view,
+                                      size_t num_nodes,
+                                      int gs_gi,
+                                      size_t gs_ss_size,
+                                      const std::vector<double>& psi)
+{
+  const size_t num_angles = angle_set_num_angles_;
+  const size_t width = gs_ss_size * num_rhs_;
+  const size_t node_stride = num_angles * width;
+  auto& output_phi = GetDestinationPhi();
+
+  for (size_t i = 0; i < num_nodes; ++i)
+  {
+    for (size_t a = 0; a < num_angles; ++a)
+    {
+      const double* psi_ia = &psi[i * node_stride + a * width];
+      const double* d2m_a = &angle_set_d2m_op_[a * num_moments_];
+      for (int m = 0; m < num_moments_; ++m)
+      {
+        const double w = d2m_a[m];
+        double* phi_im = &output_phi[cell_transport_view.MapDOF(i, m, gs_gi) * num_rhs_];
+        for (size_t j = 0; j < width; ++j)
+          phi_im[j] += w * psi_ia[j];
+      }
+    }
+  }
+}
+
+} // namespace lbs
+} // namespace opensn
@@ -4,6 +4,7 @@
 #pragma once
 
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/angle_aggregation/angle_aggregation.h"
+#include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep_chunks/time_dependent_sweep_terms.h"
 #include "modules/linear_boltzmann_solvers/lbs_solver/groupset/lbs_groupset.h"
 #include "modules/linear_boltzmann_solvers/lbs_solver/lbs_structs.h"
 #include <functional>
@@ -34,7 +35,7 @@ public:
              std::vector<double>& destination_psi,
              const MeshContinuum& grid,
              const SpatialDiscretization& discretization,
-             const std::vector<lbs::UnitCellMatrices>& unit_cell_matrices,
+             const lbs::UnitCellMatricesList& unit_cell_matrices,
              std::vector<lbs::CellLBSView>& cell_transport_views,
              const std::vector<double>& densities,
              const std::vector<double>& source_moments,
@@ -70,6 +71,12 @@ public:
   /**For cell-by-cell methods or computing the residual on a single cell.*/
   virtual void SetCell(Cell const* cell_ptr, AngleSet& angle_set) {}
 
+  /**
+   * Sets the time-dependent terms added to the sweeps. The terms are only applied while they are
+   * active. Passing nullptr detaches them.
+   */
+  void SetTimeDependentTerms(const TimeDependentSweepTerms* terms) { time_terms_ = terms; }
+
   virtual ~SweepChunk() = default;
 
 protected:
@@ -98,9 +105,52 @@ protected:
   /**Returns the surface src-active flag.*/
   bool IsSurfaceSourceActive() const { return surface_source_active; }
 
+  /**Activates or deactivates the fixed src flag.*/
+  void SetFixedSourceActiveFlag(bool flag_value) { fixed_source_active = flag_value; }
+
+  /**Returns the fixed src-active flag.*/
+  bool IsFixedSourceActive() const { return fixed_source_active; }
+
+  /**Returns the time-dependent terms if they are attached and active, otherwise nullptr.*/
+  const TimeDependentSweepTerms* ActiveTimeDependentTerms() const
+  {
+    return (time_terms_ and time_terms_->active) ? time_terms_ : nullptr;
+  }
+
+  /**
+   * Gathers the moment-to-discrete and discrete-to-moment operator rows of the directions in an
+   * angle set into contiguous blocks indexed [a * num_moments + m], where a is the index of the
+   * direction within the angle set.
+   */
+  void GatherAngleSetOperators(const AngleSet& angle_set);
+
+  /**
+   * Computes the discrete source of all directions of the gathered angle set on a cell as the
+   * dense product q(i, a, g) = sum_m m2d(a, m) Q(i, m, g) over the group subset starting at
+   * gs_gi. The result is indexed [(i * num_angles + a) * gs_ss_size + g]. Chunks that sweep
+   * several right-hand sides carry them as the innermost index of the source moments and of the
+   * result, [((i * num_angles + a) * gs_ss_size + g) * num_rhs + k].
+   */
+  void ComputeAngleSetSource(const CellLBSView& cell_transport_view,
+                             size_t num_nodes,
+                             int gs_gi,
+                             size_t gs_ss_size,
+                             std::vector<double>& source) const;
+
+  /**
+   * Accumulates the angular fluxes of all directions of the gathered angle set on a cell into
+   * the destination flux moments, phi(i, m, g) += sum_a d2m(a, m) psi(i, a, g). The angular
+   * fluxes are indexed as the output of ComputeAngleSetSource.
+   */
+  void AccumulateAngleSetMoments(const CellLBSView& cell_transport_view,
+                                 size_t num_nodes,
+                                 int gs_gi,
+                                 size_t gs_ss_size,
+                                 const std::vector<double>& psi);
+
   const MeshContinuum& grid_;
   const SpatialDiscretization& discretization_;
-  const std::vector<lbs::UnitCellMatrices>& unit_cell_matrices_;
+  const lbs::UnitCellMatricesList& unit_cell_matrices_;
   std::vector<lbs::CellLBSView>& cell_transport_views_;
   const std::vector<double>& densities_;
   const std::vector<double>& source_moments_;
@@ -112,10 +162,21 @@ protected:
   const size_t groupset_angle_group_stride_;
   const size_t groupset_group_stride_;
 
+  /// Number of right-hand sides swept together, the innermost index of the moment vectors
+  size_t num_rhs_ = 1;
+
+  /// Angle set blocks of the m2d and d2m operators, see GatherAngleSetOperators
+  size_t angle_set_num_angles_ = 0;
+  std::vector<double> angle_set_m2d_op_;
+  std::vector<double> angle_set_d2m_op_;
+
+  const TimeDependentSweepTerms* time_terms_ = nullptr;
+
 private:
   std::vector<double>* destination_phi;
   std::vector<double>* destination_psi;
   bool surface_source_active = false;
+  bool fixed_source_active = false;
 };
 
 } // namespace lbs
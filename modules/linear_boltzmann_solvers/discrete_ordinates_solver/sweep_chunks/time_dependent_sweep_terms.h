@@ -0,0 +1,87 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "framework/utils/memory_registry.h"
+#include <cstddef>
+#include <vector>
+
+namespace opensn
+{
+namespace lbs
+{
+
+/**
+ * Angular flux of a groupset at the start of a time step. The values are kept in the layout of
+ * the groupset's angular flux vector, either in double or, to halve the memory of the history,
+ * in single precision.
+ */
+class AngularFluxHistory
+{
+public:
+  /**Sets the storage precision and copies the given angular fluxes.*/
+  void Assign(const std::vector<double>& psi, bool single_precision)
+  {
+    single_precision_ = single_precision;
+    if (single_precision_)
+    {
+      psi_double_ = {};
+      psi_single_.assign(psi.begin(), psi.end());
+    }
+    else
+    {
+      psi_single_ = {};
+      psi_double_ = psi;
+    }
+  }
+
+  /**Returns the angular flux at local psi dof i.*/
+  double operator[](size_t i) const
+  {
+    return single_precision_ ? static_cast<double>(psi_single_[i]) : psi_double_[i];
+  }
+
+  /**Returns the number of stored values.*/
+  size_t Size() const { return single_precision_ ? psi_single_.size() : psi_double_.size(); }
+
+  MemoryUsage ComputeMemoryUsage() const
+  {
+    auto usage = GetMemoryUsage(psi_double_);
+    usage += GetMemoryUsage(psi_single_);
+    return usage;
+  }
+
+private:
+  bool single_precision_ = false;
+  std::vector<double> psi_double_;
+  std::vector<float> psi_single_;
+};
+
+/**
+ * Terms a theta-scheme time step adds to the sweeps. Each cell and group gets the shift
+ * tau = 1/(v theta dt) added to its total cross section. When fixed sources are active the sweep
+ * also adds the source tau psi^n, where psi^n is the angular flux at the start of the step. The
+ * sweep chunks only hold a pointer to these terms, so changing the time step size does not
+ * require the sweep structures or solvers to be rebuilt.
+ */
+struct TimeDependentSweepTerms
+{
+  bool active = false;
+  size_t num_groups = 0;
+  /// Shift of the total cross section, indexed [cell_local_id * num_groups + g]
+  std::vector<double> sigma_t_shift;
+  /// Angular flux at the start of the step, per groupset
+  std::vector<AngularFluxHistory> psi_prev;
+
+  MemoryUsage ComputeMemoryUsage() const
+  {
+    auto usage = GetMemoryUsage(sigma_t_shift);
+    for (const auto& history : psi_prev)
+      usage += history.ComputeMemoryUsage();
+    return usage;
+  }
+};
+
+} // namespace lbs
+} // namespace opensn
@@ -0,0 +1,534 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#include "modules/linear_boltzmann_solvers/executors/lbs_batched_steady_state.h"
+#include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/lbs_discrete_ordinates_solver.h"
+#include "modules/linear_boltzmann_solvers/discrete_ordinates_curvilinear_solver/lbs_curvilinear_solver.h"
+#include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/scheduler/sweep_scheduler.h"
+#include "modules/linear_boltzmann_solvers/lbs_solver/acceleration/diffusion_mip_solver.h"
+#include "framework/math/spatial_discretization/spatial_discretization.h"
+#include "framework/mesh/mesh_continuum/mesh_continuum.h"
+#include "framework/logging/log_exceptions.h"
+#include "framework/object_factory.h"
+#include "framework/runtime.h"
+#include "framework/logging/log.h"
+#include "framework/utils/timer.h"
+#include "caliper/cali.h"
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+
+namespace opensn
+{
+namespace lbs
+{
+
+OpenSnRegisterObjectInNamespace(lbs, BatchedSteadyStateSolver);
+
+namespace
+{
+
+DiscreteOrdinatesSolver&
+GetDiscreteOrdinatesSolver(LBSSolver& lbs_solver)
+{
+  auto* do_solver = dynamic_cast<DiscreteOrdinatesSolver*>(&lbs_solver);
+  OpenSnInvalidArgumentIf(not do_solver,
+                          "lbs.BatchedSteadyStateSolver requires a discrete ordinates solver.");
+  OpenSnInvalidArgumentIf(dynamic_cast<DiscreteOrdinatesCurvilinearSolver*>(&lbs_solver),
+                          "lbs.BatchedSteadyStateSolver does not support curvilinear solvers.");
+  return *do_solver;
+}
+
+/**
+ * Returns true if a groupset receives a source from a later groupset, through upscattering or
+ * fission, such that solving the groupsets once in order is not exact.
+ */
+bool
+HasAcrossGroupsetFeedback(const LBSSolver& lbs_solver)
+{
+  const auto& groupsets = lbs_solver.Groupsets();
+  if (groupsets.size() < 2)
+    return false;
+
+  std::vector<size_t> group_to_groupset(lbs_solver.NumGroups(), 0);
+  for (size_t gs = 0; gs < groupsets.size(); ++gs)
+    for (const auto& group : groupsets[gs].groups_)
+      group_to_groupset[group.id_] = gs;
+
+  for (const auto& [mat_id, xs] : lbs_solver.GetMatID2XSMap())
+  {
+    if (xs->IsFissionable())
+      return true;
+    for (const auto& S_ell : xs->TransferMatrices())
+      for (size_t g = 0; g < S_ell.NumRows(); ++g)
+        for (const auto& [_, gp, sigma_sm] : S_ell.Row(g))
+          if (group_to_groupset[gp] > group_to_groupset[g])
+            return true;
+  }
+  return false;
+}
+
+} // namespace
+
+InputParameters
+BatchedSteadyStateSolver::GetInputParameters()
+{
+  InputParameters params = opensn::Solver::GetInputParameters();
+
+  params.SetGeneralDescription(
+    "Steady state solver for a batch of independent fixed sources. Every point or distributed "
+    "source is a separate right-hand side, and the right-hand sides of a batch share the sweeps.");
+  params.SetDocGroup("LBSExecutors");
+  params.ChangeExistingParamToOptional("name", "BatchedSteadyStateSolver");
+
+  params.AddRequiredParameter<size_t>("lbs_solver_handle",
+                                      "Handle to an existing discrete ordinates solver");
+  params.AddOptionalParameterArray(
+    "point_sources", {}, "An array of handles to point sources, one right-hand side each.");
+  params.AddOptionalParameterArray(
+    "distributed_sources",
+    {},
+    "An array of handles to distributed sources, one right-hand side each. They follow the "
+    "point sources in the numbering of the right-hand sides.");
+  params.AddOptionalParameter("max_batch_size",
+                              0,
+                              "Maximum number of right-hand sides swept together. Zero sweeps "
+                              "all right-hand sides together.");
+
+  params.AddOptionalParameter("max_ags_iterations",
+                              100,
+                              "Maximum number of across-groupset iterations. They are only "
+                              "performed when upscattering or fission couples a groupset to a "
+                              "later one.");
+  params.AddOptionalParameter("ags_tolerance",
+                              1.0e-6,
+                              "Tolerance on the relative change of the flux moments of every "
+                              "right-hand side between two across-groupset iterations.");
+
+  params.ConstrainParameterRange("max_batch_size", AllowableRangeLowLimit::New(0));
+  params.ConstrainParameterRange("max_ags_iterations", AllowableRangeLowLimit::New(1));
+  params.ConstrainParameterRange("ags_tolerance", AllowableRangeLowLimit::New(0.0, false));
+
+  return params;
+}
+
+BatchedSteadyStateSolver::BatchedSteadyStateSolver(const InputParameters& params)
+  : opensn::Solver(params),
+    lbs_solver_(
+      GetStackItem<LBSSolver>(object_stack, params.GetParamValue<size_t>("lbs_solver_handle"))),
+    do_solver_(GetDiscreteOrdinatesSolver(lbs_solver_)),
+    max_batch_size_(params.GetParamValue<size_t>("max_batch_size")),
+    max_ags_iterations_(params.GetParamValue<int>("max_ags_iterations")),
+    ags_tolerance_(params.GetParamValue<double>("ags_tolerance"))
+{
+  for (const auto& sub_param : params.GetParam("point_sources"))
+    point_sources_.push_back(
+      GetStackItem<PointSource>(object_stack, sub_param.GetValue<size_t>(), __FUNCTION__));
+
+  for (const auto& sub_param : params.GetParam("distributed_sources"))
+    distributed_sources_.push_back(
+      GetStackItem<DistributedSource>(object_stack, sub_param.GetValue<size_t>(), __FUNCTION__));
+
+  OpenSnInvalidArgumentIf(NumRHS() == 0,
+                          "lbs.BatchedSteadyStateSolver requires at least one point or "
+                          "distributed source.");
+}
+
+void
+BatchedSteadyStateSolver::Initialize()
+{
+  CALI_CXX_MARK_SCOPE("BatchedSteadyStateSolver::Initialize");
+
+  lbs_solver_.Initialize();
+
+  OpenSnInvalidArgumentIf(do_solver_.SweepType() != "AAH",
+                          "lbs.BatchedSteadyStateSolver requires sweep_type \"AAH\".");
+  OpenSnInvalidArgumentIf(lbs_solver_.Options().adjoint,
+                          "lbs.BatchedSteadyStateSolver does not support adjoint mode.");
+  for (const auto& [bid, boundary] : lbs_solver_.SweepBoundaries())
+    OpenSnInvalidArgumentIf(boundary->Type() != BoundaryType::VACUUM,
+                            "lbs.BatchedSteadyStateSolver only supports vacuum boundaries.");
+
+  for (auto& point_source : point_sources_)
+    point_source.Initialize(lbs_solver_);
+  for (auto& distributed_source : distributed_sources_)
+    distributed_source.Initialize(lbs_solver_);
+}
+
+void
+BatchedSteadyStateSolver::Execute()
+{
+  CALI_CXX_MARK_SCOPE("BatchedSteadyStateSolver::Execute");
+
+  const size_t num_rhs = NumRHS();
+  const size_t batch_size = max_batch_size_ == 0 ? num_rhs : std::min(max_batch_size_, num_rhs);
+
+  solutions_.assign(num_rhs, std::vector<double>(lbs_solver_.PhiOldLocal().size(), 0.0));
+  for (size_t rhs_begin = 0; rhs_begin < num_rhs; rhs_begin += batch_size)
+    SolveBatch(rhs_begin, std::min(batch_size, num_rhs - rhs_begin));
+
+  SelectRHS(0);
+}
+
+void
+BatchedSteadyStateSolver::SetProperties(const ParameterBlock& params)
+{
+  opensn::Solver::SetProperties(params);
+
+  for (const auto& param : params)
+  {
+    if (param.Name() == "rhs")
+    {
+      const auto rhs = param.GetValue<size_t>();
+      OpenSnInvalidArgumentIf(rhs >= solutions_.size(),
+                              "Right-hand side " + std::to_string(rhs) +
+                                " has no solution. The solver has " +
+                                std::to_string(solutions_.size()) + " solutions.");
+      SelectRHS(rhs);
+    }
+  }
+}
+
+ParameterBlock
+BatchedSteadyStateSolver::GetInfo(const ParameterBlock& params) const
+{
+  const auto param_name = params.GetParamValue<std::string>("name");
+
+  if (param_name == "num_rhs")
+    return ParameterBlock("", NumRHS());
+  else
+    OpenSnInvalidArgument("Unsupported info name \"" + param_name + "\".");
+}
+
+void
+BatchedSteadyStateSolver::AddFixedSource(size_t rhs,
+                                         const LBSGroupset& groupset,
+                                         std::vector<double>& q) const
+{
+  const auto& cell_transport_views = lbs_solver_.GetCellTransportViews();
+  const auto gs_i = groupset.groups_.front().id_;
+  const auto gs_f = groupset.groups_.back().id_;
+
+  if (rhs < point_sources_.size())
+  {
+    const auto& point_source = point_sources_[rhs];
+    const auto& strength = point_source.Strength();
+    for (const auto& subscriber : point_source.Subscribers())
+    {
+      const auto& transport_view = cell_transport_views[subscriber.cell_local_id];
+      for (size_t i = 0; i < transport_view.NumNodes(); ++i)
+      {
+        const auto uk_map = transport_view.MapDOF(i, 0, 0);
+        const double weight = subscriber.node_weights[i] * subscriber.volume_weight;
+        for (int g = gs_i; g <= gs_f; ++g)
+          q[uk_map + g] += strength[g] * weight;
+      }
+    }
+    return;
+  }
+
+  const auto& grid = lbs_solver_.Grid();
+  const auto& discretization = lbs_solver_.SpatialDiscretization();
+  const auto num_groups = static_cast<int>(lbs_solver_.NumGroups());
+  const auto& distributed_source = distributed_sources_[rhs - point_sources_.size()];
+  for (const auto local_id : distributed_source.Subscribers())
+  {
+    const auto& cell = grid.local_cells[local_id];
+    const auto& transport_view = cell_transport_views[local_id];
+    const auto nodes = discretization.GetCellNodeLocations(cell);
+    for (size_t i = 0; i < nodes.size(); ++i)
+    {
+      const auto src = distributed_source(cell, nodes[i], num_groups);
+      const auto dof_map = transport_view.MapDOF(i, 0, 0);
+      for (int g = gs_i; g <= gs_f; ++g)
+        q[dof_map + g] += src[g];
+    }
+  }
+}
+
+void
+BatchedSteadyStateSolver::SolveBatch(size_t rhs_begin, size_t num_rhs)
+{
+  CALI_CXX_MARK_SCOPE("BatchedSteadyStateSolver::SolveBatch");
+
+  if (lbs_solver_.Options().verbose_inner_iterations)
+    log.Log() << "\n********** Solving right-hand sides " << rhs_begin << "-"
+              << rhs_begin + num_rhs - 1 << " together\n";
+
+  auto& groupsets = lbs_solver_.Groupsets();
+  std::vector<GroupsetSweepData> sweep_data(groupsets.size());
+  for (size_t gs = 0; gs < groupsets.size(); ++gs)
+    InitializeGroupsetSweepData(groupsets[gs], num_rhs, sweep_data[gs]);
+
+  // Without sources from later groupsets a single pass over the groupsets is exact
+  if (not HasAcrossGroupsetFeedback(lbs_solver_))
+  {
+    for (size_t gs = 0; gs < groupsets.size(); ++gs)
+      SolveGroupset(groupsets[gs], sweep_data[gs], rhs_begin, num_rhs);
+    return;
+  }
+
+  std::vector<std::vector<double>> phi_old(num_rhs);
+  std::vector<double> local_sums(2 * num_rhs, 0.0);
+  std::vector<double> global_sums(2 * num_rhs, 0.0);
+  for (int it = 0; it < max_ags_iterations_; ++it)
+  {
+    for (size_t k = 0; k < num_rhs; ++k)
+      phi_old[k] = solutions_[rhs_begin + k];
+
+    for (size_t gs = 0; gs < groupsets.size(); ++gs)
+      SolveGroupset(groupsets[gs], sweep_data[gs], rhs_begin, num_rhs);
+
+    // Relative change of every right-hand side, with a single reduction
+    std::fill(local_sums.begin(), local_sums.end(), 0.0);
+    for (size_t k = 0; k < num_rhs; ++k)
+    {
+      const auto& phi = solutions_[rhs_begin + k];
+      for (size_t i = 0; i < phi.size(); ++i)
+      {
+        local_sums[2 * k] += (phi[i] - phi_old[k][i]) * (phi[i] - phi_old[k][i]);
+        local_sums[2 * k + 1] += phi[i] * phi[i];
+      }
+    }
+    mpi_comm.all_reduce(local_sums.data(),
+                        static_cast<int>(local_sums.size()),
+                        global_sums.data(),
+                        mpi::op::sum<double>());
+
+    double max_change = 0.0;
+    for (size_t k = 0; k < num_rhs; ++k)
+    {
+      const double change_norm = std::sqrt(global_sums[2 * k]);
+      const double phi_norm = std::sqrt(global_sums[2 * k + 1]);
+      max_change = std::max(max_change, phi_norm > 1.0e-25 ? change_norm / phi_norm : change_norm);
+    }
+
+    if (lbs_solver_.Options().verbose_ags_iterations)
+      log.Log() << "********** AGS solver iteration " << std::setw(3) << it << " "
+                << " Max relative change " << std::setw(10) << std::setprecision(4)
+                << max_change;
+
+    if (max_change < ags_tolerance_)
+      return;
+  }
+
+  log.Log0Warning() << "BatchedSteadyStateSolver: the across-groupset iteration of right-hand "
+                    << "sides " << rhs_begin << "-" << rhs_begin + num_rhs - 1
+                    << " did not converge.";
+}
+
+void
+BatchedSteadyStateSolver::InitializeGroupsetSweepData(LBSGroupset& groupset,
+                                                      size_t num_rhs,
+                                                      GroupsetSweepData& sweep_data)
+{
+  CALI_CXX_MARK_SCOPE("BatchedSteadyStateSolver::InitializeGroupsetSweepData");
+
+  const size_t phi_size = lbs_solver_.PhiOldLocal().size();
+  sweep_data.q_batch.assign(phi_size * num_rhs, 0.0);
+  sweep_data.phi_batch.assign(phi_size * num_rhs, 0.0);
+
+  sweep_data.angle_agg = do_solver_.MakeAngleAggregation(groupset, num_rhs);
+  sweep_data.sweep_chunk = do_solver_.MakeBatchedSweepChunk(
+    groupset, sweep_data.phi_batch, sweep_data.q_batch, num_rhs);
+  sweep_data.sweep_scheduler = std::make_unique<SweepScheduler>(
+    SchedulingAlgorithm::DEPTH_OF_GRAPH, *sweep_data.angle_agg, *sweep_data.sweep_chunk);
+  sweep_data.sweep_scheduler->SetBoundarySourceActiveFlag(false);
+  sweep_data.sweep_scheduler->SetFixedSourceActiveFlag(true);
+}
+
+void
+BatchedSteadyStateSolver::SolveGroupset(LBSGroupset& groupset,
+                                        GroupsetSweepData& sweep_data,
+                                        size_t rhs_begin,
+                                        size_t num_rhs)
+{
+  CALI_CXX_MARK_SCOPE("BatchedSteadyStateSolver::SolveGroupset");
+
+  const auto& cell_transport_views = lbs_solver_.GetCellTransportViews();
+  const auto& densities = lbs_solver_.DensitiesLocal();
+  const auto source_function = lbs_solver_.GetActiveSetSourceFunction();
+  const auto num_moments = static_cast<int>(lbs_solver_.NumMoments());
+  const size_t phi_size = lbs_solver_.PhiOldLocal().size();
+  const bool log_info = lbs_solver_.Options().verbose_inner_iterations;
+
+  auto& q_batch = sweep_data.q_batch;
+  const auto& phi_batch = sweep_data.phi_batch;
+  auto& angle_agg = *sweep_data.angle_agg;
+  auto& sweep_scheduler = *sweep_data.sweep_scheduler;
+  std::vector<double> q_work(phi_size, 0.0);
+  std::vector<double> dsa_work;
+
+  // The groups of a groupset are contiguous for every node and moment
+  const int gsi = groupset.groups_.front().id_;
+  const size_t block_size = groupset.groups_.size();
+  std::vector<size_t> block_offsets;
+  for (const auto& cell : lbs_solver_.Grid().local_cells)
+  {
+    const auto& transport_view = cell_transport_views[cell.local_id_];
+    for (int i = 0; i < transport_view.NumNodes(); ++i)
+      for (int m = 0; m < num_moments; ++m)
+        block_offsets.push_back(transport_view.MapDOF(i, m, gsi));
+  }
+
+  const bool apply_dsa = groupset.apply_wgdsa_ or groupset.apply_tgdsa_;
+  if (apply_dsa)
+    dsa_work.assign(phi_size, 0.0);
+
+  // Every solve of the groupset starts without delayed angular fluxes
+  sweep_scheduler.ZeroIncomingDelayedPsi();
+
+  // The fixed source and the sources from the other groupsets do not change during the
+  // iteration, they are evaluated once per right-hand side
+  std::vector<std::vector<double>> q_fixed(num_rhs);
+  for (size_t k = 0; k < num_rhs; ++k)
+  {
+    std::fill(q_work.begin(), q_work.end(), 0.0);
+    AddFixedSource(rhs_begin + k, groupset, q_work);
+    source_function(groupset,
+                    q_work,
+                    solutions_[rhs_begin + k],
+                    densities,
+                    APPLY_AGS_SCATTER_SOURCES | APPLY_AGS_FISSION_SOURCES);
+    q_fixed[k].reserve(block_offsets.size() * block_size);
+    for (const auto offset : block_offsets)
+      q_fixed[k].insert(q_fixed[k].end(), &q_work[offset], &q_work[offset] + block_size);
+  }
+
+  std::vector<bool> converged(num_rhs, false);
+  std::vector<double> f_norm_prev(num_rhs, 0.0);
+  std::vector<double> rho(num_rhs, 0.0);
+  std::vector<double> local_sums(2 * num_rhs, 0.0);
+  std::vector<double> global_sums(2 * num_rhs, 0.0);
+  size_t num_converged = 0;
+  for (int it = 0; it < groupset.max_iterations_ and num_converged < num_rhs; ++it)
+  {
+    // Sources of the current iterates. Converged right-hand sides keep their last source.
+    for (size_t k = 0; k < num_rhs; ++k)
+    {
+      if (converged[k])
+        continue;
+
+      const double* q_in = q_fixed[k].data();
+      for (const auto offset : block_offsets)
+      {
+        std::copy_n(q_in, block_size, &q_work[offset]);
+        q_in += block_size;
+      }
+      source_function(groupset,
+                      q_work,
+                      solutions_[rhs_begin + k],
+                      densities,
+                      APPLY_WGS_SCATTER_SOURCES | APPLY_WGS_FISSION_SOURCES);
+      for (const auto offset : block_offsets)
+        for (size_t j = 0; j < block_size; ++j)
+          q_batch[(offset + j) * num_rhs + k] = q_work[offset + j];
+    }
+
+    // One sweep for all right-hand sides. Delayed angular fluxes are lagged by one iteration.
+    sweep_scheduler.ZeroOutputFluxDataStructures();
+    sweep_scheduler.Sweep();
+    angle_agg.SetDelayedPsiNew2Old();
+
+    // Change of every iterate, corrected by DSA, and the next iterate
+    std::fill(local_sums.begin(), local_sums.end(), 0.0);
+    for (size_t k = 0; k < num_rhs; ++k)
+    {
+      if (converged[k])
+        continue;
+
+      auto& phi = solutions_[rhs_begin + k];
+      auto& f = apply_dsa ? dsa_work : q_work;
+      for (const auto offset : block_offsets)
+        for (size_t j = 0; j < block_size; ++j)
+        {
+          const double phi_new = phi_batch[(offset + j) * num_rhs + k];
+          local_sums[2 * k + 1] += phi_new * phi_new;
+          f[offset + j] = phi_new - phi[offset + j];
+        }
+
+      if (groupset.apply_wgdsa_)
+      {
+        std::vector<double> delta_phi_local;
+        lbs_solver_.AssembleWGDSADeltaPhiVector(groupset, dsa_work, delta_phi_local);
+        groupset.wgdsa_solver_->Assemble_b(delta_phi_local);
+        groupset.wgdsa_solver_->Solve(delta_phi_local);
+        lbs_solver_.DisAssembleWGDSADeltaPhiVector(groupset, delta_phi_local, dsa_work);
+      }
+      if (groupset.apply_tgdsa_)
+      {
+        std::vector<double> delta_phi_local;
+        lbs_solver_.AssembleTGDSADeltaPhiVector(groupset, dsa_work, delta_phi_local);
+        groupset.tgdsa_solver_->Assemble_b(delta_phi_local);
+        groupset.tgdsa_solver_->Solve(delta_phi_local);
+        lbs_solver_.DisAssembleTGDSADeltaPhiVector(groupset, delta_phi_local, dsa_work);
+      }
+
+      for (const auto offset : block_offsets)
+        for (size_t j = 0; j < block_size; ++j)
+        {
+          const double f_j = f[offset + j];
+          local_sums[2 * k] += f_j * f_j;
+          phi[offset + j] += f_j;
+        }
+    }
+
+    // Single reduction for the convergence tests of all right-hand sides
+    mpi_comm.all_reduce(local_sums.data(),
+                        static_cast<int>(local_sums.size()),
+                        global_sums.data(),
+                        mpi::op::sum<double>());
+
+    // The relative change is divided by one minus the estimated spectral radius, as in
+    // classic Richardson
+    double max_residual = 0.0;
+    for (size_t k = 0; k < num_rhs; ++k)
+    {
+      if (converged[k])
+        continue;
+
+      const double f_norm = std::sqrt(global_sums[2 * k]);
+      const double phi_norm = std::sqrt(global_sums[2 * k + 1]);
+      if (it > 0 and f_norm_prev[k] > 0.0)
+        rho[k] = f_norm / f_norm_prev[k];
+      f_norm_prev[k] = f_norm;
+
+      const double relative_change = phi_norm > 1.0e-25 ? f_norm / phi_norm : f_norm;
+      const double residual = (rho[k] > 0.0 and rho[k] < 1.0)
+                                ? relative_change / (1.0 - rho[k])
+                                : relative_change;
+      max_residual = std::max(max_residual, residual);
+      if (residual < groupset.residual_tolerance_)
+      {
+        converged[k] = true;
+        ++num_converged;
+      }
+    }
+
+    if (log_info)
+      log.Log() << program_timer.GetTimeString() << " WGS groups ["
+                << groupset.groups_.front().id_ << "-" << groupset.groups_.back().id_ << "]"
+                << " Iteration " << std::setw(5) << it << " Max residual " << std::setw(9)
+                << max_residual << " Converged " << num_converged << "/" << num_rhs;
+  }
+
+  if (num_converged < num_rhs)
+    log.Log0Warning() << "BatchedSteadyStateSolver: " << num_rhs - num_converged
+                      << " right-hand sides of groupset " << groupset.id_
+                      << " did not converge.";
+}
+
+void
+BatchedSteadyStateSolver::SelectRHS(size_t rhs)
+{
+  lbs_solver_.PhiOldLocal() = solutions_[rhs];
+  lbs_solver_.PhiNewLocal() = solutions_[rhs];
+
+  if (lbs_solver_.Options().use_precursors)
+    lbs_solver_.ComputePrecursors();
+
+  lbs_solver_.UpdateFieldFunctions();
+}
+
+} // namespace lbs
+} // namespace opensn
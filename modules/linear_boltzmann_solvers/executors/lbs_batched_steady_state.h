@@ -0,0 +1,108 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "modules/linear_boltzmann_solvers/lbs_solver/lbs_solver.h"
+#include "modules/linear_boltzmann_solvers/lbs_solver/point_source/point_source.h"
+#include "modules/linear_boltzmann_solvers/lbs_solver/distributed_source/distributed_source.h"
+
+namespace opensn
+{
+namespace lbs
+{
+class DiscreteOrdinatesSolver;
+class AngleAggregation;
+class SweepChunk;
+class SweepScheduler;
+
+/**
+ * Steady-state solver for a batch of independent fixed sources of the same transport problem.
+ *
+ * Every point or distributed source given to the solver is a separate right-hand side. The
+ * right-hand sides of a batch are swept together: they are carried as the innermost dimension of
+ * the source and flux moments, of the AAH FLUDS and of the sweep messages, so each sweep sends
+ * one message per angle set and factors each cell matrix once for the whole batch.
+ *
+ * The groupsets are solved in order, each with a source iteration on the whole batch, optionally
+ * accelerated by the WGDSA/TGDSA of the groupset. Every right-hand side has its own convergence
+ * test, the one of classic Richardson, and a converged right-hand side is no longer updated.
+ * When upscattering or fission couples a groupset to a later one, the passes over the groupsets
+ * are repeated until the flux moments of every right-hand side stop changing.
+ * Only the batch sources are applied. The material, boundary, point and distributed
+ * sources of the LBS solver itself are not part of any right-hand side, and all boundaries must
+ * be vacuum boundaries.
+ *
+ * The solution of every right-hand side is kept. Selecting one with SetProperties copies it to the
+ * flux moments and field functions of the LBS solver.
+ */
+class BatchedSteadyStateSolver : public opensn::Solver
+{
+protected:
+  LBSSolver& lbs_solver_;
+  DiscreteOrdinatesSolver& do_solver_;
+
+  std::vector<PointSource> point_sources_;
+  std::vector<DistributedSource> distributed_sources_;
+  const size_t max_batch_size_;
+  const int max_ags_iterations_;
+  const double ags_tolerance_;
+
+  /// Flux moments of every right-hand side, in the layout of the primary STL vectors
+  std::vector<std::vector<double>> solutions_;
+
+public:
+  static InputParameters GetInputParameters();
+
+  explicit BatchedSteadyStateSolver(const InputParameters& params);
+
+  void Initialize() override;
+  void Execute() override;
+
+  /**The property `rhs` selects the right-hand side whose solution is copied to the LBS solver.*/
+  void SetProperties(const ParameterBlock& params) override;
+
+  /**Supported info names are `num_rhs`, the number of right-hand sides.*/
+  ParameterBlock GetInfo(const ParameterBlock& params) const override;
+
+protected:
+  /**
+   * Sweep structures of a groupset with the right-hand sides of a batch as the innermost
+   * dimension. They are built once per batch and reused by every across-groupset iteration.
+   */
+  struct GroupsetSweepData
+  {
+    /// Interleaved source and flux moments of the batch, [dof * num_rhs + k]
+    std::vector<double> q_batch;
+    std::vector<double> phi_batch;
+    std::shared_ptr<AngleAggregation> angle_agg;
+    std::shared_ptr<SweepChunk> sweep_chunk;
+    std::unique_ptr<SweepScheduler> sweep_scheduler;
+  };
+
+  /**Returns the number of right-hand sides.*/
+  size_t NumRHS() const { return point_sources_.size() + distributed_sources_.size(); }
+
+  /**Adds the fixed source of right-hand side `rhs` for the groups of a groupset to q.*/
+  void AddFixedSource(size_t rhs, const LBSGroupset& groupset, std::vector<double>& q) const;
+
+  /**Solves the right-hand sides [rhs_begin, rhs_begin + num_rhs) together.*/
+  void SolveBatch(size_t rhs_begin, size_t num_rhs);
+
+  /**Builds the sweep structures of a groupset for a batch of num_rhs right-hand sides.*/
+  void InitializeGroupsetSweepData(LBSGroupset& groupset,
+                                   size_t num_rhs,
+                                   GroupsetSweepData& sweep_data);
+
+  /**Solves one groupset for the right-hand sides [rhs_begin, rhs_begin + num_rhs).*/
+  void SolveGroupset(LBSGroupset& groupset,
+                     GroupsetSweepData& sweep_data,
+                     size_t rhs_begin,
+                     size_t num_rhs);
+
+  /**Copies the solution of a right-hand side to the flux moments of the LBS solver.*/
+  void SelectRHS(size_t rhs);
+};
+
+} // namespace lbs
+} // namespace opensn
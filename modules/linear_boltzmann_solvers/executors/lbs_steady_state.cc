@@ -3,7 +3,9 @@
 
 #include "modules/linear_boltzmann_solvers/executors/lbs_steady_state.h"
 #include "modules/linear_boltzmann_solvers/lbs_solver/iterative_methods/ags_linear_solver.h"
+#include "modules/linear_boltzmann_solvers/lbs_solver/iterative_methods/wgs_context.h"
 #include "framework/object_factory.h"
+#include "framework/logging/log_exceptions.h"
 #include "caliper/cali.h"
 
 namespace opensn
@@ -61,5 +63,32 @@ SteadyStateSolver::Execute()
   lbs_solver_.UpdateFieldFunctions();
 }
 
+ParameterBlock
+SteadyStateSolver::GetInfo(const ParameterBlock& params) const
+{
+  const auto param_name = params.GetParamValue<std::string>("name");
+
+  if (param_name == "num_sweeps")
+  {
+    const auto num_groupsets = lbs_solver_.Groupsets().size();
+    size_t num_sweeps = 0;
+    if (params.Has("groupset"))
+    {
+      const auto groupset_id = params.GetParamValue<size_t>("groupset");
+      OpenSnInvalidArgumentIf(groupset_id >= num_groupsets,
+                              "Groupset " + std::to_string(groupset_id) + " does not exist.");
+      num_sweeps = lbs_solver_.GetWGSContext(static_cast<int>(groupset_id))
+                     .counter_applications_of_inv_op_;
+    }
+    else
+      for (size_t gs = 0; gs < num_groupsets; ++gs)
+        num_sweeps +=
+          lbs_solver_.GetWGSContext(static_cast<int>(gs)).counter_applications_of_inv_op_;
+    return ParameterBlock("", num_sweeps);
+  }
+  else
+    OpenSnInvalidArgument("Unsupported info name \"" + param_name + "\".");
+}
+
 } // namespace lbs
 } // namespace opensn
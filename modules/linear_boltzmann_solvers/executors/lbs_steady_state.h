@@ -22,6 +22,10 @@ public:
 
   void Initialize() override;
   void Execute() override;
+
+  /**Supported info names are `num_sweeps`, the number of sweeps of all groupsets, or of the
+   * groupset given by the parameter `groupset`.*/
+  ParameterBlock GetInfo(const ParameterBlock& params) const override;
 };
 
 } // namespace lbs
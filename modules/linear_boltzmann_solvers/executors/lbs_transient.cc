@@ -2,10 +2,20 @@
 // SPDX-License-Identifier: MIT
 
 #include "modules/linear_boltzmann_solvers/executors/lbs_transient.h"
-
+#include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/lbs_discrete_ordinates_solver.h"
+#include "modules/linear_boltzmann_solvers/discrete_ordinates_curvilinear_solver/lbs_curvilinear_solver.h"
+#include "modules/linear_boltzmann_solvers/lbs_solver/iterative_methods/ags_linear_solver.h"
+#include "modules/linear_boltzmann_solvers/lbs_solver/source_functions/transient_source_function.h"
+#include "framework/mesh/mesh_continuum/mesh_continuum.h"
+#include "framework/physics/time_steppers/time_stepper.h"
+#include "framework/event_system/physics_event_publisher.h"
+#include "framework/utils/memory_registry.h"
+#include "framework/logging/log_exceptions.h"
 #include "framework/object_factory.h"
-
-#include "framework/math/time_integrations/time_integration.h"
+#include "framework/runtime.h"
+#include "framework/logging/log.h"
+#include "caliper/cali.h"
+#include <cmath>
 
 namespace opensn
 {
@@ -14,21 +24,70 @@ namespace lbs
 
 OpenSnRegisterObjectInNamespace(lbs, TransientSolver);
 
+namespace
+{
+
+DiscreteOrdinatesSolver&
+GetDiscreteOrdinatesSolver(LBSSolver& lbs_solver)
+{
+  auto* do_solver = dynamic_cast<DiscreteOrdinatesSolver*>(&lbs_solver);
+  OpenSnInvalidArgumentIf(not do_solver,
+                          "lbs.TransientSolver requires a discrete ordinates solver.");
+  OpenSnInvalidArgumentIf(dynamic_cast<DiscreteOrdinatesCurvilinearSolver*>(&lbs_solver),
+                          "lbs.TransientSolver does not support curvilinear solvers.");
+  return *do_solver;
+}
+
+} // namespace
+
 InputParameters
 TransientSolver::GetInputParameters()
 {
   InputParameters params = opensn::Solver::GetInputParameters();
 
-  params.SetGeneralDescription("Generalized implementation of a transient solver. This solver calls"
-                               " the Across-Groupset (AGS) solver for the lbs-data block.");
+  params.SetGeneralDescription(
+    "Time-dependent discrete ordinates solver. Every time step calls the Across-Groupset (AGS) "
+    "solver for the lbs-data block.");
   params.SetDocGroup("LBSExecutors");
 
   params.ChangeExistingParamToOptional("name", "TransientSolver");
 
-  params.AddRequiredParameter<size_t>("lbs_solver_handle", "Handle to an existing lbs solver");
+  params.AddRequiredParameter<size_t>("lbs_solver_handle",
+                                      "Handle to an existing discrete ordinates solver");
+
+  params.AddOptionalParameter(
+    "time_integration", "implicit_euler", "Time integration scheme to use");
+  params.ConstrainParameterRange("time_integration",
+                                 AllowableRangeList::New({"implicit_euler", "crank_nicolson"}));
+
+  params.AddOptionalParameter("initial_condition",
+                              "steady_state",
+                              "Initial condition. Either the steady-state solution of the "
+                              "fixed-source problem or zero.");
+  params.ConstrainParameterRange("initial_condition",
+                                 AllowableRangeList::New({"steady_state", "zero"}));
 
-  params.AddRequiredParameter<size_t>("time_integration",
-                                      "Handle to a time integration scheme to use");
+  params.AddOptionalParameter("single_precision_psi_history",
+                              false,
+                              "Flag to store the angular flux of the previous time step in "
+                              "single precision.");
+
+  params.AddOptionalParameter("adapt_dt", false, "Flag to enable adaptive time stepping.");
+  params.AddOptionalParameter("adapt_dt_max_change",
+                              0.1,
+                              "Relative change of the flux moments over a step above which the "
+                              "step is repeated with half the step size.");
+  params.AddOptionalParameter("adapt_dt_min_change",
+                              0.01,
+                              "Relative change of the flux moments over a step below which the "
+                              "step size is doubled.");
+  params.AddOptionalParameter("adapt_dt_min", 1.0e-8, "Minimum step size of adaptive stepping.");
+  params.AddOptionalParameter("adapt_dt_max", 1.0e10, "Maximum step size of adaptive stepping.");
+
+  params.ConstrainParameterRange("adapt_dt_max_change", AllowableRangeLowLimit::New(0.0, false));
+  params.ConstrainParameterRange("adapt_dt_min_change", AllowableRangeLowLimit::New(0.0));
+  params.ConstrainParameterRange("adapt_dt_min", AllowableRangeLowLimit::New(1.0e-12));
+  params.ConstrainParameterRange("adapt_dt_max", AllowableRangeLowLimit::New(1.0e-12));
 
   return params;
 }
@@ -37,30 +96,305 @@ TransientSolver::TransientSolver(const InputParameters& params)
   : opensn::Solver(params),
     lbs_solver_(
       GetStackItem<LBSSolver>(object_stack, params.GetParamValue<size_t>("lbs_solver_handle"))),
-    time_integration_(GetStackItemPtrAsType<TimeIntegration>(
-      object_stack, params.GetParamValue<size_t>("time_integration")))
+    do_solver_(GetDiscreteOrdinatesSolver(lbs_solver_)),
+    method_(params.GetParamValue<std::string>("time_integration") == "crank_nicolson"
+              ? SteppingMethod::CRANK_NICOLSON
+              : SteppingMethod::IMPLICIT_EULER),
+    initial_condition_(params.GetParamValue<std::string>("initial_condition")),
+    single_precision_psi_history_(params.GetParamValue<bool>("single_precision_psi_history")),
+    adapt_dt_(params.GetParamValue<bool>("adapt_dt")),
+    adapt_dt_max_change_(params.GetParamValue<double>("adapt_dt_max_change")),
+    adapt_dt_min_change_(params.GetParamValue<double>("adapt_dt_min_change")),
+    adapt_dt_min_(params.GetParamValue<double>("adapt_dt_min")),
+    adapt_dt_max_(params.GetParamValue<double>("adapt_dt_max"))
+{
+  OpenSnInvalidArgumentIf(adapt_dt_min_change_ >= adapt_dt_max_change_,
+                          "adapt_dt_min_change must be smaller than adapt_dt_max_change.");
+  OpenSnInvalidArgumentIf(adapt_dt_min_ > adapt_dt_max_,
+                          "adapt_dt_min must not be larger than adapt_dt_max.");
+}
+
+double
+TransientSolver::Theta() const
 {
+  return method_ == SteppingMethod::CRANK_NICOLSON ? 0.5 : 1.0;
 }
 
 void
 TransientSolver::Initialize()
 {
+  CALI_CXX_MARK_SCOPE("TransientSolver::Initialize");
+
+  // The angular flux of the previous step is part of the source of a step
+  lbs_solver_.Options().save_angular_flux = true;
   lbs_solver_.Initialize();
+  SetBoundaryEvaluationTime(timestepper_->Time());
+
+  if (initial_condition_ == "steady_state")
+  {
+    auto& ags_solver = *lbs_solver_.GetPrimaryAGSSolver();
+    ags_solver.Setup();
+    ags_solver.Solve();
+
+    if (lbs_solver_.Options().use_precursors)
+      lbs_solver_.ComputePrecursors();
+  }
+  else
+  {
+    auto& phi_old = lbs_solver_.PhiOldLocal();
+    auto& phi_new = lbs_solver_.PhiNewLocal();
+    phi_old.assign(phi_old.size(), 0.0);
+    phi_new.assign(phi_new.size(), 0.0);
+    for (auto& psi : lbs_solver_.PsiNewLocal())
+      psi.assign(psi.size(), 0.0);
+    auto& precursors = lbs_solver_.PrecursorsNewLocal();
+    precursors.assign(precursors.size(), 0.0);
+  }
+
+  phi_prev_ = lbs_solver_.PhiNewLocal();
+  precursors_new_ = lbs_solver_.PrecursorsNewLocal();
+  fission_rate_prev_ = lbs_solver_.ComputeFissionRate(phi_prev_);
+
+  // Attach the time-dependent terms. They are activated by the first step.
+  auto& terms = do_solver_.GetTimeDependentSweepTerms();
+  terms.active = false;
+  terms.num_groups = lbs_solver_.NumGroups();
+  terms.sigma_t_shift.assign(lbs_solver_.Grid().local_cells.size() * terms.num_groups, 0.0);
+  terms.psi_prev.resize(lbs_solver_.PsiNewLocal().size());
+  for (size_t gs = 0; gs < terms.psi_prev.size(); ++gs)
+    terms.psi_prev[gs].Assign(lbs_solver_.PsiNewLocal()[gs], single_precision_psi_history_);
+
+  MemoryRegistry::GetInstance().Set(lbs_solver_.TextName() + "/time_dependent_terms",
+                                    terms.ComputeMemoryUsage());
+
+  // The WGS solvers refer to the active source function, so they pick up the transient one
+  using namespace std::placeholders;
+  source_function_ = std::make_shared<TransientSourceFunction>(lbs_solver_, dt_, method_);
+  lbs_solver_.SetActiveSetSourceFunction(
+    std::bind(&SourceFunction::operator(), source_function_, _1, _2, _3, _4, _5));
+
+  if (adapt_dt_)
+    timestepper_->SetMinimumTimeStepSize(adapt_dt_min_);
+
+  lbs_solver_.UpdateFieldFunctions();
+
+  log.Log() << "Solver \"" << TextName() << "\" initial fission rate " << std::scientific
+            << fission_rate_prev_;
 }
 
 void
 TransientSolver::Execute()
 {
+  CALI_CXX_MARK_SCOPE("TransientSolver::Execute");
+
+  auto& physics_ev_pub = PhysicsEventPublisher::GetInstance();
+
+  while (timestepper_->IsActive())
+  {
+    physics_ev_pub.SolverStep(*this);
+    physics_ev_pub.SolverAdvance(*this);
+  }
 }
 
 void
 TransientSolver::Step()
 {
+  CALI_CXX_MARK_SCOPE("TransientSolver::Step");
+
+  // Do not step past the end time
+  timestepper_->SetTimeStepSize(timestepper_->TimeStepSize());
+
+  while (true)
+  {
+    dt_ = timestepper_->TimeStepSize();
+    SolveTimeStep();
+    relative_change_ = ComputeRelativeChange();
+
+    if (not adapt_dt_ or relative_change_ <= adapt_dt_max_change_ or dt_ <= adapt_dt_min_)
+      break;
+
+    log.Log() << "Solver \"" << TextName() << "\" " << timestepper_->StringTimeInfo()
+              << " rejected, relative change " << std::scientific << relative_change_;
+    timestepper_->SetTimeStepSize(std::max(0.5 * dt_, adapt_dt_min_));
+  }
+
+  log.Log() << "Solver \"" << TextName() << "\" " << timestepper_->StringTimeInfo()
+            << ", fission rate " << std::scientific << fission_rate_new_;
+}
+
+void
+TransientSolver::SolveTimeStep()
+{
+  CALI_CXX_MARK_SCOPE("TransientSolver::SolveTimeStep");
+
+  const double theta = Theta();
+
+  UpdateSweepTerms();
+  SetBoundaryEvaluationTime(timestepper_->Time() + theta * dt_);
+
+  auto& ags_solver = *lbs_solver_.GetPrimaryAGSSolver();
+  ags_solver.Setup();
+  ags_solver.Solve();
+
+  // Precursors from the flux moments at t^n + theta dt
+  auto& phi_new = lbs_solver_.PhiNewLocal();
+  if (lbs_solver_.Options().use_precursors)
+    StepPrecursors(phi_new);
+
+  // Extrapolate from t^n + theta dt to t^{n+1}
+  if (theta != 1.0)
+  {
+    for (size_t i = 0; i < phi_new.size(); ++i)
+      phi_new[i] = (phi_new[i] - (1.0 - theta) * phi_prev_[i]) / theta;
+
+    const auto& psi_prev = do_solver_.GetTimeDependentSweepTerms().psi_prev;
+    auto& psi_new = lbs_solver_.PsiNewLocal();
+    for (size_t gs = 0; gs < psi_new.size(); ++gs)
+      for (size_t i = 0; i < psi_new[gs].size(); ++i)
+        psi_new[gs][i] = (psi_new[gs][i] - (1.0 - theta) * psi_prev[gs][i]) / theta;
+  }
+
+  fission_rate_new_ = lbs_solver_.ComputeFissionRate(phi_new);
+}
+
+void
+TransientSolver::UpdateSweepTerms()
+{
+  auto& terms = do_solver_.GetTimeDependentSweepTerms();
+  const size_t num_groups = terms.num_groups;
+  const double theta_dt = Theta() * dt_;
+
+  const auto& cell_transport_views = lbs_solver_.GetCellTransportViews();
+  for (const auto& cell : lbs_solver_.Grid().local_cells)
+  {
+    const auto& inv_velocity = cell_transport_views[cell.local_id_].XS().InverseVelocity();
+    OpenSnLogicalErrorIf(inv_velocity.size() < num_groups,
+                         "The cross sections of material " + std::to_string(cell.material_id_) +
+                           " have no velocities, which a transient requires.");
+
+    double* sigma_t_shift = &terms.sigma_t_shift[cell.local_id_ * num_groups];
+    for (size_t g = 0; g < num_groups; ++g)
+      sigma_t_shift[g] = inv_velocity[g] / theta_dt;
+  }
+  terms.active = true;
+}
+
+void
+TransientSolver::SetBoundaryEvaluationTime(double time)
+{
+  for (const auto& [bid, boundary] : lbs_solver_.SweepBoundaries())
+    boundary->SetEvaluationTime(time);
+}
+
+void
+TransientSolver::StepPrecursors(const std::vector<double>& phi_theta)
+{
+  CALI_CXX_MARK_SCOPE("TransientSolver::StepPrecursors");
+
+  const double theta = Theta();
+  const double theta_dt = theta * dt_;
+  const size_t J = lbs_solver_.MaxPrecursorsPerMaterial();
+  const size_t num_groups = lbs_solver_.NumGroups();
+
+  const auto& precursors_prev = lbs_solver_.PrecursorsNewLocal();
+  const auto& unit_cell_matrices = lbs_solver_.GetUnitCellMatrices();
+  const auto& cell_transport_views = lbs_solver_.GetCellTransportViews();
+
+  precursors_new_.assign(precursors_prev.size(), 0.0);
+  for (const auto& cell : lbs_solver_.Grid().local_cells)
+  {
+    const auto& fe_values = unit_cell_matrices[cell.local_id_];
+    const auto& transport_view = cell_transport_views[cell.local_id_];
+    const double cell_volume = transport_view.Volume();
+
+    const auto& xs = transport_view.XS();
+    if (not xs.IsFissionable())
+      continue;
+    const auto& precursors = xs.Precursors();
+    const auto& nu_delayed_sigma_f = xs.NuDelayedSigmaF();
+
+    // Cell-averaged delayed neutron production
+    double delayed_production = 0.0;
+    for (int i = 0; i < transport_view.NumNodes(); ++i)
+    {
+      const size_t uk_map = transport_view.MapDOF(i, 0, 0);
+      const double node_V_fraction = fe_values.intV_shapeI[i] / cell_volume;
+      for (size_t g = 0; g < num_groups; ++g)
+        delayed_production += nu_delayed_sigma_f[g] * phi_theta[uk_map + g] * node_V_fraction;
+    }
+
+    for (size_t j = 0; j < xs.NumPrecursors(); ++j)
+    {
+      const size_t dof = cell.local_id_ * J + j;
+      const auto& precursor = precursors[j];
+
+      const double c_theta =
+        (precursors_prev[dof] + theta_dt * precursor.fractional_yield * delayed_production) /
+        (1.0 + theta_dt * precursor.decay_constant);
+      precursors_new_[dof] = (c_theta - (1.0 - theta) * precursors_prev[dof]) / theta;
+    }
+  } // for cell
+}
+
+double
+TransientSolver::ComputeRelativeChange() const
+{
+  const auto& phi_new = lbs_solver_.PhiNewLocal();
+
+  double local_sums[2] = {0.0, 0.0};
+  for (size_t i = 0; i < phi_new.size(); ++i)
+  {
+    const double diff = phi_new[i] - phi_prev_[i];
+    local_sums[0] += diff * diff;
+    local_sums[1] += phi_new[i] * phi_new[i];
+  }
+
+  double global_sums[2] = {0.0, 0.0};
+  mpi_comm.all_reduce(local_sums, 2, global_sums, mpi::op::sum<double>());
+
+  if (global_sums[1] == 0.0)
+    return 0.0;
+  return std::sqrt(global_sums[0] / global_sums[1]);
 }
 
 void
 TransientSolver::Advance()
 {
+  CALI_CXX_MARK_SCOPE("TransientSolver::Advance");
+
+  // Accept the solution of the step
+  phi_prev_ = lbs_solver_.PhiNewLocal();
+  lbs_solver_.PhiOldLocal() = phi_prev_;
+  if (lbs_solver_.Options().use_precursors)
+    lbs_solver_.PrecursorsNewLocal() = precursors_new_;
+
+  auto& terms = do_solver_.GetTimeDependentSweepTerms();
+  for (size_t gs = 0; gs < terms.psi_prev.size(); ++gs)
+    terms.psi_prev[gs].Assign(lbs_solver_.PsiNewLocal()[gs], single_precision_psi_history_);
+
+  fission_rate_prev_ = fission_rate_new_;
+
+  timestepper_->Advance();
+
+  if (adapt_dt_ and relative_change_ < adapt_dt_min_change_)
+    timestepper_->SetTimeStepSize(std::min(2.0 * timestepper_->TimeStepSize(), adapt_dt_max_));
+
+  lbs_solver_.UpdateFieldFunctions();
+}
+
+ParameterBlock
+TransientSolver::GetInfo(const ParameterBlock& params) const
+{
+  const auto param_name = params.GetParamValue<std::string>("name");
+
+  if (param_name == "fission_rate")
+    return ParameterBlock("", fission_rate_prev_);
+  else if (param_name == "time")
+    return ParameterBlock("", timestepper_->Time());
+  else if (param_name == "dt")
+    return ParameterBlock("", timestepper_->TimeStepSize());
+  else
+    OpenSnInvalidArgument("Unsupported info name \"" + param_name + "\".");
 }
 
 } // namespace lbs
@@ -4,19 +4,55 @@
 #pragma once
 
 #include "modules/linear_boltzmann_solvers/lbs_solver/lbs_solver.h"
+#include "framework/math/math_time_stepping.h"
 
 namespace opensn
 {
-class TimeIntegration;
-
 namespace lbs
 {
+class DiscreteOrdinatesSolver;
+class TransientSourceFunction;
 
+/**
+ * Time-dependent discrete-ordinates solver using a theta-scheme (implicit Euler or
+ * Crank-Nicolson) with delayed neutron precursors.
+ *
+ * Every step solves for the angular flux at t^n + theta dt with the existing AGS/WGS solvers of
+ * the discrete-ordinates solver. The time derivative enters the sweeps as a shift
+ * 1/(v theta dt) of the total cross section and a source from the angular flux at the start of
+ * the step, so the sweep orderings, flux data structures and DSA operators are built once and
+ * reused by all steps, including steps of a different size. The angular flux of the previous
+ * step is the only history kept, optionally in single precision.
+ *
+ * With adaptive time stepping a step is repeated with half the step size when the relative
+ * change of the flux moments exceeds a tolerance, and the step size is doubled after steps with
+ * a small change.
+ */
 class TransientSolver : public opensn::Solver
 {
 protected:
   LBSSolver& lbs_solver_;
-  std::shared_ptr<TimeIntegration> time_integration_;
+  DiscreteOrdinatesSolver& do_solver_;
+
+  SteppingMethod method_;
+  const std::string initial_condition_;
+  const bool single_precision_psi_history_;
+
+  const bool adapt_dt_;
+  const double adapt_dt_max_change_;
+  const double adapt_dt_min_change_;
+  const double adapt_dt_min_;
+  const double adapt_dt_max_;
+
+  /// Step size of the current step, referenced by the source function
+  double dt_ = 0.0;
+  std::shared_ptr<TransientSourceFunction> source_function_;
+
+  std::vector<double> phi_prev_;
+  std::vector<double> precursors_new_;
+  double fission_rate_prev_ = 0.0;
+  double fission_rate_new_ = 0.0;
+  double relative_change_ = 0.0;
 
 public:
   static InputParameters GetInputParameters();
@@ -24,8 +60,38 @@ public:
 
   void Initialize() override;
   void Execute() override;
+  /**Solves a time step. With adaptive time stepping the step is repeated with a smaller step
+   * size until the change over the step is acceptable. The solution is only accepted by
+   * Advance.*/
   void Step() override;
+  /**Accepts the solution of the last step and advances the time.*/
   void Advance() override;
+
+  /**Supported info names are `fission_rate`, the fission rate at the current time, `time` and
+   * `dt`, the size of the next step.*/
+  ParameterBlock GetInfo(const ParameterBlock& params) const override;
+
+protected:
+  /**Returns the theta of the time integration scheme.*/
+  double Theta() const;
+
+  /**Solves for the solution at the end of a step of size dt_.*/
+  void SolveTimeStep();
+
+  /**Sets the total cross section shifts of the sweeps for the current step size.*/
+  void UpdateSweepTerms();
+
+  /**Sets the time at which time-dependent boundaries evaluate their incident fluxes. A step
+   * solves for the flux at t^n + theta dt, so the boundaries are evaluated at that time and the
+   * extrapolation to t^{n+1} is exact for incident fluxes linear in time.*/
+  void SetBoundaryEvaluationTime(double time);
+
+  /**Computes the precursor concentrations at the end of the step from the flux moments at the
+   * intermediate time t^n + theta dt.*/
+  void StepPrecursors(const std::vector<double>& phi_theta);
+
+  /**Returns the relative change, in the 2-norm, of the flux moments over the step.*/
+  double ComputeRelativeChange() const;
 };
 
 } // namespace lbs
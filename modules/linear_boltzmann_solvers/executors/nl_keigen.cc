@@ -5,6 +5,7 @@
 #include "modules/linear_boltzmann_solvers/lbs_solver/iterative_methods/power_iteration_keigen.h"
 #include "framework/object_factory.h"
 #include "framework/logging/log.h"
+#include "framework/logging/log_exceptions.h"
 
 namespace opensn
 {
@@ -36,12 +37,35 @@ NonLinearKEigen::GetInputParameters()
   params.AddOptionalParameter("l_max_its", 50, "Linear maximum iterations");
   params.AddOptionalParameter("l_gmres_restart_intvl", 30, "GMRes restart interval");
   params.AddOptionalParameter("l_gmres_breakdown_tol", 1.0e6, "GMRes breakdown tolerance");
+  // Preconditioner parameters
+  params.AddOptionalParameter(
+    "pc_type",
+    "residual_dsa",
+    "Acceleration of the Newton-Krylov iterations. \"residual_dsa\" applies WGDSA/TGDSA, chained "
+    "across groupsets, to the residual and leaves the linear solves unpreconditioned. \"shell\" "
+    "uses the unaccelerated residual and a shell preconditioner built from DSA-accelerated source "
+    "iterations, chained across groupsets, and an optional diffusion eigen-correction.");
+  params.AddOptionalParameter("pc_num_sweeps",
+                              0,
+                              "Number of transport sweeps per application of the shell "
+                              "preconditioner. With zero sweeps only the chained DSA is applied.");
+  params.AddOptionalParameter("pc_eigen_correction",
+                              false,
+                              "If true, the shell preconditioner also applies the diffusion "
+                              "approximation of the fission operator.");
+  params.AddOptionalParameter("pc_lag",
+                              2,
+                              "Number of Newton steps between shell preconditioner rebuilds. "
+                              "-1 never rebuilds the preconditioner.");
   params.AddOptionalParameter("reset_phi0", true, "If true, reinitializes scalar fluxes to 1.0");
   params.AddOptionalParameter("num_initial_power_iterations",
                               0,
                               "The number of initial power iterations to execute before entering "
                               "the non-linear algorithm");
 
+  params.ConstrainParameterRange("pc_type", AllowableRangeList::New({"residual_dsa", "shell"}));
+  params.ConstrainParameterRange("pc_num_sweeps", AllowableRangeLowLimit::New(0));
+
   return params;
 }
 
@@ -67,6 +91,13 @@ NonLinearKEigen::NonLinearKEigen(const InputParameters& params)
   tolerances.l_max_its_ = params.GetParamValue<int>("l_max_its");
   tolerances.l_gmres_restart_intvl_ = params.GetParamValue<int>("l_gmres_restart_intvl");
   tolerances.l_gmres_breakdown_tol_ = params.GetParamValue<double>("l_gmres_breakdown_tol");
+
+  nl_context_->use_shell_pc = params.GetParamValue<std::string>("pc_type") == "shell";
+  nl_context_->pc_num_sweeps = params.GetParamValue<int>("pc_num_sweeps");
+  nl_context_->pc_eigen_correction = params.GetParamValue<bool>("pc_eigen_correction");
+  nl_context_->pc_lag = params.GetParamValue<int>("pc_lag");
+  OpenSnInvalidArgumentIf(nl_context_->pc_lag == 0 or nl_context_->pc_lag < -1,
+                          "pc_lag must be -1 or positive.");
 }
 
 void
@@ -102,5 +133,18 @@ NonLinearKEigen::Execute()
   log.Log() << "LinearBoltzmann::KEigenvalueSolver execution completed\n\n";
 }
 
+ParameterBlock
+NonLinearKEigen::GetInfo(const ParameterBlock& params) const
+{
+  const auto param_name = params.GetParamValue<std::string>("name");
+
+  if (param_name == "k_eff")
+    return ParameterBlock("", nl_context_->kresid_func_context_.k_eff);
+  else if (param_name == "num_sweeps")
+    return ParameterBlock("", nl_context_->num_sweeps);
+  else
+    OpenSnInvalidArgument("Unsupported info name \"" + param_name + "\".");
+}
+
 } // namespace lbs
 } // namespace opensn
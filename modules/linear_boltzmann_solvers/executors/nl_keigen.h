@@ -32,6 +32,10 @@ public:
   void Initialize() override;
 
   void Execute() override;
+
+  /**Supported info names are `k_eff`, the final k-eigenvalue, and `num_sweeps`, the total
+   * number of sweeps of the last solve.*/
+  ParameterBlock GetInfo(const ParameterBlock& params) const override;
 };
 
 } // namespace lbs
@@ -124,15 +124,13 @@ PowerIterationKEigen::Execute()
     // Print iteration summary
     if (lbs_solver_.Options().verbose_outer_iterations)
     {
-      std::stringstream k_iter_info;
+      auto k_iter_info = log.Log();
       k_iter_info << program_timer.GetTimeString() << " "
                   << "  Iteration " << std::setw(5) << nit << "  k_eff " << std::setw(11)
                   << std::setprecision(7) << k_eff_ << "  k_eff change " << std::setw(12)
                   << k_eff_change << "  reactivity " << std::setw(10) << reactivity * 1e5;
       if (converged)
         k_iter_info << " CONVERGED\n";
-
-      log.Log() << k_iter_info.str();
     }
 
     if (lbs_solver_.RestartsEnabled() and lbs_solver_.TriggerRestartDump())
@@ -166,6 +164,17 @@ PowerIterationKEigen::Execute()
   log.Log() << "LinearBoltzmann::KEigenvalueSolver execution completed\n\n";
 }
 
+ParameterBlock
+PowerIterationKEigen::GetInfo(const ParameterBlock& params) const
+{
+  const auto param_name = params.GetParamValue<std::string>("name");
+
+  if (param_name == "k_eff")
+    return ParameterBlock("", k_eff_);
+  else
+    OpenSnInvalidArgument("Unsupported info name \"" + param_name + "\".");
+}
+
 void
 PowerIterationKEigen::SetLBSFissionSource(const std::vector<double>& input, const bool additive)
 {
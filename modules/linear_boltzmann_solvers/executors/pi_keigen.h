@@ -43,6 +43,8 @@ public:
 
   void Execute() override;
 
+  ParameterBlock GetInfo(const ParameterBlock& params) const override;
+
 protected:
   /**
    * Combines function calls to set fission source.
@@ -286,13 +286,11 @@ PowerIterationKEigenSMM::Execute()
 
     if (lbs_solver_.Options().verbose_outer_iterations)
     {
-      std::stringstream ss;
-      ss << program_timer.GetTimeString() << " "
-         << "  Iteration " << std::setw(5) << nit << "  k_eff " << std::setw(14)
-         << std::setprecision(10) << k_eff_ << "  k_eff change " << std::setw(12) << k_eff_change
-         << "  phi change " << std::setw(12) << phi_change
-         << (k_eff_change < k_tolerance_ ? " CONVERGED" : "");
-      log.Log() << ss.str();
+      log.Log() << program_timer.GetTimeString() << " "
+                << "  Iteration " << std::setw(5) << nit << "  k_eff " << std::setw(14)
+                << std::setprecision(10) << k_eff_ << "  k_eff change " << std::setw(12)
+                << k_eff_change << "  phi change " << std::setw(12) << phi_change
+                << (k_eff_change < k_tolerance_ ? " CONVERGED" : "");
     }
 
     if (k_eff_change < k_tolerance_)
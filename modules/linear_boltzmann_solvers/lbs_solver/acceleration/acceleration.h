@@ -65,8 +65,18 @@ struct TwoGridCollapsedInfo
   std::vector<double> spectrum;
 };
 
+/**Computes the two-grid collapsed diffusion coefficient, absorption cross section and
+ * fundamental spectrum of a material. The spectrum is computed by a power iteration on the
+ * sparse transfer matrix.*/
 TwoGridCollapsedInfo MakeTwoGridCollapsedInfo(const MultiGroupXS& xs, EnergyCollapseScheme scheme);
 
+/**Computes the two-grid collapsed information of all materials in a (locally relevant) material
+ * map. Materials with identical cross sections are collapsed only once, and the distinct
+ * materials are distributed over all ranks. This call is collective.*/
+std::map<int, TwoGridCollapsedInfo>
+MakeTwoGridCollapsedInfo(const std::map<int, std::shared_ptr<MultiGroupXS>>& matid_to_xs_map,
+                         EnergyCollapseScheme scheme);
+
 /**Translates sweep boundary conditions to that used in diffusion acceleration
  * methods.*/
 std::map<uint64_t, BoundaryCondition>
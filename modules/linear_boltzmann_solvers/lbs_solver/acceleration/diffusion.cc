@@ -18,7 +18,7 @@ DiffusionSolver::DiffusionSolver(std::string text_name,
                                  const UnknownManager& uk_man,
                                  std::map<uint64_t, BoundaryCondition> bcs,
                                  MatID2XSMap map_mat_id_2_xs,
-                                 const std::vector<UnitCellMatrices>& unit_cell_matrices,
+                                 const UnitCellMatricesList& unit_cell_matrices,
                                  const bool suppress_bcs,
                                  const bool requires_ghosts,
                                  const bool verbose)
@@ -106,21 +106,21 @@ DiffusionSolver::AddToMatrix(const std::vector<int64_t>& rows,
 }
 
 void
-DiffusionSolver::Initialize()
+DiffusionSolver::BuildSparsityPattern(std::vector<int64_t>& nodal_nnz_in_diag,
+                                      std::vector<int64_t>& nodal_nnz_off_diag) const
 {
-  if (options.verbose)
-    log.Log() << text_name_ << ": Initializing PETSc items";
-
-  if (options.verbose)
-    log.Log() << text_name_ << ": Global number of DOFs=" << num_global_dofs_;
+  sdm_.BuildSparsityPattern(nodal_nnz_in_diag, nodal_nnz_off_diag, uk_man_);
+}
 
+void
+DiffusionSolver::CreateMatrix()
+{
   opensn::mpi_comm.barrier();
   log.Log() << "Sparsity pattern";
   opensn::mpi_comm.barrier();
-  // Create Matrix
   std::vector<int64_t> nodal_nnz_in_diag;
   std::vector<int64_t> nodal_nnz_off_diag;
-  sdm_.BuildSparsityPattern(nodal_nnz_in_diag, nodal_nnz_off_diag, uk_man_);
+  BuildSparsityPattern(nodal_nnz_in_diag, nodal_nnz_off_diag);
   opensn::mpi_comm.barrier();
   log.Log() << "Done Sparsity pattern";
   opensn::mpi_comm.barrier();
@@ -129,6 +129,19 @@ DiffusionSolver::Initialize()
   opensn::mpi_comm.barrier();
   log.Log() << "Done matrix creation";
   opensn::mpi_comm.barrier();
+}
+
+void
+DiffusionSolver::Initialize()
+{
+  if (options.verbose)
+    log.Log() << text_name_ << ": Initializing PETSc items";
+
+  if (options.verbose)
+    log.Log() << text_name_ << ": Global number of DOFs=" << num_global_dofs_;
+
+  // Create Matrix
+  CreateMatrix();
 
   // Create RHS
   if (not requires_ghosts_)
@@ -195,7 +208,7 @@ DiffusionSolver::Solve(std::vector<double>& solution, bool use_initial_guess)
   KSPSetTolerances(
     ksp_, options.residual_tolerance, options.residual_tolerance, 1.0e50, options.max_iters);
 
-  if (options.perform_symmetry_check)
+  if (options.perform_symmetry_check and not options.matrix_free)
   {
     PetscBool symmetry = PETSC_FALSE;
     MatIsSymmetric(A_, 1.0e-6, &symmetry);
@@ -267,7 +280,7 @@ DiffusionSolver::Solve(Vec petsc_solution, bool use_initial_guess)
   KSPSetTolerances(
     ksp_, options.residual_tolerance, options.residual_tolerance, 1.0e50, options.max_iters);
 
-  if (options.perform_symmetry_check)
+  if (options.perform_symmetry_check and not options.matrix_free)
   {
     PetscBool symmetry = PETSC_FALSE;
     MatIsSymmetric(A_, 1.0e-6, &symmetry);
@@ -312,5 +325,29 @@ DiffusionSolver::Solve(Vec petsc_solution, bool use_initial_guess)
   VecDestroy(&x);
 }
 
+MemoryUsage
+DiffusionSolver::ComputeMemoryUsage() const
+{
+  MemoryUsage usage;
+  if (A_ and not options.matrix_free)
+  {
+    MatInfo info;
+    MatGetInfo(A_, MAT_LOCAL, &info);
+    PetscInt num_local_rows, num_local_cols;
+    MatGetLocalSize(A_, &num_local_rows, &num_local_cols);
+    const auto nnz = static_cast<size_t>(info.nz_allocated);
+    usage += {nnz * (sizeof(PetscScalar) + sizeof(PetscInt)) +
+                (num_local_rows + 1) * sizeof(PetscInt),
+              static_cast<size_t>(info.mallocs) + 1};
+  }
+  if (rhs_)
+  {
+    PetscInt num_local_entries;
+    VecGetLocalSize(rhs_, &num_local_entries);
+    usage += {num_local_entries * sizeof(PetscScalar), 1};
+  }
+  return usage;
+}
+
 } // namespace lbs
 } // namespace opensn
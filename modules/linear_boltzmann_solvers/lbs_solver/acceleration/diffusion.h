@@ -5,6 +5,7 @@
 
 #include "modules/linear_boltzmann_solvers/lbs_solver/acceleration/acceleration.h"
 #include "framework/math/unknown_manager/unknown_manager.h"
+#include "framework/utils/memory_registry.h"
 #include "petscksp.h"
 
 namespace opensn
@@ -17,6 +18,7 @@ class SpatialDiscretization;
 namespace lbs
 {
 struct UnitCellMatrices;
+class UnitCellMatricesList;
 struct Multigroup_D_and_sigR;
 
 /**
@@ -36,7 +38,7 @@ protected:
 
   const MatID2XSMap mat_id_2_xs_map_;
 
-  const std::vector<UnitCellMatrices>& unit_cell_matrices_;
+  const UnitCellMatricesList& unit_cell_matrices_;
 
   const int64_t num_local_dofs_;
   const int64_t num_global_dofs_;
@@ -48,6 +50,19 @@ protected:
   const bool requires_ghosts_;
   const bool suppress_bcs_;
 
+  /**
+   * Computes the number of nonzeros of every local row in the diagonal and off-diagonal blocks
+   * of the matrix. The default is the sparsity pattern of the spatial discretization.
+   */
+  virtual void BuildSparsityPattern(std::vector<int64_t>& nodal_nnz_in_diag,
+                                    std::vector<int64_t>& nodal_nnz_off_diag) const;
+
+  /**
+   * Creates the system matrix. The default creates a MATMPIAIJ matrix preallocated with
+   * BuildSparsityPattern.
+   */
+  virtual void CreateMatrix();
+
 public:
   struct Options
   {
@@ -57,6 +72,8 @@ public:
     bool perform_symmetry_check = false; ///< For debugging only (very expensive)
     std::string additional_options_string;
     double penalty_factor = 4.0;
+    bool matrix_free = false;               ///< Apply the operator without assembling it
+    bool perform_matrix_free_check = false; ///< For debugging only (assembles the operator)
   } options;
 
 public:
@@ -65,7 +82,7 @@ public:
                   const UnknownManager& uk_man,
                   std::map<uint64_t, BoundaryCondition> bcs,
                   MatID2XSMap map_mat_id_2_xs,
-                  const std::vector<UnitCellMatrices>& unit_cell_matrices,
+                  const UnitCellMatricesList& unit_cell_matrices,
                   bool requires_ghosts,
                   bool suppress_bcs,
                   bool verbose);
@@ -94,6 +111,12 @@ public:
 
   std::pair<size_t, size_t> GetNumPhiIterativeUnknowns();
 
+  /**
+   * Returns the local memory held by the system matrix and the RHS vector, estimated from the
+   * allocated nonzeros of the matrix. Preconditioner storage is not included.
+   */
+  virtual MemoryUsage ComputeMemoryUsage() const;
+
   virtual ~DiffusionSolver();
 
   /**
@@ -10,7 +10,10 @@
 #include "modules/linear_boltzmann_solvers/lbs_solver/lbs_structs.h"
 #include "framework/runtime.h"
 #include "framework/logging/log.h"
+#include "framework/logging/log_exceptions.h"
+#include "framework/math/petsc_utils/petsc_utils.h"
 #include "framework/utils/timer.h"
+#include <numeric>
 #include <utility>
 
 namespace opensn
@@ -18,6 +21,55 @@ namespace opensn
 namespace lbs
 {
 
+namespace
+{
+
+/**
+ * Returns the interior penalty coefficient of a face of a cell, given the average of D/h over
+ * the face.
+ */
+double
+PenaltyCoefficient(const Cell& cell, double penalty_factor, double d_over_h)
+{
+  if (cell.Type() == CellType::SLAB or cell.Type() == CellType::POLYGON)
+    return fmax(penalty_factor * d_over_h, 0.25);
+  if (cell.Type() == CellType::POLYHEDRON)
+    return fmax(penalty_factor * 2.0 * d_over_h, 0.25);
+  return 1.0;
+}
+
+/**MatShell action of the matrix-free operator.*/
+PetscErrorCode
+MIPOperatorMult(Mat A, Vec x, Vec y)
+{
+  void* context;
+  MatShellGetContext(A, &context);
+  static_cast<DiffusionMIPSolver*>(context)->ApplyOperator(x, y);
+  return 0;
+}
+
+/**MatShell diagonal of the matrix-free operator.*/
+PetscErrorCode
+MIPOperatorGetDiagonal(Mat A, Vec d)
+{
+  void* context;
+  MatShellGetContext(A, &context);
+  static_cast<DiffusionMIPSolver*>(context)->GetOperatorDiagonal(d);
+  return 0;
+}
+
+/**PCShell application of the preconditioner of the matrix-free operator.*/
+PetscErrorCode
+MIPPreconditionerApply(PC pc, Vec r, Vec z)
+{
+  void* context;
+  PCShellGetContext(pc, &context);
+  static_cast<DiffusionMIPSolver*>(context)->ApplyPreconditioner(r, z);
+  return 0;
+}
+
+} // namespace
+
 void
 DiffusionMIPSolver::SetSourceFunction(std::shared_ptr<ScalarSpatialFunction> function)
 {
@@ -35,7 +87,7 @@ DiffusionMIPSolver::DiffusionMIPSolver(std::string text_name,
                                        const UnknownManager& uk_man,
                                        std::map<uint64_t, BoundaryCondition> bcs,
                                        MatID2XSMap map_mat_id_2_xs,
-                                       const std::vector<UnitCellMatrices>& unit_cell_matrices,
+                                       const UnitCellMatricesList& unit_cell_matrices,
                                        const bool suppress_bcs,
                                        const bool verbose)
   : DiffusionSolver(std::move(text_name),
@@ -52,6 +104,16 @@ DiffusionMIPSolver::DiffusionMIPSolver(std::string text_name,
     throw std::logic_error("lbs::acceleration::DiffusionMIPSolver can only be used with PWLD.");
 }
 
+DiffusionMIPSolver::~DiffusionMIPSolver()
+{
+  VecDestroy(&x_ghosted_);
+  VecDestroy(&y_ghosted_);
+  MatDestroy(&A0_);
+  KSPDestroy(&ksp0_);
+  VecDestroy(&x0_);
+  VecDestroy(&b0_);
+}
+
 void
 DiffusionMIPSolver::AssembleAand_b_wQpoints(const std::vector<double>& q_vector)
 {
@@ -602,6 +664,29 @@ DiffusionMIPSolver::AssembleAand_b(const std::vector<double>& q_vector)
     log.Log() << program_timer.GetTimeString() << " Starting assembly";
 
   const size_t num_groups = uk_man_.unknowns_.front().num_components_;
+  const bool matrix_free = options.matrix_free;
+
+  std::vector<FaceTopology> cell_topology;
+  std::vector<FaceGradients> gradients;
+  CellBlocks blocks;
+  std::vector<PetscInt> cell_dofs;
+  std::vector<PetscInt> adj_dofs;
+  std::vector<double> b_block;
+
+  if (matrix_free)
+    diagonal_.assign(num_local_dofs_, 0.0);
+
+  // The matrix-free check also assembles the operator to compare the two
+  Mat A_check = nullptr;
+  if (matrix_free and options.perform_matrix_free_check)
+  {
+    std::vector<int64_t> nodal_nnz_in_diag;
+    std::vector<int64_t> nodal_nnz_off_diag;
+    BuildSparsityPattern(nodal_nnz_in_diag, nodal_nnz_off_diag);
+    A_check = CreateSquareMatrix(num_local_dofs_, num_global_dofs_);
+    InitMatrixSparsity(A_check, nodal_nnz_in_diag, nodal_nnz_off_diag);
+  }
+  Mat A_assembly = matrix_free ? A_check : A_;
 
   VecSet(rhs_, 0.0);
   for (const auto& cell : grid_.local_cells)
@@ -609,254 +694,96 @@ DiffusionMIPSolver::AssembleAand_b(const std::vector<double>& q_vector)
     const size_t num_faces = cell.faces_.size();
     const auto& cell_mapping = sdm_.GetCellMapping(cell);
     const size_t num_nodes = cell_mapping.NumNodes();
-    const auto cc_nodes = cell_mapping.GetNodeLocations();
-    const auto& unit_cell_matrices = unit_cell_matrices_[cell.local_id_];
+    const auto& intV_shapeI_shapeJ = unit_cell_matrices_[cell.local_id_].intV_shapeI_shapeJ;
 
-    const auto& intV_gradshapeI_gradshapeJ = unit_cell_matrices.intV_gradshapeI_gradshapeJ;
-    const auto& intV_shapeI_shapeJ = unit_cell_matrices.intV_shapeI_shapeJ;
+    // The face connectivity and gradient blocks are the same for all groups
+    if (not matrix_free)
+      ComputeFaceTopology(cell, cell_topology);
+    const auto& topology = matrix_free ? face_topology_[cell.local_id_] : cell_topology;
+    ComputeFaceGradients(cell, topology, gradients);
 
-    const auto& xs = mat_id_2_xs_map_.at(cell.material_id_);
+    cell_dofs.resize(num_nodes);
+    b_block.resize(num_nodes);
 
     for (size_t g = 0; g < num_groups; ++g)
     {
-      // Get coefficient and nodal src
-      const double Dg = xs.Dg[g];
-      const double sigr_g = xs.sigR[g];
+      ComputeCellBlocks(cell, g, topology, gradients, blocks);
 
-      std::vector<double> qg(num_nodes, 0.0);
-      for (size_t j = 0; j < num_nodes; j++)
-        qg[j] = q_vector[sdm_.MapDOFLocal(cell, j, uk_man_, 0, g)];
+      for (size_t j = 0; j < num_nodes; ++j)
+        cell_dofs[j] = sdm_.MapDOF(cell, j, uk_man_, 0, g);
 
-      // Assemble continuous terms
-      for (size_t i = 0; i < num_nodes; i++)
+      // Nodal source and boundary source
+      for (size_t i = 0; i < num_nodes; ++i)
       {
-        const int64_t imap = sdm_.MapDOF(cell, i, uk_man_, 0, g);
-        double entry_rhs_i = 0.0;
-        for (size_t j = 0; j < num_nodes; j++)
-        {
-          const int64_t jmap = sdm_.MapDOF(cell, j, uk_man_, 0, g);
-
-          const double entry_aij =
-            Dg * intV_gradshapeI_gradshapeJ[i][j] + sigr_g * intV_shapeI_shapeJ[i][j];
-
-          entry_rhs_i += intV_shapeI_shapeJ[i][j] * qg[j];
-
-          MatSetValue(A_, imap, jmap, entry_aij, ADD_VALUES);
-        } // for j
+        double entry_rhs_i = blocks.b[i];
+        for (size_t j = 0; j < num_nodes; ++j)
+          entry_rhs_i +=
+            intV_shapeI_shapeJ[i][j] * q_vector[sdm_.MapDOFLocal(cell, j, uk_man_, 0, g)];
+        b_block[i] = entry_rhs_i;
+      }
 
-        VecSetValue(rhs_, imap, entry_rhs_i, ADD_VALUES);
-      } // for i
+      const auto n = static_cast<PetscInt>(num_nodes);
+      VecSetValues(rhs_, n, cell_dofs.data(), b_block.data(), ADD_VALUES);
 
-      // Assemble face terms
-      for (size_t f = 0; f < num_faces; ++f)
+      if (A_assembly != nullptr)
       {
-        const auto& face = cell.faces_[f];
-        const auto& n_f = face.normal_;
-        const size_t num_face_nodes = cell_mapping.NumFaceNodes(f);
-
-        const auto& intS_shapeI_shapeJ = unit_cell_matrices.intS_shapeI_shapeJ[f];
-        const auto& intS_shapeI_gradshapeJ = unit_cell_matrices.intS_shapeI_gradshapeJ[f];
-        const auto& intS_shapeI = unit_cell_matrices.intS_shapeI[f];
-
-        const double hm = HPerpendicular(cell, f);
-
-        typedef MeshContinuum Grid;
-
-        if (face.has_neighbor_)
+        MatSetValues(
+          A_assembly, n, cell_dofs.data(), n, cell_dofs.data(), blocks.Acc.data(), ADD_VALUES);
+        for (size_t f = 0; f < num_faces; ++f)
         {
-          const auto& adj_cell = grid_.cells[face.neighbor_id_];
-          const auto& adj_cell_mapping = sdm_.GetCellMapping(adj_cell);
-          const auto ac_nodes = adj_cell_mapping.GetNodeLocations();
-          const size_t acf = Grid::MapCellFace(cell, adj_cell, f);
-          const double hp = HPerpendicular(adj_cell, acf);
-
-          const auto& adj_xs = mat_id_2_xs_map_.at(adj_cell.material_id_);
-          const double adj_Dg = adj_xs.Dg[g];
-
-          // Compute kappa
-          double kappa = 1.0;
-          if (cell.Type() == CellType::SLAB)
-            kappa = fmax(options.penalty_factor * (adj_Dg / hp + Dg / hm) * 0.5, 0.25);
-          if (cell.Type() == CellType::POLYGON)
-            kappa = fmax(options.penalty_factor * (adj_Dg / hp + Dg / hm) * 0.5, 0.25);
-          if (cell.Type() == CellType::POLYHEDRON)
-            kappa = fmax(options.penalty_factor * 2.0 * (adj_Dg / hp + Dg / hm) * 0.5, 0.25);
-
-          // Assembly penalty terms
-          for (size_t fi = 0; fi < num_face_nodes; ++fi)
-          {
-            const int i = cell_mapping.MapFaceNode(f, fi);
-            const int64_t imap = sdm_.MapDOF(cell, i, uk_man_, 0, g);
-
-            for (size_t fj = 0; fj < num_face_nodes; ++fj)
-            {
-              const int jm = cell_mapping.MapFaceNode(f, fj); // j-minus
-              const int jp =
-                MapFaceNodeDisc(cell, adj_cell, cc_nodes, ac_nodes, f, acf, fj); // j-plus
-              const int64_t jmmap = sdm_.MapDOF(cell, jm, uk_man_, 0, g);
-              const int64_t jpmap = sdm_.MapDOF(adj_cell, jp, uk_man_, 0, g);
-
-              const double aij = kappa * intS_shapeI_shapeJ[i][jm];
-
-              MatSetValue(A_, imap, jmmap, aij, ADD_VALUES);
-              MatSetValue(A_, imap, jpmap, -aij, ADD_VALUES);
-            } // for fj
-          }   // for fi
-
-          // Assemble gradient terms
-          // For the following comments we use the notation:
-          // Dk = 0.5* n dot nabla bk
-
-          // 0.5*D* n dot (b_j^+ - b_j^-)*nabla b_i^-
-          for (int i = 0; i < num_nodes; i++)
-          {
-            const int64_t imap = sdm_.MapDOF(cell, i, uk_man_, 0, g);
-
-            for (int fj = 0; fj < num_face_nodes; fj++)
-            {
-              const int jm = cell_mapping.MapFaceNode(f, fj); // j-minus
-              const int jp =
-                MapFaceNodeDisc(cell, adj_cell, cc_nodes, ac_nodes, f, acf, fj); // j-plus
-              const int64_t jmmap = sdm_.MapDOF(cell, jm, uk_man_, 0, g);
-              const int64_t jpmap = sdm_.MapDOF(adj_cell, jp, uk_man_, 0, g);
-
-              const double aij = -0.5 * Dg * n_f.Dot(intS_shapeI_gradshapeJ[jm][i]);
-
-              MatSetValue(A_, imap, jmmap, aij, ADD_VALUES);
-              MatSetValue(A_, imap, jpmap, -aij, ADD_VALUES);
-            } // for fj
-          }   // for i
-
-          // 0.5*D* n dot (b_i^+ - b_i^-)*nabla b_j^-
-          for (int fi = 0; fi < num_face_nodes; fi++)
-          {
-            const int im = cell_mapping.MapFaceNode(f, fi); // i-minus
-            const int ip =
-              MapFaceNodeDisc(cell, adj_cell, cc_nodes, ac_nodes, f, acf, fi); // i-plus
-            const int64_t immap = sdm_.MapDOF(cell, im, uk_man_, 0, g);
-            const int64_t ipmap = sdm_.MapDOF(adj_cell, ip, uk_man_, 0, g);
-
-            for (int j = 0; j < num_nodes; j++)
-            {
-              const int64_t jmap = sdm_.MapDOF(cell, j, uk_man_, 0, g);
-
-              const double aij = -0.5 * Dg * n_f.Dot(intS_shapeI_gradshapeJ[im][j]);
-
-              MatSetValue(A_, immap, jmap, aij, ADD_VALUES);
-              MatSetValue(A_, ipmap, jmap, -aij, ADD_VALUES);
-            } // for j
-          }   // for fi
-
-        } // internal face
-        else
+          const auto& ft = topology[f];
+          if (ft.adj_cell == nullptr)
+            continue;
+
+          const size_t num_face_nodes = ft.face_nodes.size();
+          adj_dofs.resize(num_face_nodes);
+          for (size_t fj = 0; fj < num_face_nodes; ++fj)
+            adj_dofs[fj] = sdm_.MapDOF(*ft.adj_cell, ft.adj_face_nodes[fj], uk_man_, 0, g);
+
+          const auto nf = static_cast<PetscInt>(num_face_nodes);
+          MatSetValues(
+            A_assembly, n, cell_dofs.data(), nf, adj_dofs.data(), blocks.Acn[f].data(), ADD_VALUES);
+          MatSetValues(
+            A_assembly, nf, adj_dofs.data(), n, cell_dofs.data(), blocks.Anc[f].data(), ADD_VALUES);
+        }
+      }
+      if (matrix_free)
+      {
+        // Diagonal and Galerkin coarse operator, the sums of the blocks
+        for (size_t i = 0; i < num_nodes; ++i)
+          diagonal_[sdm_.MapDOFLocal(cell, i, uk_man_, 0, g)] = blocks.Acc[i * num_nodes + i];
+
+        const int64_t row = coarse_row_offset_ + cell.local_id_ * num_groups + g;
+        const double acc_sum = std::accumulate(blocks.Acc.begin(), blocks.Acc.end(), 0.0);
+        MatSetValue(A0_, row, row, acc_sum, ADD_VALUES);
+        for (size_t f = 0; f < num_faces; ++f)
         {
-          BoundaryCondition bc;
-          if (bcs_.count(face.neighbor_id_) > 0)
-            bc = bcs_.at(face.neighbor_id_);
-
-          if (bc.type == BCType::DIRICHLET)
-          {
-            const double bc_value = bc.values[0];
-
-            // Compute kappa
-            double kappa = 1.0;
-            if (cell.Type() == CellType::SLAB)
-              kappa = fmax(options.penalty_factor * Dg / hm, 0.25);
-            if (cell.Type() == CellType::POLYGON)
-              kappa = fmax(options.penalty_factor * Dg / hm, 0.25);
-            if (cell.Type() == CellType::POLYHEDRON)
-              kappa = fmax(options.penalty_factor * 2.0 * Dg / hm, 0.25);
-
-            // Assembly penalty terms
-            for (size_t fi = 0; fi < num_face_nodes; ++fi)
-            {
-              const int i = cell_mapping.MapFaceNode(f, fi);
-              const int64_t imap = sdm_.MapDOF(cell, i, uk_man_, 0, g);
-
-              for (size_t fj = 0; fj < num_face_nodes; ++fj)
-              {
-                const int jm = cell_mapping.MapFaceNode(f, fj);
-                const int64_t jmmap = sdm_.MapDOF(cell, jm, uk_man_, 0, g);
-
-                const double aij = kappa * intS_shapeI_shapeJ[i][jm];
-                const double aij_bc_value = aij * bc_value;
-
-                MatSetValue(A_, imap, jmmap, aij, ADD_VALUES);
-                VecSetValue(rhs_, imap, aij_bc_value, ADD_VALUES);
-              } // for fj
-            }   // for fi
-
-            // Assemble gradient terms
-            // For the following comments we use the notation:
-            // Dk = n dot nabla bk
-
-            // D* n dot (b_j^+ - b_j^-)*nabla b_i^-
-            for (size_t i = 0; i < num_nodes; i++)
-            {
-              const int64_t imap = sdm_.MapDOF(cell, i, uk_man_, 0, g);
-
-              for (size_t j = 0; j < num_nodes; j++)
-              {
-                const int64_t jmap = sdm_.MapDOF(cell, j, uk_man_, 0, g);
-
-                const double aij =
-                  -Dg * n_f.Dot(intS_shapeI_gradshapeJ[j][i] + intS_shapeI_gradshapeJ[i][j]);
-                const double aij_bc_value = aij * bc_value;
-
-                MatSetValue(A_, imap, jmap, aij, ADD_VALUES);
-                VecSetValue(rhs_, imap, aij_bc_value, ADD_VALUES);
-              } // for fj
-            }   // for i
-          }     // Dirichlet BC
-          else if (bc.type == BCType::ROBIN)
-          {
-            const double aval = bc.values[0];
-            const double bval = bc.values[1];
-            const double fval = bc.values[2];
-
-            if (std::fabs(bval) < 1.0e-12)
-              continue; // a and f assumed zero
-
-            for (size_t fi = 0; fi < num_face_nodes; fi++)
-            {
-              const int i = cell_mapping.MapFaceNode(f, fi);
-              const int64_t ir = sdm_.MapDOF(cell, i, uk_man_, 0, g);
-
-              if (std::fabs(aval) >= 1.0e-12)
-              {
-                for (size_t fj = 0; fj < num_face_nodes; fj++)
-                {
-                  const int j = cell_mapping.MapFaceNode(f, fj);
-                  const int64_t jr = sdm_.MapDOF(cell, j, uk_man_, 0, g);
-
-                  const double aij = (aval / bval) * intS_shapeI_shapeJ[i][j];
-
-                  MatSetValue(A_, ir, jr, aij, ADD_VALUES);
-                } // for fj
-              }   // if a nonzero
+          const auto& ft = topology[f];
+          if (ft.adj_cell == nullptr)
+            continue;
+
+          const int64_t adj_row = ft.adj_coarse_row + static_cast<int64_t>(g);
+          const auto& Acn = blocks.Acn[f];
+          const auto& Anc = blocks.Anc[f];
+          MatSetValue(A0_, row, adj_row, std::accumulate(Acn.begin(), Acn.end(), 0.0), ADD_VALUES);
+          MatSetValue(A0_, adj_row, row, std::accumulate(Anc.begin(), Anc.end(), 0.0), ADD_VALUES);
+        }
+      }
+    } // for g
+  }   // for cell
 
-              if (std::fabs(fval) >= 1.0e-12)
-              {
-                const double rhs_val = (fval / bval) * intS_shapeI[i];
+  // The assembled matrix is A_ itself or the coarse operator of the matrix-free operator
+  Mat assembled = matrix_free ? A0_ : A_;
 
-                VecSetValue(rhs_, ir, rhs_val, ADD_VALUES);
-              } // if f nonzero
-            }   // for fi
-          }     // Robin BC
-        }       // boundary face
-      }         // for face
-    }           // for g
-  }             // for cell
-
-  MatAssemblyBegin(A_, MAT_FINAL_ASSEMBLY);
-  MatAssemblyEnd(A_, MAT_FINAL_ASSEMBLY);
+  MatAssemblyBegin(assembled, MAT_FINAL_ASSEMBLY);
+  MatAssemblyEnd(assembled, MAT_FINAL_ASSEMBLY);
   VecAssemblyBegin(rhs_);
   VecAssemblyEnd(rhs_);
 
   if (options.verbose)
   {
     MatInfo info;
-    MatGetInfo(A_, MAT_GLOBAL_SUM, &info);
+    MatGetInfo(assembled, MAT_GLOBAL_SUM, &info);
 
     log.Log() << "Number of mallocs used = " << info.mallocs
               << "\nNumber of non-zeros allocated = " << info.nz_allocated
@@ -867,11 +794,19 @@ DiffusionMIPSolver::AssembleAand_b(const std::vector<double>& q_vector)
   if (options.perform_symmetry_check)
   {
     PetscBool symmetry = PETSC_FALSE;
-    MatIsSymmetric(A_, 1.0e-6, &symmetry);
+    MatIsSymmetric(assembled, 1.0e-6, &symmetry);
     if (symmetry == PETSC_FALSE)
       throw std::logic_error(fname + ":Symmetry check failed");
   }
 
+  if (A_check != nullptr)
+  {
+    MatAssemblyBegin(A_check, MAT_FINAL_ASSEMBLY);
+    MatAssemblyEnd(A_check, MAT_FINAL_ASSEMBLY);
+    CheckMatrixFreeOperator(A_check);
+    MatDestroy(&A_check);
+  }
+
   KSPSetOperators(ksp_, A_, A_);
 
   if (options.verbose)
@@ -879,6 +814,15 @@ DiffusionMIPSolver::AssembleAand_b(const std::vector<double>& q_vector)
 
   PC pc;
   KSPGetPC(ksp_, &pc);
+  if (matrix_free)
+  {
+    PCSetType(pc, PCSHELL);
+    PCShellSetApply(pc, MIPPreconditionerApply);
+    PCShellSetContext(pc, this);
+
+    KSPSetOperators(ksp0_, A0_, A0_);
+    KSPSetUp(ksp0_);
+  }
   PCSetUp(pc);
 
   KSPSetUp(ksp_);
@@ -1278,5 +1222,674 @@ DiffusionMIPSolver::MapFaceNodeDisc(const Cell& cur_cell,
     "lbs::acceleration::DiffusionMIPSolver::MapFaceNodeDisc: Mapping failure.");
 }
 
+void
+DiffusionMIPSolver::ComputeFaceTopology(const Cell& cell, std::vector<FaceTopology>& topology)
+{
+  const size_t num_faces = cell.faces_.size();
+  const auto& cell_mapping = sdm_.GetCellMapping(cell);
+  const auto cc_nodes = cell_mapping.GetNodeLocations();
+
+  topology.assign(num_faces, FaceTopology());
+  for (size_t f = 0; f < num_faces; ++f)
+  {
+    const auto& face = cell.faces_[f];
+    const size_t num_face_nodes = cell_mapping.NumFaceNodes(f);
+
+    auto& ft = topology[f];
+    ft.face_nodes.resize(num_face_nodes);
+    for (size_t fi = 0; fi < num_face_nodes; ++fi)
+      ft.face_nodes[fi] = cell_mapping.MapFaceNode(f, fi);
+    ft.hm = HPerpendicular(cell, f);
+
+    if (face.has_neighbor_)
+    {
+      const auto& adj_cell = grid_.cells[face.neighbor_id_];
+      const auto& adj_cell_mapping = sdm_.GetCellMapping(adj_cell);
+      const auto ac_nodes = adj_cell_mapping.GetNodeLocations();
+      const size_t acf = MeshContinuum::MapCellFace(cell, adj_cell, f);
+
+      ft.adj_cell = &adj_cell;
+      ft.hp = HPerpendicular(adj_cell, acf);
+      ft.adj_face_nodes.resize(num_face_nodes);
+      for (size_t fi = 0; fi < num_face_nodes; ++fi)
+        ft.adj_face_nodes[fi] = MapFaceNodeDisc(cell, adj_cell, cc_nodes, ac_nodes, f, acf, fi);
+    }
+  }
+}
+
+void
+DiffusionMIPSolver::ComputeFaceGradients(const Cell& cell,
+                                         const std::vector<FaceTopology>& topology,
+                                         std::vector<FaceGradients>& gradients) const
+{
+  const size_t num_faces = cell.faces_.size();
+  const size_t num_nodes = sdm_.GetCellMapping(cell).NumNodes();
+  const auto& unit_cell_matrices = unit_cell_matrices_[cell.local_id_];
+
+  gradients.resize(num_faces);
+  for (size_t f = 0; f < num_faces; ++f)
+  {
+    const auto& n_f = cell.faces_[f].normal_;
+    const auto& ft = topology[f];
+    const size_t num_face_nodes = ft.face_nodes.size();
+    const auto& intS_shapeI_gradshapeJ = unit_cell_matrices.intS_shapeI_gradshapeJ[f];
+
+    auto& fg = gradients[f];
+    if (ft.adj_cell != nullptr)
+    {
+      fg.grad_in.resize(num_nodes * num_face_nodes);
+      for (size_t i = 0; i < num_nodes; ++i)
+        for (size_t fj = 0; fj < num_face_nodes; ++fj)
+          fg.grad_in[i * num_face_nodes + fj] =
+            -0.5 * n_f.Dot(intS_shapeI_gradshapeJ[ft.face_nodes[fj]][i]);
+
+      fg.grad_out.resize(num_face_nodes * num_nodes);
+      for (size_t fi = 0; fi < num_face_nodes; ++fi)
+        for (size_t j = 0; j < num_nodes; ++j)
+          fg.grad_out[fi * num_nodes + j] =
+            -0.5 * n_f.Dot(intS_shapeI_gradshapeJ[ft.face_nodes[fi]][j]);
+
+      fg.bndry_grad.clear();
+    }
+    else
+    {
+      fg.grad_in.clear();
+      fg.grad_out.clear();
+
+      fg.bndry_grad.resize(num_nodes * num_nodes);
+      for (size_t i = 0; i < num_nodes; ++i)
+        for (size_t j = 0; j < num_nodes; ++j)
+          fg.bndry_grad[i * num_nodes + j] =
+            -n_f.Dot(intS_shapeI_gradshapeJ[j][i] + intS_shapeI_gradshapeJ[i][j]);
+    }
+  }
+}
+
+void
+DiffusionMIPSolver::ComputeCellBlocks(const Cell& cell,
+                                      size_t g,
+                                      const std::vector<FaceTopology>& topology,
+                                      const std::vector<FaceGradients>& gradients,
+                                      CellBlocks& blocks) const
+{
+  const size_t num_faces = cell.faces_.size();
+  const size_t num_nodes = sdm_.GetCellMapping(cell).NumNodes();
+  const auto& unit_cell_matrices = unit_cell_matrices_[cell.local_id_];
+
+  const auto& intV_gradshapeI_gradshapeJ = unit_cell_matrices.intV_gradshapeI_gradshapeJ;
+  const auto& intV_shapeI_shapeJ = unit_cell_matrices.intV_shapeI_shapeJ;
+
+  const auto& xs = mat_id_2_xs_map_.at(cell.material_id_);
+  const double Dg = xs.Dg[g];
+  const double sigr_g = xs.sigR[g];
+
+  // Continuous terms
+  auto& Acc = blocks.Acc;
+  Acc.resize(num_nodes * num_nodes);
+  for (size_t i = 0; i < num_nodes; ++i)
+    for (size_t j = 0; j < num_nodes; ++j)
+      Acc[i * num_nodes + j] =
+        Dg * intV_gradshapeI_gradshapeJ[i][j] + sigr_g * intV_shapeI_shapeJ[i][j];
+
+  blocks.b.assign(num_nodes, 0.0);
+  blocks.Acn.resize(num_faces);
+  blocks.Anc.resize(num_faces);
+
+  // Face terms
+  for (size_t f = 0; f < num_faces; ++f)
+  {
+    const auto& face = cell.faces_[f];
+    const auto& ft = topology[f];
+    const auto& fg = gradients[f];
+    const size_t num_face_nodes = ft.face_nodes.size();
+
+    const auto& intS_shapeI_shapeJ = unit_cell_matrices.intS_shapeI_shapeJ[f];
+    const auto& intS_shapeI = unit_cell_matrices.intS_shapeI[f];
+
+    auto& Acn = blocks.Acn[f];
+    auto& Anc = blocks.Anc[f];
+
+    if (face.has_neighbor_)
+    {
+      const auto& adj_xs = mat_id_2_xs_map_.at(ft.adj_cell->material_id_);
+      const double adj_Dg = adj_xs.Dg[g];
+
+      const double kappa =
+        PenaltyCoefficient(cell, options.penalty_factor, (adj_Dg / ft.hp + Dg / ft.hm) * 0.5);
+
+      // The neighbor contributions are the negated cell contributions
+      Acn.assign(num_nodes * num_face_nodes, 0.0);
+      Anc.resize(num_face_nodes * num_nodes);
+
+      // Penalty terms
+      for (size_t fi = 0; fi < num_face_nodes; ++fi)
+      {
+        const int i = ft.face_nodes[fi];
+        for (size_t fj = 0; fj < num_face_nodes; ++fj)
+        {
+          const int jm = ft.face_nodes[fj];
+          const double aij = kappa * intS_shapeI_shapeJ[i][jm];
+          Acc[i * num_nodes + jm] += aij;
+          Acn[i * num_face_nodes + fj] -= aij;
+        }
+      }
+
+      // 0.5*D* n dot (b_j^+ - b_j^-)*nabla b_i^-
+      for (size_t i = 0; i < num_nodes; ++i)
+        for (size_t fj = 0; fj < num_face_nodes; ++fj)
+        {
+          const int jm = ft.face_nodes[fj];
+          const double aij = Dg * fg.grad_in[i * num_face_nodes + fj];
+          Acc[i * num_nodes + jm] += aij;
+          Acn[i * num_face_nodes + fj] -= aij;
+        }
+
+      // 0.5*D* n dot (b_i^+ - b_i^-)*nabla b_j^-
+      for (size_t fi = 0; fi < num_face_nodes; ++fi)
+      {
+        const int im = ft.face_nodes[fi];
+        for (size_t j = 0; j < num_nodes; ++j)
+        {
+          const double aij = Dg * fg.grad_out[fi * num_nodes + j];
+          Acc[im * num_nodes + j] += aij;
+          Anc[fi * num_nodes + j] = -aij;
+        }
+      }
+    } // internal face
+    else
+    {
+      Acn.clear();
+      Anc.clear();
+
+      BoundaryCondition bc;
+      if (bcs_.count(face.neighbor_id_) > 0)
+        bc = bcs_.at(face.neighbor_id_);
+
+      if (bc.type == BCType::DIRICHLET)
+      {
+        const double bc_value = bc.values[0];
+        const double kappa = PenaltyCoefficient(cell, options.penalty_factor, Dg / ft.hm);
+
+        // Penalty terms
+        for (size_t fi = 0; fi < num_face_nodes; ++fi)
+        {
+          const int i = ft.face_nodes[fi];
+          for (size_t fj = 0; fj < num_face_nodes; ++fj)
+          {
+            const int jm = ft.face_nodes[fj];
+            const double aij = kappa * intS_shapeI_shapeJ[i][jm];
+            Acc[i * num_nodes + jm] += aij;
+            blocks.b[i] += aij * bc_value;
+          }
+        }
+
+        // D* n dot (b_j^+ - b_j^-)*nabla b_i^-
+        for (size_t i = 0; i < num_nodes; ++i)
+          for (size_t j = 0; j < num_nodes; ++j)
+          {
+            const double aij = Dg * fg.bndry_grad[i * num_nodes + j];
+            Acc[i * num_nodes + j] += aij;
+            blocks.b[i] += aij * bc_value;
+          }
+      } // Dirichlet BC
+      else if (bc.type == BCType::ROBIN)
+      {
+        const double aval = bc.values[0];
+        const double bval = bc.values[1];
+        const double fval = bc.values[2];
+
+        if (std::fabs(bval) < 1.0e-12)
+          continue; // a and f assumed zero
+
+        for (size_t fi = 0; fi < num_face_nodes; ++fi)
+        {
+          const int i = ft.face_nodes[fi];
+
+          if (std::fabs(aval) >= 1.0e-12)
+            for (size_t fj = 0; fj < num_face_nodes; ++fj)
+            {
+              const int j = ft.face_nodes[fj];
+              Acc[i * num_nodes + j] += (aval / bval) * intS_shapeI_shapeJ[i][j];
+            }
+
+          if (std::fabs(fval) >= 1.0e-12)
+            blocks.b[i] += (fval / bval) * intS_shapeI[i];
+        } // for fi
+      }   // Robin BC
+    }     // boundary face
+  }       // for face
+}
+
+int64_t
+DiffusionMIPSolver::MapNeighborDOF(const FaceTopology& face_topology, int node, size_t g) const
+{
+  if (face_topology.adj_ghost_base < 0)
+    return sdm_.MapDOFLocal(*face_topology.adj_cell, node, uk_man_, 0, g);
+
+  const size_t num_groups = uk_man_.unknowns_.front().num_components_;
+  return num_local_dofs_ + face_topology.adj_ghost_base +
+         static_cast<int64_t>(node * num_groups + g);
+}
+
+void
+DiffusionMIPSolver::CreateMatrix()
+{
+  if (options.matrix_free)
+    InitializeMatrixFreeOperator();
+  else
+    DiffusionSolver::CreateMatrix();
+}
+
+void
+DiffusionMIPSolver::InitializeMatrixFreeOperator()
+{
+  const size_t num_groups = uk_man_.unknowns_.front().num_components_;
+
+  // Face connectivity, and the ghost entries holding the nodes of the non-local neighbors
+  std::map<uint64_t, int64_t> ghost_cell_base;
+  std::vector<int64_t> ghost_ids;
+  face_topology_.resize(grid_.local_cells.size());
+  for (const auto& cell : grid_.local_cells)
+  {
+    auto& topology = face_topology_[cell.local_id_];
+    ComputeFaceTopology(cell, topology);
+
+    for (size_t f = 0; f < cell.faces_.size(); ++f)
+    {
+      const auto& face = cell.faces_[f];
+      if (not face.has_neighbor_ or face.IsNeighborLocal(grid_))
+        continue;
+
+      const auto& adj_cell = *topology[f].adj_cell;
+      auto it = ghost_cell_base.find(adj_cell.global_id_);
+      if (it == ghost_cell_base.end())
+      {
+        it = ghost_cell_base.emplace(adj_cell.global_id_, ghost_ids.size()).first;
+        const size_t adj_num_nodes = sdm_.GetCellMapping(adj_cell).NumNodes();
+        for (size_t j = 0; j < adj_num_nodes; ++j)
+          for (size_t g = 0; g < num_groups; ++g)
+            ghost_ids.push_back(sdm_.MapDOF(adj_cell, j, uk_man_, 0, g));
+      }
+      topology[f].adj_ghost_base = it->second;
+    }
+  }
+
+  x_ghosted_ = CreateVectorWithGhosts(
+    num_local_dofs_, num_global_dofs_, static_cast<int64_t>(ghost_ids.size()), ghost_ids);
+  VecDuplicate(x_ghosted_, &y_ghosted_);
+
+  // Coarse rows, numbered by location, cell and group
+  const auto num_coarse_rows = static_cast<int64_t>(grid_.local_cells.size() * num_groups);
+  std::vector<int64_t> locJ_num_coarse_rows;
+  mpi_comm.all_gather(num_coarse_rows, locJ_num_coarse_rows);
+  int64_t num_global_coarse_rows = 0;
+  for (int locJ = 0; locJ < opensn::mpi_comm.size(); ++locJ)
+  {
+    if (locJ == opensn::mpi_comm.rank())
+      coarse_row_offset_ = num_global_coarse_rows;
+    num_global_coarse_rows += locJ_num_coarse_rows[locJ];
+  }
+
+  // The coarse row of every neighbor is exchanged through the first node of the neighbor
+  {
+    Vec x_local;
+    VecGhostGetLocalForm(x_ghosted_, &x_local);
+    double* x;
+    VecGetArray(x_local, &x);
+    for (const auto& cell : grid_.local_cells)
+      x[sdm_.MapDOFLocal(cell, 0, uk_man_, 0, 0)] =
+        static_cast<double>(coarse_row_offset_ + cell.local_id_ * num_groups);
+    VecRestoreArray(x_local, &x);
+    VecGhostRestoreLocalForm(x_ghosted_, &x_local);
+  }
+  CommunicateGhostEntries(x_ghosted_);
+
+  std::vector<int64_t> coarse_nnz_in(num_coarse_rows, 1);
+  std::vector<int64_t> coarse_nnz_off(num_coarse_rows, 0);
+  {
+    auto x = GetGhostVectorLocalViewRead(x_ghosted_);
+    for (const auto& cell : grid_.local_cells)
+      for (size_t f = 0; f < cell.faces_.size(); ++f)
+      {
+        auto& ft = face_topology_[cell.local_id_][f];
+        if (ft.adj_cell == nullptr)
+          continue;
+
+        ft.adj_coarse_row = std::llround(x[MapNeighborDOF(ft, 0, 0)]);
+
+        auto& coarse_nnz = cell.faces_[f].IsNeighborLocal(grid_) ? coarse_nnz_in : coarse_nnz_off;
+        for (size_t g = 0; g < num_groups; ++g)
+          ++coarse_nnz[cell.local_id_ * num_groups + g];
+      }
+    RestoreGhostVectorLocalViewRead(x_ghosted_, x);
+  }
+
+  // Matrix-free operator
+  MatCreateShell(opensn::mpi_comm,
+                 num_local_dofs_,
+                 num_local_dofs_,
+                 num_global_dofs_,
+                 num_global_dofs_,
+                 this,
+                 &A_);
+  MatShellSetOperation(A_, MATOP_MULT, (void (*)())MIPOperatorMult);
+  MatShellSetOperation(A_, MATOP_GET_DIAGONAL, (void (*)())MIPOperatorGetDiagonal);
+
+  // Coarse operator and its solver
+  A0_ = CreateSquareMatrix(num_coarse_rows, num_global_coarse_rows);
+  InitMatrixSparsity(A0_, coarse_nnz_in, coarse_nnz_off);
+  x0_ = CreateVector(num_coarse_rows, num_global_coarse_rows);
+  VecDuplicate(x0_, &b0_);
+
+  const std::string coarse_prefix = text_name_ + "coarse_";
+  KSPCreate(opensn::mpi_comm, &ksp0_);
+  KSPSetOptionsPrefix(ksp0_, coarse_prefix.c_str());
+  KSPSetType(ksp0_, KSPPREONLY);
+
+  PC pc0;
+  KSPGetPC(ksp0_, &pc0);
+  PCSetType(pc0, PCHYPRE);
+  PCHYPRESetType(pc0, "boomeramg");
+  std::vector<std::string> pc_options = {"pc_hypre_boomeramg_agg_nl 1",
+                                         "pc_hypre_boomeramg_P_max 4",
+                                         "pc_hypre_boomeramg_grid_sweeps_coarse 1",
+                                         "pc_hypre_boomeramg_max_levels 25",
+                                         "pc_hypre_boomeramg_relax_type_all symmetric-SOR/Jacobi",
+                                         "pc_hypre_boomeramg_coarsen_type HMIS",
+                                         "pc_hypre_boomeramg_interp_type ext+i"};
+  for (const auto& option : pc_options)
+    PetscOptionsInsertString(nullptr, ("-" + coarse_prefix + option).c_str());
+  PCSetFromOptions(pc0);
+  KSPSetFromOptions(ksp0_);
+
+  if (options.verbose)
+    log.Log() << text_name_ << ": Matrix-free operator with " << num_global_coarse_rows
+              << " coarse rows";
+}
+
+void
+DiffusionMIPSolver::ApplyOperator(Vec x, Vec y)
+{
+  OpenSnLogicalErrorIf(not options.matrix_free,
+                       text_name_ + ": The operator is only applied matrix-free when "
+                                    "options.matrix_free is set.");
+
+  const size_t num_groups = uk_man_.unknowns_.front().num_components_;
+
+  // Values of the neighbor nodes on other locations
+  VecCopy(x, x_ghosted_);
+  CommunicateGhostEntries(x_ghosted_);
+
+  Vec x_local, y_local;
+  VecGhostGetLocalForm(x_ghosted_, &x_local);
+  VecGhostGetLocalForm(y_ghosted_, &y_local);
+  VecSet(y_local, 0.0);
+
+  const double* x_raw;
+  double* y_raw;
+  VecGetArrayRead(x_local, &x_raw);
+  VecGetArray(y_local, &y_raw);
+
+  std::vector<FaceGradients> gradients;
+  CellBlocks blocks;
+  std::vector<double> xc;
+  std::vector<double> yc;
+  for (const auto& cell : grid_.local_cells)
+  {
+    const auto& topology = face_topology_[cell.local_id_];
+    const size_t num_faces = cell.faces_.size();
+    const size_t num_nodes = sdm_.GetCellMapping(cell).NumNodes();
+    ComputeFaceGradients(cell, topology, gradients);
+
+    xc.resize(num_nodes);
+    yc.resize(num_nodes);
+    for (size_t g = 0; g < num_groups; ++g)
+    {
+      ComputeCellBlocks(cell, g, topology, gradients, blocks);
+
+      for (size_t j = 0; j < num_nodes; ++j)
+        xc[j] = x_raw[sdm_.MapDOFLocal(cell, j, uk_man_, 0, g)];
+
+      // Cell rows, cell columns
+      for (size_t i = 0; i < num_nodes; ++i)
+      {
+        double value = 0.0;
+        for (size_t j = 0; j < num_nodes; ++j)
+          value += blocks.Acc[i * num_nodes + j] * xc[j];
+        yc[i] = value;
+      }
+
+      for (size_t f = 0; f < num_faces; ++f)
+      {
+        const auto& ft = topology[f];
+        if (ft.adj_cell == nullptr)
+          continue;
+
+        const size_t num_face_nodes = ft.face_nodes.size();
+        const auto& Acn = blocks.Acn[f];
+        const auto& Anc = blocks.Anc[f];
+
+        // Cell rows, neighbor columns
+        for (size_t fj = 0; fj < num_face_nodes; ++fj)
+        {
+          const double xn = x_raw[MapNeighborDOF(ft, ft.adj_face_nodes[fj], g)];
+          for (size_t i = 0; i < num_nodes; ++i)
+            yc[i] += Acn[i * num_face_nodes + fj] * xn;
+        }
+
+        // Neighbor rows, cell columns
+        for (size_t fi = 0; fi < num_face_nodes; ++fi)
+        {
+          double value = 0.0;
+          for (size_t j = 0; j < num_nodes; ++j)
+            value += Anc[fi * num_nodes + j] * xc[j];
+          y_raw[MapNeighborDOF(ft, ft.adj_face_nodes[fi], g)] += value;
+        }
+      }
+
+      for (size_t i = 0; i < num_nodes; ++i)
+        y_raw[sdm_.MapDOFLocal(cell, i, uk_man_, 0, g)] += yc[i];
+    } // for g
+  }   // for cell
+
+  VecRestoreArrayRead(x_local, &x_raw);
+  VecRestoreArray(y_local, &y_raw);
+  VecGhostRestoreLocalForm(x_ghosted_, &x_local);
+  VecGhostRestoreLocalForm(y_ghosted_, &y_local);
+
+  // Contributions to the rows of other locations
+  VecGhostUpdateBegin(y_ghosted_, ADD_VALUES, SCATTER_REVERSE);
+  VecGhostUpdateEnd(y_ghosted_, ADD_VALUES, SCATTER_REVERSE);
+  VecCopy(y_ghosted_, y);
+}
+
+void
+DiffusionMIPSolver::CheckMatrixFreeOperator(Mat A_assembled)
+{
+  Vec x, y_assembled, y;
+  VecDuplicate(rhs_, &x);
+  VecDuplicate(rhs_, &y_assembled);
+  VecDuplicate(rhs_, &y);
+
+  PetscRandom random;
+  PetscRandomCreate(opensn::mpi_comm, &random);
+  PetscRandomSetSeed(random, 1234);
+  PetscRandomSeed(random);
+  VecSetRandom(x, random);
+  PetscRandomDestroy(&random);
+
+  MatMult(A_assembled, x, y_assembled);
+  MatMult(A_, x, y);
+
+  double norm_assembled, norm_diff;
+  VecNorm(y_assembled, NORM_2, &norm_assembled);
+  VecAXPY(y, -1.0, y_assembled);
+  VecNorm(y, NORM_2, &norm_diff);
+
+  const double relative_difference = norm_diff / norm_assembled;
+  log.Log() << text_name_ << ": Matrix-free operator relative difference " << relative_difference;
+  OpenSnLogicalErrorIf(relative_difference > 1.0e-10,
+                       text_name_ + ": The matrix-free operator does not match the assembled "
+                                    "operator.");
+
+  VecDestroy(&x);
+  VecDestroy(&y_assembled);
+  VecDestroy(&y);
+}
+
+void
+DiffusionMIPSolver::ApplyPreconditioner(Vec r, Vec z)
+{
+  const size_t num_groups = uk_man_.unknowns_.front().num_components_;
+
+  const double* r_raw;
+  double* z_raw;
+  double* b0_raw;
+  VecGetArrayRead(r, &r_raw);
+  VecGetArray(z, &z_raw);
+
+  // Jacobi part and restriction to the cell sums
+  VecGetArray(b0_, &b0_raw);
+  for (const auto& cell : grid_.local_cells)
+  {
+    const size_t num_nodes = sdm_.GetCellMapping(cell).NumNodes();
+    for (size_t g = 0; g < num_groups; ++g)
+    {
+      double sum = 0.0;
+      for (size_t i = 0; i < num_nodes; ++i)
+      {
+        const int64_t ir = sdm_.MapDOFLocal(cell, i, uk_man_, 0, g);
+        z_raw[ir] = r_raw[ir] / diagonal_[ir];
+        sum += r_raw[ir];
+      }
+      b0_raw[cell.local_id_ * num_groups + g] = sum;
+    }
+  }
+  VecRestoreArray(b0_, &b0_raw);
+
+  // Coarse correction, prolongated by injection
+  KSPSolve(ksp0_, b0_, x0_);
+
+  const double* x0_raw;
+  VecGetArrayRead(x0_, &x0_raw);
+  for (const auto& cell : grid_.local_cells)
+  {
+    const size_t num_nodes = sdm_.GetCellMapping(cell).NumNodes();
+    for (size_t g = 0; g < num_groups; ++g)
+    {
+      const double correction = x0_raw[cell.local_id_ * num_groups + g];
+      for (size_t i = 0; i < num_nodes; ++i)
+        z_raw[sdm_.MapDOFLocal(cell, i, uk_man_, 0, g)] += correction;
+    }
+  }
+  VecRestoreArrayRead(x0_, &x0_raw);
+
+  VecRestoreArrayRead(r, &r_raw);
+  VecRestoreArray(z, &z_raw);
+}
+
+void
+DiffusionMIPSolver::GetOperatorDiagonal(Vec d) const
+{
+  double* d_raw;
+  VecGetArray(d, &d_raw);
+  std::copy(diagonal_.begin(), diagonal_.end(), d_raw);
+  VecRestoreArray(d, &d_raw);
+}
+
+MemoryUsage
+DiffusionMIPSolver::ComputeMemoryUsage() const
+{
+  auto usage = DiffusionSolver::ComputeMemoryUsage();
+  if (not options.matrix_free)
+    return usage;
+
+  for (const auto& topology : face_topology_)
+  {
+    usage += GetMemoryUsage(topology);
+    for (const auto& ft : topology)
+    {
+      usage += GetMemoryUsage(ft.face_nodes);
+      usage += GetMemoryUsage(ft.adj_face_nodes);
+    }
+  }
+  usage += GetMemoryUsage(diagonal_);
+
+  for (const auto& x : {x_ghosted_, y_ghosted_, x0_, b0_})
+    if (x)
+    {
+      PetscInt num_local_entries;
+      VecGetLocalSize(x, &num_local_entries);
+      usage += {num_local_entries * sizeof(PetscScalar), 1};
+    }
+
+  if (A0_)
+  {
+    MatInfo info;
+    MatGetInfo(A0_, MAT_LOCAL, &info);
+    PetscInt num_local_rows, num_local_cols;
+    MatGetLocalSize(A0_, &num_local_rows, &num_local_cols);
+    const auto nnz = static_cast<size_t>(info.nz_allocated);
+    usage += {nnz * (sizeof(PetscScalar) + sizeof(PetscInt)) +
+                (num_local_rows + 1) * sizeof(PetscInt),
+              static_cast<size_t>(info.mallocs) + 1};
+  }
+  return usage;
+}
+
+void
+DiffusionMIPSolver::BuildSparsityPattern(std::vector<int64_t>& nodal_nnz_in_diag,
+                                         std::vector<int64_t>& nodal_nnz_off_diag) const
+{
+  const size_t num_groups = uk_man_.unknowns_.front().num_components_;
+
+  nodal_nnz_in_diag.assign(num_local_dofs_, 0);
+  nodal_nnz_off_diag.assign(num_local_dofs_, 0);
+
+  std::vector<int64_t> node_nnz_in;
+  std::vector<int64_t> node_nnz_off;
+  for (const auto& cell : grid_.local_cells)
+  {
+    const auto& cell_mapping = sdm_.GetCellMapping(cell);
+    const size_t num_nodes = cell_mapping.NumNodes();
+
+    // All nodes of the cell
+    node_nnz_in.assign(num_nodes, static_cast<int64_t>(num_nodes));
+    node_nnz_off.assign(num_nodes, 0);
+
+    // Nodes on a face couple to all nodes of the neighbor through the gradient terms of the
+    // neighbor, the other nodes only to the face nodes of the neighbor.
+    for (size_t f = 0; f < cell.faces_.size(); ++f)
+    {
+      const auto& face = cell.faces_[f];
+      if (not face.has_neighbor_)
+        continue;
+
+      const auto& adj_cell = grid_.cells[face.neighbor_id_];
+      const auto& adj_cell_mapping = sdm_.GetCellMapping(adj_cell);
+      const size_t acf = MeshContinuum::MapCellFace(cell, adj_cell, f);
+      const auto adj_num_nodes = static_cast<int64_t>(adj_cell_mapping.NumNodes());
+      const auto adj_num_face_nodes = static_cast<int64_t>(adj_cell_mapping.NumFaceNodes(acf));
+
+      auto& node_nnz = face.IsNeighborLocal(grid_) ? node_nnz_in : node_nnz_off;
+      std::vector<bool> on_face(num_nodes, false);
+      for (size_t fi = 0; fi < cell_mapping.NumFaceNodes(f); ++fi)
+        on_face[cell_mapping.MapFaceNode(f, fi)] = true;
+
+      for (size_t i = 0; i < num_nodes; ++i)
+        node_nnz[i] += on_face[i] ? adj_num_nodes : adj_num_face_nodes;
+    }
+
+    // Groups are decoupled, every group row has the pattern of its node
+    for (size_t i = 0; i < num_nodes; ++i)
+      for (size_t g = 0; g < num_groups; ++g)
+      {
+        const int64_t ir = sdm_.MapDOFLocal(cell, i, uk_man_, 0, g);
+        nodal_nnz_in_diag[ir] = node_nnz_in[i];
+        nodal_nnz_off_diag[ir] = node_nnz_off[i];
+      }
+  }
+}
+
 } // namespace lbs
 } // namespace opensn
@@ -28,10 +28,10 @@ public:
                      const UnknownManager& uk_man,
                      std::map<uint64_t, BoundaryCondition> bcs,
                      MatID2XSMap map_mat_id_2_xs,
-                     const std::vector<UnitCellMatrices>& unit_cell_matrices,
+                     const UnitCellMatricesList& unit_cell_matrices,
                      bool suppress_bcs,
                      bool verbose);
-  virtual ~DiffusionMIPSolver() = default;
+  ~DiffusionMIPSolver() override;
 
   void SetSourceFunction(std::shared_ptr<ScalarSpatialFunction> function);
 
@@ -87,9 +87,141 @@ public:
                       size_t ccfi,
                       double epsilon = 1.0e-12);
 
+  /**
+   * Computes y = A x with the matrix-free operator. Only available when the solver was initialized
+   * with options.matrix_free.
+   */
+  void ApplyOperator(Vec x, Vec y);
+
+  /**
+   * Applies the preconditioner of the matrix-free operator, z = P^{-1} r. The preconditioner is
+   * the additive two-level method P^{-1} = D^{-1} + R^T A_0^{-1} R, with D the diagonal of the
+   * operator, R the restriction of the nodal values to the cell sums and A_0 = R A R^T the
+   * Galerkin projection of the operator onto piecewise constants. A_0 has one row per cell and
+   * group and is solved with one BoomerAMG V-cycle.
+   */
+  void ApplyPreconditioner(Vec r, Vec z);
+
+  /**
+   * Compares the matrix-free operator with the assembled operator on a random vector and logs the
+   * relative difference of the products. Throws if they differ by more than roundoff. Only
+   * available when the solver was initialized with options.matrix_free.
+   */
+  void CheckMatrixFreeOperator(Mat A_assembled);
+
+  /**Copies the diagonal of the matrix-free operator to a vector.*/
+  void GetOperatorDiagonal(Vec d) const;
+
+  /**
+   * Adds the work vectors, the cached face connectivity and the coarse operator of the
+   * matrix-free operator to the memory of the system.
+   */
+  MemoryUsage ComputeMemoryUsage() const override;
+
+protected:
+  /**
+   * Computes the exact number of nonzeros of every local row from the face connectivity. A node
+   * couples to all nodes of its cell, to all nodes of the neighbors across the faces it lies on
+   * and to the face nodes of the neighbors across the other faces of its cell.
+   */
+  void BuildSparsityPattern(std::vector<int64_t>& nodal_nnz_in_diag,
+                            std::vector<int64_t>& nodal_nnz_off_diag) const override;
+
+  /**
+   * Creates the assembled matrix or, with options.matrix_free, a MatShell applying the operator
+   * cell by cell together with its coarse operator.
+   */
+  void CreateMatrix() override;
+
 private:
+  /**Group independent connectivity of a cell face.*/
+  struct FaceTopology
+  {
+    /// Cell nodes on the face
+    std::vector<int> face_nodes;
+    /// Neighbor cell of an interior face, nullptr on boundary faces
+    const Cell* adj_cell = nullptr;
+    /// Neighbor cell nodes coinciding with the face nodes
+    std::vector<int> adj_face_nodes;
+    /// Perpendicular lengths of the cell and the neighbor cell
+    double hm = 0.0;
+    double hp = 0.0;
+    /// Index of the first ghost entry of a non-local neighbor in the ghosted work vectors, -1 if
+    /// the neighbor is local. Only set for the matrix-free operator.
+    int64_t adj_ghost_base = -1;
+    /// Global coarse row of group 0 of the neighbor. Only set for the matrix-free operator.
+    int64_t adj_coarse_row = -1;
+  };
+
+  /**
+   * Group independent surface gradient blocks of a cell face. The blocks only have to be scaled by
+   * the diffusion coefficient of a group.
+   */
+  struct FaceGradients
+  {
+    /// -0.5 n . intS_shapeI_gradshapeJ[jm][i] of interior faces, indexed [i * num_face_nodes + fj]
+    std::vector<double> grad_in;
+    /// -0.5 n . intS_shapeI_gradshapeJ[im][j] of interior faces, indexed [fi * num_nodes + j]
+    std::vector<double> grad_out;
+    /// -n . (intS_shapeI_gradshapeJ[j][i] + intS_shapeI_gradshapeJ[i][j]) of boundary faces,
+    /// indexed [i * num_nodes + j]
+    std::vector<double> bndry_grad;
+  };
+
+  /**Dense blocks of the operator of one group of a cell.*/
+  struct CellBlocks
+  {
+    /// Cell rows and cell columns, indexed [i * num_nodes + j]
+    std::vector<double> Acc;
+    /// Per face, cell rows and neighbor face node columns, indexed [i * num_face_nodes + fj]
+    std::vector<std::vector<double>> Acn;
+    /// Per face, neighbor face node rows and cell columns, indexed [fi * num_nodes + j]
+    std::vector<std::vector<double>> Anc;
+    /// Boundary condition source of the cell rows
+    std::vector<double> b;
+  };
+
+  /**Computes the connectivity of all faces of a cell.*/
+  void ComputeFaceTopology(const Cell& cell, std::vector<FaceTopology>& topology);
+
+  /**Computes the surface gradient blocks of all faces of a cell.*/
+  void ComputeFaceGradients(const Cell& cell,
+                            const std::vector<FaceTopology>& topology,
+                            std::vector<FaceGradients>& gradients) const;
+
+  /**
+   * Computes the operator blocks and the boundary source of group g of a cell. The blocks of a
+   * face are the contributions of this cell only, the neighbor adds its own.
+   */
+  void ComputeCellBlocks(const Cell& cell,
+                         size_t g,
+                         const std::vector<FaceTopology>& topology,
+                         const std::vector<FaceGradients>& gradients,
+                         CellBlocks& blocks) const;
+
+  /**Returns the index of a node and group of a face neighbor in the ghosted work vectors.*/
+  int64_t MapNeighborDOF(const FaceTopology& face_topology, int node, size_t g) const;
+
+  /**Creates the MatShell, the ghosted work vectors and the coarse operator.*/
+  void InitializeMatrixFreeOperator();
+
   std::shared_ptr<ScalarSpatialFunction> source_function_;
   std::shared_ptr<ScalarSpatialFunction> ref_solution_function_;
+
+  /// Face connectivity of every local cell, kept for the matrix-free operator
+  std::vector<std::vector<FaceTopology>> face_topology_;
+  /// Ghosted work vectors of the matrix-free operator
+  Vec x_ghosted_ = nullptr;
+  Vec y_ghosted_ = nullptr;
+  /// Diagonal of the matrix-free operator, in the local DOF ordering
+  std::vector<double> diagonal_;
+  /// Coarse operator, one row per local cell and group, and its solver
+  Mat A0_ = nullptr;
+  KSP ksp0_ = nullptr;
+  Vec x0_ = nullptr;
+  Vec b0_ = nullptr;
+  /// Global index of the first coarse row of this location
+  int64_t coarse_row_offset_ = 0;
 };
 
 } // namespace lbs
@@ -3,55 +3,102 @@
 
 #include "modules/linear_boltzmann_solvers/lbs_solver/acceleration/acceleration.h"
 #include "framework/materials/multi_group_xs/multi_group_xs.h"
+#include "framework/mpi/mpi_utils.h"
 #include "framework/logging/log.h"
 #include "framework/runtime.h"
+#include <algorithm>
+#include <cmath>
+#include <functional>
 
 namespace opensn
 {
 namespace lbs
 {
 
-TwoGridCollapsedInfo
-MakeTwoGridCollapsedInfo(const MultiGroupXS& xs, EnergyCollapseScheme scheme)
+namespace
 {
-  const std::string fname = "lbs::acceleration::MakeTwoGridCollapsedInfo";
 
-  const size_t num_groups = xs.NumGroups();
-  const auto& sigma_t = xs.SigmaTotal();
-  const auto& diffusion_coeff = xs.DiffusionCoefficient();
+/**Packs the data the energy collapse depends on into a flat signature: the number of groups,
+ * the total cross sections, the diffusion coefficients and, for every group, the number of
+ * isotropic transfer entries followed by their (source group, value) pairs.*/
+std::vector<double>
+MakeCollapseSignature(const MultiGroupXS& xs)
+{
+  const std::string fname = "lbs::acceleration::MakeTwoGridCollapsedInfo";
 
-  // Make a Dense matrix from sparse transfer matrix
   if (xs.TransferMatrices().empty())
     throw std::logic_error(fname + ": list of scattering matrices empty.");
 
+  const size_t num_groups = xs.NumGroups();
+  const auto& sigma_t = xs.SigmaTotal();
+  const auto& diffusion_coeff = xs.DiffusionCoefficient();
   const auto& isotropic_transfer_matrix = xs.TransferMatrix(0);
 
-  MatDbl S(num_groups, std::vector<double>(num_groups, 0.0));
-  for (int g = 0; g < num_groups; g++)
-    for (const auto& [row_g, gprime, sigma] : isotropic_transfer_matrix.Row(g))
-      S[g][gprime] = sigma;
-
-  // Compiling the A and B matrices for different methods
-  MatDbl A(num_groups, std::vector<double>(num_groups, 0.0));
-  MatDbl B(num_groups, std::vector<double>(num_groups, 0.0));
-  for (int g = 0; g < num_groups; g++)
+  std::vector<double> signature;
+  signature.reserve(1 + 3 * num_groups);
+  signature.push_back(static_cast<double>(num_groups));
+  signature.insert(signature.end(), sigma_t.begin(), sigma_t.begin() + num_groups);
+  signature.insert(signature.end(), diffusion_coeff.begin(), diffusion_coeff.begin() + num_groups);
+  for (size_t g = 0; g < num_groups; ++g)
   {
-    if (scheme == EnergyCollapseScheme::JFULL)
+    const size_t count_position = signature.size();
+    signature.push_back(0.0);
+    for (const auto& [row_g, gprime, sigma] : isotropic_transfer_matrix.Row(g))
     {
-      A[g][g] = sigma_t[g] - S[g][g];
-      for (int gp = 0; gp < g; gp++)
-        B[g][gp] = S[g][gp];
-
-      for (int gp = g + 1; gp < num_groups; gp++)
-        B[g][gp] = S[g][gp];
+      signature.push_back(static_cast<double>(gprime));
+      signature.push_back(sigma);
+      signature[count_position] += 1.0;
     }
-    else if (scheme == EnergyCollapseScheme::JPARTIAL)
+  }
+
+  return signature;
+}
+
+uint64_t
+HashSignature(const std::vector<double>& signature)
+{
+  uint64_t seed = signature.size();
+  for (const double value : signature)
+    seed ^= std::hash<double>{}(value) + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2);
+  return seed;
+}
+
+/**Computes the two-grid information of a signature. For both schemes the matrix A is diagonal,
+ * so the iteration matrix inv(A) B is applied as a sparse product with B followed by a diagonal
+ * scaling, which makes the collapse linear in the number of transfer entries.*/
+TwoGridCollapsedInfo
+CollapseSignature(const std::vector<double>& signature, EnergyCollapseScheme scheme)
+{
+  const auto num_groups = static_cast<size_t>(signature[0]);
+  const double* sigma_t = &signature[1];
+  const double* diffusion_coeff = &signature[1 + num_groups];
+
+  // Unpack the transfer matrix rows into compressed row storage
+  std::vector<size_t> row_start(num_groups + 1, 0);
+  std::vector<size_t> cols;
+  std::vector<double> vals;
+  size_t pos = 1 + 2 * num_groups;
+  for (size_t g = 0; g < num_groups; ++g)
+  {
+    const auto num_entries = static_cast<size_t>(signature[pos++]);
+    for (size_t k = 0; k < num_entries; ++k, pos += 2)
     {
-      A[g][g] = sigma_t[g];
-      for (int gp = 0; gp < num_groups; gp++)
-        B[g][gp] = S[g][gp];
+      cols.push_back(static_cast<size_t>(signature[pos]));
+      vals.push_back(signature[pos + 1]);
     }
-  } // for g
+    row_start[g + 1] = cols.size();
+  }
+
+  // Diagonal of A. For the full Jacobi scheme the within-group scattering moves from B to A.
+  std::vector<double> A_diag(num_groups, 0.0);
+  for (size_t g = 0; g < num_groups; ++g)
+  {
+    A_diag[g] = sigma_t[g];
+    if (scheme == EnergyCollapseScheme::JFULL)
+      for (size_t k = row_start[g]; k < row_start[g + 1]; ++k)
+        if (cols[k] == g)
+          A_diag[g] -= vals[k];
+  }
 
   // Correction for zero xs groups
   // Some cross sections developed from monte-carlo
@@ -59,37 +106,75 @@ MakeTwoGridCollapsedInfo(const MultiGroupXS& xs, EnergyCollapseScheme scheme)
   // having zero cross sections. In that case
   // it will screw up the power iteration
   // initial guess of 1.0. Here we reset them
-  for (int g = 0; g < num_groups; g++)
+  for (size_t g = 0; g < num_groups; ++g)
     if (sigma_t[g] < 1.0e-16)
-      A[g][g] = 1.0;
+      A_diag[g] = 1.0;
 
-  MatDbl Ainv = Inverse(A);
-  MatDbl C = MatMul(Ainv, B);
-  std::vector<double> E(num_groups, 1.0);
+  /**Lambda applying inv(A) B.*/
+  auto ApplyIterationMatrix = [&](const std::vector<double>& x, std::vector<double>& y)
+  {
+    for (size_t g = 0; g < num_groups; ++g)
+    {
+      double value = 0.0;
+      for (size_t k = row_start[g]; k < row_start[g + 1]; ++k)
+        if (scheme != EnergyCollapseScheme::JFULL or cols[k] != g)
+          value += vals[k] * x[cols[k]];
+      y[g] = value / A_diag[g];
+    }
+  };
 
-  double collapsed_D = 0.0;
-  double collapsed_sig_a = 0.0;
-  std::vector<double> spectrum(num_groups, 1.0);
+  /**Lambda normalizing Ay into y and returning the Rayleigh quotient y.Ay.*/
+  auto Normalize = [num_groups](const std::vector<double>& Ay, std::vector<double>& y)
+  {
+    double lambda = 0.0;
+    double norm = 0.0;
+    for (size_t g = 0; g < num_groups; ++g)
+    {
+      lambda += y[g] * Ay[g];
+      norm += Ay[g] * Ay[g];
+    }
+    norm = std::sqrt(norm);
+    for (size_t g = 0; g < num_groups; ++g)
+      y[g] = Ay[g] / norm;
+    return lambda;
+  };
 
   // Perform power iteration
-  double rho = PowerIteration(C, E, 1000, 1.0e-12);
+  const int max_it = 1000;
+  const double tol = 1.0e-12;
+  std::vector<double> E(num_groups, 1.0);
+  std::vector<double> AE(num_groups, 0.0);
+
+  ApplyIterationMatrix(E, AE);
+  double rho = Normalize(AE, E);
+  for (int it = 0; it < max_it; ++it)
+  {
+    const double rho_old = std::fabs(rho);
+    ApplyIterationMatrix(E, AE);
+    rho = Normalize(AE, E);
+    if (std::fabs(std::fabs(rho) - rho_old) <= tol)
+      break;
+  }
 
-  // Compute two-grid diffusion quantities
+  // Compute two-grid diffusion quantities from the last iterate
   double sum = 0.0;
-  for (int g = 0; g < num_groups; g++)
-    sum += std::fabs(E[g]);
+  for (size_t g = 0; g < num_groups; ++g)
+    sum += std::fabs(AE[g] / rho);
 
-  for (int g = 0; g < num_groups; g++)
-    spectrum[g] = std::fabs(E[g]) / sum;
+  std::vector<double> spectrum(num_groups, 1.0);
+  for (size_t g = 0; g < num_groups; ++g)
+    spectrum[g] = std::fabs(AE[g] / rho) / sum;
 
-  for (int g = 0; g < num_groups; ++g)
+  double collapsed_D = 0.0;
+  double collapsed_sig_a = 0.0;
+  for (size_t g = 0; g < num_groups; ++g)
   {
     collapsed_D += diffusion_coeff[g] * spectrum[g];
 
     collapsed_sig_a += sigma_t[g] * spectrum[g];
 
-    for (int gp = 0; gp < num_groups; ++gp)
-      collapsed_sig_a -= S[g][gp] * spectrum[gp];
+    for (size_t k = row_start[g]; k < row_start[g + 1]; ++k)
+      collapsed_sig_a -= vals[k] * spectrum[cols[k]];
   }
 
   // Verbose output the spectrum
@@ -102,5 +187,130 @@ MakeTwoGridCollapsedInfo(const MultiGroupXS& xs, EnergyCollapseScheme scheme)
   return {collapsed_D, collapsed_sig_a, spectrum};
 }
 
+} // namespace
+
+TwoGridCollapsedInfo
+MakeTwoGridCollapsedInfo(const MultiGroupXS& xs, EnergyCollapseScheme scheme)
+{
+  return CollapseSignature(MakeCollapseSignature(xs), scheme);
+}
+
+std::map<int, TwoGridCollapsedInfo>
+MakeTwoGridCollapsedInfo(const std::map<int, std::shared_ptr<MultiGroupXS>>& matid_to_xs_map,
+                         EnergyCollapseScheme scheme)
+{
+  // Group the local materials with identical cross sections
+  struct LocalEntry
+  {
+    std::vector<double> signature;
+    uint64_t hash = 0;
+    std::vector<int> mat_ids;
+  };
+  std::vector<LocalEntry> entries;
+  {
+    std::map<uint64_t, std::vector<size_t>> hash_to_entries;
+    for (const auto& [mat_id, xs] : matid_to_xs_map)
+    {
+      auto signature = MakeCollapseSignature(*xs);
+      const uint64_t hash = HashSignature(signature);
+
+      auto& candidates = hash_to_entries[hash];
+      auto match = std::find_if(candidates.begin(),
+                                candidates.end(),
+                                [&](size_t k) { return entries[k].signature == signature; });
+      if (match != candidates.end())
+        entries[*match].mat_ids.push_back(mat_id);
+      else
+      {
+        candidates.push_back(entries.size());
+        entries.push_back({std::move(signature), hash, {mat_id}});
+      }
+    }
+  }
+
+  // Every distinct material is collapsed by the rank its hash maps to. Requests hold the local
+  // entry index, the signature size and the signature.
+  const auto num_ranks = static_cast<uint64_t>(mpi_comm.size());
+  std::map<int, std::vector<double>> requests;
+  for (size_t k = 0; k < entries.size(); ++k)
+  {
+    const auto& signature = entries[k].signature;
+    auto& request = requests[static_cast<int>(entries[k].hash % num_ranks)];
+    request.push_back(static_cast<double>(k));
+    request.push_back(static_cast<double>(signature.size()));
+    request.insert(request.end(), signature.begin(), signature.end());
+  }
+  const auto received_requests = MapAllToAll(requests);
+
+  // Collapse each distinct signature once. Replies hold the entry index of the requester, the
+  // collapsed diffusion coefficient and absorption cross section, and the spectrum.
+  struct CollapsedEntry
+  {
+    std::vector<double> signature;
+    TwoGridCollapsedInfo info;
+  };
+  std::map<uint64_t, std::vector<CollapsedEntry>> collapsed;
+  std::map<int, std::vector<double>> replies;
+  size_t num_collapsed = 0;
+  for (const auto& [pid, request] : received_requests)
+  {
+    auto& reply = replies[pid];
+    for (size_t pos = 0; pos < request.size();)
+    {
+      const double k = request[pos];
+      const auto size = static_cast<size_t>(request[pos + 1]);
+      std::vector<double> signature(request.begin() + pos + 2, request.begin() + pos + 2 + size);
+      pos += 2 + size;
+
+      auto& candidates = collapsed[HashSignature(signature)];
+      auto match = std::find_if(candidates.begin(),
+                                candidates.end(),
+                                [&](const CollapsedEntry& entry)
+                                { return entry.signature == signature; });
+      if (match == candidates.end())
+      {
+        auto info = CollapseSignature(signature, scheme);
+        candidates.push_back({std::move(signature), std::move(info)});
+        match = std::prev(candidates.end());
+        ++num_collapsed;
+      }
+
+      const auto& info = match->info;
+      reply.push_back(k);
+      reply.push_back(info.collapsed_D);
+      reply.push_back(info.collapsed_sig_a);
+      reply.insert(reply.end(), info.spectrum.begin(), info.spectrum.end());
+    }
+  }
+  const auto received_replies = MapAllToAll(replies);
+
+  // Unpack the replies for all materials of each entry
+  std::map<int, TwoGridCollapsedInfo> matid_to_tginfo;
+  for (const auto& [pid, reply] : received_replies)
+  {
+    for (size_t pos = 0; pos < reply.size();)
+    {
+      const auto& entry = entries[static_cast<size_t>(reply[pos])];
+      const auto num_groups = static_cast<size_t>(entry.signature[0]);
+
+      TwoGridCollapsedInfo info;
+      info.collapsed_D = reply[pos + 1];
+      info.collapsed_sig_a = reply[pos + 2];
+      info.spectrum.assign(reply.begin() + pos + 3, reply.begin() + pos + 3 + num_groups);
+      pos += 3 + num_groups;
+
+      for (const int mat_id : entry.mat_ids)
+        matid_to_tginfo[mat_id] = info;
+    }
+  }
+
+  size_t num_globally_collapsed = 0;
+  mpi_comm.all_reduce(num_collapsed, num_globally_collapsed, mpi::op::sum<size_t>());
+  log.Log0Verbose1() << "Two-grid energy collapse: " << num_globally_collapsed
+                     << " distinct material(s) collapsed.";
+
+  return matid_to_tginfo;
+}
+
 } // namespace lbs
 } // namespace opensn
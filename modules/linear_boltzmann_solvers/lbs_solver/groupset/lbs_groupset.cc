@@ -52,8 +52,17 @@ LBSGroupset::GetInputParameters()
   params.AddOptionalParameter("l_max_its", 200, "Inner linear solver maximum iterations");
   params.AddOptionalParameter("gmres_restart_interval",
                               30,
-                              "If this inner linear solver is gmres, sets the number of "
-                              "iterations before a restart occurs.");
+                              "If this inner linear solver is gmres or pipelined_gmres, sets the "
+                              "number of iterations before a restart occurs.");
+  params.AddOptionalParameter("classic_richardson_acceleration",
+                              "none",
+                              "If this inner linear solver is classic_richardson, the acceleration "
+                              "of the iteration: none, aitken (Aitken extrapolation with the "
+                              "estimated spectral radius) or anderson (Anderson mixing).");
+  params.AddOptionalParameter("anderson_depth",
+                              5,
+                              "If the classic_richardson acceleration is anderson, the number of "
+                              "previous iterates that are mixed.");
   params.AddOptionalParameter(
     "allow_cycles", true, "Flag indicating whether cycles are to be allowed or not");
 
@@ -68,6 +77,17 @@ LBSGroupset::GetInputParameters()
   params.AddOptionalParameter(
     "wgdsa_verbose", false, "If true, WGDSA routines will print verbosely");
   params.AddOptionalParameter("wgdsa_petsc_options", "", "PETSc options to pass to WGDSA solver");
+  params.AddOptionalParameter("wgdsa_matrix_free",
+                              false,
+                              "If true, the WGDSA operator is applied cell by cell instead of "
+                              "being assembled, and is preconditioned by Jacobi plus a "
+                              "cell-wise constant coarse operator. This trades memory for time "
+                              "on problems with many groups.");
+  params.AddOptionalParameter("wgdsa_matrix_free_check",
+                              false,
+                              "If true, the matrix-free WGDSA operator is compared with the "
+                              "assembled operator on a random vector when it is set up. For "
+                              "debugging only, the operator is assembled for the comparison.");
 
   // TG DSA options
   params.AddOptionalParameter(
@@ -84,7 +104,16 @@ LBSGroupset::GetInputParameters()
   params.ConstrainParameterRange("angle_aggregation_num_subsets", AllowableRangeLowLimit::New(1));
   params.ConstrainParameterRange("groupset_num_subsets", AllowableRangeLowLimit::New(1));
   params.ConstrainParameterRange(
-    "inner_linear_method", AllowableRangeList::New({"krylov_richardson", "gmres", "bicgstab"}));
+    "inner_linear_method",
+    AllowableRangeList::New({"classic_richardson",
+                             "krylov_richardson",
+                             "gmres",
+                             "bicgstab",
+                             "pipelined_gmres",
+                             "pipelined_bicgstab"}));
+  params.ConstrainParameterRange("classic_richardson_acceleration",
+                                 AllowableRangeList::New({"none", "aitken", "anderson"}));
+  params.ConstrainParameterRange("anderson_depth", AllowableRangeLowLimit::New(1));
   params.ConstrainParameterRange("l_abs_tol", AllowableRangeLowLimit::New(1.0e-18));
   params.ConstrainParameterRange("l_max_its", AllowableRangeLowLimit::New(0));
   params.ConstrainParameterRange("gmres_restart_interval", AllowableRangeLowLimit::New(1));
@@ -108,6 +137,8 @@ LBSGroupset::Init(int id)
   residual_tolerance_ = 1.0e-6;
   max_iterations_ = 200;
   gmres_restart_intvl_ = 30;
+  cr_acceleration_ = ClassicRichardsonAcceleration::NONE;
+  anderson_depth_ = 5;
   allow_cycles_ = false;
   apply_wgdsa_ = false;
   apply_tgdsa_ = false;
@@ -117,6 +148,8 @@ LBSGroupset::Init(int id)
   tgdsa_tol_ = 1.0e-4;
   wgdsa_verbose_ = false;
   tgdsa_verbose_ = false;
+  wgdsa_matrix_free_ = false;
+  wgdsa_matrix_free_check_ = false;
   wgdsa_solver_ = nullptr;
   tgdsa_solver_ = nullptr;
 }
@@ -182,14 +215,28 @@ LBSGroupset::LBSGroupset(const InputParameters& params, const int id, const LBSS
 
   // Inner solver
   const auto inner_linear_method = params.GetParamValue<std::string>("inner_linear_method");
-  if (inner_linear_method == "krylov_richardson")
+  if (inner_linear_method == "classic_richardson")
+    iterative_method_ = IterativeMethod::CLASSICRICHARDSON;
+  else if (inner_linear_method == "krylov_richardson")
     iterative_method_ = IterativeMethod::KRYLOV_RICHARDSON;
   else if (inner_linear_method == "gmres")
     iterative_method_ = IterativeMethod::KRYLOV_GMRES;
   else if (inner_linear_method == "bicgstab")
     iterative_method_ = IterativeMethod::KRYLOV_BICGSTAB;
+  else if (inner_linear_method == "pipelined_gmres")
+    iterative_method_ = IterativeMethod::KRYLOV_PGMRES;
+  else if (inner_linear_method == "pipelined_bicgstab")
+    iterative_method_ = IterativeMethod::KRYLOV_PIPEBICGSTAB;
 
   gmres_restart_intvl_ = params.GetParamValue<int>("gmres_restart_interval");
+
+  const auto cr_acceleration = params.GetParamValue<std::string>("classic_richardson_acceleration");
+  if (cr_acceleration == "aitken")
+    cr_acceleration_ = ClassicRichardsonAcceleration::AITKEN;
+  else if (cr_acceleration == "anderson")
+    cr_acceleration_ = ClassicRichardsonAcceleration::ANDERSON;
+  anderson_depth_ = params.GetParamValue<int>("anderson_depth");
+
   allow_cycles_ = params.GetParamValue<bool>("allow_cycles");
   residual_tolerance_ = params.GetParamValue<double>("l_abs_tol");
   max_iterations_ = params.GetParamValue<int>("l_max_its");
@@ -209,6 +256,9 @@ LBSGroupset::LBSGroupset(const InputParameters& params, const int id, const LBSS
 
   wgdsa_string_ = params.GetParamValue<std::string>("wgdsa_petsc_options");
   tgdsa_string_ = params.GetParamValue<std::string>("tgdsa_petsc_options");
+
+  wgdsa_matrix_free_ = params.GetParamValue<bool>("wgdsa_matrix_free");
+  wgdsa_matrix_free_check_ = params.GetParamValue<bool>("wgdsa_matrix_free_check");
 }
 
 void
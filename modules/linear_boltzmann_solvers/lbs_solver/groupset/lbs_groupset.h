@@ -43,6 +43,8 @@ public:
   double residual_tolerance_;
   int max_iterations_;
   int gmres_restart_intvl_;
+  ClassicRichardsonAcceleration cr_acceleration_;
+  int anderson_depth_;
 
   bool allow_cycles_;
 
@@ -56,6 +58,8 @@ public:
   bool tgdsa_verbose_;
   std::string wgdsa_string_;
   std::string tgdsa_string_;
+  bool wgdsa_matrix_free_;
+  bool wgdsa_matrix_free_check_;
 
   std::shared_ptr<DiffusionMIPSolver> wgdsa_solver_ = nullptr;
   std::shared_ptr<DiffusionMIPSolver> tgdsa_solver_ = nullptr;
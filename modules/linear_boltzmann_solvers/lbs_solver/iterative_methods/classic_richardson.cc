@@ -0,0 +1,371 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#include "modules/linear_boltzmann_solvers/lbs_solver/iterative_methods/classic_richardson.h"
+#include "modules/linear_boltzmann_solvers/lbs_solver/acceleration/diffusion_mip_solver.h"
+#include "modules/linear_boltzmann_solvers/lbs_solver/lbs_solver.h"
+#include "framework/mesh/mesh_continuum/mesh_continuum.h"
+#include "framework/math/math.h"
+#include "framework/logging/log.h"
+#include "framework/utils/timer.h"
+#include "framework/runtime.h"
+#include "caliper/cali.h"
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+
+namespace opensn
+{
+namespace lbs
+{
+
+ClassicRichardson::ClassicRichardson(std::shared_ptr<WGSContext> gs_context_ptr)
+  : LinearSolver("classic_richardson", gs_context_ptr), gs_context_ptr_(gs_context_ptr)
+{
+  auto& groupset = gs_context_ptr->groupset_;
+  auto& solver_tol_options = this->ToleranceOptions();
+  solver_tol_options.residual_absolute = groupset.residual_tolerance_;
+  solver_tol_options.maximum_iterations = groupset.max_iterations_;
+}
+
+void
+ClassicRichardson::Setup()
+{
+  CALI_CXX_MARK_SCOPE("ClassicRichardson::Setup");
+
+  if (is_setup_)
+    return;
+
+  auto& ctx = *gs_context_ptr_;
+  const auto& groupset = ctx.groupset_;
+  const auto& lbs_solver = ctx.lbs_solver_;
+
+  ctx.PreSetupCallback();
+
+  // The groups of a groupset are contiguous for every node and moment
+  const int gsi = groupset.groups_.front().id_;
+  const auto num_moments = static_cast<int>(lbs_solver.NumMoments());
+  const auto& cell_transport_views = lbs_solver.GetCellTransportViews();
+
+  block_size_ = groupset.groups_.size();
+  block_offsets_.clear();
+  for (const auto& cell : lbs_solver.Grid().local_cells)
+  {
+    const auto& transport_view = cell_transport_views[cell.local_id_];
+    for (int i = 0; i < transport_view.NumNodes(); ++i)
+      for (int m = 0; m < num_moments; ++m)
+        block_offsets_.push_back(transport_view.MapDOF(i, m, gsi));
+  }
+
+  const size_t n = block_offsets_.size() * block_size_;
+  q_saved_.resize(n);
+  q_fixed_.resize(n);
+  x_.resize(n);
+  f_.resize(n);
+  x_next_.resize(n);
+
+  if (groupset.apply_wgdsa_ or groupset.apply_tgdsa_)
+    dsa_work_.assign(lbs_solver.PhiOldLocal().size(), 0.0);
+
+  if (groupset.cr_acceleration_ == ClassicRichardsonAcceleration::ANDERSON)
+  {
+    anderson_depth_ = static_cast<size_t>(groupset.anderson_depth_);
+    f_prev_.resize(n);
+    g_prev_.resize(n);
+    delta_f_.assign(anderson_depth_, std::vector<double>(n));
+    delta_g_.assign(anderson_depth_, std::vector<double>(n));
+    gram_.assign(anderson_depth_ * anderson_depth_, 0.0);
+  }
+
+  ctx.PostSetupCallback();
+  is_setup_ = true;
+}
+
+void
+ClassicRichardson::Solve()
+{
+  CALI_CXX_MARK_SCOPE("ClassicRichardson::Solve");
+
+  auto& ctx = *gs_context_ptr_;
+  auto& groupset = ctx.groupset_;
+  auto& lbs_solver = ctx.lbs_solver_;
+
+  auto& q_moments_local = lbs_solver.QMomentsLocal();
+  auto& phi_old_local = lbs_solver.PhiOldLocal();
+  auto& phi_new_local = lbs_solver.PhiNewLocal();
+  const auto& densities_local = lbs_solver.DensitiesLocal();
+
+  const auto acceleration = groupset.cr_acceleration_;
+  const bool apply_dsa = groupset.apply_wgdsa_ or groupset.apply_tgdsa_;
+  const size_t n = x_.size();
+
+  ctx.PreSolveCallback();
+
+  // The sources of the rhs scope do not depend on the flux moments of the groupset, so they are
+  // evaluated once and added to the caller's source moments
+  Gather(q_moments_local, q_saved_);
+  ctx.set_source_function_(
+    groupset, q_moments_local, phi_old_local, densities_local, ctx.rhs_src_scope_);
+  Gather(q_moments_local, q_fixed_);
+
+  const auto scope = ctx.lhs_src_scope_ | ctx.rhs_src_scope_;
+  const std::string offset = apply_dsa ? std::string("    ") : std::string();
+
+  anderson_num_cols_ = 0;
+  anderson_next_col_ = 0;
+  std::vector<double> local_sums(2 + 2 * anderson_depth_, 0.0);
+  std::vector<double> global_sums(local_sums.size(), 0.0);
+
+  double f_norm_prev = 0.0;
+  double rho = 0.0;
+  double rho_prev = 0.0;
+  for (int k = 0; k < tolerance_options_.maximum_iterations; ++k)
+  {
+    // Sweep with the sources of the current iterate
+    Scatter(q_fixed_, q_moments_local);
+    ctx.set_source_function_(
+      groupset, q_moments_local, phi_old_local, densities_local, ctx.lhs_src_scope_);
+    ctx.ApplyInverseTransportOperator(scope);
+
+    // Delayed angular fluxes are lagged by one iteration
+    if (groupset.angle_agg_)
+      groupset.angle_agg_->SetDelayedPsiNew2Old();
+
+    // Change of the iterate, f = phi_new - phi_old, corrected by DSA
+    Gather(phi_old_local, x_);
+    Gather(phi_new_local, f_);
+
+    std::fill(local_sums.begin(), local_sums.end(), 0.0);
+    for (size_t j = 0; j < n; ++j)
+    {
+      local_sums[1] += f_[j] * f_[j];
+      f_[j] -= x_[j];
+    }
+    if (apply_dsa)
+      ApplyDSA(f_);
+    for (size_t j = 0; j < n; ++j)
+      local_sums[0] += f_[j] * f_[j];
+
+    // Extend the Anderson history with the differences to the previous change and image
+    if (acceleration == ClassicRichardsonAcceleration::ANDERSON)
+    {
+      if (k > 0)
+      {
+        const size_t c = anderson_next_col_;
+        auto& df = delta_f_[c];
+        auto& dg = delta_g_[c];
+        for (size_t j = 0; j < n; ++j)
+        {
+          df[j] = f_[j] - f_prev_[j];
+          dg[j] = x_[j] + f_[j] - g_prev_[j];
+        }
+        anderson_next_col_ = (c + 1) % anderson_depth_;
+        anderson_num_cols_ = std::min(anderson_num_cols_ + 1, anderson_depth_);
+
+        for (size_t col = 0; col < anderson_num_cols_; ++col)
+        {
+          const auto& df_col = delta_f_[col];
+          double gram_value = 0.0;
+          double rhs_value = 0.0;
+          for (size_t j = 0; j < n; ++j)
+          {
+            gram_value += df[j] * df_col[j];
+            rhs_value += df_col[j] * f_[j];
+          }
+          local_sums[2 + col] = gram_value;
+          local_sums[2 + anderson_depth_ + col] = rhs_value;
+        }
+      }
+      for (size_t j = 0; j < n; ++j)
+      {
+        f_prev_[j] = f_[j];
+        g_prev_[j] = x_[j] + f_[j];
+      }
+    }
+
+    // Single reduction of all the dot products of the iteration
+    mpi_comm.all_reduce(local_sums.data(),
+                        static_cast<int>(local_sums.size()),
+                        global_sums.data(),
+                        mpi::op::sum<double>());
+
+    // Convergence test. The relative change is divided by one minus the estimated spectral
+    // radius, which bounds the remaining error when the iteration converges linearly.
+    const double f_norm = std::sqrt(global_sums[0]);
+    const double phi_norm = std::sqrt(global_sums[1]);
+    if (k > 0 and f_norm_prev > 0.0)
+    {
+      rho_prev = rho;
+      rho = f_norm / f_norm_prev;
+    }
+    f_norm_prev = f_norm;
+
+    const double relative_change = phi_norm > 1.0e-25 ? f_norm / phi_norm : f_norm;
+    const double residual =
+      (rho > 0.0 and rho < 1.0) ? relative_change / (1.0 - rho) : relative_change;
+    const bool converged = residual < tolerance_options_.residual_absolute;
+
+    if (ctx.log_info_)
+    {
+      auto iter_info = log.Log();
+      iter_info << program_timer.GetTimeString() << " " << offset << "WGS groups ["
+                << groupset.groups_.front().id_ << "-" << groupset.groups_.back().id_ << "]"
+                << " Iteration " << std::setw(5) << k << " Residual " << std::setw(9)
+                << residual;
+      if (converged)
+        iter_info << " CONVERGED\n";
+      iter_info << std::endl;
+    }
+
+    if (converged)
+      break;
+
+    // Next iterate
+    if (acceleration == ClassicRichardsonAcceleration::ANDERSON and anderson_num_cols_ > 0)
+    {
+      std::vector<double> gram_row(global_sums.begin() + 2,
+                                   global_sums.begin() + 2 + static_cast<long>(anderson_depth_));
+      std::vector<double> rhs(global_sums.begin() + 2 + static_cast<long>(anderson_depth_),
+                              global_sums.end());
+      AndersonMix(gram_row, rhs);
+    }
+    else
+    {
+      // Aitken extrapolation every third iteration, once the two spectral radius estimates of the
+      // unextrapolated iterations before agree
+      double factor = 1.0;
+      if (acceleration == ClassicRichardsonAcceleration::AITKEN and k % 3 == 2 and rho > 0.0 and
+          rho < 1.0 and std::fabs(rho - rho_prev) < 0.1 * rho)
+        factor = 1.0 / (1.0 - rho);
+
+      for (size_t j = 0; j < n; ++j)
+        x_next_[j] = x_[j] + factor * f_[j];
+    }
+    Scatter(x_next_, phi_old_local);
+  }
+
+  if (ctx.log_info_)
+    log.Log() << "        Estimated spectral radius " << rho;
+
+  // The last sweep is consistent with the angular fluxes, outflows and delayed fluxes of the
+  // groupset, so it is kept as the solution. Without iterations there is no sweep to keep.
+  if (tolerance_options_.maximum_iterations > 0)
+  {
+    Gather(phi_new_local, x_);
+    Scatter(x_, phi_old_local);
+  }
+
+  // Restore the caller's source moments
+  Scatter(q_saved_, q_moments_local);
+
+  ctx.PostSolveCallback();
+}
+
+void
+ClassicRichardson::Gather(const std::vector<double>& src, std::vector<double>& dest) const
+{
+  double* out = dest.data();
+  for (const auto block_offset : block_offsets_)
+  {
+    std::copy_n(&src[block_offset], block_size_, out);
+    out += block_size_;
+  }
+}
+
+void
+ClassicRichardson::Scatter(const std::vector<double>& src, std::vector<double>& dest) const
+{
+  const double* in = src.data();
+  for (const auto block_offset : block_offsets_)
+  {
+    std::copy_n(in, block_size_, &dest[block_offset]);
+    in += block_size_;
+  }
+}
+
+void
+ClassicRichardson::ApplyDSA(std::vector<double>& f)
+{
+  CALI_CXX_MARK_SCOPE("ClassicRichardson::ApplyDSA");
+
+  auto& groupset = gs_context_ptr_->groupset_;
+  auto& lbs_solver = gs_context_ptr_->lbs_solver_;
+
+  Scatter(f, dsa_work_);
+
+  if (groupset.apply_wgdsa_)
+  {
+    std::vector<double> delta_phi_local;
+    lbs_solver.AssembleWGDSADeltaPhiVector(groupset, dsa_work_, delta_phi_local);
+
+    groupset.wgdsa_solver_->Assemble_b(delta_phi_local);
+    groupset.wgdsa_solver_->Solve(delta_phi_local);
+
+    lbs_solver.DisAssembleWGDSADeltaPhiVector(groupset, delta_phi_local, dsa_work_);
+  }
+  if (groupset.apply_tgdsa_)
+  {
+    std::vector<double> delta_phi_local;
+    lbs_solver.AssembleTGDSADeltaPhiVector(groupset, dsa_work_, delta_phi_local);
+
+    groupset.tgdsa_solver_->Assemble_b(delta_phi_local);
+    groupset.tgdsa_solver_->Solve(delta_phi_local);
+
+    lbs_solver.DisAssembleTGDSADeltaPhiVector(groupset, delta_phi_local, dsa_work_);
+  }
+
+  Gather(dsa_work_, f);
+}
+
+void
+ClassicRichardson::AndersonMix(const std::vector<double>& gram_row, const std::vector<double>& rhs)
+{
+  const size_t m = anderson_num_cols_;
+  const size_t depth = anderson_depth_;
+  const size_t newest = (anderson_next_col_ + depth - 1) % depth;
+
+  // Update the Gram matrix with the row of the newest column
+  for (size_t col = 0; col < m; ++col)
+  {
+    gram_[newest * depth + col] = gram_row[col];
+    gram_[col * depth + newest] = gram_row[col];
+  }
+
+  // Least-squares coefficients from the regularized normal equations
+  double max_diag = 0.0;
+  for (size_t col = 0; col < m; ++col)
+    max_diag = std::max(max_diag, gram_[col * depth + col]);
+
+  const size_t n = x_.size();
+  if (max_diag <= 0.0)
+  {
+    for (size_t j = 0; j < n; ++j)
+      x_next_[j] = x_[j] + f_[j];
+    return;
+  }
+
+  MatDbl A(m, std::vector<double>(m, 0.0));
+  std::vector<double> gamma(rhs.begin(), rhs.begin() + static_cast<long>(m));
+  for (size_t i = 0; i < m; ++i)
+  {
+    for (size_t j = 0; j < m; ++j)
+      A[i][j] = gram_[i * depth + j];
+    A[i][i] += 1.0e-12 * max_diag;
+  }
+  GaussElimination(A, gamma, static_cast<int>(m));
+
+  // x_next = g - dG gamma, with g = x + f
+  for (size_t j = 0; j < n; ++j)
+    x_next_[j] = x_[j] + f_[j];
+  for (size_t col = 0; col < m; ++col)
+  {
+    const auto& dg_col = delta_g_[col];
+    const double gamma_col = gamma[col];
+    for (size_t j = 0; j < n; ++j)
+      x_next_[j] -= gamma_col * dg_col[j];
+  }
+}
+
+} // namespace lbs
+} // namespace opensn
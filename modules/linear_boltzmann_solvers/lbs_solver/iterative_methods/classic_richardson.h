@@ -0,0 +1,93 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "framework/math/linear_solver/linear_solver.h"
+#include "modules/linear_boltzmann_solvers/lbs_solver/iterative_methods/wgs_context.h"
+#include <memory>
+#include <vector>
+
+namespace opensn
+{
+namespace lbs
+{
+
+/**
+ * Native source iteration (classic Richardson) for Within GroupSet (WGS) solves.
+ *
+ * Every iteration evaluates the within-groupset sources from phi_old, applies the inverse
+ * transport operator and takes the result, optionally corrected by WGDSA/TGDSA, as the next
+ * iterate. The iteration works directly on the primary STL flux vectors, so no PETSc vectors,
+ * shell matrices or extra sweeps are involved. The last sweep of a converged solve already
+ * produces a consistent angular flux, so no final sweep is needed either.
+ *
+ * Optionally the iteration is accelerated with Aitken extrapolation, using the spectral radius
+ * estimated from the ratio of successive changes, or with Anderson mixing of the last few
+ * iterates. The convergence test divides the relative change of an iteration by one minus the
+ * estimated spectral radius, so slowly converging problems are not declared converged early.
+ * All the global reductions of an iteration are fused into a single one.
+ */
+class ClassicRichardson : public LinearSolver
+{
+public:
+  /**
+   * Constructor.
+   * \param gs_context_ptr Context Pointer to abstract context.
+   */
+  explicit ClassicRichardson(std::shared_ptr<WGSContext> gs_context_ptr);
+
+  void Setup() override;
+  void Solve() override;
+
+protected:
+  void SetSystemSize() override {}
+  void SetSystem() override {}
+  void SetInitialGuess() override {}
+  void SetRHS() override {}
+
+private:
+  /**Copies the groupset blocks of a primary STL vector into a compact vector.*/
+  void Gather(const std::vector<double>& src, std::vector<double>& dest) const;
+  /**Copies a compact vector into the groupset blocks of a primary STL vector.*/
+  void Scatter(const std::vector<double>& src, std::vector<double>& dest) const;
+
+  /**Applies WGDSA and/or TGDSA to the compact change `f` in place.*/
+  void ApplyDSA(std::vector<double>& f);
+
+  /**Computes the Anderson mixed iterate from the history and the dot products of the current
+   * change with the history columns.*/
+  void AndersonMix(const std::vector<double>& gram_row, const std::vector<double>& rhs);
+
+  std::shared_ptr<WGSContext> gs_context_ptr_;
+  bool is_setup_ = false;
+
+  /// Offsets of the contiguous groupset blocks of the flux moment vectors
+  std::vector<size_t> block_offsets_;
+  size_t block_size_ = 0;
+
+  /// Caller's source moments and the fixed part of the source, compact
+  std::vector<double> q_saved_;
+  std::vector<double> q_fixed_;
+
+  /// Current iterate, its change and the accelerated next iterate, compact
+  std::vector<double> x_;
+  std::vector<double> f_;
+  std::vector<double> x_next_;
+  /// Full size scratch for the DSA solves
+  std::vector<double> dsa_work_;
+
+  /// Anderson history: the previous change and image, and the ring buffers of their differences
+  size_t anderson_depth_ = 0;
+  size_t anderson_num_cols_ = 0;
+  size_t anderson_next_col_ = 0;
+  std::vector<double> f_prev_;
+  std::vector<double> g_prev_;
+  std::vector<std::vector<double>> delta_f_;
+  std::vector<std::vector<double>> delta_g_;
+  /// Gram matrix of the change differences, indexed [i * anderson_depth + j]
+  std::vector<double> gram_;
+};
+
+} // namespace lbs
+} // namespace opensn
@@ -12,7 +12,7 @@ namespace lbs
 enum class IterativeMethod : int
 {
   NONE = 0,
-  // CLASSICRICHARDSON = 1,        ///< Otherwise known as Source Iteration
+  CLASSICRICHARDSON = 1,        ///< Otherwise known as Source Iteration
   // CLASSICRICHARDSON_CYCLES = 2, ///< Source Iteration with Cycles support
   GMRES = 3,                    ///< GMRES iterative algorithm
   GMRES_CYCLES = 4,             ///< GMRES with Cycles support
@@ -22,6 +22,16 @@ enum class IterativeMethod : int
   KRYLOV_GMRES_CYCLES = 8,      ///< GMRES with Cycles support
   KRYLOV_BICGSTAB = 9,          ///< BiCGStab iterative algorithm
   KRYLOV_BICGSTAB_CYCLES = 10,  ///< BiCGStab with Cycles support
+  KRYLOV_PGMRES = 11,           ///< Pipelined GMRES, overlaps its reductions with the sweep
+  KRYLOV_PIPEBICGSTAB = 12,     ///< Pipelined BiCGStab, overlaps its reductions with the sweep
+};
+
+/**Acceleration of classic Richardson iteration.*/
+enum class ClassicRichardsonAcceleration : int
+{
+  NONE = 0,     ///< Plain source iteration
+  AITKEN = 1,   ///< Aitken extrapolation with the estimated spectral radius
+  ANDERSON = 2, ///< Anderson mixing of the last iterates
 };
 
 inline std::string
@@ -31,6 +41,9 @@ IterativeMethodPETScName(IterativeMethod it_method)
   {
     case IterativeMethod::NONE:
       return "preonly";
+    case IterativeMethod::CLASSICRICHARDSON:
+      // Not a PETSc method, classic Richardson is solved natively
+      return "classic_richardson";
     case IterativeMethod::KRYLOV_RICHARDSON:
     case IterativeMethod::KRYLOV_RICHARDSON_CYCLES:
       return "richardson";
@@ -42,6 +55,10 @@ IterativeMethodPETScName(IterativeMethod it_method)
     case IterativeMethod::KRYLOV_BICGSTAB:
     case IterativeMethod::KRYLOV_BICGSTAB_CYCLES:
       return "bcgs";
+    case IterativeMethod::KRYLOV_PGMRES:
+      return "pgmres";
+    case IterativeMethod::KRYLOV_PIPEBICGSTAB:
+      return "pipebcgs";
   }
   return "";
 }
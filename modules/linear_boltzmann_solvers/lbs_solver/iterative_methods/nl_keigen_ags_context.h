@@ -24,6 +24,21 @@ struct NLKEigenAGSContext : public NonLinearSolverContext
 
   std::vector<int> groupset_ids;
 
+  /// When true the residual is not accelerated and a shell preconditioner is used instead
+  bool use_shell_pc = false;
+  /// Number of transport sweeps applied by the shell preconditioner
+  int pc_num_sweeps = 0;
+  /// Applies the diffusion approximation of the fission operator in the shell preconditioner
+  bool pc_eigen_correction = false;
+  /// Number of Newton steps between preconditioner rebuilds
+  int pc_lag = 2;
+  /// k-eigenvalue used by the preconditioner, updated when the preconditioner is rebuilt
+  double pc_k_eff = 1.0;
+  /// Number of sweeps performed by the preconditioner
+  int num_pc_sweeps = 0;
+  /// Total number of sweeps of the last solve, including the preconditioner sweeps
+  int num_sweeps = 0;
+
   explicit NLKEigenAGSContext(LBSSolver& lbs_solver)
     : lbs_solver_(lbs_solver), kresid_func_context_({lbs_solver.TextName(), 1.0})
   {
@@ -0,0 +1,119 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#include "modules/linear_boltzmann_solvers/lbs_solver/iterative_methods/nl_keigen_ags_preconditioner.h"
+#include "modules/linear_boltzmann_solvers/lbs_solver/iterative_methods/nl_keigen_ags_context.h"
+#include "modules/linear_boltzmann_solvers/lbs_solver/iterative_methods/wgs_context.h"
+#include "modules/linear_boltzmann_solvers/lbs_solver/preconditioning/lbs_shell_operations.h"
+
+namespace opensn
+{
+namespace lbs
+{
+
+PetscErrorCode
+NLKEigenPreconditionerSetup(PC pc)
+{
+  void* context;
+  PCShellGetContext(pc, &context);
+
+  auto& nl_context = *((NLKEigenAGSContext*)context);
+
+  // The k-eigenvalue of the last residual evaluation
+  nl_context.pc_k_eff = nl_context.kresid_func_context_.k_eff;
+
+  return 0;
+}
+
+PetscErrorCode
+NLKEigenPreconditionerApply(PC pc, Vec x, Vec y)
+{
+  void* context;
+  PCShellGetContext(pc, &context);
+
+  auto& nl_context = *((NLKEigenAGSContext*)context);
+
+  // Shorten some names
+  auto& lbs_solver = nl_context.lbs_solver_;
+  const auto& groupset_ids = nl_context.groupset_ids;
+  auto& phi_old_local = lbs_solver.PhiOldLocal();
+  auto& phi_new_local = lbs_solver.PhiNewLocal();
+  auto& q_moments_local = lbs_solver.QMomentsLocal();
+  const auto& densities_local = lbs_solver.DensitiesLocal();
+
+  auto active_set_source_function = lbs_solver.GetActiveSetSourceFunction();
+
+  // Disassemble the input vector
+  lbs_solver.SetPrimarySTLvectorFromMultiGSPETScVecFrom(groupset_ids, x, PhiSTLOption::PHI_NEW);
+  const std::vector<double> v = phi_new_local;
+
+  // Approximate z = (I - DL^{-1}MS)^{-1} v with DSA-accelerated source iterations
+  // z_{s+1} = z_s + P (v - (I - DL^{-1}MS) z_s), starting from z_0 = 0
+  std::vector<double> z(v.size(), 0.0);
+  std::vector<double> dz = v;
+  for (int s = 0; s <= nl_context.pc_num_sweeps; ++s)
+  {
+    if (s > 0)
+    {
+      phi_old_local = z;
+
+      Set(q_moments_local, 0.0);
+      for (auto& groupset : lbs_solver.Groupsets())
+      {
+        auto& wgs_context = lbs_solver.GetWGSContext(groupset.id_);
+        const bool supress_wgs = wgs_context.lhs_src_scope_ & SUPPRESS_WG_SCATTER;
+        SourceFlags source_flags = APPLY_AGS_SCATTER_SOURCES | APPLY_WGS_SCATTER_SOURCES;
+        if (supress_wgs)
+          source_flags |= SUPPRESS_WG_SCATTER;
+        active_set_source_function(
+          groupset, q_moments_local, phi_old_local, densities_local, source_flags);
+      }
+
+      // After this phi_new = DL^{-1}MS z
+      for (auto& groupset : lbs_solver.Groupsets())
+      {
+        auto& wgs_context = lbs_solver.GetWGSContext(groupset.id_);
+        wgs_context.ApplyInverseTransportOperator(SourceFlags());
+      }
+      ++nl_context.num_pc_sweeps;
+
+      for (size_t i = 0; i < dz.size(); ++i)
+        dz[i] = v[i] - z[i] + phi_new_local[i];
+    }
+
+    MultiGroupsetDSAMult(lbs_solver, groupset_ids, dz);
+
+    for (size_t i = 0; i < z.size(); ++i)
+      z[i] += dz[i];
+  }
+
+  // Eigen-correction, z = (I + A) z with A = (I - DL^{-1}MS)^{-1} DL^{-1} F / k approximated by
+  // the chained groupset diffusion operators
+  if (nl_context.pc_eigen_correction)
+  {
+    phi_old_local = z;
+
+    Set(q_moments_local, 0.0);
+    for (auto& groupset : lbs_solver.Groupsets())
+      active_set_source_function(groupset,
+                                 q_moments_local,
+                                 phi_old_local,
+                                 densities_local,
+                                 APPLY_AGS_FISSION_SOURCES | APPLY_WGS_FISSION_SOURCES);
+    Scale(q_moments_local, 1.0 / nl_context.pc_k_eff);
+
+    MultiGroupsetDiffusionSolve(lbs_solver, groupset_ids, q_moments_local, z);
+  }
+
+  // The Jacobian is the negative of the operator approximated above
+  Scale(z, -1.0);
+
+  // Reassemble the output vector
+  phi_new_local = z;
+  lbs_solver.SetMultiGSPETScVecFromPrimarySTLvector(groupset_ids, y, PhiSTLOption::PHI_NEW);
+
+  return 0;
+}
+
+} // namespace lbs
+} // namespace opensn
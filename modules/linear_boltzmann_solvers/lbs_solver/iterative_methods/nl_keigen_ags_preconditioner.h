@@ -0,0 +1,27 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <petscksp.h>
+
+namespace opensn
+{
+namespace lbs
+{
+
+/**Updates the k-eigenvalue used by the Newton-Krylov k-eigenvalue preconditioner. Called by
+ * PETSc whenever the (lagged) preconditioner is rebuilt.*/
+PetscErrorCode NLKEigenPreconditionerSetup(PC pc);
+
+/**Applies the Newton-Krylov k-eigenvalue preconditioner. The Jacobian of the residual
+ * \f$ r(\phi) = DL^{-1} (\frac{1}{k} F\phi + MS \phi) - \phi \f$ is approximately
+ * \f$ -(I - DL^{-1}MS)(I - A) \f$ with \f$ A = (I - DL^{-1}MS)^{-1} DL^{-1} \frac{1}{k} F \f$.
+ * The inverse of \f$ I - DL^{-1}MS \f$ is approximated by the requested number of DSA-accelerated
+ * source iterations, the first of which requires no sweep, with DSA chained across groupsets.
+ * Optionally, \f$ (I - A)^{-1} \f$ is approximated by \f$ I + A \f$ where \f$ A \f$ is replaced
+ * by its diffusion approximation.*/
+PetscErrorCode NLKEigenPreconditionerApply(PC pc, Vec x, Vec y);
+
+} // namespace lbs
+} // namespace opensn
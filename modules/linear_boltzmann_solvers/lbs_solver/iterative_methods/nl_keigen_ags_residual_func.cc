@@ -15,7 +15,6 @@ namespace lbs
 PetscErrorCode
 NLKEigenResidualFunction(SNES snes, Vec phi, Vec r, void* ctx)
 {
-  const std::string fname = "lbs::SNESKResidualFunction";
   auto& function_context = *((KResidualFunctionContext*)ctx);
 
   NLKEigenAGSContext* nl_context_ptr;
@@ -75,15 +74,9 @@ NLKEigenResidualFunction(SNES snes, Vec phi, Vec r, void* ctx)
 
   VecAXPY(r, -1.0, phi);
 
-  for (auto& groupset : lbs_solver.Groupsets())
-  {
-    if ((groupset.apply_wgdsa_ or groupset.apply_tgdsa_) and lbs_solver.Groupsets().size() > 1)
-      throw std::logic_error(fname + ": Preconditioning currently only supports"
-                                     "single groupset simulations.");
-
-    auto& wgs_context = lbs_solver.GetWGSContext(groupset.id_);
-    lbs::WGDSA_TGDSA_PreConditionerMult2(wgs_context, r, r);
-  }
+  // Accelerate the residual unless a shell preconditioner takes care of it
+  if (not nl_context_ptr->use_shell_pc)
+    lbs::MultiGroupsetDSAPreConditionerMult(lbs_solver, groupset_ids, r, r);
 
   // Assign k to the context so monitors can work
   function_context.k_eff = k_eff;
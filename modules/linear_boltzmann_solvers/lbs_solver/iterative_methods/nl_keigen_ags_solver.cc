@@ -7,6 +7,8 @@
 
 #include "modules/linear_boltzmann_solvers/lbs_solver/iterative_methods/nl_keigen_ags_residual_func.h"
 
+#include "modules/linear_boltzmann_solvers/lbs_solver/iterative_methods/nl_keigen_ags_preconditioner.h"
+
 #include "framework/math/petsc_utils/petsc_utils.h"
 
 #include "framework/runtime.h"
@@ -98,6 +100,29 @@ NLKEigenvalueAGSSolver::SetJacobian()
   SNESSetJacobian(nl_solver_, J_, J_, MatMFFDComputeJacobian, nullptr);
 }
 
+void
+NLKEigenvalueAGSSolver::SetPreconditioner()
+{
+  auto nl_context_ptr = GetNLKAGSContextPtr(context_ptr_, __PRETTY_FUNCTION__);
+
+  if (not nl_context_ptr->use_shell_pc)
+    return;
+
+  KSP ksp;
+  SNESGetKSP(nl_solver_, &ksp);
+
+  PC pc;
+  KSPGetPC(ksp, &pc);
+  PCSetType(pc, PCSHELL);
+  PCShellSetSetUp(pc, NLKEigenPreconditionerSetup);
+  PCShellSetApply(pc, NLKEigenPreconditionerApply);
+  PCShellSetContext(pc, &(*nl_context_ptr));
+  PCShellSetName(pc, "NLKEigenPreconditioner");
+
+  // The preconditioner is only rebuilt every pc_lag Newton steps
+  SNESSetLagPreconditioner(nl_solver_, nl_context_ptr->pc_lag);
+}
+
 void
 NLKEigenvalueAGSSolver::SetInitialGuess()
 {
@@ -123,14 +148,20 @@ NLKEigenvalueAGSSolver::PostSolveCallback()
 
   // Compute final k_eff
   double k_eff = lbs_solver.ComputeFissionProduction(lbs_solver.PhiOldLocal());
+  nl_context_ptr->kresid_func_context_.k_eff = k_eff;
 
   PetscInt number_of_func_evals;
   SNESGetNumberFunctionEvals(nl_solver_, &number_of_func_evals);
 
+  // Function evaluations and preconditioner sweeps each sweep all the groupsets once
+  nl_context_ptr->num_sweeps =
+    static_cast<int>(number_of_func_evals) + nl_context_ptr->num_pc_sweeps;
+
   // Print summary
   log.Log() << "\n"
             << "        Final k-eigenvalue    :        " << std::fixed << std::setw(10)
-            << std::setprecision(7) << k_eff << " (Number of Sweeps:" << number_of_func_evals << ")"
+            << std::setprecision(7) << k_eff
+            << " (Number of Sweeps:" << nl_context_ptr->num_sweeps << ")"
             << "\n";
 }
 
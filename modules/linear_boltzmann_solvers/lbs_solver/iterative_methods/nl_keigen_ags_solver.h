@@ -29,6 +29,7 @@ protected:
   void SetSystem() override;
   void SetFunction() override;
   void SetJacobian() override;
+  void SetPreconditioner() override;
 
 protected:
   void SetInitialGuess() override;
@@ -3,6 +3,9 @@
 
 #include "modules/linear_boltzmann_solvers/lbs_solver/iterative_methods/wgs_context.h"
 #include "modules/linear_boltzmann_solvers/lbs_solver/lbs_solver.h"
+#include "modules/linear_boltzmann_solvers/lbs_solver/preconditioning/lbs_shell_operations.h"
+#include "framework/logging/log.h"
+#include "framework/runtime.h"
 #include "caliper/cali.h"
 
 namespace opensn
@@ -10,6 +13,8 @@ namespace opensn
 namespace lbs
 {
 
+typedef PetscErrorCode (*PCShellPtr)(PC, Vec, Vec);
+
 WGSContext::WGSContext(LBSSolver& lbs_solver,
                        LBSGroupset& groupset,
                        const SetSourceFunction& set_source_function,
@@ -69,5 +74,67 @@ WGSContext::MatrixAction(Mat& matrix, Vec& action_vector, Vec& action)
   return 0;
 }
 
+void
+WGSContext::SetPreconditioner(KSP& solver)
+{
+  CALI_CXX_MARK_SCOPE("WGSContext::SetPreconditioner");
+
+  auto& ksp = solver;
+
+  PC pc;
+  KSPGetPC(ksp, &pc);
+
+  if (groupset_.apply_wgdsa_ or groupset_.apply_tgdsa_)
+  {
+    PCSetType(pc, PCSHELL);
+    PCShellSetApply(pc, (PCShellPtr)WGDSA_TGDSA_PreConditionerMult);
+    PCShellSetContext(pc, &(*this));
+  }
+
+  // Pipelined BiCGStab only supports right preconditioning. The residual it tests is then not
+  // preconditioned and is scaled with the plain rhs norm.
+  if (groupset_.iterative_method_ == IterativeMethod::KRYLOV_PIPEBICGSTAB)
+  {
+    KSPSetPCSide(ksp, PC_RIGHT);
+    residual_scale_type = ResidualScaleType::RHS_NORM;
+  }
+  else
+    KSPSetPCSide(ksp, PC_LEFT);
+  KSPSetUp(ksp);
+}
+
+std::string
+WGSContext::IterativeMethodName() const
+{
+  switch (groupset_.iterative_method_)
+  {
+    case IterativeMethod::CLASSICRICHARDSON:
+      return "CLASSIC_RICHARDSON";
+    case IterativeMethod::KRYLOV_RICHARDSON:
+      return "KRYLOV_RICHARDSON";
+    case IterativeMethod::KRYLOV_GMRES:
+      return "KRYLOV_GMRES";
+    case IterativeMethod::KRYLOV_BICGSTAB:
+      return "KRYLOV_BICGSTAB";
+    case IterativeMethod::KRYLOV_PGMRES:
+      return "KRYLOV_PGMRES";
+    case IterativeMethod::KRYLOV_PIPEBICGSTAB:
+      return "KRYLOV_PIPEBICGSTAB";
+    default:
+      return "KRYLOV_GMRES";
+  }
+}
+
+void
+WGSContext::LogSolveHeader(const std::string& info) const
+{
+  log.Log() << "\n\n"
+            << "********** Solving groupset " << groupset_.id_ << " with "
+            << IterativeMethodName() << ".\n\n"
+            << "Quadrature number of angles: " << groupset_.quadrature_->abscissae_.size() << "\n"
+            << info << "Groups " << groupset_.groups_.front().id_ << " "
+            << groupset_.groups_.back().id_ << "\n\n";
+}
+
 } // namespace lbs
 } // namespace opensn
@@ -6,6 +6,7 @@
 #include "framework/math/linear_solver/linear_solver_context.h"
 #include "modules/linear_boltzmann_solvers/lbs_solver/lbs_structs.h"
 #include <vector>
+#include <string>
 #include <functional>
 #include <memory>
 #include <petscksp.h>
@@ -35,7 +36,10 @@ struct WGSContext : public LinearSolverContext
              bool log_info);
 
   virtual void PreSetupCallback(){};
-  virtual void SetPreconditioner(KSP& solver){};
+
+  /**Applies the WGDSA/TGDSA shell preconditioner when the groupset uses one and sets the
+   * preconditioning side the iterative method supports.*/
+  virtual void SetPreconditioner(KSP& solver);
   virtual void PostSetupCallback(){};
 
   virtual void PreSolveCallback(){};
@@ -50,6 +54,13 @@ struct WGSContext : public LinearSolverContext
   virtual void ApplyInverseTransportOperator(SourceFlags scope) = 0;
 
   virtual void PostSolveCallback(){};
+
+  /**Returns the name of the iterative method of the groupset.*/
+  std::string IterativeMethodName() const;
+
+  /**Logs the iterative method, the number of angles and the groups of the groupset solve.
+   * `info`, if not empty, is logged after the number of angles.*/
+  void LogSolveHeader(const std::string& info = "") const;
 };
 
 } // namespace lbs
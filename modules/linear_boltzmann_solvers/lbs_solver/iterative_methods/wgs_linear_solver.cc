@@ -187,17 +187,7 @@ WGSLinearSolver::SetRHS()
     // Assemble PETSc vector
     lbs_solver.SetGSPETScVecFromPrimarySTLvector(groupset, b_, PhiSTLOption::PHI_NEW);
 
-    // Compute RHS norm
-    VecNorm(b_, NORM_2, &context_ptr_->rhs_norm);
-
-    // Compute precondition RHS norm
-    PC pc;
-    KSPGetPC(ksp_, &pc);
-    Vec temp_vec;
-    VecDuplicate(b_, &temp_vec);
-    PCApply(pc, b_, temp_vec);
-    VecNorm(temp_vec, NORM_2, &context_ptr_->rhs_preconditioned_norm);
-    VecDestroy(&temp_vec);
+    ComputeRHSNorm(b_);
   }
   // If we have a single richardson iteration then the user probably wants
   // only a single sweep. Therefore, we are going to combine the scattering
@@ -218,22 +208,40 @@ WGSLinearSolver::SetRHS()
     // Assemble PETSc vector
     lbs_solver.SetGSPETScVecFromPrimarySTLvector(groupset, x_, PhiSTLOption::PHI_NEW);
 
-    // Compute RHS norm
-    VecNorm(x_, NORM_2, &context_ptr_->rhs_norm);
-
-    // Compute precondition RHS norm
-    PC pc;
-    KSPGetPC(ksp_, &pc);
-    Vec temp_vec;
-    VecDuplicate(x_, &temp_vec);
-    PCApply(pc, x_, temp_vec);
-    VecNorm(temp_vec, NORM_2, &context_ptr_->rhs_preconditioned_norm);
-    VecDestroy(&temp_vec);
+    ComputeRHSNorm(x_);
 
     SetKSPSolveSuppressionFlag(true);
   }
 }
 
+void
+WGSLinearSolver::ComputeRHSNorm(Vec rhs)
+{
+  CALI_CXX_MARK_SCOPE("WGSLinearSolver::ComputeRHSNorm");
+
+  // Each norm is a blocking global reduction and the preconditioned norm also costs a DSA solve,
+  // so only the norm the convergence test scales the residual with is computed
+  switch (context_ptr_->residual_scale_type)
+  {
+    case ResidualScaleType::RHS_NORM:
+      VecNorm(rhs, NORM_2, &context_ptr_->rhs_norm);
+      break;
+    case ResidualScaleType::RHS_PRECONDITIONED_NORM:
+    {
+      PC pc;
+      KSPGetPC(ksp_, &pc);
+      Vec temp_vec;
+      VecDuplicate(rhs, &temp_vec);
+      PCApply(pc, rhs, temp_vec);
+      VecNorm(temp_vec, NORM_2, &context_ptr_->rhs_preconditioned_norm);
+      VecDestroy(&temp_vec);
+      break;
+    }
+    default:
+      break;
+  }
+}
+
 void
 WGSLinearSolver::PostSolveCallback()
 {
@@ -39,6 +39,10 @@ protected:
   void SetInitialGuess() override;
   void PostSolveCallback() override;
 
+  /**Computes the rhs norm the convergence test scales the residual with. Only the norm selected
+   * by the residual scale type of the context is computed.*/
+  void ComputeRHSNorm(Vec rhs);
+
   std::vector<double> saved_q_moments_local_;
 };
 
@@ -19,6 +19,7 @@
 #include "framework/materials/material.h"
 #include "framework/logging/log.h"
 #include "framework/utils/hdf_utils.h"
+#include "framework/utils/memory_registry.h"
 #include "framework/object_factory.h"
 #include "framework/runtime.h"
 #include "caliper/cali.h"
@@ -230,7 +231,7 @@ LBSSolver::SpatialDiscretization() const
   return *discretization_;
 }
 
-const std::vector<UnitCellMatrices>&
+const UnitCellMatricesList&
 LBSSolver::GetUnitCellMatrices() const
 {
   return unit_cell_matrices_;
@@ -350,6 +351,73 @@ LBSSolver::DensitiesLocal() const
   return densities_local_;
 }
 
+void
+LBSSolver::SetCellTemperatures(const std::vector<double>& temperatures,
+                               const std::vector<double>& densities)
+{
+  CALI_CXX_MARK_SCOPE("LBSSolver::SetCellTemperatures");
+
+  const size_t num_local_cells = grid_ptr_->local_cells.size();
+  OpenSnInvalidArgumentIf(temperatures.size() != num_local_cells,
+                          "The number of temperatures (" + std::to_string(temperatures.size()) +
+                            ") does not match the number of local cells (" +
+                            std::to_string(num_local_cells) + ").");
+  OpenSnInvalidArgumentIf(not densities.empty() and densities.size() != num_local_cells,
+                          "The number of densities (" + std::to_string(densities.size()) +
+                            ") does not match the number of local cells (" +
+                            std::to_string(num_local_cells) + ").");
+  OpenSnLogicalErrorIf(cell_transport_views_.size() != num_local_cells,
+                       "The solver must be initialized before setting cell temperatures.");
+
+  if (not densities.empty())
+    densities_local_ = densities;
+
+  // Re-evaluate the cross sections of cells whose temperature changed
+  const bool all_cells = cell_temperatures_local_.empty();
+  size_t num_updated = 0;
+  for (const auto& cell : grid_ptr_->local_cells)
+  {
+    const double temperature = temperatures[cell.local_id_];
+    if (not all_cells and temperature == cell_temperatures_local_[cell.local_id_])
+      continue;
+
+    const auto& mat_xs = matid_to_xs_map_.at(cell.material_id_);
+    if (not mat_xs->IsTabulated())
+      continue;
+
+    auto& xs = interpolated_xs_cache_[{cell.material_id_, temperature}];
+    if (not xs)
+    {
+      xs = std::make_shared<MultiGroupXS>();
+      mat_xs->Interpolate(temperature, *xs);
+    }
+    cell_transport_views_[cell.local_id_].ReassignXS(*xs);
+    ++num_updated;
+  }
+  cell_temperatures_local_ = temperatures;
+
+  // Remove cached cross sections no longer referenced by any cell
+  if (num_updated > 0)
+  {
+    std::set<std::pair<int, double>> keys_in_use;
+    for (const auto& cell : grid_ptr_->local_cells)
+      if (matid_to_xs_map_.at(cell.material_id_)->IsTabulated())
+        keys_in_use.emplace(cell.material_id_, cell_temperatures_local_[cell.local_id_]);
+    for (auto it = interpolated_xs_cache_.begin(); it != interpolated_xs_cache_.end();)
+      it = keys_in_use.count(it->first) ? std::next(it) : interpolated_xs_cache_.erase(it);
+  }
+
+  log.Log0Verbose1() << "Re-evaluated the cross sections of " << num_updated
+                     << " local cells. Number of cached cross sections: "
+                     << interpolated_xs_cache_.size();
+}
+
+const std::vector<double>&
+LBSSolver::CellTemperaturesLocal() const
+{
+  return cell_temperatures_local_;
+}
+
 const std::map<uint64_t, std::shared_ptr<SweepBoundary>>&
 LBSSolver::SweepBoundaries() const
 {
@@ -362,6 +430,12 @@ LBSSolver::GetActiveSetSourceFunction() const
   return active_set_source_function_;
 }
 
+void
+LBSSolver::SetActiveSetSourceFunction(SetSourceFunction source_function)
+{
+  active_set_source_function_ = std::move(source_function);
+}
+
 std::shared_ptr<AGSLinearSolver>
 LBSSolver::GetPrimaryAGSSolver()
 {
@@ -528,10 +602,16 @@ LBSSolver::BoundaryOptionsBlock()
                                            {},
                                            "Required only if \"type\" is \"isotropic\". An array "
                                            "of isotropic strength per group");
+  params.AddOptionalParameter("function_handle",
+                              SIZE_T_INVALID,
+                              "Required only if \"type\" is \"arbitrary\" and "
+                              "\"function_name\" is not given. Handle to the boundary function "
+                              "giving the incident angular fluxes.");
   params.AddOptionalParameter("function_name",
                               "",
                               "Text name of the lua function to be called for this boundary "
-                              "condition.");
+                              "condition. Shorthand for a \"function_handle\" to an "
+                              "lbs.LuaBoundaryFunction with this function name.");
   params.ConstrainParameterRange(
     "name", AllowableRangeList::New({"xmin", "xmax", "ymin", "ymax", "zmin", "zmax"}));
   params.ConstrainParameterRange(
@@ -593,6 +673,20 @@ LBSSolver::SetOptions(const InputParameters& params)
         for (auto& psi : psi_new_local_)
           psi.assign(psi.size(), 0.0);
         precursor_new_local_.assign(precursor_new_local_.size(), 0.0);
+
+        // The sweep orderings, flux data structures and WGDSA operators are shared by the
+        // forward and adjoint problems. The adjoint is swept along the forward directions with
+        // the transposed transfer matrices and reoriented afterwards, and the diffusion
+        // coefficients and removal cross sections of the within-group operators do not change
+        // under transposition. Only the two-grid operators, which are built from the
+        // up-scattering and its spectrum, differ and are rebuilt.
+        for (auto& groupset : groupsets_)
+        {
+          if (not groupset.tgdsa_solver_)
+            continue;
+          groupset.tg_acceleration_info_.map_mat_id_2_tginfo.clear();
+          InitTGDSA(groupset);
+        }
       }
     }
   }
@@ -751,12 +845,24 @@ LBSSolver::SetBoundaryOptions(const InputParameters& params)
     }
     case BoundaryType::ARBITRARY:
     {
-      OpenSnInvalidArgumentIf(not user_params.Has("function_name"),
-                              "Boundary conditions with type=\"arbitrary\" require parameter "
-                              "\"function_name\".");
-
-      const auto bndry_function_name = user_params.GetParamValue<std::string>("function_name");
-      boundary_preferences_[bid] = {type, {}, bndry_function_name};
+      OpenSnInvalidArgumentIf(user_params.Has("function_handle") ==
+                                user_params.Has("function_name"),
+                              "Boundary conditions with type=\"arbitrary\" require either "
+                              "parameter \"function_handle\" or \"function_name\".");
+
+      size_t handle = 0;
+      if (user_params.Has("function_handle"))
+        handle = user_params.GetParamValue<size_t>("function_handle");
+      else
+      {
+        ParameterBlock function_params;
+        function_params.AddParameter("function_name",
+                                     user_params.GetParamValue<std::string>("function_name"));
+        handle = ObjectFactory::GetInstance().MakeRegisteredObjectOfType(
+          "lbs::LuaBoundaryFunction", function_params);
+      }
+      boundary_preferences_[bid] = {
+        type, {}, GetStackItemPtrAsType<BoundaryFunction>(object_stack, handle, fname)};
       break;
     }
   }
@@ -788,6 +894,48 @@ LBSSolver::Initialize()
     distributed_source.Initialize(*this);
 }
 
+void
+LBSSolver::PrintMemoryReport() const
+{
+  ReportMemoryUsage();
+  MemoryRegistry::GetInstance().PrintReport(TextName());
+}
+
+void
+LBSSolver::ReportMemoryUsage() const
+{
+  auto& registry = MemoryRegistry::GetInstance();
+  const std::string prefix = TextName() + "/";
+
+  MemoryUsage phi = GetMemoryUsage(phi_old_local_);
+  phi += GetMemoryUsage(phi_new_local_);
+  registry.Set(prefix + "phi", phi);
+
+  registry.Set(prefix + "psi", GetMemoryUsage(psi_new_local_));
+
+  MemoryUsage sources = GetMemoryUsage(q_moments_local_);
+  sources += GetMemoryUsage(ext_src_moments_local_);
+  registry.Set(prefix + "source_moments", sources);
+
+  if (options_.use_precursors)
+    registry.Set(prefix + "precursors", GetMemoryUsage(precursor_new_local_));
+
+  registry.Set(prefix + "unit_cell_matrices", unit_cell_matrices_.ComputeMemoryUsage());
+  registry.Set(prefix + "mesh", grid_ptr_->ComputeMemoryUsage());
+
+  MemoryUsage boundaries;
+  for (const auto& [bid, boundary] : sweep_boundaries_)
+    boundaries += boundary->ComputeMemoryUsage();
+  registry.Set(prefix + "boundaries", boundaries);
+
+  MemoryUsage dsa;
+  for (const auto& groupset : groupsets_)
+    for (const auto& dsa_solver : {groupset.wgdsa_solver_, groupset.tgdsa_solver_})
+      if (dsa_solver)
+        dsa += dsa_solver->ComputeMemoryUsage();
+  registry.Set(prefix + "dsa_matrices", dsa);
+}
+
 void
 LBSSolver::PerformInputChecks()
 {
@@ -1018,6 +1166,16 @@ LBSSolver::InitializeMaterials()
       transport_view.ReassignXS(*xs_ptr);
     }
 
+  // Re-apply cell temperatures, the tabulated cross sections may have changed
+  interpolated_xs_cache_.clear();
+  if (not cell_temperatures_local_.empty() and
+      grid_ptr_->local_cells.size() == cell_transport_views_.size())
+  {
+    const auto temperatures = std::move(cell_temperatures_local_);
+    cell_temperatures_local_.clear();
+    SetCellTemperatures(temperatures);
+  }
+
   log.Log0Verbose1() << "Materials Initialized:\n" << materials_list.str() << "\n";
 
   mpi_comm.barrier();
@@ -1034,6 +1192,19 @@ LBSSolver::InitializeSpatialDiscretization()
   ComputeUnitIntegrals();
 }
 
+void
+LBSSolver::ShareSpatialDiscretization(const LBSSolver& other)
+{
+  OpenSnInvalidArgumentIf(other.grid_ptr_ != grid_ptr_,
+                          "Solver " + other.TextName() + " is defined on a different grid.");
+  OpenSnInvalidArgumentIf(not other.discretization_,
+                          "Solver " + other.TextName() + " has not been initialized.");
+
+  log.Log() << "Sharing the spatial discretization of solver " << other.TextName() << ".\n";
+  discretization_ = other.discretization_;
+  unit_cell_matrices_ = other.unit_cell_matrices_;
+}
+
 void
 LBSSolver::ComputeUnitIntegrals()
 {
@@ -1065,9 +1236,29 @@ LBSSolver::ComputeUnitIntegrals()
   if (options_.geometry_type == lbs::GeometryType::TWOD_CYLINDRICAL)
     swf_ptr = std::make_shared<CylindricalSWF>();
 
-  auto ComputeCellUnitIntegrals = [&sdm](const Cell& cell, const SpatialWeightFunction& swf)
+  // With a uniform spatial weight, cell mappings that provide closed-form unit integrals are
+  // not integrated by quadrature
+  const bool uniform_weight = options_.geometry_type != GeometryType::ONED_SPHERICAL and
+                              options_.geometry_type != GeometryType::TWOD_CYLINDRICAL;
+
+  auto ComputeCellUnitIntegrals =
+    [&sdm, uniform_weight](const Cell& cell, const SpatialWeightFunction& swf)
   {
     const auto& cell_mapping = sdm.GetCellMapping(cell);
+    if (uniform_weight)
+    {
+      FiniteElementUnitIntegrals unit_integrals;
+      if (cell_mapping.ComputeUnitIntegrals(unit_integrals))
+        return UnitCellMatrices{std::move(unit_integrals.intV_gradshapeI_gradshapeJ),
+                                std::move(unit_integrals.intV_shapeI_gradshapeJ),
+                                std::move(unit_integrals.intV_shapeI_shapeJ),
+                                std::move(unit_integrals.intV_shapeI),
+
+                                std::move(unit_integrals.intS_shapeI_shapeJ),
+                                std::move(unit_integrals.intS_shapeI_gradshapeJ),
+                                std::move(unit_integrals.intS_shapeI)};
+    }
+
     const size_t cell_num_faces = cell.faces_.size();
     const size_t cell_num_nodes = cell_mapping.NumNodes();
     const auto fe_vol_data = cell_mapping.MakeVolumetricFiniteElementData();
@@ -1154,10 +1345,28 @@ LBSSolver::ComputeUnitIntegrals()
   };
 
   const size_t num_local_cells = grid_ptr_->local_cells.size();
-  unit_cell_matrices_.resize(num_local_cells);
+  unit_cell_matrices_.Resize(num_local_cells);
 
-  for (const auto& cell : grid_ptr_->local_cells)
-    unit_cell_matrices_[cell.local_id_] = ComputeCellUnitIntegrals(cell, *swf_ptr);
+  // On orthogonal meshes with a uniform spatial weight all congruent cells have identical unit
+  // integrals, so they are computed once per distinct cell shape and shared.
+  const bool share_congruent_cells = grid_ptr_->Type() == ORTHOGONAL and uniform_weight;
+  if (share_congruent_cells)
+  {
+    std::map<std::vector<int64_t>, size_t> shape_key_to_entry;
+    for (const auto& cell : grid_ptr_->local_cells)
+    {
+      const auto shape_key = MakeCongruentCellKey(cell);
+      const auto it = shape_key_to_entry.find(shape_key);
+      if (it != shape_key_to_entry.end())
+        unit_cell_matrices_.Share(cell.local_id_, it->second);
+      else
+        shape_key_to_entry[shape_key] =
+          unit_cell_matrices_.Set(cell.local_id_, ComputeCellUnitIntegrals(cell, *swf_ptr));
+    }
+  }
+  else
+    for (const auto& cell : grid_ptr_->local_cells)
+      unit_cell_matrices_.Set(cell.local_id_, ComputeCellUnitIntegrals(cell, *swf_ptr));
 
   const auto ghost_ids = grid_ptr_->cells.GetGhostGlobalIDs();
   for (uint64_t ghost_id : ghost_ids)
@@ -1174,9 +1383,49 @@ LBSSolver::ComputeUnitIntegrals()
   opensn::mpi_comm.barrier();
   log.Log() << "Ghost cell unit cell-matrix ratio: "
             << (double)num_globl_ucms[1] * 100 / (double)num_globl_ucms[0] << "%";
+  if (share_congruent_cells)
+  {
+    size_t num_globl_unique_ucms = 0;
+    mpi_comm.all_reduce(
+      unit_cell_matrices_.NumUniqueEntries(), num_globl_unique_ucms, mpi::op::sum<size_t>());
+    log.Log() << "Unique unit cell-matrices (congruent cells shared): " << num_globl_unique_ucms;
+  }
   log.Log() << "Cell matrices computed.";
 }
 
+std::vector<int64_t>
+LBSSolver::MakeCongruentCellKey(const Cell& cell) const
+{
+  const auto& v0 = grid_ptr_->vertices[cell.vertex_ids_.front()];
+  double scale = 0.0;
+  for (const uint64_t vid : cell.vertex_ids_)
+    scale = std::max(scale, (grid_ptr_->vertices[vid] - v0).Norm());
+
+  // Vertex positions relative to the first vertex, quantized relative to the cell size, followed
+  // by each face's vertices as indices into the cell vertex list. This captures the node and face
+  // ordering, not just the cell extents.
+  const double quantum = 1.0e-12 * scale;
+  std::vector<int64_t> key;
+  key.reserve(1 + 3 * cell.vertex_ids_.size());
+  key.push_back(static_cast<int64_t>(cell.SubType()));
+  for (const uint64_t vid : cell.vertex_ids_)
+  {
+    const auto dv = grid_ptr_->vertices[vid] - v0;
+    for (int d = 0; d < 3; ++d)
+      key.push_back(std::llround(dv[d] / quantum));
+  }
+  for (const auto& face : cell.faces_)
+  {
+    key.push_back(-static_cast<int64_t>(face.vertex_ids_.size()));
+    for (const uint64_t fvid : face.vertex_ids_)
+    {
+      const auto it = std::find(cell.vertex_ids_.begin(), cell.vertex_ids_.end(), fvid);
+      key.push_back(std::distance(cell.vertex_ids_.begin(), it));
+    }
+  }
+  return key;
+}
+
 void
 LBSSolver::InitializeGroupsets()
 {
@@ -1248,6 +1497,57 @@ LBSSolver::InitializeParrays()
 
   log.LogAllVerbose1() << "LBS Number of phi unknowns: " << local_unknown_count;
 
+  // Estimate the memory of the parallel arrays and DSA matrices before allocating them. The
+  // estimate is a lower bound: the sweep plane and flux data structures (SPDS and FLUDS) depend
+  // on the sweep orderings, which are not known yet, and only appear in the memory report
+  // printed after initialization.
+  {
+    const std::string prefix = TextName() + "/";
+    size_t num_psi_unknowns = 0;
+    if (options_.save_angular_flux)
+      for (const auto& groupset : groupsets_)
+        num_psi_unknowns += discretization_->GetNumLocalDOFs(groupset.psi_uk_man_);
+    size_t num_precursor_dofs = 0;
+    if (options_.use_precursors)
+      num_precursor_dofs = grid_ptr_->local_cells.size() * max_precursors_per_material_;
+
+    // The MIP operators couple every node of a cell with the nodes of the cell and of its face
+    // neighbors, which are assumed to have as many nodes, within each group of the operator
+    size_t num_dsa_groups = 0;
+    for (const auto& groupset : groupsets_)
+    {
+      if (groupset.apply_wgdsa_)
+        num_dsa_groups += groupset.groups_.size();
+      if (groupset.apply_tgdsa_)
+        num_dsa_groups += 1;
+    }
+    size_t num_dsa_bytes = 0;
+    if (num_dsa_groups > 0)
+    {
+      size_t num_couplings = 0;
+      for (const auto& cell : grid_ptr_->local_cells)
+      {
+        const size_t num_nodes = discretization_->GetCellMapping(cell).NumNodes();
+        size_t num_coupled_cells = 1;
+        for (const auto& face : cell.faces_)
+          if (face.has_neighbor_)
+            ++num_coupled_cells;
+        num_couplings += num_nodes * num_nodes * num_coupled_cells;
+      }
+      num_dsa_bytes =
+        num_dsa_groups * (num_couplings * (sizeof(PetscScalar) + sizeof(PetscInt)) +
+                          local_node_count_ * (sizeof(PetscInt) + sizeof(PetscScalar)));
+    }
+
+    const std::vector<std::pair<std::string, size_t>> estimates = {
+      {prefix + "phi", 2 * local_unknown_count * sizeof(double)},
+      {prefix + "psi", num_psi_unknowns * sizeof(double)},
+      {prefix + "source_moments", local_unknown_count * sizeof(double)},
+      {prefix + "precursors", num_precursor_dofs * sizeof(double)},
+      {prefix + "dsa_matrices", num_dsa_bytes}};
+    MemoryRegistry::PrintSummary("estimated before allocation", estimates);
+  }
+
   // Size local vectors
   q_moments_local_.assign(local_unknown_count, 0.0);
   phi_old_local_.assign(local_unknown_count, 0.0);
@@ -1524,13 +1824,7 @@ LBSSolver::InitializeBoundaries()
       else if (bndry_pref.type == lbs::BoundaryType::ISOTROPIC)
         sweep_boundaries_[bid] = std::make_shared<IsotropicBoundary>(G, mg_q);
       else if (bndry_pref.type == BoundaryType::ARBITRARY)
-      {
-        // FIXME:
-#if 0
-        sweep_boundaries_[bid] = std::make_shared<ArbitraryBoundary>(
-          G, std::make_unique<BoundaryFunctionToLua>(bndry_pref.source_function), bid);
-#endif
-      }
+        sweep_boundaries_[bid] = std::make_shared<ArbitraryBoundary>(G, bndry_pref.function, bid);
       else if (bndry_pref.type == lbs::BoundaryType::REFLECTING)
       {
         // Locally check all faces, that subscribe to this boundary,
@@ -1650,6 +1944,8 @@ lbs::LBSSolver::InitWGDSA(LBSGroupset& groupset, bool vaccum_bcs_are_dirichlet)
     solver->options.max_iters = groupset.wgdsa_max_iters_;
     solver->options.verbose = groupset.wgdsa_verbose_;
     solver->options.additional_options_string = groupset.wgdsa_string_;
+    solver->options.matrix_free = groupset.wgdsa_matrix_free_;
+    solver->options.perform_matrix_free_check = groupset.wgdsa_matrix_free_check_;
 
     solver->Initialize();
 
@@ -1661,6 +1957,42 @@ lbs::LBSSolver::InitWGDSA(LBSGroupset& groupset, bool vaccum_bcs_are_dirichlet)
   }
 }
 
+bool
+lbs::LBSSolver::ShareWGDSA(LBSGroupset& groupset, const LBSSolver& other)
+{
+  if (not groupset.apply_wgdsa_ or other.discretization_ != discretization_ or
+      other.matid_to_xs_map_ != matid_to_xs_map_ or
+      other.sweep_boundaries_.size() != sweep_boundaries_.size())
+    return false;
+
+  // Only the boundary types enter the diffusion boundary conditions
+  for (const auto& [bid, boundary] : sweep_boundaries_)
+  {
+    const auto it = other.sweep_boundaries_.find(bid);
+    if (it == other.sweep_boundaries_.end() or it->second->Type() != boundary->Type())
+      return false;
+  }
+
+  for (const auto& other_groupset : other.groupsets_)
+  {
+    if (not other_groupset.wgdsa_solver_ or
+        other_groupset.groups_.front().id_ != groupset.groups_.front().id_ or
+        other_groupset.groups_.back().id_ != groupset.groups_.back().id_ or
+        other_groupset.wgdsa_tol_ != groupset.wgdsa_tol_ or
+        other_groupset.wgdsa_max_iters_ != groupset.wgdsa_max_iters_ or
+        other_groupset.wgdsa_string_ != groupset.wgdsa_string_ or
+        other_groupset.wgdsa_matrix_free_ != groupset.wgdsa_matrix_free_)
+      continue;
+
+    log.Log() << "Groupset " << groupset.id_ << " shares the WGDSA solver of solver "
+              << other.TextName() << ".\n";
+    groupset.wgdsa_solver_ = other_groupset.wgdsa_solver_;
+    return true;
+  }
+
+  return false;
+}
+
 void
 lbs::LBSSolver::CleanUpWGDSA(LBSGroupset& groupset)
 {
@@ -1761,7 +2093,7 @@ lbs::LBSSolver::AssembleWGDSADeltaPhiVector(const LBSGroupset& groupset,
   {
     const auto& cell_mapping = sdm.GetCellMapping(cell);
     const size_t num_nodes = cell_mapping.NumNodes();
-    const auto& sigma_s = matid_to_xs_map_[cell.material_id_]->SigmaSGtoG();
+    const auto& sigma_s = cell_transport_views_[cell.local_id_].XS().SigmaSGtoG();
 
     for (size_t i = 0; i < num_nodes; i++)
     {
@@ -1826,16 +2158,19 @@ lbs::LBSSolver::InitTGDSA(LBSGroupset& groupset)
     auto bcs = TranslateBCs(sweep_boundaries_);
 
     // Make TwoGridInfo
-    for (const auto& mat_id_xs_pair : matid_to_xs_map_)
-    {
-      const auto& mat_id = mat_id_xs_pair.first;
-      const auto& xs = mat_id_xs_pair.second;
-
-      TwoGridCollapsedInfo tginfo = MakeTwoGridCollapsedInfo(*xs, EnergyCollapseScheme::JFULL);
+    groupset.tg_acceleration_info_.map_mat_id_2_tginfo =
+      MakeTwoGridCollapsedInfo(matid_to_xs_map_, EnergyCollapseScheme::JFULL);
 
-      groupset.tg_acceleration_info_.map_mat_id_2_tginfo.insert(
-        std::make_pair(mat_id, std::move(tginfo)));
-    }
+    if (groupset.tgdsa_verbose_)
+      for (const auto& [mat_id, tg_info] : groupset.tg_acceleration_info_.map_mat_id_2_tginfo)
+      {
+        std::stringstream outstr;
+        outstr << "TGDSA material " << mat_id << " collapsed D=" << tg_info.collapsed_D
+               << " sigma_a=" << tg_info.collapsed_sig_a << " spectrum:";
+        for (const double xi : tg_info.spectrum)
+          outstr << ' ' << xi;
+        log.Log() << outstr.str();
+      }
 
     // Make xs map
     typedef lbs::Multigroup_D_and_sigR MultiGroupXS;
@@ -1907,7 +2242,7 @@ LBSSolver::AssembleTGDSADeltaPhiVector(const LBSGroupset& groupset,
   {
     const auto& cell_mapping = sdm.GetCellMapping(cell);
     const size_t num_nodes = cell_mapping.NumNodes();
-    const auto& S = matid_to_xs_map_[cell.material_id_]->TransferMatrix(0);
+    const auto& S = cell_transport_views_[cell.local_id_].XS().TransferMatrix(0);
 
     for (size_t i = 0; i < num_nodes; ++i)
     {
@@ -2672,9 +3007,9 @@ LBSSolver::UpdateFieldFunctions()
 
       const auto& Vi = unit_cell_matrices_[cell.local_id_].intV_shapeI;
 
-      const auto& xs = matid_to_xs_map_.at(cell.material_id_);
+      const auto& xs = cell_transport_views_[cell.local_id_].XS();
 
-      if (not xs->IsFissionable())
+      if (not xs.IsFissionable())
         continue;
 
       for (size_t i = 0; i < num_nodes; ++i)
@@ -2685,8 +3020,8 @@ LBSSolver::UpdateFieldFunctions()
         double nodal_power = 0.0;
         for (size_t g = 0; g < groups_.size(); ++g)
         {
-          const double sigma_fg = xs->SigmaFission()[g];
-          // const double kappa_g = xs->Kappa()[g];
+          const double sigma_fg = xs.SigmaFission()[g];
+          // const double kappa_g = xs.Kappa()[g];
           const double kappa_g = options_.power_default_kappa;
 
           nodal_power += kappa_g * sigma_fg * phi_old_local_[imapB + g];
@@ -158,7 +158,7 @@ public:
   /**
    * Returns read-only access to the unit cell matrices.
    */
-  const std::vector<UnitCellMatrices>& GetUnitCellMatrices() const;
+  const UnitCellMatricesList& GetUnitCellMatrices() const;
 
   /**
    * Returns read-only access to the unit ghost cell matrices.
@@ -260,6 +260,28 @@ public:
    */
   const std::vector<double>& DensitiesLocal() const;
 
+  /**
+   * Sets the temperatures, and optionally the densities, of the local cells. Cells whose
+   * material has temperature-tabulated cross sections are assigned cross sections interpolated
+   * at the cell temperature. Interpolated cross sections are cached and shared by all cells with
+   * the same material and temperature, and only cells whose temperature changed are
+   * re-evaluated. Cross-section based operators of the acceleration methods are not rebuilt.
+   */
+  void SetCellTemperatures(const std::vector<double>& temperatures,
+                           const std::vector<double>& densities = {});
+
+  /**
+   * Read access to the cell-wise temperatures. Empty if the temperatures were never set.
+   */
+  const std::vector<double>& CellTemperaturesLocal() const;
+
+  /**
+   * Registers the current memory usage of the solver's subsystems with the MemoryRegistry and
+   * prints the per-rank usage and a min/max/avg summary over all ranks. Must be called on all
+   * ranks.
+   */
+  void PrintMemoryReport() const;
+
   /**
    * Returns the sweep boundaries as a read only reference
    */
@@ -267,6 +289,12 @@ public:
 
   SetSourceFunction GetActiveSetSourceFunction() const;
 
+  /**
+   * Replaces the active set source function. The within-group solvers refer to the active
+   * function, so the replacement takes effect without rebuilding them.
+   */
+  void SetActiveSetSourceFunction(SetSourceFunction source_function);
+
   std::shared_ptr<AGSLinearSolver> GetPrimaryAGSSolver();
 
   std::vector<std::shared_ptr<LinearSolver>>& GetWGSSolvers();
@@ -510,6 +538,18 @@ protected:
 
   void ComputeUnitIntegrals();
 
+  /**
+   * Uses the spatial discretization and the unit cell matrices of another, initialized solver
+   * on the same grid instead of building new ones.
+   */
+  void ShareSpatialDiscretization(const LBSSolver& other);
+
+  /**
+   * Makes a key that is identical for cells with the same shape, size, and node/face ordering,
+   * i.e. cells whose unit integrals are identical under a uniform spatial weight.
+   */
+  std::vector<int64_t> MakeCongruentCellKey(const Cell& cell) const;
+
   /**
    * Initializes common groupset items.
    */
@@ -534,9 +574,23 @@ protected:
 
   virtual void InitializeWGSSolvers(){};
 
+  /**
+   * Registers the memory usage of the flux moments, angular fluxes, sources, unit cell
+   * matrices, mesh, boundaries and diffusion acceleration matrices with the MemoryRegistry
+   * under categories prefixed by the solver name.
+   */
+  virtual void ReportMemoryUsage() const;
+
   /**Initializes the Within-Group DSA solver. */
   void InitTGDSA(LBSGroupset& groupset);
 
+  /**
+   * Makes a groupset use the WGDSA solver of a groupset of another solver with the same groups,
+   * cross sections, boundary types and WGDSA options, i.e. the same diffusion operator. Returns
+   * false, leaving the groupset unchanged, when the other solver has no such groupset.
+   */
+  bool ShareWGDSA(LBSGroupset& groupset, const LBSSolver& other);
+
   lbs::Options options_;
   size_t last_restart_write_time_ = 0;
   size_t num_moments_ = 0;
@@ -560,7 +614,7 @@ protected:
   std::shared_ptr<MPICommunicatorSet> grid_local_comm_set_ = nullptr;
   std::shared_ptr<GridFaceHistogram> grid_face_histogram_ = nullptr;
 
-  std::vector<UnitCellMatrices> unit_cell_matrices_;
+  UnitCellMatricesList unit_cell_matrices_;
   std::map<uint64_t, UnitCellMatrices> unit_ghost_cell_matrices_;
   std::vector<lbs::CellLBSView> cell_transport_views_;
 
@@ -578,6 +632,10 @@ protected:
   std::vector<std::vector<double>> psi_new_local_;
   std::vector<double> precursor_new_local_;
   std::vector<double> densities_local_;
+  std::vector<double> cell_temperatures_local_;
+
+  /// Cross sections interpolated at cell temperatures, keyed by material id and temperature
+  std::map<std::pair<int, double>, std::shared_ptr<MultiGroupXS>> interpolated_xs_cache_;
 
   SetSourceFunction active_set_source_function_;
 
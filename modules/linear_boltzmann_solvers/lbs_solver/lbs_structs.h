@@ -6,8 +6,10 @@
 #include "framework/materials/multi_group_xs/multi_group_xs.h"
 #include "framework/materials/isotropic_multigroup_source.h"
 #include "framework/math/math.h"
+#include "framework/utils/memory_registry.h"
 #include <functional>
 #include <map>
+#include <memory>
 
 namespace opensn
 {
@@ -72,11 +74,13 @@ enum class BoundaryType
   ARBITRARY = 4   ///< Complex different for each angle and face node
 };
 
+class BoundaryFunction;
+
 struct BoundaryPreference
 {
   BoundaryType type;
   std::vector<double> isotropic_mg_source;
-  std::string source_function;
+  std::shared_ptr<BoundaryFunction> function; ///< Incident fluxes of arbitrary boundaries
 };
 
 enum SourceType
@@ -340,6 +344,70 @@ struct UnitCellMatrices
   std::vector<std::vector<double>> intS_shapeI;
 };
 
+/**
+ * Unit cell matrices of the local cells, indexed by cell local id. Cells with identical geometry,
+ * such as the congruent cells of an orthogonal mesh, share a single stored entry. Copies of a list
+ * share its entries, which lets solvers on the same discretization use one set of matrices.
+ */
+class UnitCellMatricesList
+{
+public:
+  const UnitCellMatrices& operator[](size_t local_id) const
+  {
+    return (*entries_)[(*entry_ids_)[local_id]];
+  }
+  const UnitCellMatrices& at(size_t local_id) const
+  {
+    return entries_->at(entry_ids_->at(local_id));
+  }
+
+  /// Number of cells.
+  size_t size() const { return entry_ids_->size(); }
+  /// Number of distinct entries actually stored.
+  size_t NumUniqueEntries() const { return entries_->size(); }
+
+  /// Clears the list and sizes it for `num_cells` cells. Copies made before keep the old entries.
+  void Resize(size_t num_cells)
+  {
+    entries_ = std::make_shared<std::vector<UnitCellMatrices>>();
+    entry_ids_ = std::make_shared<std::vector<size_t>>(num_cells, 0);
+  }
+
+  /// Stores new matrices for a cell and returns the id of the new entry.
+  size_t Set(size_t local_id, UnitCellMatrices&& matrices)
+  {
+    entries_->push_back(std::move(matrices));
+    (*entry_ids_)[local_id] = entries_->size() - 1;
+    return (*entry_ids_)[local_id];
+  }
+
+  /// Makes a cell share an existing entry.
+  void Share(size_t local_id, size_t entry_id) { (*entry_ids_)[local_id] = entry_id; }
+
+  /// Returns the heap memory held by the list. Shared entries are counted once.
+  MemoryUsage ComputeMemoryUsage() const
+  {
+    MemoryUsage usage = GetMemoryUsage(*entries_);
+    usage += GetMemoryUsage(*entry_ids_);
+    for (const auto& entry : *entries_)
+    {
+      usage += GetMemoryUsage(entry.intV_gradshapeI_gradshapeJ);
+      usage += GetMemoryUsage(entry.intV_shapeI_gradshapeJ);
+      usage += GetMemoryUsage(entry.intV_shapeI_shapeJ);
+      usage += GetMemoryUsage(entry.intV_shapeI);
+      usage += GetMemoryUsage(entry.intS_shapeI_shapeJ);
+      usage += GetMemoryUsage(entry.intS_shapeI_gradshapeJ);
+      usage += GetMemoryUsage(entry.intS_shapeI);
+    }
+    return usage;
+  }
+
+private:
+  std::shared_ptr<std::vector<UnitCellMatrices>> entries_ =
+    std::make_shared<std::vector<UnitCellMatrices>>();
+  std::shared_ptr<std::vector<size_t>> entry_ids_ = std::make_shared<std::vector<size_t>>();
+};
+
 enum class AGSSchemeEntryType
 {
   GROUPSET_ID = 1,
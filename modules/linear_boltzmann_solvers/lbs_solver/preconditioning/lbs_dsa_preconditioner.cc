@@ -6,12 +6,98 @@
 #include "modules/linear_boltzmann_solvers/lbs_solver/lbs_solver.h"
 #include "modules/linear_boltzmann_solvers/lbs_solver/acceleration/diffusion_mip_solver.h"
 #include "modules/linear_boltzmann_solvers/lbs_solver/iterative_methods/wgs_context.h"
+#include "framework/math/spatial_discretization/spatial_discretization.h"
+#include "framework/mesh/mesh_continuum/mesh_continuum.h"
 
 namespace opensn
 {
 namespace lbs
 {
 
+namespace
+{
+
+/**Adds to the right-hand side of a groupset diffusion solve the zeroth-moment scattering of
+ * `phi` from the groups flagged in `source_groups`. When `collapsed` is true the right-hand side
+ * has the TGDSA layout (one unknown per node), otherwise the WGDSA layout.*/
+void
+AddCrossGroupsetScatter(const LBSSolver& lbs_solver,
+                        const LBSGroupset& groupset,
+                        const std::vector<double>& phi,
+                        const std::vector<bool>& source_groups,
+                        bool collapsed,
+                        std::vector<double>& rhs)
+{
+  const auto& sdm = lbs_solver.SpatialDiscretization();
+  const auto& cell_transport_views = lbs_solver.GetCellTransportViews();
+
+  const int gsi = groupset.groups_.front().id_;
+  const size_t gss = groupset.groups_.size();
+
+  for (const auto& cell : lbs_solver.Grid().local_cells)
+  {
+    const auto& transport_view = cell_transport_views[cell.local_id_];
+    const auto& S = transport_view.XS().TransferMatrix(0);
+
+    for (int i = 0; i < transport_view.NumNodes(); ++i)
+    {
+      const size_t phi_map = transport_view.MapDOF(i, 0, 0);
+      const int64_t rhs_map =
+        collapsed ? sdm.MapDOFLocal(cell, i)
+                  : sdm.MapDOFLocal(cell, i, groupset.wgdsa_solver_->UnknownStructure(), 0, 0);
+
+      for (size_t g = 0; g < gss; ++g)
+      {
+        double value = 0.0;
+        for (const auto& [row_g, gprime, sigma_sm] : S.Row(gsi + g))
+          if (source_groups[gprime])
+            value += sigma_sm * phi[phi_map + gprime];
+
+        rhs[collapsed ? rhs_map : rhs_map + g] += value;
+      } // for g
+    }   // for node
+  }     // for cell
+}
+
+/**Copies the zeroth moment of the groupset groups of `source` into the right-hand side of a
+ * groupset diffusion solve, summing over the groups when `collapsed` is true.*/
+void
+AssembleDiffusionSource(const LBSSolver& lbs_solver,
+                        const LBSGroupset& groupset,
+                        const std::vector<double>& source,
+                        bool collapsed,
+                        std::vector<double>& rhs)
+{
+  const auto& sdm = lbs_solver.SpatialDiscretization();
+  const auto& cell_transport_views = lbs_solver.GetCellTransportViews();
+
+  const int gsi = groupset.groups_.front().id_;
+  const size_t gss = groupset.groups_.size();
+
+  if (collapsed)
+    rhs.assign(sdm.GetNumLocalDOFs(sdm.UNITARY_UNKNOWN_MANAGER), 0.0);
+  else
+    rhs.assign(sdm.GetNumLocalDOFs(groupset.wgdsa_solver_->UnknownStructure()), 0.0);
+
+  for (const auto& cell : lbs_solver.Grid().local_cells)
+  {
+    const auto& transport_view = cell_transport_views[cell.local_id_];
+
+    for (int i = 0; i < transport_view.NumNodes(); ++i)
+    {
+      const size_t src_map = transport_view.MapDOF(i, 0, gsi);
+      const int64_t rhs_map =
+        collapsed ? sdm.MapDOFLocal(cell, i)
+                  : sdm.MapDOFLocal(cell, i, groupset.wgdsa_solver_->UnknownStructure(), 0, 0);
+
+      for (size_t g = 0; g < gss; ++g)
+        rhs[collapsed ? rhs_map : rhs_map + g] += source[src_map + g];
+    } // for node
+  }   // for cell
+}
+
+} // namespace
+
 int
 WGDSA_TGDSA_PreConditionerMult(PC pc, Vec phi_input, Vec pc_output)
 {
@@ -97,5 +183,110 @@ WGDSA_TGDSA_PreConditionerMult2(WGSContext& gs_context_ptr, Vec phi_input, Vec p
   return 0;
 }
 
+void
+MultiGroupsetDSAMult(LBSSolver& lbs_solver,
+                     const std::vector<int>& groupset_ids,
+                     std::vector<double>& phi)
+{
+  // Groups whose corrected fluxes scatter into the groupsets that follow
+  std::vector<bool> corrected_groups(lbs_solver.NumGroups(), false);
+
+  for (int gs_id : groupset_ids)
+  {
+    auto& groupset = lbs_solver.Groupsets().at(gs_id);
+
+    // The scattering from the groupsets already corrected is added to the first diffusion solve
+    // of the groupset.
+    bool chained = false;
+    if (groupset.apply_wgdsa_)
+    {
+      std::vector<double> delta_phi_local;
+      lbs_solver.AssembleWGDSADeltaPhiVector(groupset, phi, delta_phi_local);
+      AddCrossGroupsetScatter(lbs_solver, groupset, phi, corrected_groups, false, delta_phi_local);
+      chained = true;
+
+      groupset.wgdsa_solver_->Assemble_b(delta_phi_local);
+      groupset.wgdsa_solver_->Solve(delta_phi_local);
+
+      lbs_solver.DisAssembleWGDSADeltaPhiVector(groupset, delta_phi_local, phi);
+    }
+    if (groupset.apply_tgdsa_)
+    {
+      std::vector<double> delta_phi_local;
+      lbs_solver.AssembleTGDSADeltaPhiVector(groupset, phi, delta_phi_local);
+      if (not chained)
+        AddCrossGroupsetScatter(lbs_solver, groupset, phi, corrected_groups, true, delta_phi_local);
+
+      groupset.tgdsa_solver_->Assemble_b(delta_phi_local);
+      groupset.tgdsa_solver_->Solve(delta_phi_local);
+
+      lbs_solver.DisAssembleTGDSADeltaPhiVector(groupset, delta_phi_local, phi);
+    }
+
+    for (const auto& group : groupset.groups_)
+      corrected_groups[group.id_] = true;
+  }
+}
+
+int
+MultiGroupsetDSAPreConditionerMult(LBSSolver& lbs_solver,
+                                   const std::vector<int>& groupset_ids,
+                                   Vec phi_input,
+                                   Vec pc_output)
+{
+  // Copy PETSc vector to STL
+  auto& phi_new_local = lbs_solver.PhiNewLocal();
+  lbs_solver.SetPrimarySTLvectorFromMultiGSPETScVecFrom(
+    groupset_ids, phi_input, PhiSTLOption::PHI_NEW);
+
+  MultiGroupsetDSAMult(lbs_solver, groupset_ids, phi_new_local);
+
+  // Copy STL vector to PETSc Vec
+  lbs_solver.SetMultiGSPETScVecFromPrimarySTLvector(groupset_ids, pc_output, PhiSTLOption::PHI_NEW);
+
+  return 0;
+}
+
+void
+MultiGroupsetDiffusionSolve(LBSSolver& lbs_solver,
+                            const std::vector<int>& groupset_ids,
+                            const std::vector<double>& source,
+                            std::vector<double>& phi)
+{
+  // The solutions of the groupsets already processed. Groups of the groupsets that follow are
+  // zero and do not contribute to the scattering sources.
+  std::vector<double> solution(phi.size(), 0.0);
+  std::vector<bool> solved_groups(lbs_solver.NumGroups(), false);
+
+  for (int gs_id : groupset_ids)
+  {
+    auto& groupset = lbs_solver.Groupsets().at(gs_id);
+
+    if (groupset.apply_wgdsa_ or groupset.apply_tgdsa_)
+    {
+      const bool collapsed = not groupset.apply_wgdsa_;
+      auto& diffusion_solver = collapsed ? *groupset.tgdsa_solver_ : *groupset.wgdsa_solver_;
+
+      std::vector<double> rhs;
+      AssembleDiffusionSource(lbs_solver, groupset, source, collapsed, rhs);
+      AddCrossGroupsetScatter(lbs_solver, groupset, solution, solved_groups, collapsed, rhs);
+
+      diffusion_solver.Assemble_b(rhs);
+      diffusion_solver.Solve(rhs);
+
+      if (collapsed)
+        lbs_solver.DisAssembleTGDSADeltaPhiVector(groupset, rhs, solution);
+      else
+        lbs_solver.DisAssembleWGDSADeltaPhiVector(groupset, rhs, solution);
+    }
+
+    for (const auto& group : groupset.groups_)
+      solved_groups[group.id_] = true;
+  }
+
+  for (size_t i = 0; i < phi.size(); ++i)
+    phi[i] += solution[i];
+}
+
 } // namespace lbs
 } // namespace opensn
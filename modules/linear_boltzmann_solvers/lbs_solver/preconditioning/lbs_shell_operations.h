@@ -7,6 +7,8 @@
 
 #include "modules/linear_boltzmann_solvers/lbs_solver/iterative_methods/wgs_context.h"
 
+#include <vector>
+
 namespace opensn
 {
 namespace lbs
@@ -17,5 +19,24 @@ int WGDSA_TGDSA_PreConditionerMult(PC pc, Vec phi_input, Vec pc_output);
 int WGDSA_TGDSA_PreConditionerMult2(WGSContext& gs_context_ptr, Vec phi_input, Vec pc_output);
 /**Applies TGDSA to the given input vector.*/
 int MIP_TGDSA_PreConditionerMult(PC pc, Vec phi_input, Vec pc_output);
+
+/**Applies WGDSA or TGDSA, in place, to a primary STL vector spanning the given groupsets. The
+ * groupsets are processed in order and the scattering from the corrected fluxes of the groupsets
+ * already processed is added to the diffusion source of the next one.*/
+void MultiGroupsetDSAMult(LBSSolver& lbs_solver,
+                          const std::vector<int>& groupset_ids,
+                          std::vector<double>& phi);
+/**Applies WGDSA or TGDSA to an input vector spanning the given groupsets.*/
+int MultiGroupsetDSAPreConditionerMult(LBSSolver& lbs_solver,
+                                       const std::vector<int>& groupset_ids,
+                                       Vec phi_input,
+                                       Vec pc_output);
+/**Adds to `phi` the solution of the WGDSA (or, when absent, TGDSA) diffusion operators of the
+ * given groupsets for the zeroth moment of `source`, chained across groupsets through the
+ * scattering from the groupsets already solved. Groupsets without DSA are left unchanged.*/
+void MultiGroupsetDiffusionSolve(LBSSolver& lbs_solver,
+                                 const std::vector<int>& groupset_ids,
+                                 const std::vector<double>& source,
+                                 std::vector<double>& phi);
 } // namespace lbs
 } // namespace opensn
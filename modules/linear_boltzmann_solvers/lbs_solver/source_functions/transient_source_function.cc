@@ -2,6 +2,8 @@
 // SPDX-License-Identifier: MIT
 
 #include "modules/linear_boltzmann_solvers/lbs_solver/source_functions/transient_source_function.h"
+#include "modules/linear_boltzmann_solvers/lbs_solver/lbs_solver.h"
+#include "framework/mesh/mesh_continuum/mesh_continuum.h"
 
 namespace opensn
 {
@@ -15,24 +17,24 @@ TransientSourceFunction::TransientSourceFunction(const LBSSolver& lbs_solver,
 {
 }
 
+double
+TransientSourceFunction::Theta() const
+{
+  if (method_ == SteppingMethod::IMPLICIT_EULER)
+    return 1.0;
+  else if (method_ == SteppingMethod::CRANK_NICOLSON)
+    return 0.5;
+  else
+    return 0.7;
+}
+
 double
 TransientSourceFunction::AddDelayedFission(const PrecursorList& precursors,
                                            const double& rho,
                                            const std::vector<double>& nu_delayed_sigma_f,
                                            const double* phi) const
 {
-  const auto& BackwardEuler = SteppingMethod::IMPLICIT_EULER;
-  const auto& CrankNicolson = SteppingMethod::CRANK_NICOLSON;
-
-  double theta;
-  if (method_ == BackwardEuler)
-    theta = 1.0;
-  else if (method_ == CrankNicolson)
-    theta = 0.5;
-  else
-    theta = 0.7;
-
-  const double eff_dt = theta * dt_;
+  const double eff_dt = Theta() * dt_;
 
   double value = 0.0;
   if (apply_ags_fission_src_)
@@ -44,7 +46,7 @@ TransientSourceFunction::AddDelayedFission(const PrecursorList& precursors,
                                (1.0 + eff_dt * precursor.decay_constant);
 
           value += coeff * eff_dt * precursor.fractional_yield * rho * nu_delayed_sigma_f[gp] *
-                   phi[gp] / cell_volume_;
+                   phi[gp];
         }
 
   if (apply_wgs_fission_src_)
@@ -55,11 +57,59 @@ TransientSourceFunction::AddDelayedFission(const PrecursorList& precursors,
                              (1.0 + eff_dt * precursor.decay_constant);
 
         value += coeff * eff_dt * precursor.fractional_yield * rho * nu_delayed_sigma_f[gp] *
-                 phi[gp] / cell_volume_;
+                 phi[gp];
       }
 
   return value;
 }
 
+void
+TransientSourceFunction::AddAdditionalSources(const LBSGroupset& groupset,
+                                              std::vector<double>& q,
+                                              const std::vector<double>& phi,
+                                              const SourceFlags source_flags)
+{
+  SourceFunction::AddAdditionalSources(groupset, q, phi, source_flags);
+
+  if (not(source_flags & APPLY_FIXED_SOURCES) or not lbs_solver_.Options().use_precursors)
+    return;
+
+  const double eff_dt = Theta() * dt_;
+
+  const auto gs_i = groupset.groups_.front().id_;
+  const auto gs_f = groupset.groups_.back().id_;
+
+  const auto& cell_transport_views = lbs_solver_.GetCellTransportViews();
+  const auto& precursors_prev = lbs_solver_.PrecursorsNewLocal();
+  const auto J = lbs_solver_.MaxPrecursorsPerMaterial();
+
+  for (const auto& cell : lbs_solver_.Grid().local_cells)
+  {
+    const auto& transport_view = cell_transport_views[cell.local_id_];
+    const auto& xs = transport_view.XS();
+    if (not xs.IsFissionable())
+      continue;
+
+    const auto& precursors = xs.Precursors();
+    const double* cell_precursors = &precursors_prev[cell.local_id_ * J];
+
+    for (size_t i = 0; i < transport_view.NumNodes(); ++i)
+    {
+      const auto uk_map = transport_view.MapDOF(i, 0, 0);
+      for (size_t g = gs_i; g <= gs_f; ++g)
+      {
+        double value = 0.0;
+        for (size_t j = 0; j < xs.NumPrecursors(); ++j)
+        {
+          const auto& precursor = precursors[j];
+          value += precursor.emission_spectrum[g] * precursor.decay_constant *
+                   cell_precursors[j] / (1.0 + eff_dt * precursor.decay_constant);
+        }
+        q[uk_map + g] += value;
+      }
+    } // for node i
+  }   // for cell
+}
+
 } // namespace lbs
 } // namespace opensn
@@ -13,7 +13,14 @@ namespace lbs
 {
 
 /**A transient source function needs to adjust the AddDelayedFission
- * routine to properly fit with the current timestepping method and timestep.*/
+ * routine to properly fit with the current timestepping method and timestep.
+ *
+ * For a theta-scheme step the precursor concentrations at the intermediate
+ * time are eliminated, C_j = (C_j^n + theta dt beta_j nu_d sigma_f phi) /
+ * (1 + theta dt lambda_j). The phi-dependent part is added with the fission
+ * sources, the part due to C_j^n is added with the fixed sources. C_j^n is
+ * read from the solver's precursor vector, which therefore has to hold the
+ * concentrations at the start of the step.*/
 class TransientSourceFunction : public SourceFunction
 {
 private:
@@ -30,6 +37,16 @@ public:
                            const double& rho,
                            const std::vector<double>& nu_delayed_sigma_f,
                            const double* phi) const override;
+
+  /**Adds the point and distributed sources and the decay of the precursors
+   * present at the start of the step.*/
+  void AddAdditionalSources(const LBSGroupset& groupset,
+                            std::vector<double>& q,
+                            const std::vector<double>& phi,
+                            const SourceFlags source_flags) override;
+
+  /**Returns the theta of the current stepping method.*/
+  double Theta() const;
 };
 
 } // namespace lbs
@@ -0,0 +1,108 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#include "modules/linear_boltzmann_solvers/moc_solver/iterative_methods/moc_wgs_context.h"
+#include "modules/linear_boltzmann_solvers/moc_solver/lbs_moc_solver.h"
+#include "framework/runtime.h"
+#include "framework/logging/log.h"
+#include <petscksp.h>
+#include "caliper/cali.h"
+#include <chrono>
+
+namespace opensn
+{
+namespace lbs
+{
+
+MOCWGSContext::MOCWGSContext(MOCSolver& moc_solver,
+                             LBSGroupset& groupset,
+                             const SetSourceFunction& set_source_function,
+                             SourceFlags lhs_scope,
+                             SourceFlags rhs_scope,
+                             bool log_info)
+  : WGSContext(moc_solver, groupset, set_source_function, lhs_scope, rhs_scope, log_info),
+    moc_solver_(moc_solver)
+{
+}
+
+void
+MOCWGSContext::PreSetupCallback()
+{
+  CALI_CXX_MARK_SCOPE("MOCWGSContext::PreSetupCallback");
+
+  if (log_info_)
+    LogSolveHeader("Track segments per sweep: " +
+                   std::to_string(moc_solver_.NumSegmentsPerSweep(groupset_)) + "\n");
+}
+
+std::pair<int64_t, int64_t>
+MOCWGSContext::SystemSize()
+{
+  const size_t local_node_count = lbs_solver_.LocalNodeCount();
+  const size_t globl_node_count = lbs_solver_.GlobalNodeCount();
+  const size_t num_moments = lbs_solver_.NumMoments();
+
+  const size_t groupset_numgrps = groupset_.groups_.size();
+  const size_t local_size = local_node_count * num_moments * groupset_numgrps;
+  const size_t globl_size = globl_node_count * num_moments * groupset_numgrps;
+
+  return {static_cast<int64_t>(local_size), static_cast<int64_t>(globl_size)};
+}
+
+void
+MOCWGSContext::ApplyInverseTransportOperator(SourceFlags scope)
+{
+  CALI_CXX_MARK_SCOPE("MOCWGSContext::ApplyInverseTransportOperator");
+
+  ++counter_applications_of_inv_op_;
+  const bool use_bndry_source_flag =
+    (scope & APPLY_FIXED_SOURCES) and (not lbs_solver_.Options().use_src_moments);
+
+  const auto sweep_start = std::chrono::high_resolution_clock::now();
+  moc_solver_.Sweep(
+    groupset_, lbs_solver_.PhiNewLocal(), lbs_solver_.QMomentsLocal(), use_bndry_source_flag);
+  const auto sweep_end = std::chrono::high_resolution_clock::now();
+  sweep_times_.push_back(
+    std::chrono::duration_cast<std::chrono::nanoseconds>(sweep_end - sweep_start).count() /
+    1.0e+9);
+}
+
+void
+MOCWGSContext::PostSolveCallback()
+{
+  CALI_CXX_MARK_SCOPE("MOCWGSContext::PostSolveCallback");
+
+  // Perform a final sweep with the converged phi so that the flux moments are cell averages
+  // again after the Krylov update, which may add non-flat DSA corrections. Classic Richardson
+  // already ends with a sweep.
+  if (groupset_.iterative_method_ != IterativeMethod::CLASSICRICHARDSON)
+  {
+    const auto scope = lhs_src_scope_ | rhs_src_scope_;
+    set_source_function_(groupset_,
+                         lbs_solver_.QMomentsLocal(),
+                         lbs_solver_.PhiOldLocal(),
+                         lbs_solver_.DensitiesLocal(),
+                         scope);
+    ApplyInverseTransportOperator(scope);
+    lbs_solver_.GSScopedCopyPrimarySTLvectors(
+      groupset_, PhiSTLOption::PHI_NEW, PhiSTLOption::PHI_OLD);
+  }
+
+  if (log_info_ and not sweep_times_.empty())
+  {
+    double tot_sweep_time = 0.0;
+    for (auto time : sweep_times_)
+      tot_sweep_time += time;
+    const double avg_sweep_time = tot_sweep_time / static_cast<double>(sweep_times_.size());
+    const size_t num_segment_unknowns =
+      moc_solver_.NumSegmentsPerSweep(groupset_) * groupset_.groups_.size();
+
+    log.Log() << "\n       Average sweep time (s):        " << avg_sweep_time
+              << "\n       Sweep Time/Segment (ns):       "
+              << avg_sweep_time * 1.0e9 / static_cast<double>(num_segment_unknowns)
+              << "\n       Number of segments per sweep:  " << num_segment_unknowns << "\n\n";
+  }
+}
+
+} // namespace lbs
+} // namespace opensn
@@ -0,0 +1,37 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "modules/linear_boltzmann_solvers/lbs_solver/iterative_methods/wgs_context.h"
+#include "modules/linear_boltzmann_solvers/lbs_solver/groupset/lbs_groupset.h"
+
+namespace opensn
+{
+namespace lbs
+{
+class MOCSolver;
+
+struct MOCWGSContext : public WGSContext
+{
+  MOCSolver& moc_solver_;
+  std::vector<double> sweep_times_;
+
+  MOCWGSContext(MOCSolver& moc_solver,
+                LBSGroupset& groupset,
+                const SetSourceFunction& set_source_function,
+                SourceFlags lhs_scope,
+                SourceFlags rhs_scope,
+                bool log_info);
+
+  void PreSetupCallback() override;
+
+  std::pair<int64_t, int64_t> SystemSize() override;
+
+  void ApplyInverseTransportOperator(SourceFlags scope) override;
+
+  void PostSolveCallback() override;
+};
+
+} // namespace lbs
+} // namespace opensn
@@ -0,0 +1,496 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#include "modules/linear_boltzmann_solvers/moc_solver/lbs_moc_solver.h"
+#include "modules/linear_boltzmann_solvers/moc_solver/iterative_methods/moc_wgs_context.h"
+#include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/boundary/sweep_boundary.h"
+#include "modules/linear_boltzmann_solvers/lbs_solver/iterative_methods/wgs_linear_solver.h"
+#include "modules/linear_boltzmann_solvers/lbs_solver/iterative_methods/classic_richardson.h"
+#include "modules/linear_boltzmann_solvers/lbs_solver/source_functions/source_function.h"
+#include "modules/linear_boltzmann_solvers/lbs_solver/groupset/lbs_groupset.h"
+#include "framework/mesh/mesh_continuum/mesh_continuum.h"
+#include "framework/math/quadratures/angular/angular_quadrature.h"
+#include "framework/logging/log.h"
+#include "framework/logging/log_exceptions.h"
+#include "framework/utils/memory_registry.h"
+#include "framework/object_factory.h"
+#include "framework/runtime.h"
+#include "caliper/cali.h"
+#include <cmath>
+
+namespace opensn
+{
+namespace lbs
+{
+
+OpenSnRegisterObjectInNamespace(lbs, MOCSolver);
+
+InputParameters
+MOCSolver::GetInputParameters()
+{
+  InputParameters params = LBSSolver::GetInputParameters();
+
+  params.SetClassName("MOCSolver");
+  params.SetDocGroup("lbs__LBSSolver");
+
+  params.ChangeExistingParamToOptional("name", "LBSMOCSolver");
+
+  params.AddOptionalParameter(
+    "track_spacing", 0.05, "Maximum perpendicular distance between the characteristic tracks.");
+
+  params.AddOptionalParameter("exponential_table_tolerance",
+                              1.0e-7,
+                              "Maximum absolute error of the tabulated exponentials.");
+
+  params.ConstrainParameterRange("track_spacing", AllowableRangeLowLimit::New(0.0, false));
+  params.ConstrainParameterRange("exponential_table_tolerance",
+                                 AllowableRangeLowLimit::New(0.0, false));
+
+  return params;
+}
+
+MOCSolver::MOCSolver(const InputParameters& params)
+  : LBSSolver(params),
+    track_spacing_(params.GetParamValue<double>("track_spacing")),
+    exponential_table_(params.GetParamValue<double>("exponential_table_tolerance"))
+{
+}
+
+MOCSolver::~MOCSolver()
+{
+  for (auto& groupset : groupsets_)
+  {
+    CleanUpWGDSA(groupset);
+    CleanUpTGDSA(groupset);
+  }
+}
+
+void
+MOCSolver::Initialize()
+{
+  CALI_CXX_MARK_SCOPE("MOCSolver::Initialize");
+
+  LBSSolver::Initialize();
+
+  OpenSnInvalidArgumentIf(grid_ptr_->Dimension() != 2,
+                          "The MOC solver only supports 2D Cartesian meshes.");
+  OpenSnInvalidArgumentIf(opensn::mpi_comm.size() != 1,
+                          "The MOC solver does not support domain decomposition yet. Run it on a "
+                          "single process.");
+  OpenSnInvalidArgumentIf(options_.save_angular_flux,
+                          "The MOC solver does not store angular fluxes.");
+
+  // Initialize source func
+  using namespace std::placeholders;
+  auto src_function = std::make_shared<SourceFunction>(*this);
+  active_set_source_function_ =
+    std::bind(&SourceFunction::operator(), src_function, _1, _2, _3, _4, _5);
+
+  InitializeTracking();
+  for (auto& groupset : groupsets_)
+  {
+    InitWGDSA(groupset);
+    InitTGDSA(groupset);
+  }
+  InitializeSolverSchemes();
+
+  PrintMemoryReport();
+}
+
+void
+MOCSolver::ReportMemoryUsage() const
+{
+  LBSSolver::ReportMemoryUsage();
+
+  MemoryUsage tracks;
+  for (const auto& [quadrature, tracking] : quadrature_tracking_map_)
+  {
+    tracks += tracking->tracks.ComputeMemoryUsage();
+    tracks += GetMemoryUsage(tracking->states);
+    tracks += GetMemoryUsage(tracking->chain_offsets);
+  }
+  MemoryRegistry::GetInstance().Set(TextName() + "/moc_tracks", tracks);
+}
+
+void
+MOCSolver::InitializeTracking()
+{
+  CALI_CXX_MARK_SCOPE("MOCSolver::InitializeTracking");
+
+  const auto& grid = *grid_ptr_;
+  std::vector<double> cell_volumes(grid.local_cells.size());
+  for (const auto& cell : grid.local_cells)
+    cell_volumes[cell.local_id_] = cell_transport_views_[cell.local_id_].Volume();
+
+  const auto bounding_box = grid.GetLocalBoundingBox();
+  const double tolerance =
+    1.0e-6 * std::max(bounding_box.second.x - bounding_box.first.x,
+                      bounding_box.second.y - bounding_box.first.y);
+
+  quadrature_tracking_map_.clear();
+  for (const auto& groupset : groupsets_)
+  {
+    const auto& quadrature = groupset.quadrature_;
+    if (quadrature_tracking_map_.count(quadrature) > 0)
+      continue;
+
+    auto tracking = std::make_shared<QuadratureTracking>();
+    const auto& omegas = quadrature->omegas_;
+    const size_t num_directions = omegas.size();
+
+    // Group the directions by their azimuthal angle modulo pi. Each group shares the tracks of
+    // one azimuth, directions with an angle above pi sweep them backwards.
+    std::vector<double> azimuthal_angles;
+    std::vector<size_t> direction_azimuth(num_directions);
+    std::vector<bool> direction_forward(num_directions);
+    tracking->inv_sin_theta.resize(num_directions);
+    for (size_t d = 0; d < num_directions; ++d)
+    {
+      const auto& omega = omegas[d];
+      const double sin_theta = std::sqrt(omega.x * omega.x + omega.y * omega.y);
+      OpenSnInvalidArgumentIf(sin_theta < 1.0e-12,
+                              "The MOC solver does not support directions normal to the "
+                              "xy-plane.");
+      tracking->inv_sin_theta[d] = 1.0 / sin_theta;
+
+      double alpha = std::atan2(omega.y, omega.x);
+      if (alpha < 0.0)
+        alpha += 2.0 * M_PI;
+      direction_forward[d] = alpha < M_PI;
+      if (not direction_forward[d])
+        alpha -= M_PI;
+
+      size_t a = 0;
+      while (a < azimuthal_angles.size() and std::fabs(azimuthal_angles[a] - alpha) > 1.0e-10)
+        ++a;
+      if (a == azimuthal_angles.size())
+        azimuthal_angles.push_back(alpha);
+      direction_azimuth[d] = a;
+    }
+
+    auto& tracks = tracking->tracks;
+    tracks = MakeCyclicTracks(grid, azimuthal_angles, track_spacing_, cell_volumes);
+
+    // Sweep states of every direction, one per track of its azimuth
+    std::vector<size_t> direction_state_offsets(num_directions + 1, 0);
+    for (size_t d = 0; d < num_directions; ++d)
+      direction_state_offsets[d + 1] =
+        direction_state_offsets[d] + tracks.azimuths[direction_azimuth[d]].num_tracks;
+    const size_t num_states = direction_state_offsets.back();
+
+    auto StateTrack = [&](size_t d, size_t state)
+    {
+      const auto& azimuth = tracks.azimuths[direction_azimuth[d]];
+      return azimuth.first_track + (state - direction_state_offsets[d]);
+    };
+    auto StateBoundary = [&](size_t d, size_t state, bool outgoing)
+    {
+      const auto& track = tracks.tracks[StateTrack(d, state)];
+      return (outgoing == direction_forward[d]) ? track.end_boundary_id : track.start_boundary_id;
+    };
+    auto IsReflecting = [this](uint64_t bid)
+    {
+      const auto boundary = sweep_boundaries_.find(bid);
+      OpenSnLogicalErrorIf(boundary == sweep_boundaries_.end() or
+                             boundary->second->Type() == BoundaryType::ARBITRARY,
+                           "The MOC solver only supports vacuum, isotropic and reflecting "
+                           "boundaries.");
+      return boundary->second->IsReflecting();
+    };
+
+    // Link each state leaving through a reflecting boundary to the state of the reflected
+    // direction starting at the same point
+    std::vector<size_t> next_state(num_states, num_states);
+    std::vector<size_t> state_direction(num_states);
+    for (size_t d = 0; d < num_directions; ++d)
+    {
+      for (size_t s = direction_state_offsets[d]; s < direction_state_offsets[d + 1]; ++s)
+      {
+        state_direction[s] = d;
+        if (not IsReflecting(StateBoundary(d, s, true)))
+          continue;
+
+        const auto& track = tracks.tracks[StateTrack(d, s)];
+        const auto& exit_point = direction_forward[d] ? track.end : track.start;
+        const auto& normal = direction_forward[d] ? track.end_normal : track.start_normal;
+        const Vector3 reflected_omega = omegas[d] - 2.0 * omegas[d].Dot(normal) * normal;
+
+        size_t rd = 0;
+        while (rd < num_directions and (omegas[rd] - reflected_omega).Norm() > 1.0e-8)
+          ++rd;
+        OpenSnLogicalErrorIf(rd == num_directions,
+                             "The angular quadrature has no reflected direction for direction " +
+                               std::to_string(d) + ".");
+
+        for (size_t rs = direction_state_offsets[rd]; rs < direction_state_offsets[rd + 1]; ++rs)
+        {
+          const auto& reflected_track = tracks.tracks[StateTrack(rd, rs)];
+          const auto& entry_point =
+            direction_forward[rd] ? reflected_track.start : reflected_track.end;
+          if ((entry_point - exit_point).Norm() < tolerance)
+          {
+            next_state[s] = rs;
+            break;
+          }
+        }
+        OpenSnLogicalErrorIf(next_state[s] == num_states,
+                             "No cyclic MOC track continues the track ending at " +
+                               exit_point.PrintStr() +
+                               ". Reflecting boundaries require a rectangular domain and an "
+                               "angular quadrature symmetric about the x- and y-axes.");
+      }
+    }
+
+    // Order the states in chains. Open chains start on non-reflecting boundaries, the remaining
+    // states form closed cycles through reflecting boundaries.
+    std::vector<bool> visited(num_states, false);
+    auto AddChain = [&](size_t first_state, bool is_cycle)
+    {
+      tracking->chain_offsets.push_back(tracking->states.size());
+      tracking->chain_is_cycle.push_back(is_cycle);
+      size_t s = first_state;
+      do
+      {
+        OpenSnLogicalErrorIf(visited[s], "Inconsistent MOC track links.");
+        visited[s] = true;
+        const size_t d = state_direction[s];
+        tracking->states.push_back({static_cast<uint32_t>(StateTrack(d, s)),
+                                    static_cast<uint32_t>(d),
+                                    static_cast<bool>(direction_forward[d])});
+        s = next_state[s];
+      } while (s != num_states and s != first_state);
+    };
+
+    for (size_t s = 0; s < num_states; ++s)
+      if (not IsReflecting(StateBoundary(state_direction[s], s, false)))
+        AddChain(s, false);
+    size_t num_cycles = 0;
+    for (size_t s = 0; s < num_states; ++s)
+      if (not visited[s])
+      {
+        AddChain(s, true);
+        ++num_cycles;
+      }
+    tracking->chain_offsets.push_back(tracking->states.size());
+
+    log.Log() << "MOC tracking: " << tracks.azimuths.size() << " azimuthal angles, "
+              << tracks.tracks.size() << " tracks, " << tracks.segment_cells.size()
+              << " segments, " << tracking->chain_offsets.size() - 1 - num_cycles
+              << " open chains and " << num_cycles << " cycles.";
+
+    quadrature_tracking_map_[quadrature] = tracking;
+  } // for groupset
+}
+
+size_t
+MOCSolver::NumSegmentsPerSweep(const LBSGroupset& groupset) const
+{
+  const auto& tracking = *quadrature_tracking_map_.at(groupset.quadrature_);
+
+  size_t num_segments = 0;
+  for (const auto& state : tracking.states)
+    num_segments += tracking.tracks.tracks[state.track].num_segments;
+  return num_segments;
+}
+
+void
+MOCSolver::InitializeWGSSolvers()
+{
+  CALI_CXX_MARK_SCOPE("MOCSolver::InitializeWGSSolvers");
+
+  wgs_solvers_.clear(); // this is required
+  for (auto& groupset : groupsets_)
+  {
+    auto moc_wgs_context_ptr = std::make_shared<MOCWGSContext>(
+      *this,
+      groupset,
+      active_set_source_function_,
+      APPLY_WGS_SCATTER_SOURCES | APPLY_WGS_FISSION_SOURCES,
+      APPLY_FIXED_SOURCES | APPLY_AGS_SCATTER_SOURCES | APPLY_AGS_FISSION_SOURCES,
+      options_.verbose_inner_iterations);
+
+    std::shared_ptr<LinearSolver> wgs_solver;
+    if (groupset.iterative_method_ == IterativeMethod::CLASSICRICHARDSON)
+      wgs_solver = std::make_shared<ClassicRichardson>(moc_wgs_context_ptr);
+    else
+      wgs_solver = std::make_shared<WGSLinearSolver>(moc_wgs_context_ptr);
+
+    wgs_solvers_.push_back(wgs_solver);
+  } // for groupset
+}
+
+void
+MOCSolver::Sweep(const LBSGroupset& groupset,
+                 std::vector<double>& destination_phi,
+                 const std::vector<double>& source_moments,
+                 bool apply_boundary_sources)
+{
+  CALI_CXX_MARK_SCOPE("MOCSolver::Sweep");
+
+  const auto& tracking = *quadrature_tracking_map_.at(groupset.quadrature_);
+  const auto& tracks = tracking.tracks;
+  const auto& m2d_op = groupset.quadrature_->GetMomentToDiscreteOperatorByDirection();
+  const auto& d2m_op = groupset.quadrature_->GetDiscreteToMomentOperatorByDirection();
+
+  const int gs_gi = groupset.groups_.front().id_;
+  const size_t gs_size = groupset.groups_.size();
+  const size_t num_moments = num_moments_;
+  const size_t cell_stride = num_moments * gs_size;
+  const size_t num_cells = grid_ptr_->local_cells.size();
+
+  // Flat sources, the cell averages of the source moments, and total cross sections
+  std::vector<double> cell_q(num_cells * cell_stride, 0.0);
+  std::vector<double> cell_sigma_t(num_cells * gs_size);
+  for (const auto& cell : grid_ptr_->local_cells)
+  {
+    const auto& transport_view = cell_transport_views_[cell.local_id_];
+    const auto& IntV_shapeI = unit_cell_matrices_[cell.local_id_].intV_shapeI;
+    const double inv_volume = 1.0 / transport_view.Volume();
+    double* q = &cell_q[cell.local_id_ * cell_stride];
+
+    for (int i = 0; i < transport_view.NumNodes(); ++i)
+    {
+      const double w = IntV_shapeI[i] * inv_volume;
+      for (size_t m = 0; m < num_moments; ++m)
+      {
+        const double* q_mom = &source_moments[transport_view.MapDOF(i, m, gs_gi)];
+        for (size_t g = 0; g < gs_size; ++g)
+          q[m * gs_size + g] += w * q_mom[g];
+      }
+    }
+
+    const auto& sigma_t = transport_view.XS().SigmaTotal();
+    const double rho = densities_local_[cell.local_id_];
+    for (size_t g = 0; g < gs_size; ++g)
+      cell_sigma_t[cell.local_id_ * gs_size + g] = rho * sigma_t[gs_gi + g];
+  }
+
+  std::vector<double> cell_phi(num_cells * cell_stride, 0.0);
+  std::vector<double> psi(gs_size);
+  std::vector<double> psi_incident(gs_size);
+  std::vector<double> attenuation(gs_size);
+  std::vector<double> q_dir(gs_size);
+
+  /**Lambda sweeping the segments of a state. The angular flux psi is transported along the
+   * state. The flux moments are tallied when `tally` is true and the attenuation factors of the
+   * groups are accumulated when `accumulated_attenuation` is not null.*/
+  auto SweepState = [&](const QuadratureTracking::SweepState& state,
+                        bool tally,
+                        double* accumulated_attenuation)
+  {
+    const auto& track = tracks.tracks[state.track];
+    const double spacing = tracks.azimuths[track.azimuth].spacing;
+    const double inv_sin_theta = tracking.inv_sin_theta[state.direction];
+    const double* m2d = &m2d_op[state.direction * num_moments];
+    const double* d2m = &d2m_op[state.direction * num_moments];
+
+    for (size_t k = 0; k < track.num_segments; ++k)
+    {
+      const size_t seg = track.first_segment + (state.forward ? k : track.num_segments - 1 - k);
+      const uint64_t c = tracks.segment_cells[seg];
+      const double length = tracks.segment_lengths[seg];
+      const double path_length = length * inv_sin_theta;
+      const double* q = &cell_q[c * cell_stride];
+      const double* sigma_t = &cell_sigma_t[c * gs_size];
+
+      // Discrete source of the direction, q = M2D * q_moms
+      q_dir.assign(gs_size, 0.0);
+      for (size_t m = 0; m < num_moments; ++m)
+        for (size_t g = 0; g < gs_size; ++g)
+          q_dir[g] += m2d[m] * q[m * gs_size + g];
+
+      for (size_t g = 0; g < gs_size; ++g)
+      {
+        // Flat-source characteristic solution, psi_out = psi_in - (psi_in - q/sigma) F(tau)
+        const double tau = sigma_t[g] * path_length;
+        double psi_avg;
+        if (tau > 1.0e-8)
+        {
+          const double F = exponential_table_(tau);
+          const double q_over_sigma = q_dir[g] / sigma_t[g];
+          const double delta_psi = (psi[g] - q_over_sigma) * F;
+          psi_avg = q_over_sigma + delta_psi / tau;
+          psi[g] -= delta_psi;
+          if (accumulated_attenuation)
+            accumulated_attenuation[g] *= 1.0 - F;
+        }
+        else
+        {
+          const double delta_psi = (q_dir[g] - sigma_t[g] * psi[g]) * path_length;
+          psi_avg = psi[g] + 0.5 * delta_psi;
+          psi[g] += delta_psi;
+          if (accumulated_attenuation)
+            accumulated_attenuation[g] *= 1.0 - tau;
+        }
+
+        if (tally)
+        {
+          double* phi = &cell_phi[c * cell_stride + g];
+          const double weight = spacing * length * psi_avg;
+          for (size_t m = 0; m < num_moments; ++m)
+            phi[m * gs_size] += d2m[m] * weight;
+        }
+      } // for g
+    }   // for segment
+  };
+
+  // Sweep the chains
+  const size_t num_chains = tracking.chain_offsets.size() - 1;
+  for (size_t ch = 0; ch < num_chains; ++ch)
+  {
+    const auto* chain_begin = tracking.states.data() + tracking.chain_offsets[ch];
+    const auto* chain_end = tracking.states.data() + tracking.chain_offsets[ch + 1];
+
+    if (tracking.chain_is_cycle[ch])
+    {
+      // The outgoing flux of a cycle is linear in its incident flux, psi_out = b + a psi_in, with
+      // a the attenuation around the cycle. Sweeping once without incident flux gives b and a,
+      // and the periodic incident flux is psi_in = b / (1 - a).
+      psi.assign(gs_size, 0.0);
+      attenuation.assign(gs_size, 1.0);
+      for (const auto* state = chain_begin; state != chain_end; ++state)
+        SweepState(*state, false, attenuation.data());
+      for (size_t g = 0; g < gs_size; ++g)
+        psi_incident[g] = attenuation[g] < 1.0 ? psi[g] / (1.0 - attenuation[g]) : 0.0;
+    }
+    else
+    {
+      psi_incident.assign(gs_size, 0.0);
+      if (apply_boundary_sources)
+      {
+        const auto& track = tracks.tracks[chain_begin->track];
+        const uint64_t bid =
+          chain_begin->forward ? track.start_boundary_id : track.end_boundary_id;
+        auto& boundary = *sweep_boundaries_.at(bid);
+        if (boundary.Type() == BoundaryType::ISOTROPIC)
+        {
+          const double* psi_bndry = boundary.PsiIncoming(0, 0, 0, 0, gs_gi, 0);
+          psi_incident.assign(psi_bndry, psi_bndry + gs_size);
+        }
+      }
+    }
+
+    psi = psi_incident;
+    for (const auto* state = chain_begin; state != chain_end; ++state)
+      SweepState(*state, true, nullptr);
+  } // for chain
+
+  // Store the cell averaged flux moments at every node of the cell
+  for (const auto& cell : grid_ptr_->local_cells)
+  {
+    const auto& transport_view = cell_transport_views_[cell.local_id_];
+    const double inv_volume = 1.0 / transport_view.Volume();
+    const double* phi = &cell_phi[cell.local_id_ * cell_stride];
+
+    for (int i = 0; i < transport_view.NumNodes(); ++i)
+      for (size_t m = 0; m < num_moments; ++m)
+      {
+        double* phi_mom = &destination_phi[transport_view.MapDOF(i, m, gs_gi)];
+        for (size_t g = 0; g < gs_size; ++g)
+          phi_mom[g] = phi[m * gs_size + g] * inv_volume;
+      }
+  }
+}
+
+} // namespace lbs
+} // namespace opensn
@@ -0,0 +1,95 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "modules/linear_boltzmann_solvers/lbs_solver/lbs_solver.h"
+#include "modules/linear_boltzmann_solvers/moc_solver/moc_tracks.h"
+#include "modules/linear_boltzmann_solvers/moc_solver/moc_exponential_table.h"
+
+namespace opensn
+{
+namespace lbs
+{
+
+/**
+ * Flat-source method of characteristics solver for 2D Cartesian problems.
+ *
+ * Cyclic tracks are laid down once per angular quadrature and the groupset directions are swept
+ * along them with tabulated exponentials. The sources, flux moments and iterative schemes are
+ * the ones of LBSSolver: a sweep uses the cell averages of the source moments and stores the
+ * cell averaged flux moments at every node of the cell. Reflecting boundaries link the tracks
+ * into closed cycles whose incident fluxes are solved for exactly in every sweep, so the sweep
+ * is a linear operator of the source without lagged angular fluxes.
+ */
+class MOCSolver : public LBSSolver
+{
+public:
+  explicit MOCSolver(const InputParameters& params);
+  ~MOCSolver() override;
+
+  void Initialize() override;
+
+  /**
+   * Sweeps all directions of a groupset along the tracks of its quadrature and overwrites the
+   * flux moments of the groupset groups in `destination_phi`. The incident fluxes of isotropic
+   * boundaries are only applied when `apply_boundary_sources` is true.
+   */
+  void Sweep(const LBSGroupset& groupset,
+             std::vector<double>& destination_phi,
+             const std::vector<double>& source_moments,
+             bool apply_boundary_sources);
+
+  /**
+   * Returns the number of track segments a sweep of a groupset traverses per group, summed over
+   * the directions.
+   */
+  size_t NumSegmentsPerSweep(const LBSGroupset& groupset) const;
+
+protected:
+  /**
+   * Characteristic sweep data of an angular quadrature. A sweep state is a track swept in one
+   * direction of the quadrature. The states are ordered in chains, each starting on a
+   * non-reflecting boundary or forming a closed cycle through reflecting boundaries, in which
+   * every state continues the previous one.
+   */
+  struct QuadratureTracking
+  {
+    struct SweepState
+    {
+      uint32_t track = 0;
+      uint32_t direction = 0;
+      bool forward = true;
+    };
+
+    MOCTracks tracks;
+    std::vector<SweepState> states;
+    std::vector<size_t> chain_offsets;
+    std::vector<bool> chain_is_cycle;
+    /// Inverse in-plane projection, 1 / sin(theta), of every direction
+    std::vector<double> inv_sin_theta;
+  };
+
+  void InitializeWGSSolvers() override;
+
+  /**
+   * Additionally registers the memory of the tracks.
+   */
+  void ReportMemoryUsage() const override;
+
+  /**
+   * Lays down the tracks and builds the sweep chains of every groupset quadrature.
+   */
+  void InitializeTracking();
+
+  const double track_spacing_;
+  const MOCExponentialTable exponential_table_;
+  std::map<std::shared_ptr<AngularQuadrature>, std::shared_ptr<QuadratureTracking>>
+    quadrature_tracking_map_;
+
+public:
+  static InputParameters GetInputParameters();
+};
+
+} // namespace lbs
+} // namespace opensn
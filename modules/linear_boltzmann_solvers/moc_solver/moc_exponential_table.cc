@@ -0,0 +1,34 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#include "modules/linear_boltzmann_solvers/moc_solver/moc_exponential_table.h"
+#include "framework/logging/log_exceptions.h"
+
+namespace opensn
+{
+namespace lbs
+{
+
+MOCExponentialTable::MOCExponentialTable(double tolerance, double max_tau) : max_tau_(max_tau)
+{
+  OpenSnInvalidArgumentIf(tolerance <= 0.0, "The exponential table tolerance must be positive.");
+  OpenSnInvalidArgumentIf(max_tau <= 0.0, "The exponential table range must be positive.");
+
+  // The tangent error at distance h/2 from the midpoint is bounded by max|F''| h^2/8 with
+  // max|F''| = 1
+  const auto num_intervals = static_cast<size_t>(std::ceil(max_tau / std::sqrt(8.0 * tolerance)));
+  spacing_ = max_tau / static_cast<double>(num_intervals);
+  inv_spacing_ = 1.0 / spacing_;
+
+  coefficients_.resize(2 * num_intervals);
+  for (size_t i = 0; i < num_intervals; ++i)
+  {
+    const double tau_mid = (static_cast<double>(i) + 0.5) * spacing_;
+    const double exp_mid = std::exp(-tau_mid);
+    coefficients_[2 * i] = exp_mid;
+    coefficients_[2 * i + 1] = 1.0 - exp_mid - exp_mid * tau_mid;
+  }
+}
+
+} // namespace lbs
+} // namespace opensn
@@ -0,0 +1,46 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace opensn
+{
+namespace lbs
+{
+
+/**
+ * Tabulated attenuation factor F(tau) = 1 - exp(-tau) of the characteristic segment sweeps.
+ * Between the table points F is replaced by its tangent at the interval midpoint, which keeps
+ * the absolute error below the requested tolerance. Optical thicknesses inside the first
+ * interval or beyond the table are evaluated exactly.
+ */
+class MOCExponentialTable
+{
+public:
+  explicit MOCExponentialTable(double tolerance = 1.0e-7, double max_tau = 10.0);
+
+  double operator()(double tau) const
+  {
+    if (tau < spacing_ or tau >= max_tau_)
+      return -std::expm1(-tau);
+
+    const auto i = std::min(static_cast<size_t>(tau * inv_spacing_), NumIntervals() - 1);
+    return coefficients_[2 * i] * tau + coefficients_[2 * i + 1];
+  }
+
+  size_t NumIntervals() const { return coefficients_.size() / 2; }
+
+private:
+  double max_tau_;
+  double spacing_;
+  double inv_spacing_;
+  /// Slope and intercept of the tangent of every interval
+  std::vector<double> coefficients_;
+};
+
+} // namespace lbs
+} // namespace opensn
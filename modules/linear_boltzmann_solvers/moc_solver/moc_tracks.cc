@@ -0,0 +1,225 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#include "modules/linear_boltzmann_solvers/moc_solver/moc_tracks.h"
+#include "framework/mesh/mesh_continuum/mesh_continuum.h"
+#include "framework/mesh/raytrace/raytracer.h"
+#include "framework/mesh/cell/cell.h"
+#include "framework/logging/log_exceptions.h"
+#include "framework/logging/log.h"
+#include "framework/runtime.h"
+#include <algorithm>
+#include <cmath>
+
+namespace opensn
+{
+namespace lbs
+{
+
+MemoryUsage
+MOCTracks::ComputeMemoryUsage() const
+{
+  MemoryUsage usage = GetMemoryUsage(azimuths);
+  usage += GetMemoryUsage(tracks);
+  usage += GetMemoryUsage(segment_cells);
+  usage += GetMemoryUsage(segment_lengths);
+  return usage;
+}
+
+MOCTracks
+MakeCyclicTracks(const MeshContinuum& grid,
+                 const std::vector<double>& azimuthal_angles,
+                 double track_spacing,
+                 const std::vector<double>& cell_volumes)
+{
+  OpenSnInvalidArgumentIf(track_spacing <= 0.0, "The MOC track spacing must be positive.");
+
+  const auto bounding_box = grid.GetLocalBoundingBox();
+  const Vector3 xyz_min = bounding_box.first;
+  const Vector3 xyz_max = bounding_box.second;
+  const double width = xyz_max.x - xyz_min.x;
+  const double height = xyz_max.y - xyz_min.y;
+  const double tolerance = 1.0e-8 * std::max(width, height);
+
+  // Approximate cell sizes for the raytracer tolerances
+  const size_t num_local_cells = grid.local_cells.size();
+  std::vector<double> cell_sizes(num_local_cells, 0.0);
+  std::vector<const Cell*> boundary_cells;
+  for (const auto& cell : grid.local_cells)
+  {
+    Vector3 cell_min = grid.vertices[cell.vertex_ids_.front()];
+    Vector3 cell_max = cell_min;
+    for (const uint64_t vid : cell.vertex_ids_)
+    {
+      const auto& v = grid.vertices[vid];
+      cell_min = Vector3(std::min(cell_min.x, v.x), std::min(cell_min.y, v.y), 0.0);
+      cell_max = Vector3(std::max(cell_max.x, v.x), std::max(cell_max.y, v.y), 0.0);
+    }
+    cell_sizes[cell.local_id_] = (cell_max - cell_min).Norm();
+
+    for (const auto& face : cell.faces_)
+      if (not face.has_neighbor_)
+      {
+        boundary_cells.push_back(&cell);
+        break;
+      }
+  }
+
+  RayTracer ray_tracer(grid, cell_sizes);
+
+  /**Lambda returning the boundary face of a cell containing a point.*/
+  auto FindBoundaryFace = [&grid, tolerance](const Cell& cell, const Vector3& point)
+  {
+    for (const auto& face : cell.faces_)
+    {
+      if (face.has_neighbor_ or std::fabs(face.normal_.Dot(point - face.centroid_)) > tolerance)
+        continue;
+
+      const auto& v0 = grid.vertices[face.vertex_ids_.front()];
+      const auto& v1 = grid.vertices[face.vertex_ids_.back()];
+      const double s = (point - v0).Dot(v1 - v0) / (v1 - v0).NormSquare();
+      if (s >= -1.0e-10 and s <= 1.0 + 1.0e-10)
+        return &face;
+    }
+    return static_cast<const CellFace*>(nullptr);
+  };
+
+  MOCTracks tracks;
+
+  /**Lambda tracing a track from its start point on the boundary.*/
+  auto AddTrack = [&](size_t azimuth, const Vector3& start, const Vector3& omega)
+  {
+    // The end point is where the line leaves the bounding box
+    const double t_x =
+      omega.x > 0.0 ? (xyz_max.x - start.x) / omega.x : (xyz_min.x - start.x) / omega.x;
+    const double t_y = (xyz_max.y - start.y) / omega.y;
+    Vector3 end = start + std::min(t_x, t_y) * omega;
+    if (t_y <= t_x)
+      end.y = xyz_max.y;
+    else
+      end.x = omega.x > 0.0 ? xyz_max.x : xyz_min.x;
+
+    // Locate the cell the track enters
+    const Vector3 start_inside = start + tolerance * omega;
+    const Cell* cell = nullptr;
+    for (const auto* boundary_cell : boundary_cells)
+      if (grid.CheckPointInsideCell(*boundary_cell, start_inside))
+      {
+        cell = boundary_cell;
+        break;
+      }
+    OpenSnLogicalErrorIf(cell == nullptr,
+                         "No cell found at the start of MOC track " +
+                           std::to_string(tracks.tracks.size()) + " at " + start.PrintStr() + ".");
+    const auto* start_face = FindBoundaryFace(*cell, start);
+    OpenSnLogicalErrorIf(start_face == nullptr,
+                         "MOC track start " + start.PrintStr() +
+                           " is not on the domain boundary. The MOC solver requires a "
+                           "rectangular domain.");
+
+    MOCTracks::Track track;
+    track.azimuth = azimuth;
+    track.start = start;
+    track.end = end;
+    track.start_boundary_id = start_face->neighbor_id_;
+    track.start_normal = start_face->normal_;
+    track.first_segment = tracks.segment_cells.size();
+
+    // Trace the track through the cells
+    Vector3 position = start;
+    Vector3 direction = omega;
+    while (true)
+    {
+      auto trace = ray_tracer.TraceRay(*cell, position, direction);
+      OpenSnLogicalErrorIf(trace.particle_lost,
+                           "MOC track lost during ray tracing.\n" + trace.lost_particle_info);
+
+      if (trace.distance_to_surface > 0.0)
+      {
+        tracks.segment_cells.push_back(cell->local_id_);
+        tracks.segment_lengths.push_back(trace.distance_to_surface);
+      }
+      position = trace.pos_f;
+
+      const auto& face = cell->faces_[trace.destination_face_index];
+      if (not face.has_neighbor_)
+      {
+        OpenSnLogicalErrorIf((position - end).Norm() > 1.0e2 * tolerance,
+                             "MOC track from " + start.PrintStr() + " left the domain at " +
+                               position.PrintStr() + " instead of " + end.PrintStr() +
+                               ". The MOC solver requires a rectangular domain.");
+        track.end_boundary_id = face.neighbor_id_;
+        track.end_normal = face.normal_;
+        break;
+      }
+      cell = &grid.cells[face.neighbor_id_];
+    }
+    track.num_segments = tracks.segment_cells.size() - track.first_segment;
+    tracks.tracks.push_back(track);
+  };
+
+  // Lay down the tracks of every azimuthal angle. The numbers of tracks crossing the x- and
+  // y-axes fix the cyclic angle, tan(phi) = (height / ny) / (width / nx).
+  for (const double alpha : azimuthal_angles)
+  {
+    const double nx = std::max(1.0, std::ceil(width * std::fabs(std::sin(alpha)) / track_spacing));
+    const double ny = std::max(1.0, std::ceil(height * std::fabs(std::cos(alpha)) / track_spacing));
+    const double dx = width / nx;
+    const double dy = height / ny;
+
+    double phi = std::atan(dy / dx);
+    if (alpha > M_PI_2)
+      phi = M_PI - phi;
+    const Vector3 omega(std::cos(phi), std::sin(phi), 0.0);
+
+    MOCTracks::Azimuth azimuth;
+    azimuth.phi = phi;
+    azimuth.spacing = dx * std::sin(phi);
+    azimuth.first_track = tracks.tracks.size();
+
+    const size_t a = tracks.azimuths.size();
+    for (int i = 0; i < static_cast<int>(nx); ++i)
+      AddTrack(a, Vector3(xyz_min.x + (i + 0.5) * dx, xyz_min.y, 0.0), omega);
+    const double x_side = phi < M_PI_2 ? xyz_min.x : xyz_max.x;
+    for (int j = 0; j < static_cast<int>(ny); ++j)
+      AddTrack(a, Vector3(x_side, xyz_min.y + (j + 0.5) * dy, 0.0), omega);
+
+    azimuth.num_tracks = tracks.tracks.size() - azimuth.first_track;
+    tracks.azimuths.push_back(azimuth);
+  }
+
+  // Renormalize the segment lengths such that the tracks of each azimuth integrate the cell
+  // volumes exactly
+  size_t num_missed_cells = 0;
+  std::vector<double> track_volumes(num_local_cells);
+  for (const auto& azimuth : tracks.azimuths)
+  {
+    const size_t segments_begin = tracks.tracks[azimuth.first_track].first_segment;
+    const auto& last_track = tracks.tracks[azimuth.first_track + azimuth.num_tracks - 1];
+    const size_t segments_end = last_track.first_segment + last_track.num_segments;
+
+    track_volumes.assign(num_local_cells, 0.0);
+    for (size_t s = segments_begin; s < segments_end; ++s)
+      track_volumes[tracks.segment_cells[s]] += azimuth.spacing * tracks.segment_lengths[s];
+
+    for (size_t s = segments_begin; s < segments_end; ++s)
+    {
+      const uint64_t c = tracks.segment_cells[s];
+      tracks.segment_lengths[s] *= cell_volumes[c] / track_volumes[c];
+    }
+
+    for (const double volume : track_volumes)
+      if (volume == 0.0)
+        ++num_missed_cells;
+  }
+
+  if (num_missed_cells > 0)
+    log.Log0Warning() << "MOC tracking: " << num_missed_cells
+                      << " (cell, azimuth) pairs are not crossed by any track. Reduce the track "
+                         "spacing.";
+
+  return tracks;
+}
+
+} // namespace lbs
+} // namespace opensn
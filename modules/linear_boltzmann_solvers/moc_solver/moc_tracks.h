@@ -0,0 +1,71 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "framework/mesh/mesh.h"
+#include "framework/utils/memory_registry.h"
+#include <vector>
+
+namespace opensn
+{
+class MeshContinuum;
+
+namespace lbs
+{
+
+/**
+ * Cyclic characteristic tracks of a rectangular 2D domain.
+ *
+ * The tracks of an azimuthal angle are parallel and equally spaced. Angles below pi/2 start
+ * tracks on the bottom and left edges of the domain, angles above pi/2 on the bottom and right
+ * edges. Every track ends exactly where a track of the reflected angle starts, so that
+ * reflecting boundaries connect the tracks into closed cycles. The segments of all tracks are
+ * stored in flat arrays, track after track, in the forward direction of the track.
+ */
+struct MOCTracks
+{
+  struct Azimuth
+  {
+    double phi = 0.0;     ///< Cyclic azimuthal angle in (0, pi)
+    double spacing = 0.0; ///< Perpendicular distance between the tracks
+    size_t first_track = 0;
+    size_t num_tracks = 0;
+  };
+
+  struct Track
+  {
+    size_t azimuth = 0;
+    Vector3 start;
+    Vector3 end;
+    uint64_t start_boundary_id = 0;
+    uint64_t end_boundary_id = 0;
+    Vector3 start_normal; ///< Outward normal of the boundary at the start
+    Vector3 end_normal;   ///< Outward normal of the boundary at the end
+    size_t first_segment = 0;
+    size_t num_segments = 0;
+  };
+
+  std::vector<Azimuth> azimuths;
+  std::vector<Track> tracks;
+  /// Local id of the cell crossed by each segment
+  std::vector<uint64_t> segment_cells;
+  /// In-plane length of each segment, corrected to preserve the cell volumes per azimuth
+  std::vector<double> segment_lengths;
+
+  MemoryUsage ComputeMemoryUsage() const;
+};
+
+/**
+ * Lays down cyclic tracks for the given azimuthal angles, in [0, pi), with a spacing of at most
+ * `track_spacing`. Each angle is adjusted to the nearest cyclic angle. The tracks are traced
+ * through the local cells with the RayTracer and the segment lengths of every azimuth are
+ * renormalized such that the tracks reproduce `cell_volumes`, indexed by local cell id.
+ */
+MOCTracks MakeCyclicTracks(const MeshContinuum& grid,
+                           const std::vector<double>& azimuthal_angles,
+                           double track_spacing,
+                           const std::vector<double>& cell_volumes);
+
+} // namespace lbs
+} // namespace opensn
@@ -165,6 +165,9 @@ Solver::Initialize()
     //                                                        ghost_dof_indices);
   }
 
+  // Shape function integrals shared by all groups
+  mg_diffusion::Solver::Compute_UnitCellIntegrals();
+
   if (do_two_grid_)
     mg_diffusion::Solver::Compute_TwoGrid_VolumeFractions();
 
@@ -196,6 +199,24 @@ Solver::Initialize()
   }   // if not ff set
 }
 
+void
+Solver::SetProperties(const ParameterBlock& params)
+{
+  opensn::Solver::SetProperties(params);
+
+  for (const auto& param : params)
+  {
+    if (param.Name() == "reassemble" and param.GetValue<bool>())
+    {
+      OpenSnLogicalErrorIf(not system_assembled_,
+                           TextName() + ": The solver must be initialized before reassembly.");
+      if (do_two_grid_)
+        Compute_TwoGrid_Params();
+      Assemble_A_bext();
+    }
+  }
+}
+
 void
 Solver::Initialize_Materials(std::set<int>& material_ids)
 {
@@ -413,12 +434,81 @@ Solver::Compute_TwoGrid_Params()
     //    chi::Exit(12345);
 
     const auto mat_id = mat_id_xs.first;
-    map_mat_id_2_tginfo.insert(
-      std::make_pair(mat_id, TwoGridCollapsedInfo{collapsed_D, collapsed_sig_a, spectrum}));
+    map_mat_id_2_tginfo.insert_or_assign(
+      mat_id, TwoGridCollapsedInfo{collapsed_D, collapsed_sig_a, spectrum});
 
   } // end loop over materials
 }
 
+void
+Solver::Compute_UnitCellIntegrals()
+{
+  const auto& grid = *grid_ptr_;
+  const auto& sdm = *sdm_ptr_;
+
+  unit_cell_integrals_.assign(grid.local_cells.size(), UnitCellIntegrals{});
+  for (const auto& cell : grid.local_cells)
+  {
+    const auto& cell_mapping = sdm.GetCellMapping(cell);
+    const auto fe_vol_data = cell_mapping.MakeVolumetricFiniteElementData();
+    const size_t num_nodes = cell_mapping.NumNodes();
+    auto& integrals = unit_cell_integrals_[cell.local_id_];
+
+    auto& K = integrals.intV_gradshapeI_gradshapeJ;
+    auto& M = integrals.intV_shapeI_shapeJ;
+    K.assign(num_nodes * num_nodes, 0.0);
+    M.assign(num_nodes * num_nodes, 0.0);
+    integrals.intV_shapeI.assign(num_nodes, 0.0);
+    for (size_t i = 0; i < num_nodes; ++i)
+    {
+      for (size_t j = 0; j < num_nodes; ++j)
+      {
+        for (size_t qp : fe_vol_data.QuadraturePointIndices())
+        {
+          M[i * num_nodes + j] +=
+            fe_vol_data.ShapeValue(i, qp) * fe_vol_data.ShapeValue(j, qp) * fe_vol_data.JxW(qp);
+
+          K[i * num_nodes + j] +=
+            fe_vol_data.ShapeGrad(i, qp).Dot(fe_vol_data.ShapeGrad(j, qp)) * fe_vol_data.JxW(qp);
+        } // for qp
+      }   // for j
+      for (size_t qp : fe_vol_data.QuadraturePointIndices())
+        integrals.intV_shapeI[i] += fe_vol_data.ShapeValue(i, qp) * fe_vol_data.JxW(qp);
+    } // for i
+
+    // Face integrals are only needed for the boundary conditions
+    const size_t num_faces = cell.faces_.size();
+    integrals.intS_shapeI_shapeJ.resize(num_faces);
+    integrals.intS_shapeI.resize(num_faces);
+    for (size_t f = 0; f < num_faces; ++f)
+    {
+      if (cell.faces_[f].has_neighbor_)
+        continue;
+
+      const auto fe_srf_data = cell_mapping.MakeSurfaceFiniteElementData(f);
+      const size_t num_face_nodes = cell_mapping.NumFaceNodes(f);
+      auto& face_M = integrals.intS_shapeI_shapeJ[f];
+      auto& face_intS = integrals.intS_shapeI[f];
+      face_M.assign(num_face_nodes * num_face_nodes, 0.0);
+      face_intS.assign(num_face_nodes, 0.0);
+      for (size_t fi = 0; fi < num_face_nodes; ++fi)
+      {
+        const uint i = cell_mapping.MapFaceNode(f, fi);
+        for (size_t qp : fe_srf_data.QuadraturePointIndices())
+          face_intS[fi] += fe_srf_data.ShapeValue(i, qp) * fe_srf_data.JxW(qp);
+
+        for (size_t fj = 0; fj < num_face_nodes; ++fj)
+        {
+          const uint j = cell_mapping.MapFaceNode(f, fj);
+          for (size_t qp : fe_srf_data.QuadraturePointIndices())
+            face_M[fi * num_face_nodes + fj] += fe_srf_data.ShapeValue(i, qp) *
+                                                fe_srf_data.ShapeValue(j, qp) * fe_srf_data.JxW(qp);
+        } // for fj
+      }   // for fi
+    }     // for f
+  }       // for cell
+}
+
 void
 Solver::Compute_TwoGrid_VolumeFractions()
 {
@@ -432,19 +522,13 @@ Solver::Compute_TwoGrid_VolumeFractions()
   for (const auto& cell : grid.local_cells)
   {
     const auto& cell_mapping = sdm.GetCellMapping(cell);
-    const auto fe_vol_data = cell_mapping.MakeVolumetricFiniteElementData();
+    const auto& intV_shapeI = unit_cell_integrals_[cell.local_id_].intV_shapeI;
     const size_t num_nodes = cell_mapping.NumNodes();
 
     VF_[counter].resize(num_nodes, 0.0);
 
     for (size_t i = 0; i < num_nodes; ++i)
-    {
-      double vol_frac_shape_i = 0.0;
-      for (size_t qp : fe_vol_data.QuadraturePointIndices())
-        vol_frac_shape_i += fe_vol_data.ShapeValue(i, qp) * fe_vol_data.JxW(qp);
-      vol_frac_shape_i /= cell_mapping.CellVolume();
-      VF_[counter][i] = vol_frac_shape_i;
-    } // for i
+      VF_[counter][i] = intV_shapeI[i] / cell_mapping.CellVolume();
 
     counter++;
   } // for cell
@@ -527,12 +611,36 @@ Solver::Assemble_A_bext()
 
   // Assemble the system
   unsigned int i_two_grid = do_two_grid_ ? 1 : 0;
+  const uint num_systems = num_groups_ + i_two_grid;
+
+  // Reassembly after a change of material data starts from empty systems
+  if (system_assembled_)
+  {
+    for (uint g = 0; g < num_systems; ++g)
+      MatZeroEntries(A_[g]);
+    for (uint g = 0; g < num_groups_; ++g)
+      VecSet(bext_[g], 0.0);
+  }
 
+  // for two-grid, the Robin boundaries are homogenous
+  if (do_two_grid_)
+    for (auto& bndry : boundaries_)
+      if (bndry.type_ == BoundaryType::Robin and bndry.mg_values_[0].size() == num_groups_)
+      {
+        bndry.mg_values_[0].push_back(0.25);
+        bndry.mg_values_[1].push_back(0.5);
+        bndry.mg_values_[2].push_back(0.0);
+      }
+
+  std::vector<double> Acell;
+  std::vector<double> rhs_cell;
   for (const auto& cell : grid.local_cells)
   {
     const auto& cell_mapping = sdm.GetCellMapping(cell);
-    const auto fe_vol_data = cell_mapping.MakeVolumetricFiniteElementData();
     const size_t num_nodes = cell_mapping.NumNodes();
+    const auto& integrals = unit_cell_integrals_[cell.local_id_];
+    const auto& K = integrals.intV_gradshapeI_gradshapeJ;
+    const auto& M = integrals.intV_shapeI_shapeJ;
 
     const auto& xs = matid_to_xs_map.at(cell.material_id_);
     const auto& D = xs->DiffusionCoefficient();
@@ -547,126 +655,81 @@ Solver::Assemble_A_bext()
       collapsed_sig_a = xstg.collapsed_sig_a;
     }
 
-    std::vector<std::vector<double>> rhs_cell;
-    rhs_cell.resize(num_groups_);
-    for (uint g = 0; g < num_groups_; ++g)
-      rhs_cell[g].resize(num_nodes, 0.0);
-
-    std::vector<MatDbl> Acell;
-    Acell.resize(num_groups_ + i_two_grid);
-    for (uint g = 0; g < num_groups_ + i_two_grid; ++g)
-      Acell[g].resize(num_nodes, std::vector<double>(num_nodes, 0.0));
-
+    // Develop node mapping
+    std::vector<int64_t> imap(num_nodes, 0); // node-mapping
     for (size_t i = 0; i < num_nodes; ++i)
+      imap[i] = sdm.MapDOF(cell, i);
+    const auto n = static_cast<int64_t>(num_nodes);
+
+    for (uint g = 0; g < num_systems; ++g)
     {
-      for (size_t j = 0; j < num_nodes; ++j)
-      {
-        double entry_mij = 0.0;
-        double entry_kij = 0.0;
-        for (size_t qp : fe_vol_data.QuadraturePointIndices())
-        {
-          entry_mij +=
-            fe_vol_data.ShapeValue(i, qp) * fe_vol_data.ShapeValue(j, qp) * fe_vol_data.JxW(qp);
+      const double D_g = g < num_groups_ ? D[g] : collapsed_D;
+      const double sigma_g = g < num_groups_ ? sigma_r[g] : collapsed_sig_a;
 
-          entry_kij +=
-            fe_vol_data.ShapeGrad(i, qp).Dot(fe_vol_data.ShapeGrad(j, qp)) * fe_vol_data.JxW(qp);
-        } // for qp
-        for (uint g = 0; g < num_groups_; ++g)
-          Acell[g][i][j] = entry_mij * sigma_r[g] + entry_kij * D[g];
+      Acell.assign(num_nodes * num_nodes, 0.0);
+      for (size_t ij = 0; ij < num_nodes * num_nodes; ++ij)
+        Acell[ij] = M[ij] * sigma_g + K[ij] * D_g;
 
-        if (do_two_grid_)
-          Acell[num_groups_][i][j] = entry_mij * collapsed_sig_a + entry_kij * collapsed_D;
-      } // for j
-      double entry_rhsi = 0.0;
-      for (size_t qp : fe_vol_data.QuadraturePointIndices())
-        entry_rhsi += fe_vol_data.ShapeValue(i, qp) * fe_vol_data.JxW(qp);
-      for (uint g = 0; g < num_groups_; ++g)
-        rhs_cell[g][i] = entry_rhsi * (qext->source_value_g[g]);
-    } // for i
+      rhs_cell.assign(num_nodes, 0.0);
+      if (g < num_groups_) // check due to two-grid
+        for (size_t i = 0; i < num_nodes; ++i)
+          rhs_cell[i] = integrals.intV_shapeI[i] * (qext->source_value_g[g]);
 
-    // Deal with BC (all based on variations of Robin)
-    const size_t num_faces = cell.faces_.size();
-    for (size_t f = 0; f < num_faces; ++f)
-    {
-      const auto& face = cell.faces_[f];
-      // not a boundary face
-      if (face.has_neighbor_)
-        continue;
+      // Deal with BC (all based on variations of Robin)
+      const size_t num_faces = cell.faces_.size();
+      for (size_t f = 0; f < num_faces; ++f)
+      {
+        const auto& face = cell.faces_[f];
+        // not a boundary face
+        if (face.has_neighbor_)
+          continue;
 
-      auto& bndry = boundaries_[face.neighbor_id_];
+        const auto& bndry = boundaries_[face.neighbor_id_];
 
-      // Robin boundary
-      //   for two-grid, it is homogenous Robin
-      if (bndry.type_ == BoundaryType::Robin)
-      {
-        const auto fe_srf_data = cell_mapping.MakeSurfaceFiniteElementData(f);
-        const size_t num_face_nodes = face.vertex_ids_.size();
+        // Robin boundary
+        //   for two-grid, it is homogenous Robin
+        if (bndry.type_ != BoundaryType::Robin)
+          continue;
 
-        auto& aval = bndry.mg_values_[0];
-        auto& bval = bndry.mg_values_[1];
-        auto& fval = bndry.mg_values_[2];
-        if (do_two_grid_)
-        {
-          aval.push_back(0.25);
-          bval.push_back(0.5);
-          fval.push_back(0.0);
-        }
+        const auto& aval = bndry.mg_values_[0];
+        const auto& bval = bndry.mg_values_[1];
+        const auto& fval = bndry.mg_values_[2];
 
         // sanity check, Assert if b=0
-        for (uint g = 0; g < num_groups_ + i_two_grid; ++g)
-        {
-          if (std::fabs(bval[g]) < 1e-8)
-            throw std::logic_error("if b=0, this is a Dirichlet BC, not a Robin BC");
-        }
+        if (std::fabs(bval[g]) < 1e-8)
+          throw std::logic_error("if b=0, this is a Dirichlet BC, not a Robin BC");
 
         // true Robin when a!=0, otherwise, it is a Neumann:
         // only do this part if true Robin (i.e., a!=0)
-        for (uint g = 0; g < num_groups_ + i_two_grid; ++g)
-        {
-          if (std::fabs(aval[g]) > 1.0e-8)
-          {
-            // loop over nodes of that face
-            for (size_t fi = 0; fi < num_face_nodes; ++fi)
-            {
-              const uint i = cell_mapping.MapFaceNode(f, fi);
-
-              double entry_rhsi = 0.0;
-              for (size_t qp : fe_srf_data.QuadraturePointIndices())
-                entry_rhsi += fe_srf_data.ShapeValue(i, qp) * fe_srf_data.JxW(qp);
-              if (g < num_groups_) // check due to two-grid
-                rhs_cell[g][i] += fval[g] / bval[g] * entry_rhsi;
-
-              for (size_t fj = 0; fj < num_face_nodes; ++fj)
-              {
-                const uint j = cell_mapping.MapFaceNode(f, fj);
-                double entry_aij = 0.0;
-                for (size_t qp : fe_srf_data.QuadraturePointIndices())
-                  entry_aij += fe_srf_data.ShapeValue(i, qp) * fe_srf_data.ShapeValue(j, qp) *
-                               fe_srf_data.JxW(qp);
-                Acell[g][i][j] += aval[g] / bval[g] * entry_aij;
-              } // for fj
-            }   // for fi
-          }     // end true Robin
-        }       // for g
-      }         // if Robin
-    }           // for face f
+        if (std::fabs(aval[g]) <= 1.0e-8)
+          continue;
 
-    // Develop node mapping
-    std::vector<int64_t> imap(num_nodes, 0); // node-mapping
-    for (size_t i = 0; i < num_nodes; ++i)
-      imap[i] = sdm.MapDOF(cell, i);
+        const size_t num_face_nodes = cell_mapping.NumFaceNodes(f);
+        const auto& face_M = integrals.intS_shapeI_shapeJ[f];
+        const auto& face_intS = integrals.intS_shapeI[f];
 
-    // Assembly into system
-    for (uint g = 0; g < num_groups_; ++g)
-      for (size_t i = 0; i < num_nodes; ++i)
-        VecSetValue(bext_[g], imap[i], rhs_cell[g][i], ADD_VALUES);
+        // loop over nodes of that face
+        for (size_t fi = 0; fi < num_face_nodes; ++fi)
+        {
+          const uint i = cell_mapping.MapFaceNode(f, fi);
 
-    for (uint g = 0; g < num_groups_ + i_two_grid; ++g)
-      for (size_t i = 0; i < num_nodes; ++i)
-        for (size_t j = 0; j < num_nodes; ++j)
-          MatSetValue(A_[g], imap[i], imap[j], Acell[g][i][j], ADD_VALUES);
+          if (g < num_groups_) // check due to two-grid
+            rhs_cell[i] += fval[g] / bval[g] * face_intS[fi];
 
-  } // for cell
+          for (size_t fj = 0; fj < num_face_nodes; ++fj)
+          {
+            const uint j = cell_mapping.MapFaceNode(f, fj);
+            Acell[i * num_nodes + j] += aval[g] / bval[g] * face_M[fi * num_face_nodes + fj];
+          } // for fj
+        }   // for fi
+      }     // for face f
+
+      // Assembly into system
+      MatSetValues(A_[g], n, imap.data(), n, imap.data(), Acell.data(), ADD_VALUES);
+      if (g < num_groups_)
+        VecSetValues(bext_[g], n, imap.data(), rhs_cell.data(), ADD_VALUES);
+    } // for g
+  }   // for cell
 
   log.Log() << "Global assembly";
 
@@ -675,23 +738,12 @@ Solver::Assemble_A_bext()
     VecAssemblyBegin(bext_[g]);
     VecAssemblyEnd(bext_[g]);
   }
-  for (uint g = 0; g < num_groups_ + i_two_grid; ++g)
+  for (uint g = 0; g < num_systems; ++g)
   {
     MatAssemblyBegin(A_[g], MAT_FINAL_ASSEMBLY);
     MatAssemblyEnd(A_[g], MAT_FINAL_ASSEMBLY);
   }
-
-  //  PetscViewer viewer;
-  //  PetscViewerASCIIOpen(opensn::mpi_comm,"A2_before_bc.m",&viewer);
-  //  PetscViewerPushFormat(viewer, PETSC_VIEWER_ASCII_MATLAB);
-  //  MatView(A[0],viewer);
-  //  PetscViewerPopFormat(viewer);
-  //  PetscViewerDestroy(&viewer);
-  //  PetscViewerASCIIOpen(opensn::mpi_comm,"bext2_before_bc.m",&viewer);
-  //  PetscViewerPushFormat(viewer, PETSC_VIEWER_ASCII_MATLAB);
-  //  VecView(bext[0],viewer);
-  //  PetscViewerPopFormat(viewer);
-  //  PetscViewerDestroy(&viewer);
+  system_assembled_ = true;
 
   log.Log() << "Done global assembly";
 }
@@ -801,15 +853,25 @@ Solver::Assemble_RHS(const unsigned int g, const int64_t verbose)
 
   const auto& sdm = *mg_diffusion::Solver::sdm_ptr_;
   // compute inscattering term
+  std::vector<double> inscatter;
   for (const auto& cell : mg_diffusion::Solver::grid_ptr_->local_cells)
   {
     const auto& cell_mapping = sdm.GetCellMapping(cell);
-    const auto fe_vol_data = cell_mapping.MakeVolumetricFiniteElementData();
     const size_t num_nodes = cell_mapping.NumNodes();
+    const auto& M = unit_cell_integrals_[cell.local_id_].intV_shapeI_shapeJ;
 
     const auto& xs = matid_to_xs_map.at(cell.material_id_);
     const auto& S = xs->TransferMatrix(0);
 
+    std::vector<int64_t> imap(num_nodes, 0);
+    std::vector<int64_t> jmap(num_nodes, 0);
+    for (size_t i = 0; i < num_nodes; ++i)
+    {
+      imap[i] = sdm.MapDOF(cell, i);
+      jmap[i] = sdm.MapDOFLocal(cell, i);
+    }
+
+    inscatter.assign(num_nodes, 0.0);
     for (const auto& [row_g, gprime, sigma_sm] : S.Row(g))
     {
       if (gprime != g) // g and row_g are the same, maybe different int types
@@ -818,27 +880,20 @@ Solver::Assemble_RHS(const unsigned int g, const int64_t verbose)
         VecGetArrayRead(x_[gprime], &xlocal);
 
         for (size_t i = 0; i < num_nodes; ++i)
-        {
-          const int64_t imap = sdm.MapDOF(cell, i);
-          double inscatter_g = 0.0;
-
           for (size_t j = 0; j < num_nodes; ++j)
           {
-            const int64_t jmap = sdm.MapDOFLocal(cell, j);
-
             // get flux at node j
-            const double flxj_gp = xlocal[jmap];
-            for (size_t qp : fe_vol_data.QuadraturePointIndices())
-              inscatter_g += sigma_sm * flxj_gp * fe_vol_data.ShapeValue(i, qp) *
-                             fe_vol_data.ShapeValue(j, qp) * fe_vol_data.JxW(qp);
+            const double flxj_gp = xlocal[jmap[j]];
+            inscatter[i] += sigma_sm * flxj_gp * M[i * num_nodes + j];
           } // for j
-          // add inscattering value to vector
-          VecSetValue(b_, imap, inscatter_g, ADD_VALUES);
-        } // for i
         VecRestoreArrayRead(x_[gprime], &xlocal);
       } // if gp!=g
     }   // for gprime
-  }     // for cell
+
+    // add inscattering values to vector
+    const auto n = static_cast<int64_t>(num_nodes);
+    VecSetValues(b_, n, imap.data(), inscatter.data(), ADD_VALUES);
+  } // for cell
 
   VecAssemblyBegin(b_);
   VecAssemblyEnd(b_);
@@ -870,14 +925,24 @@ Solver::Assemble_RHS_TwoGrid(const int64_t verbose)
 
   const auto& sdm = *sdm_ptr_;
   // compute inscattering term
+  std::vector<double> inscatter;
   for (const auto& cell : grid_ptr_->local_cells)
   {
     const auto& cell_mapping = sdm.GetCellMapping(cell);
-    const auto fe_vol_data = cell_mapping.MakeVolumetricFiniteElementData();
     const size_t num_nodes = cell_mapping.NumNodes();
+    const auto& M = unit_cell_integrals_[cell.local_id_].intV_shapeI_shapeJ;
 
     const auto& S = matid_to_xs_map.at(cell.material_id_)->TransferMatrix(0);
 
+    std::vector<int64_t> imap(num_nodes, 0);
+    std::vector<int64_t> jmap(num_nodes, 0);
+    for (size_t i = 0; i < num_nodes; ++i)
+    {
+      imap[i] = sdm.MapDOF(cell, i);
+      jmap[i] = sdm.MapDOFLocal(cell, i);
+    }
+
+    inscatter.assign(num_nodes, 0.0);
     for (unsigned g = last_fast_group_; g < num_groups_; ++g)
     {
       for (const auto& [row_g, gprime, sigma_sm] : S.Row(g))
@@ -890,29 +955,22 @@ Solver::Assemble_RHS_TwoGrid(const int64_t verbose)
           VecGetArrayRead(x_old_[gprime], &xlocal_old);
 
           for (size_t i = 0; i < num_nodes; ++i)
-          {
-            const int64_t imap = sdm.MapDOF(cell, i);
-            double inscatter_g = 0.0;
-
             for (size_t j = 0; j < num_nodes; ++j)
             {
-              const int64_t jmap = sdm.MapDOFLocal(cell, j);
-
               // get flux at node j
-              const double delta_flxj_gp = xlocal[jmap] - xlocal_old[jmap];
-              for (size_t qp : fe_vol_data.QuadraturePointIndices())
-                inscatter_g += sigma_sm * delta_flxj_gp * fe_vol_data.ShapeValue(i, qp) *
-                               fe_vol_data.ShapeValue(j, qp) * fe_vol_data.JxW(qp);
+              const double delta_flxj_gp = xlocal[jmap[j]] - xlocal_old[jmap[j]];
+              inscatter[i] += sigma_sm * delta_flxj_gp * M[i * num_nodes + j];
             } // for j
-            // add inscattering value to vector
-            VecSetValue(b_, imap, inscatter_g, ADD_VALUES);
-          } // for i
           VecRestoreArrayRead(x_[gprime], &xlocal);
           VecRestoreArrayRead(x_old_[gprime], &xlocal_old);
         } // if gp!=g
       }   // for gprime
     }     // for g
-  }       // for cell
+
+    // add inscattering values to vector
+    const auto n = static_cast<int64_t>(num_nodes);
+    VecSetValues(b_, n, imap.data(), inscatter.data(), ADD_VALUES);
+  } // for cell
 
   VecAssemblyBegin(b_);
   VecAssemblyEnd(b_);
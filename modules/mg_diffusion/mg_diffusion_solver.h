@@ -32,6 +32,23 @@ struct TwoGridCollapsedInfo
   std::vector<double> spectrum;
 };
 
+/**
+ * Integrals of the shape functions of a cell. They do not depend on the material data and are
+ * shared by all groups.
+ */
+struct UnitCellIntegrals
+{
+  /// Stiffness matrix, indexed [i * num_nodes + j]
+  std::vector<double> intV_gradshapeI_gradshapeJ;
+  /// Mass matrix, indexed [i * num_nodes + j]
+  std::vector<double> intV_shapeI_shapeJ;
+  std::vector<double> intV_shapeI;
+  /// Per boundary face, mass matrix of the face nodes, indexed [fi * num_face_nodes + fj]
+  std::vector<std::vector<double>> intS_shapeI_shapeJ;
+  /// Per boundary face, integral of the face node shape functions
+  std::vector<std::vector<double>> intS_shapeI;
+};
+
 // struct Multigroup_D_and_sigR
 //{
 //   std::vector<double> Dg;
@@ -74,6 +91,10 @@ public:
 
   std::vector<std::vector<double>> VF_;
 
+  /// unit cell integrals of each local cell
+  std::vector<UnitCellIntegrals> unit_cell_integrals_;
+  bool system_assembled_ = false;
+
   //  typedef std::pair<BoundaryType,std::vector<double>> BoundaryInfo;
   typedef std::pair<BoundaryType, std::array<std::vector<double>, 3>> BoundaryInfo;
 
@@ -86,8 +107,21 @@ public:
 
   void Initialize() override;
 
+  /**
+   * Supports the property `reassemble`, which recomputes the group matrices and external
+   * sources after the cross sections or sources of the materials changed.
+   */
+  void SetProperties(const ParameterBlock& params) override;
+
   void Initialize_Materials(std::set<int>& material_ids);
   void Set_BCs(const std::vector<uint64_t>& globl_unique_bndry_ids);
+  /**Computes the unit cell integrals of all local cells.*/
+  void Compute_UnitCellIntegrals();
+  /**
+   * Assembles the group matrices and external sources from the unit cell integrals. It can be
+   * called again after the material data changed, in which case only the combination of the
+   * integrals with the new coefficients is redone.
+   */
   void Assemble_A_bext();
   void Compute_TwoGrid_Params();
   void Compute_TwoGrid_VolumeFractions();
@@ -95,10 +95,9 @@ TransientSolver::Initialize()
   // Initializing linalg items
   const auto& J = num_precursors_;
   A_ = DynamicMatrix<double>(J + 1, J + 1, 0.0);
-  I_ = A_;
-  I_.SetDiagonal(1.0);
 
   x_t_ = DynamicVector<double>(J + 1, 0.0);
+  x_tp1_ = x_t_;
 
   // Assembling system
   A_[0][0] = beta_ * (rho_ - 1.0) / gen_time_;
@@ -160,6 +159,11 @@ TransientSolver::Step()
 
   A_[0][0] = beta_ * (rho_ - 1.0) / gen_time_;
 
+  const auto& J = num_precursors_;
+  const auto& A0 = A_[0];
+  const auto& x_t = x_t_.elements_;
+  auto& x_tp1 = x_tp1_.elements_;
+
   if (time_integration_ == "implicit_euler" or time_integration_ == "crank_nicolson")
   {
     double theta = 1.0;
@@ -171,16 +175,38 @@ TransientSolver::Step()
 
     const double inv_tau = theta * dt;
 
-    auto A_theta = I_ - inv_tau * A_;
-    auto b_theta = x_t_ + inv_tau * q_;
-
-    auto x_theta = A_theta.Inverse() * b_theta;
-
-    x_tp1_ = x_t_ + (1.0 / theta) * (x_theta - x_t_);
+    // Solve (I - inv_tau A) x_theta = x_t + inv_tau q. The system is an arrowhead matrix, so
+    // the precursor rows are eliminated into the population row, which is solved for first.
+    double diag_0 = 1.0 - inv_tau * A0[0];
+    double rhs_0 = x_t[0] + inv_tau * q_[0];
+    for (size_t j = 1; j <= J; ++j)
+    {
+      const double diag_j = 1.0 - inv_tau * A_[j][j];
+      const double row_0j = -inv_tau * A0[j];
+      const double col_j0 = -inv_tau * A_[j][0];
+      diag_0 -= row_0j * col_j0 / diag_j;
+      rhs_0 -= row_0j * (x_t[j] + inv_tau * q_[j]) / diag_j;
+    }
+
+    const double x_theta_0 = rhs_0 / diag_0;
+    x_tp1[0] = x_t[0] + (x_theta_0 - x_t[0]) / theta;
+    for (size_t j = 1; j <= J; ++j)
+    {
+      const double diag_j = 1.0 - inv_tau * A_[j][j];
+      const double col_j0 = -inv_tau * A_[j][0];
+      const double x_theta_j = (x_t[j] + inv_tau * q_[j] - col_j0 * x_theta_0) / diag_j;
+      x_tp1[j] = x_t[j] + (x_theta_j - x_t[j]) / theta;
+    }
   }
   else if (time_integration_ == "explicit_euler")
   {
-    x_tp1_ = x_t_ + dt * A_ * x_t_ + dt * q_;
+    double dx_0 = A0[0] * x_t[0] + q_[0];
+    for (size_t j = 1; j <= J; ++j)
+    {
+      dx_0 += A0[j] * x_t[j];
+      x_tp1[j] = x_t[j] + dt * (A_[j][0] * x_t[0] + A_[j][j] * x_t[j] + q_[j]);
+    }
+    x_tp1[0] = x_t[0] + dt * dx_0;
   }
   else
     OpenSnLogicalError("Unsupported time integration scheme.");
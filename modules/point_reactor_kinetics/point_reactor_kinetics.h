@@ -26,7 +26,7 @@ private:
   std::string time_integration_;
 
   size_t num_precursors_;
-  DynamicMatrix<double> A_, I_;
+  DynamicMatrix<double> A_;
   DynamicVector<double> x_t_, x_tp1_, q_;
   double beta_ = 1.0;
   double period_tph_ = 0.0;
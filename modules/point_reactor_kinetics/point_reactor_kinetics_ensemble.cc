@@ -0,0 +1,409 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#include "modules/point_reactor_kinetics/point_reactor_kinetics_ensemble.h"
+#include "framework/physics/time_steppers/time_stepper.h"
+#include "framework/event_system/physics_event_publisher.h"
+#include "framework/object_factory.h"
+#include "framework/runtime.h"
+#include "framework/logging/log.h"
+
+#include <cmath>
+
+namespace opensn
+{
+namespace prk
+{
+
+OpenSnRegisterObjectInNamespace(prk, EnsembleTransientSolver);
+
+namespace
+{
+
+/**Expands a per-member parameter that is given either as a single value or as
+ * one value per member.*/
+std::vector<double>
+ExpandPerMember(const std::vector<double>& values, size_t num_members, const std::string& name)
+{
+  if (values.size() == num_members)
+    return values;
+
+  OpenSnInvalidArgumentIf(values.size() != 1,
+                          "Parameter \"" + name + "\" must have either 1 or " +
+                            std::to_string(num_members) + " entries, but has " +
+                            std::to_string(values.size()) + ".");
+  return std::vector<double>(num_members, values.front());
+}
+
+/**Transposes precursor data into [j * num_members + m] order. The input is
+ * either shared by all members (J entries) or given per member, member-major
+ * (num_members * J entries).*/
+std::vector<double>
+MakePrecursorData(const std::vector<double>& shared,
+                  const std::vector<double>& per_member,
+                  size_t num_members,
+                  size_t num_precursors,
+                  const std::string& name)
+{
+  std::vector<double> data(num_precursors * num_members);
+  if (per_member.empty())
+  {
+    for (size_t j = 0; j < num_precursors; ++j)
+      for (size_t m = 0; m < num_members; ++m)
+        data[j * num_members + m] = shared[j];
+    return data;
+  }
+
+  OpenSnInvalidArgumentIf(per_member.size() != num_members * num_precursors,
+                          "Parameter \"" + name + "\" must have " +
+                            std::to_string(num_members * num_precursors) +
+                            " entries (number of members times number of precursors).");
+  for (size_t m = 0; m < num_members; ++m)
+    for (size_t j = 0; j < num_precursors; ++j)
+      data[j * num_members + m] = per_member[m * num_precursors + j];
+  return data;
+}
+
+} // namespace
+
+InputParameters
+EnsembleTransientSolver::GetInputParameters()
+{
+  InputParameters params = opensn::Solver::GetInputParameters();
+
+  params.SetGeneralDescription(
+    "Point kinetics transient solver that advances an ensemble of independent systems in "
+    "lockstep.");
+  params.SetDocGroup("prk");
+
+  params.ChangeExistingParamToOptional("name", "prk_EnsembleTransientSolver");
+
+  std::vector<double> default_lambdas = {0.0124, 0.0304, 0.111, 0.301, 1.14, 3.01};
+  std::vector<double> default_betas = {0.00021, 0.00142, 0.00127, 0.00257, 0.00075, 0.00027};
+
+  params.AddRequiredParameterArray(
+    "initial_rho", "Initial reactivity [$] of each member. Determines the number of members.");
+
+  params.AddOptionalParameterArray(
+    "precursor_lambdas", default_lambdas, "An array of decay constants shared by all members");
+  params.AddOptionalParameterArray("precursor_betas",
+                                   default_betas,
+                                   "An array of fractional delayed neutron fractions shared by "
+                                   "all members");
+  params.AddOptionalParameterArray(
+    "member_precursor_lambdas",
+    std::vector<double>{},
+    "Decay constants per member, member-major. Overrides precursor_lambdas.");
+  params.AddOptionalParameterArray(
+    "member_precursor_betas",
+    std::vector<double>{},
+    "Fractional delayed neutron fractions per member, member-major. Overrides "
+    "precursor_betas.");
+
+  params.AddOptionalParameterArray("gen_time",
+                                   std::vector<double>{1.0e-5},
+                                   "Neutron generation time [s], single or per member");
+  params.AddOptionalParameterArray("initial_source",
+                                   std::vector<double>{1.0},
+                                   "Initial source strength [/s], single or per member");
+
+  params.AddOptionalParameter(
+    "time_integration", "implicit_euler", "Time integration scheme to use");
+
+  auto time_intgl_list =
+    AllowableRangeList::New({"explicit_euler", "implicit_euler", "crank_nicolson"});
+
+  params.ConstrainParameterRange("time_integration", std::move(time_intgl_list));
+
+  return params;
+}
+
+EnsembleTransientSolver::EnsembleTransientSolver(const InputParameters& params)
+  : opensn::Solver(params),
+    num_members_(params.GetParamVectorValue<double>("initial_rho").size()),
+    num_precursors_(params.GetParamVectorValue<double>("precursor_lambdas").size()),
+    time_integration_(params.GetParamValue<std::string>("time_integration")),
+    rhos_(params.GetParamVectorValue<double>("initial_rho"))
+{
+  const auto lambdas = params.GetParamVectorValue<double>("precursor_lambdas");
+  const auto betas = params.GetParamVectorValue<double>("precursor_betas");
+  const auto member_lambdas = params.GetParamVectorValue<double>("member_precursor_lambdas");
+  const auto member_betas = params.GetParamVectorValue<double>("member_precursor_betas");
+
+  OpenSnInvalidArgumentIf(num_members_ == 0, "At least one ensemble member is required.");
+  OpenSnInvalidArgumentIf(lambdas.size() != betas.size(),
+                          "Number of precursors cannot be deduced from precursor data because "
+                          "the data lists are of different size.");
+
+  gen_times_ =
+    ExpandPerMember(params.GetParamVectorValue<double>("gen_time"), num_members_, "gen_time");
+  sources_ = ExpandPerMember(
+    params.GetParamVectorValue<double>("initial_source"), num_members_, "initial_source");
+  for (size_t m = 0; m < num_members_; ++m)
+  {
+    OpenSnInvalidArgumentIf(gen_times_[m] < 1.0e-12, "gen_time must be at least 1.0e-12.");
+    OpenSnInvalidArgumentIf(sources_[m] < 0.0, "initial_source must be non-negative.");
+  }
+
+  lambdas_ = MakePrecursorData(
+    lambdas, member_lambdas, num_members_, num_precursors_, "member_precursor_lambdas");
+  betas_ = MakePrecursorData(
+    betas, member_betas, num_members_, num_precursors_, "member_precursor_betas");
+
+  log.Log() << "Created solver " << TextName() << " with " << num_members_ << " members and "
+            << num_precursors_ << " precursor groups";
+}
+
+void
+EnsembleTransientSolver::Initialize()
+{
+  const size_t N = num_members_;
+  const size_t J = num_precursors_;
+
+  beta_totals_.assign(N, 0.0);
+  for (size_t j = 0; j < J; ++j)
+    for (size_t m = 0; m < N; ++m)
+      beta_totals_[m] += betas_[j * N + m];
+
+  periods_.assign(N, 0.0);
+  diag_0_.assign(N, 0.0);
+  rhs_0_.assign(N, 0.0);
+  x_t_.assign((J + 1) * N, 0.0);
+
+  // The steady state of each member is found in closed form. If there is a
+  // source and the reactivity is < 0 there exists a unique solution,
+  // otherwise the member is initialized as a critical system with unit
+  // population and no source.
+  for (size_t m = 0; m < N; ++m)
+    if (sources_[m] > 0.0 and rhos_[m] < 0.0)
+      x_t_[m] = -sources_[m] * gen_times_[m] / (beta_totals_[m] * rhos_[m]);
+    else
+      x_t_[m] = 1.0;
+
+  for (size_t j = 0; j < J; ++j)
+  {
+    const double* lambda = &lambdas_[j * N];
+    const double* beta = &betas_[j * N];
+    double* c = &x_t_[(j + 1) * N];
+    for (size_t m = 0; m < N; ++m)
+      c[m] = beta[m] * x_t_[m] / (gen_times_[m] * lambda[m]);
+  }
+
+  x_tp1_ = x_t_;
+}
+
+void
+EnsembleTransientSolver::Execute()
+{
+  auto& physics_ev_pub = PhysicsEventPublisher::GetInstance();
+
+  while (timestepper_->IsActive())
+  {
+    physics_ev_pub.SolverStep(*this);
+    physics_ev_pub.SolverAdvance(*this);
+  }
+}
+
+void
+EnsembleTransientSolver::Step()
+{
+  log.Log() << "Solver \"" + TextName() + "\" " + timestepper_->StringTimeInfo();
+
+  const size_t N = num_members_;
+  const size_t J = num_precursors_;
+  const double dt = timestepper_->TimeStepSize();
+
+  const double* n_t = x_t_.data();
+  double* n_tp1 = x_tp1_.data();
+
+  if (time_integration_ == "implicit_euler" or time_integration_ == "crank_nicolson")
+  {
+    const double theta = time_integration_ == "implicit_euler" ? 1.0 : 0.5;
+    const double inv_tau = theta * dt;
+
+    // Each member's system (I - inv_tau A) x_theta = x_t + inv_tau q is an
+    // arrowhead matrix. The precursor rows are eliminated into the population
+    // row, which is solved first, followed by back-substitution.
+    for (size_t m = 0; m < N; ++m)
+    {
+      diag_0_[m] = 1.0 - inv_tau * beta_totals_[m] * (rhos_[m] - 1.0) / gen_times_[m];
+      rhs_0_[m] = n_t[m] + inv_tau * sources_[m];
+    }
+
+    for (size_t j = 0; j < J; ++j)
+    {
+      const double* lambda = &lambdas_[j * N];
+      const double* beta = &betas_[j * N];
+      const double* c_t = &x_t_[(j + 1) * N];
+      for (size_t m = 0; m < N; ++m)
+      {
+        const double diag_j = 1.0 + inv_tau * lambda[m];
+        const double row_0j = -inv_tau * lambda[m];
+        const double col_j0 = -inv_tau * beta[m] / gen_times_[m];
+        diag_0_[m] -= row_0j * col_j0 / diag_j;
+        rhs_0_[m] -= row_0j * c_t[m] / diag_j;
+      }
+    }
+
+    // rhs_0_ is overwritten with the population at theta
+    for (size_t m = 0; m < N; ++m)
+    {
+      rhs_0_[m] /= diag_0_[m];
+      n_tp1[m] = n_t[m] + (rhs_0_[m] - n_t[m]) / theta;
+    }
+
+    for (size_t j = 0; j < J; ++j)
+    {
+      const double* lambda = &lambdas_[j * N];
+      const double* beta = &betas_[j * N];
+      const double* c_t = &x_t_[(j + 1) * N];
+      double* c_tp1 = &x_tp1_[(j + 1) * N];
+      for (size_t m = 0; m < N; ++m)
+      {
+        const double diag_j = 1.0 + inv_tau * lambda[m];
+        const double col_j0 = -inv_tau * beta[m] / gen_times_[m];
+        const double c_theta = (c_t[m] - col_j0 * rhs_0_[m]) / diag_j;
+        c_tp1[m] = c_t[m] + (c_theta - c_t[m]) / theta;
+      }
+    }
+  }
+  else if (time_integration_ == "explicit_euler")
+  {
+    for (size_t m = 0; m < N; ++m)
+      rhs_0_[m] = beta_totals_[m] * (rhos_[m] - 1.0) / gen_times_[m] * n_t[m] + sources_[m];
+
+    for (size_t j = 0; j < J; ++j)
+    {
+      const double* lambda = &lambdas_[j * N];
+      const double* beta = &betas_[j * N];
+      const double* c_t = &x_t_[(j + 1) * N];
+      double* c_tp1 = &x_tp1_[(j + 1) * N];
+      for (size_t m = 0; m < N; ++m)
+      {
+        rhs_0_[m] += lambda[m] * c_t[m];
+        c_tp1[m] = c_t[m] + dt * (beta[m] / gen_times_[m] * n_t[m] - lambda[m] * c_t[m]);
+      }
+    }
+
+    for (size_t m = 0; m < N; ++m)
+      n_tp1[m] = n_t[m] + dt * rhs_0_[m];
+  }
+  else
+    OpenSnLogicalError("Unsupported time integration scheme.");
+
+  for (size_t m = 0; m < N; ++m)
+  {
+    double period = dt / std::log(n_tp1[m] / n_t[m]);
+    if (period > 0.0 and period > 1.0e6)
+      period = 1.0e6;
+    if (period < 0.0 and period < -1.0e6)
+      period = -1.0e6;
+    periods_[m] = period;
+  }
+}
+
+void
+EnsembleTransientSolver::Advance()
+{
+  x_t_ = x_tp1_;
+  timestepper_->Advance();
+}
+
+ParameterBlock
+EnsembleTransientSolver::GetInfo(const ParameterBlock& params) const
+{
+  const auto param_name = params.GetParamValue<std::string>("name");
+
+  if (param_name == "num_members")
+    return ParameterBlock("", num_members_);
+  else if (param_name == "time_integration")
+    return ParameterBlock("", time_integration_);
+  else if (param_name == "time_next")
+    return ParameterBlock("", TimeNew());
+
+  std::vector<double> values;
+  if (param_name == "neutron_population")
+    values.assign(x_t_.begin(), x_t_.begin() + num_members_);
+  else if (param_name == "population_next")
+    values.assign(x_tp1_.begin(), x_tp1_.begin() + num_members_);
+  else if (param_name == "period")
+    values = periods_;
+  else if (param_name == "rho")
+    values = rhos_;
+  else
+    OpenSnInvalidArgument("Unsupported info name \"" + param_name + "\".");
+
+  if (params.Has("member"))
+  {
+    const auto m = params.GetParamValue<size_t>("member");
+    OpenSnInvalidArgumentIf(m >= num_members_,
+                            "Member index " + std::to_string(m) + " out of range.");
+    return ParameterBlock("", values[m]);
+  }
+  return ParameterBlock("", values);
+}
+
+size_t
+EnsembleTransientSolver::NumMembers() const
+{
+  return num_members_;
+}
+
+double
+EnsembleTransientSolver::PopulationPrev(size_t m) const
+{
+  return x_t_[m];
+}
+
+double
+EnsembleTransientSolver::PopulationNew(size_t m) const
+{
+  return x_tp1_[m];
+}
+
+double
+EnsembleTransientSolver::Period(size_t m) const
+{
+  return periods_[m];
+}
+
+double
+EnsembleTransientSolver::TimeNew() const
+{
+  return timestepper_->Time() + timestepper_->TimeStepSize();
+}
+
+void
+EnsembleTransientSolver::SetRho(size_t m, double value)
+{
+  rhos_[m] = value;
+}
+
+void
+EnsembleTransientSolver::SetProperties(const ParameterBlock& params)
+{
+  opensn::Solver::SetProperties(params);
+
+  for (const auto& param : params)
+  {
+    const std::string& param_name = param.Name();
+    if (param_name == "rho")
+    {
+      if (param.Type() == ParameterBlockType::ARRAY)
+      {
+        const auto values = param.GetVectorValue<double>();
+        OpenSnInvalidArgumentIf(values.size() != num_members_,
+                                "Property \"rho\" must have " + std::to_string(num_members_) +
+                                  " entries.");
+        for (size_t m = 0; m < num_members_; ++m)
+          SetRho(m, values[m]);
+      }
+      else
+        for (size_t m = 0; m < num_members_; ++m)
+          SetRho(m, param.GetValue<double>());
+    }
+  }
+}
+
+} // namespace prk
+} // namespace opensn
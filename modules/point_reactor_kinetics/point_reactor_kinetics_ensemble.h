@@ -0,0 +1,91 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "framework/physics/solver_base/solver.h"
+
+namespace opensn
+{
+namespace prk
+{
+
+/**Transient solver for an ensemble of independent point kinetics systems.
+ *
+ * All members share the number of precursor groups and the time integration
+ * scheme, and are advanced in lockstep. Every member can have its own
+ * reactivity, generation time, source strength and precursor data. The
+ * member data is stored as structure-of-arrays, i.e. for each quantity the
+ * values of all members are contiguous, so that a time step is a sequence of
+ * vectorizable loops over the members.*/
+class EnsembleTransientSolver : public opensn::Solver
+{
+private:
+  size_t num_members_;
+  size_t num_precursors_;
+  std::string time_integration_;
+
+  // Per-member data, indexed [m]
+  std::vector<double> gen_times_;
+  std::vector<double> rhos_;
+  std::vector<double> sources_;
+  std::vector<double> beta_totals_;
+  std::vector<double> periods_;
+
+  // Per-member precursor data, indexed [j * num_members_ + m]
+  std::vector<double> lambdas_;
+  std::vector<double> betas_;
+
+  // Solutions, indexed [i * num_members_ + m] with i = 0 the neutron population
+  // and i = j + 1 precursor group j
+  std::vector<double> x_t_;
+  std::vector<double> x_tp1_;
+
+  // Work vectors for the population row of the implicit system, indexed [m]
+  std::vector<double> diag_0_;
+  std::vector<double> rhs_0_;
+
+public:
+  /**Sets input parameters.*/
+  static InputParameters GetInputParameters();
+  /**Constructor.*/
+  explicit EnsembleTransientSolver(const InputParameters& params);
+
+  void Initialize() override;
+  void Execute() override;
+  void Step() override;
+  void Advance() override;
+
+  /**Supports the same info names as prk::TransientSolver, plus `num_members`.
+   * Per-member quantities are returned as an array over all members, or as a
+   * scalar when the parameter `member` (0-based) is supplied.*/
+  ParameterBlock GetInfo(const ParameterBlock& params) const override;
+
+  /**Returns the number of ensemble members.*/
+  size_t NumMembers() const;
+  /**Returns the population of member m at the previous time step.*/
+  double PopulationPrev(size_t m) const;
+  /**Returns the population of member m at the next time step.*/
+  double PopulationNew(size_t m) const;
+  /**Returns the period of member m computed for the last time step.*/
+  double Period(size_t m) const;
+  /**Returns the time computed for the next time step.*/
+  double TimeNew() const;
+
+  /**\addtogroup prk
+   *
+   * PRK ensemble solver settable properties:
+   * - `rho`, The current reactivities. Either an array with a value per
+   *   member, or a single value applied to all members.
+   *
+   * Parents:
+   * \copydoc opensn::Solver::SetProperties
+   */
+  void SetProperties(const ParameterBlock& params) override;
+
+  /**Sets the value of rho for member m.*/
+  void SetRho(size_t m, double value);
+};
+
+} // namespace prk
+} // namespace opensn
@@ -0,0 +1,66 @@
+#include "framework/runtime.h"
+#include "framework/logging/log.h"
+
+#include "lua/framework/console/console.h"
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace opensn;
+
+namespace unit_tests
+{
+
+ParameterBlock logging_Test00(const InputParameters& params);
+
+RegisterWrapperFunctionInNamespace(unit_tests, logging_Test00, nullptr, logging_Test00);
+
+ParameterBlock
+logging_Test00(const InputParameters&)
+{
+  bool passed = true;
+
+  // Filtered logs return inactive streams
+  opensn::log.SetVerbosity(0);
+  if (opensn::log.IsEnabled(Logger::LOG_0VERBOSE_1) or opensn::log.Log0Verbose1().IsActive() or
+      opensn::log.LogAllVerbose2().IsActive())
+    passed = false;
+  if (not opensn::log.LogAll().IsActive())
+    passed = false;
+  if (opensn::mpi_comm.rank() != 0 and opensn::log.Log0().IsActive())
+    passed = false;
+
+  // File sink
+  const std::string file_name =
+    "logging_test_00_" + std::to_string(opensn::mpi_comm.rank()) + ".log";
+  opensn::log.SetFileSink("logging_test_00");
+  opensn::log.LogAll() << "line a\nline b";
+  opensn::log.LogAllWarning() << "warning";
+  opensn::log.LogAllVerbose1() << "filtered";
+  opensn::log.Flush();
+  opensn::log.SetFileSink("");
+
+  const std::string header = "[" + std::to_string(opensn::mpi_comm.rank()) + "]  ";
+  const std::vector<std::string> expected = {
+    header + "line a", header + "line b", header + "**WARNING** warning"};
+  std::vector<std::string> lines;
+  {
+    std::ifstream file(file_name);
+    std::string line;
+    while (std::getline(file, line))
+      lines.push_back(line);
+  }
+  std::remove(file_name.c_str());
+
+  opensn::log.LogAll() << "File sink lines: " << lines.size();
+  if (lines != expected)
+    passed = false;
+
+  opensn::log.LogAll() << "Logging test " << (passed ? "passed" : "failed");
+
+  return ParameterBlock();
+}
+
+} //  namespace unit_tests
@@ -0,0 +1 @@
+unit_tests.logging_Test00()
@@ -0,0 +1,102 @@
+-- Writes an orthogonal mesh to PVTU and reads its pieces back in parallel.
+-- The cells get a material id per quadrant before they are written. Each location records the
+-- centroids of the local and ghost cells it sees. After the pieces are read back, every
+-- location must see the same cells, so it reads the piece it wrote and builds the same ghost
+-- layer, and every cell must carry the material id of its quadrant.
+num_procs = 4
+
+--############################################### Check num_procs
+if check_num_procs == nil and number_of_processes ~= num_procs then
+  log.Log(
+    LOG_0ERROR,
+    "Incorrect amount of processors. "
+      .. "Expected "
+      .. tostring(num_procs)
+      .. ". Pass check_num_procs=false to override if possible."
+  )
+  os.exit(false)
+end
+
+--############################################### Setup mesh
+nodes = {}
+N = 8
+L = 2
+xmin = -L / 2
+dx = L / N
+for i = 1, (N + 1) do
+  k = i - 1
+  nodes[i] = xmin + k * dx
+end
+
+meshgen1 = mesh.OrthogonalMeshGenerator.Create({ node_sets = { nodes, nodes, nodes } })
+mesh.MeshGenerator.Execute(meshgen1)
+
+function QuadrantMaterialID(pt)
+  local mat_id = 0
+  if pt.x > 0.0 then
+    mat_id = mat_id + 1
+  end
+  if pt.y > 0.0 then
+    mat_id = mat_id + 2
+  end
+  return mat_id
+end
+
+function CellKey(pt)
+  return string.format("%.6f %.6f %.6f", pt.x, pt.y, pt.z)
+end
+
+written_cells = {}
+num_written_cells = 0
+function SetQuadrantMaterialID(pt, cur_id)
+  written_cells[CellKey(pt)] = true
+  num_written_cells = num_written_cells + 1
+  return QuadrantMaterialID(pt)
+end
+
+mesh.SetMaterialIDFromFunction("SetQuadrantMaterialID")
+
+mesh.ExportToPVTU("distributed_pvtu")
+
+--############################################### Read the pieces back
+meshgen2 = mesh.FromFileMeshGenerator.Create({
+  filename = "distributed_pvtu.pvtu",
+  material_id_fieldname = "Material",
+  distributed = true,
+})
+mesh.MeshGenerator.Execute(meshgen2)
+
+--############################################### Check the cells of this location
+num_read_cells = 0
+num_unknown_cells = 0
+num_wrong_material_ids = 0
+function CheckCell(pt, cur_id)
+  num_read_cells = num_read_cells + 1
+  if written_cells[CellKey(pt)] == nil then
+    num_unknown_cells = num_unknown_cells + 1
+  end
+  if cur_id ~= QuadrantMaterialID(pt) then
+    num_wrong_material_ids = num_wrong_material_ids + 1
+  end
+  return cur_id
+end
+
+mesh.SetMaterialIDFromFunction("CheckCell")
+
+log.Log(
+  LOG_ALL,
+  string.format(
+    "Read %d of %d written cells, %d unknown cells, %d wrong material ids",
+    num_read_cells,
+    num_written_cells,
+    num_unknown_cells,
+    num_wrong_material_ids
+  )
+)
+if
+  num_read_cells == num_written_cells
+  and num_unknown_cells == 0
+  and num_wrong_material_ids == 0
+then
+  log.Log(LOG_ALL, "The cells and material ids match the written partition")
+end
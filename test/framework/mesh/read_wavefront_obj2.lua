@@ -0,0 +1,34 @@
+-- Reads an unstructured mesh and establishes connectivity with the
+-- threaded sort-based face matcher.
+-- Test: 3242 cells with material ids up to 3, and the 1040 boundary edges of the
+-- file as the only faces without a neighbor, the same as the hash table matcher
+-- of read_wavefront_obj1.lua.
+num_procs = 4
+--Unstructured mesh
+
+--############################################### Check num_procs
+if check_num_procs == nil and number_of_processes ~= num_procs then
+  log.Log(
+    LOG_0ERROR,
+    "Incorrect amount of processors. "
+      .. "Expected "
+      .. tostring(num_procs)
+      .. ". Pass check_num_procs=false to override if possible."
+  )
+  os.exit(false)
+end
+
+--############################################### Setup mesh
+meshgen1 = mesh.MeshGenerator.Create({
+  inputs = {
+    mesh.FromFileMeshGenerator.Create({
+      filename = "reactor_pin_mesh.obj",
+      connectivity_method = "sort",
+    }),
+  },
+})
+mesh.MeshGenerator.Execute(meshgen1)
+--############################################### Exports
+if master_export == nil then
+  mesh.ExportToPVTU("ZObjMesh2")
+end
@@ -0,0 +1,119 @@
+-- 2D DFEM diffusion reassembled after coefficient changes
+-- The problem of d_diffusion_2d_1a_linear.lua is solved, then solved again with D = 2 and once
+-- more with D = 2 on the left half and D = 4 on the right half of the domain. Only the change in
+-- the coefficient-dependent terms is added to the assembled system. The exact solutions are
+-- linear and piecewise linear, so interior penalty reproduces them exactly. With the Robin
+-- conditions and the flux J = -D dphi/dx the maximum of the solution is
+--   phi(-1) = J (2 + 1 / D_left + 1 / D_right) with J (1 + 0.25 / D_left + 0.25 / D_right) = 1
+-- Test: Max-value 2.4 for the uniform change and 44 / 19 = 2.315789 for the piecewise one.
+--############################################### Setup mesh
+nodes = {}
+N = 10
+L = 2
+xmin = -L / 2
+dx = L / N
+for i = 1, (N + 1) do
+  k = i - 1
+  nodes[i] = xmin + k * dx
+end
+
+meshgen1 = mesh.OrthogonalMeshGenerator.Create({ node_sets = { nodes, nodes } })
+mesh.MeshGenerator.Execute(meshgen1)
+
+--############################################### Set Material IDs
+mesh.SetUniformMaterialID(0)
+right_vol = logvol.RPPLogicalVolume.Create({ xmin = 0.0, xmax = 1000.0, infy = true, infz = true })
+mesh.SetMaterialIDFromLogicalVolume(right_vol, 1)
+
+D = { 1.0, 1.0 }
+Q = { 0.0, 0.0 }
+XSa = { 0.0, 0.0 }
+function D_coef(i, pt)
+  return D[i + 1]
+end
+function Q_ext(i, pt)
+  return Q[i + 1]
+end
+function Sigma_a(i, pt)
+  return XSa[i + 1]
+end
+
+-- Setboundary IDs
+-- xmin,xmax,ymin,ymax,zmin,zmax
+e_vol = logvol.RPPLogicalVolume.Create({ xmin = 0.99999, xmax = 1000.0, infy = true, infz = true })
+w_vol =
+  logvol.RPPLogicalVolume.Create({ xmin = -1000.0, xmax = -0.99999, infy = true, infz = true })
+n_vol = logvol.RPPLogicalVolume.Create({ ymin = 0.99999, ymax = 1000.0, infx = true, infz = true })
+s_vol =
+  logvol.RPPLogicalVolume.Create({ ymin = -1000.0, ymax = -0.99999, infx = true, infz = true })
+
+e_bndry = "0"
+w_bndry = "1"
+n_bndry = "2"
+s_bndry = "3"
+
+mesh.SetBoundaryIDFromLogicalVolume(e_vol, e_bndry)
+mesh.SetBoundaryIDFromLogicalVolume(w_vol, w_bndry)
+mesh.SetBoundaryIDFromLogicalVolume(n_vol, n_bndry)
+mesh.SetBoundaryIDFromLogicalVolume(s_vol, s_bndry)
+
+diff_options = {
+  boundary_conditions = {
+    {
+      boundary = e_bndry,
+      type = "robin",
+      coeffs = { 0.25, 0.5, 0.0 },
+    },
+    {
+      boundary = n_bndry,
+      type = "reflecting",
+    },
+    {
+      boundary = s_bndry,
+      type = "reflecting",
+    },
+    {
+      boundary = w_bndry,
+      type = "robin",
+      coeffs = { 0.25, 0.5, 1.0 },
+    },
+  },
+}
+
+-- DFEM solver
+phys1 = diffusion.DFEMSolver.Create({
+  name = "DFEMSolver",
+  residual_tolerance = 1e-8,
+})
+diffusion.SetOptions(phys1, diff_options)
+
+solver.Initialize(phys1)
+solver.Execute(phys1)
+
+--############################################### Get field functions
+fflist, count = solver.GetFieldFunctionList(phys1)
+
+--############################################### Volume integrations
+vol0 = logvol.RPPLogicalVolume.Create({ infx = true, infy = true, infz = true })
+
+function MaxValue()
+  local ffvol = fieldfunc.FFInterpolationCreate(VOLUME)
+  fieldfunc.SetProperty(ffvol, OPERATION, OP_MAX)
+  fieldfunc.SetProperty(ffvol, LOGICAL_VOLUME, vol0)
+  fieldfunc.SetProperty(ffvol, ADD_FIELDFUNCTION, fflist[1])
+
+  fieldfunc.Initialize(ffvol)
+  fieldfunc.Execute(ffvol)
+  return fieldfunc.GetValue(ffvol)
+end
+
+-- Uniform change of the diffusion coefficient
+D = { 2.0, 2.0 }
+solver.Execute(phys1)
+log.Log(LOG_0, string.format("Uniform D Max-value=%.6f", MaxValue()))
+
+-- Change on the right half only, which also changes the interior penalty terms of the faces
+-- between the halves
+D = { 2.0, 4.0 }
+solver.Execute(phys1)
+log.Log(LOG_0, string.format("Piecewise D Max-value=%.6f", MaxValue()))
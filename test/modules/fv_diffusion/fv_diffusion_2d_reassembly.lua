@@ -0,0 +1,107 @@
+-- 2D finite volume diffusion reassembled after coefficient changes
+-- A medium with a distributed source surrounds a block without source. The problem is solved,
+-- the diffusion coefficient and the absorption cross section of the block are changed and the
+-- problem is solved again. The rows of the cells in the block and of their neighbors, whose
+-- face coefficients are harmonic averages, are replaced in the assembled system. The result is
+-- compared with a solver created from scratch with the new coefficients. The block is split
+-- between the ranks, so the changed face coefficients include ghost cells.
+-- Test: The reassembled and the from-scratch solutions agree.
+num_procs = 2
+
+--############################################### Check num_procs
+if check_num_procs == nil and number_of_processes ~= num_procs then
+  log.Log(
+    LOG_0ERROR,
+    "Incorrect amount of processors. "
+      .. "Expected "
+      .. tostring(num_procs)
+      .. ". Pass check_num_procs=false to override if possible."
+  )
+  os.exit(false)
+end
+
+--############################################### Setup mesh
+nodes = {}
+N = 20
+L = 2.0
+dx = L / N
+for i = 1, (N + 1) do
+  nodes[i] = (i - 1) * dx
+end
+
+meshgen1 = mesh.OrthogonalMeshGenerator.Create({ node_sets = { nodes, nodes } })
+mesh.MeshGenerator.Execute(meshgen1)
+
+--############################################### Set Material IDs
+mesh.SetUniformMaterialID(0)
+block_vol = logvol.RPPLogicalVolume.Create({
+  xmin = 0.5,
+  xmax = 1.5,
+  ymin = 0.5,
+  ymax = 1.5,
+  infz = true,
+})
+mesh.SetMaterialIDFromLogicalVolume(block_vol, 1)
+
+D = { 1.0, 1.0 }
+Q = { 1.0, 0.0 }
+XSa = { 0.1, 0.5 }
+function D_coef(i, pt)
+  return D[i + 1]
+end
+function Q_ext(i, pt)
+  return Q[i + 1]
+end
+function Sigma_a(i, pt)
+  return XSa[i + 1]
+end
+
+--############################################### Setup Physics
+-- XMIN has an incoming current, the other boundaries default to a zero Dirichlet condition
+function CreateSolver(name)
+  local phys = diffusion.FVSolverCreate(name)
+  diffusion.FVSetBCProperty(phys, "boundary_type", "XMIN", "robin", 0.25, 0.5, 1.0)
+  solver.SetBasicOption(phys, "residual_tolerance", 1.0e-12)
+  solver.Initialize(phys)
+  return phys
+end
+
+domain_vol = logvol.RPPLogicalVolume.Create({ infx = true, infy = true, infz = true })
+
+function Integral(phys, volume)
+  local fflist, count = solver.GetFieldFunctionList(phys)
+  local ffi = fieldfunc.FFInterpolationCreate(VOLUME)
+  fieldfunc.SetProperty(ffi, OPERATION, OP_SUM)
+  fieldfunc.SetProperty(ffi, LOGICAL_VOLUME, volume)
+  fieldfunc.SetProperty(ffi, ADD_FIELDFUNCTION, fflist[1])
+  fieldfunc.Initialize(ffi)
+  fieldfunc.Execute(ffi)
+  return fieldfunc.GetValue(ffi)
+end
+
+phys1 = CreateSolver("reassembled")
+solver.Execute(phys1)
+old_value = Integral(phys1, domain_vol)
+
+-- Change the coefficients of the block and solve again
+D = { 1.0, 3.0 }
+XSa = { 0.1, 1.0 }
+solver.Execute(phys1)
+
+phys2 = CreateSolver("from_scratch")
+solver.Execute(phys2)
+
+max_rel_diff = 0.0
+for _, volume in ipairs({ block_vol, domain_vol }) do
+  local value = Integral(phys1, volume)
+  local ref_value = Integral(phys2, volume)
+  log.Log(LOG_0, string.format("Reassembled %.8e, from scratch %.8e", value, ref_value))
+  max_rel_diff = math.max(max_rel_diff, math.abs(value - ref_value) / ref_value)
+end
+
+if math.abs(Integral(phys2, domain_vol) - old_value) / old_value > 1.0e-3 then
+  log.Log(LOG_0, "The coefficient change changes the solution")
+end
+if max_rel_diff < 1.0e-6 then
+  log.Log(LOG_0, "The reassembled and from-scratch solutions agree")
+end
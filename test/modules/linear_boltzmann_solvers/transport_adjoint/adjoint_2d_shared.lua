@@ -0,0 +1,135 @@
+-- 2D adjoint transport test with an adjoint solver that shares the data structures of the
+-- forward solver
+-- SDM: PWLD
+-- Test: The adjoint solver that shares the discretization, sweep structures and WGDSA solver of
+--       the forward solver gives the same solution as an adjoint solver that builds its own.
+num_procs = 2
+
+-- Check num_procs
+if check_num_procs == nil and number_of_processes ~= num_procs then
+  log.Log(
+    LOG_0ERROR,
+    "Incorrect amount of processors. "
+      .. "Expected "
+      .. tostring(num_procs)
+      .. ". Pass check_num_procs=false to override if possible."
+  )
+  os.exit(false)
+end
+
+-- Create mesh
+N = 20
+L = 5.0
+ds = L / N
+
+nodes = {}
+for i = 0, N do
+  nodes[i + 1] = i * ds
+end
+
+meshgen = mesh.OrthogonalMeshGenerator.Create({ node_sets = { nodes, nodes } })
+mesh.MeshGenerator.Execute(meshgen)
+
+-- Set material IDs
+mesh.SetUniformMaterialID(0)
+
+src_vol = logvol.RPPLogicalVolume.Create({
+  xmin = 2.0,
+  xmax = 3.0,
+  ymin = 0.0,
+  ymax = 1.0,
+  infz = true,
+})
+mesh.SetMaterialIDFromLogicalVolume(src_vol, 1)
+
+-- Create materials
+materials = {}
+materials[1] = mat.AddMaterial("Scatterer")
+materials[2] = mat.AddMaterial("Source")
+
+num_groups = 1
+mat.SetProperty(materials[1], TRANSPORT_XSECTIONS, SIMPLE_ONE_GROUP, 1.0, 0.9)
+mat.SetProperty(materials[2], TRANSPORT_XSECTIONS, SIMPLE_ONE_GROUP, 1.0, 0.5)
+
+mat.SetProperty(materials[1], ISOTROPIC_MG_SOURCE, FROM_ARRAY, { 0.0 })
+mat.SetProperty(materials[2], ISOTROPIC_MG_SOURCE, FROM_ARRAY, { 1.0 })
+
+-- Setup physics
+pquad = aquad.CreateProductQuadrature(GAUSS_LEGENDRE_CHEBYSHEV, 8, 2)
+aquad.OptimizeForPolarSymmetry(pquad, 4.0 * math.pi)
+
+function LBSBlock(prefix, options)
+  options.scattering_order = 1
+  options.field_function_prefix = prefix
+  return {
+    name = prefix,
+    num_groups = num_groups,
+    groupsets = {
+      {
+        groups_from_to = { 0, num_groups - 1 },
+        angular_quadrature_handle = pquad,
+        inner_linear_method = "gmres",
+        l_abs_tol = 1.0e-10,
+        l_max_its = 300,
+        gmres_restart_interval = 100,
+        apply_wgdsa = true,
+        wgdsa_l_abs_tol = 1.0e-4,
+      },
+    },
+    options = options,
+  }
+end
+
+-- Forward solve
+phys = lbs.DiscreteOrdinatesSolver.Create(LBSBlock("fwd", {}))
+ss_solver = lbs.SteadyStateSolver.Create({ lbs_solver_handle = phys })
+solver.Initialize(ss_solver)
+solver.Execute(ss_solver)
+
+-- Adjoint solves for a detector in the upper part of the domain
+qoi_vol = logvol.RPPLogicalVolume.Create({
+  xmin = 1.0,
+  xmax = 2.0,
+  ymin = 4.0,
+  ymax = 5.0,
+  infz = true,
+})
+adjoint_source = lbs.DistributedSource.Create({ logical_volume_handle = qoi_vol })
+
+function SolveAdjoint(prefix, forward_solver)
+  local block = LBSBlock(prefix, { adjoint = true, distributed_sources = { adjoint_source } })
+  block.forward_solver = forward_solver
+  local adj_phys = lbs.DiscreteOrdinatesAdjointSolver.Create(block)
+  solver.Initialize(adj_phys)
+  solver.Execute(adj_phys)
+end
+
+SolveAdjoint("shared", phys)
+SolveAdjoint("own", nil)
+
+-- Compare the importance over the source and the whole domain
+domain_vol = logvol.RPPLogicalVolume.Create({ infx = true, infy = true, infz = true })
+
+function Integral(prefix, volume)
+  local ff = fieldfunc.GetHandleByName(prefix .. "_phi_g000_m00")
+  local ffi = fieldfunc.FFInterpolationCreate(VOLUME)
+  fieldfunc.SetProperty(ffi, OPERATION, OP_SUM)
+  fieldfunc.SetProperty(ffi, LOGICAL_VOLUME, volume)
+  fieldfunc.SetProperty(ffi, ADD_FIELDFUNCTION, ff)
+
+  fieldfunc.Initialize(ffi)
+  fieldfunc.Execute(ffi)
+  return fieldfunc.GetValue(ffi)
+end
+
+max_rel_diff = 0.0
+for _, volume in ipairs({ src_vol, domain_vol }) do
+  local shared = Integral("shared", volume)
+  local own = Integral("own", volume)
+  log.Log(LOG_0, string.format("Importance shared %.8e own %.8e", shared, own))
+  max_rel_diff = math.max(max_rel_diff, math.abs(shared - own) / own)
+end
+
+if max_rel_diff < 1.0e-6 then
+  log.Log(LOG_0, "Shared and unshared adjoint solutions agree")
+end
@@ -0,0 +1,110 @@
+-- 2D 2G KEigenvalue::Solver test using NonLinearK with two groupsets
+-- The problem is solved without acceleration, with WGDSA applied to the residual, and with the
+-- shell preconditioner with and without preconditioner sweeps. The same problem is also solved
+-- with power iteration.
+-- Test: Final k-eigenvalue: 0.5969127 for every case, every NonLinearK case agrees with power
+--       iteration, and every accelerated case needs fewer sweeps than the unaccelerated one.
+
+dofile("utils/qblock_mesh.lua")
+dofile("utils/qblock_materials.lua") --num_groups assigned here
+
+--############################################### Setup Physics
+pquad = aquad.CreateProductQuadrature(GAUSS_LEGENDRE_CHEBYSHEV, 4, 4)
+aquad.OptimizeForPolarSymmetry(pquad, 4.0 * math.pi)
+
+lbs_options = {
+  boundary_conditions = {
+    { name = "xmin", type = "reflecting" },
+    { name = "ymin", type = "reflecting" },
+  },
+  scattering_order = 2,
+
+  use_precursors = false,
+
+  verbose_inner_iterations = false,
+  verbose_outer_iterations = true,
+}
+
+function MakeGroupset(group, apply_wgdsa)
+  return {
+    groups_from_to = { group, group },
+    angular_quadrature_handle = pquad,
+    inner_linear_method = "gmres",
+    l_max_its = 50,
+    gmres_restart_interval = 50,
+    l_abs_tol = 1.0e-10,
+    apply_wgdsa = apply_wgdsa,
+    wgdsa_l_abs_tol = 1.0e-4,
+  }
+end
+
+-- Solves the problem with one groupset per group and returns the k-eigenvalue and the number
+-- of sweeps
+function Solve(case_name, apply_wgdsa, k_solver_params)
+  local phys = lbs.DiscreteOrdinatesSolver.Create({
+    name = case_name,
+    num_groups = num_groups,
+    groupsets = { MakeGroupset(0, apply_wgdsa), MakeGroupset(1, apply_wgdsa) },
+  })
+  lbs.SetOptions(phys, lbs_options)
+
+  k_solver_params.lbs_solver_handle = phys
+  local k_solver = lbs.NonLinearKEigen.Create(k_solver_params)
+  solver.Initialize(k_solver)
+  solver.Execute(k_solver)
+
+  local k_eff = solver.GetInfo(k_solver, "k_eff")
+  local num_sweeps = solver.GetInfo(k_solver, "num_sweeps")
+  log.Log(
+    LOG_0,
+    string.format("Case %s: k-eigenvalue %.7f, %d sweeps", case_name, k_eff, num_sweeps)
+  )
+  return k_eff, num_sweeps
+end
+
+k_unacc, sweeps_unacc = Solve("unaccelerated", false, {})
+k_res, sweeps_res = Solve("residual_dsa", true, {})
+k_shell, sweeps_shell = Solve("shell", true, { pc_type = "shell", pc_eigen_correction = true })
+k_shell_sweeps, sweeps_shell_sweeps = Solve("shell_sweeps", true, {
+  pc_type = "shell",
+  pc_num_sweeps = 2,
+  pc_eigen_correction = true,
+})
+
+-- Power iteration reference on the same problem
+pi_phys = lbs.DiscreteOrdinatesSolver.Create({
+  name = "power_iteration",
+  num_groups = num_groups,
+  groupsets = { MakeGroupset(0, false), MakeGroupset(1, false) },
+})
+lbs.SetOptions(pi_phys, lbs_options)
+pi_solver = lbs.PowerIterationKEigen.Create({ lbs_solver_handle = pi_phys })
+solver.Initialize(pi_solver)
+solver.Execute(pi_solver)
+k_pi = solver.GetInfo(pi_solver, "k_eff")
+log.Log(LOG_0, string.format("Case power_iteration: k-eigenvalue %.7f", k_pi))
+
+-- Reference value k_eff = 0.5969127
+k_ref = 0.5969127
+max_k_diff = 0.0
+for _, k_eff in ipairs({ k_unacc, k_res, k_shell, k_shell_sweeps }) do
+  max_k_diff = math.max(max_k_diff, math.abs(k_eff - k_ref))
+end
+if max_k_diff < 1.0e-6 then
+  log.Log(LOG_0, "All cases converge to the reference k-eigenvalue")
+end
+
+max_pi_diff = 0.0
+for _, k_eff in ipairs({ k_unacc, k_res, k_shell, k_shell_sweeps }) do
+  max_pi_diff = math.max(max_pi_diff, math.abs(k_eff - k_pi))
+end
+if max_pi_diff < 1.0e-6 then
+  log.Log(LOG_0, "All NonLinearK cases agree with power iteration")
+end
+
+if sweeps_res < sweeps_unacc then
+  log.Log(LOG_0, "Multi-groupset residual DSA reduces the number of sweeps")
+end
+if sweeps_shell < sweeps_unacc and sweeps_shell_sweeps < sweeps_unacc then
+  log.Log(LOG_0, "The shell preconditioner reduces the number of sweeps")
+end
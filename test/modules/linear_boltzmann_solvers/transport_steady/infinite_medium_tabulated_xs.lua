@@ -0,0 +1,92 @@
+-- Infinite, 1-group, pure absorber with temperature-tabulated cross sections
+-- Test: Max-value1=0.66667 and Max-value2=0.50000
+-- Create Mesh
+nodes = {}
+N = 2
+L = 10
+xmin = -L / 2
+dx = L / N
+for i = 1, (N + 1) do
+  k = i - 1
+  nodes[i] = xmin + k * dx
+end
+
+meshgen = mesh.OrthogonalMeshGenerator.Create({ node_sets = { nodes, nodes, nodes } })
+mesh.MeshGenerator.Execute(meshgen)
+
+-- Set Material IDs
+mesh.SetUniformMaterialID(0)
+
+materials = {}
+materials[1] = mat.AddMaterial("TestMat")
+
+num_groups = 1
+
+-- Add temperature-tabulated cross sections to materials
+xs_300 = xs.Create()
+xs.Set(xs_300, SIMPLE_ONE_GROUP, 1.0, 0.0)
+xs_600 = xs.Create()
+xs.Set(xs_600, SIMPLE_ONE_GROUP, 2.0, 0.0)
+xs_tab = xs.MakeTabulated({ 300.0, 600.0 }, { xs_300, xs_600 })
+mat.SetProperty(materials[1], TRANSPORT_XSECTIONS, EXISTING, xs_tab)
+
+src = {}
+src[1] = 1.0
+mat.SetProperty(materials[1], ISOTROPIC_MG_SOURCE, FROM_ARRAY, src)
+
+-- Angular Quadrature
+pquad = aquad.CreateProductQuadrature(GAUSS_LEGENDRE_CHEBYSHEV, 2, 2)
+
+-- LBS block option
+lbs_block = {
+  num_groups = num_groups,
+  groupsets = {
+    {
+      groups_from_to = { 0, num_groups - 1 },
+      angular_quadrature_handle = pquad,
+      inner_linear_method = "gmres",
+      l_abs_tol = 1.0e-9,
+      l_max_its = 300,
+      gmres_restart_interval = 30,
+    },
+  },
+  options = {
+    boundary_conditions = {
+      { name = "xmin", type = "reflecting" },
+      { name = "xmax", type = "reflecting" },
+      { name = "ymin", type = "reflecting" },
+      { name = "ymax", type = "reflecting" },
+      { name = "zmin", type = "reflecting" },
+      { name = "zmax", type = "reflecting" },
+    },
+  },
+}
+
+phys = lbs.DiscreteOrdinatesSolver.Create(lbs_block)
+
+-- Initialize solver
+ss_solver = lbs.SteadyStateSolver.Create({ lbs_solver_handle = phys })
+solver.Initialize(ss_solver)
+
+fflist, count = lbs.GetScalarFieldFunctionList(phys)
+vol0 = logvol.RPPLogicalVolume.Create({ infx = true, infy = true, infz = true })
+
+function MaxValue()
+  ffi = fieldfunc.FFInterpolationCreate(VOLUME)
+  fieldfunc.SetProperty(ffi, OPERATION, OP_MAX)
+  fieldfunc.SetProperty(ffi, LOGICAL_VOLUME, vol0)
+  fieldfunc.SetProperty(ffi, ADD_FIELDFUNCTION, fflist[1])
+  fieldfunc.Initialize(ffi)
+  fieldfunc.Execute(ffi)
+  return fieldfunc.GetValue(ffi)
+end
+
+-- Solve at 450K, the midpoint of the table
+lbs.SetCellTemperatures(phys, 450.0)
+solver.Execute(ss_solver)
+log.Log(LOG_0, string.format("Max-value1=%.5f", MaxValue()))
+
+-- Solve at 600K
+lbs.SetCellTemperatures(phys, 600.0)
+solver.Execute(ss_solver)
+log.Log(LOG_0, string.format("Max-value2=%.5f", MaxValue()))
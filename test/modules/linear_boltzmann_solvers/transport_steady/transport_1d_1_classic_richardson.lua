@@ -0,0 +1,169 @@
+-- 1D Transport test with Vacuum and Incident-isotropic BC, solved with classic Richardson
+-- (source iteration) accelerated with Aitken extrapolation and with Anderson mixing plus WGDSA.
+-- SDM: PWLD
+-- Test: Max-value=0.49903 and 7.18243e-4. Both accelerations need fewer sweeps than the
+--       unaccelerated iteration.
+num_procs = 3
+
+--############################################### Check num_procs
+if check_num_procs == nil and number_of_processes ~= num_procs then
+  log.Log(
+    LOG_0ERROR,
+    "Incorrect amount of processors. "
+      .. "Expected "
+      .. tostring(num_procs)
+      .. ". Pass check_num_procs=false to override if possible."
+  )
+  os.exit(false)
+end
+
+--############################################### Setup mesh
+nodes = {}
+N = 100
+L = 30.0
+xmin = 0.0
+dx = L / N
+for i = 1, (N + 1) do
+  k = i - 1
+  nodes[i] = xmin + k * dx
+end
+
+meshgen1 = mesh.OrthogonalMeshGenerator.Create({ node_sets = { nodes } })
+mesh.MeshGenerator.Execute(meshgen1)
+
+--############################################### Set Material IDs
+mesh.SetUniformMaterialID(0)
+
+--############################################### Add materials
+materials = {}
+materials[1] = mat.AddMaterial("Test Material")
+materials[2] = mat.AddMaterial("Test Material2")
+
+num_groups = 168
+mat.SetProperty(materials[1], TRANSPORT_XSECTIONS, OPENSN_XSFILE, "xs_3_170.xs")
+mat.SetProperty(materials[2], TRANSPORT_XSECTIONS, OPENSN_XSFILE, "xs_3_170.xs")
+
+src = {}
+for g = 1, num_groups do
+  src[g] = 0.0
+end
+--src[1] = 1.0
+mat.SetProperty(materials[1], ISOTROPIC_MG_SOURCE, FROM_ARRAY, src)
+mat.SetProperty(materials[2], ISOTROPIC_MG_SOURCE, FROM_ARRAY, src)
+
+--############################################### Setup Physics
+pquad0 = aquad.CreateProductQuadrature(GAUSS_LEGENDRE, 40)
+
+bsrc = {}
+for g = 1, num_groups do
+  bsrc[g] = 0.0
+end
+bsrc[1] = 1.0 / 2
+
+lbs_options = {
+  boundary_conditions = {
+    {
+      name = "zmin",
+      type = "isotropic",
+      group_strength = bsrc,
+    },
+  },
+  scattering_order = 5,
+}
+
+-- Solves the problem with the given classic Richardson accelerations of the two groupsets and
+-- returns the solver and the number of sweeps of each groupset
+function Solve(acceleration0, acceleration1)
+  local lbs_block = {
+    num_groups = num_groups,
+    groupsets = {
+      {
+        groups_from_to = { 0, 62 },
+        angular_quadrature_handle = pquad0,
+        angle_aggregation_num_subsets = 1,
+        groupset_num_subsets = 8,
+        inner_linear_method = "classic_richardson",
+        classic_richardson_acceleration = acceleration0,
+        l_abs_tol = 1.0e-6,
+        l_max_its = 500,
+      },
+      {
+        groups_from_to = { 63, num_groups - 1 },
+        angular_quadrature_handle = pquad0,
+        angle_aggregation_num_subsets = 1,
+        groupset_num_subsets = 8,
+        inner_linear_method = "classic_richardson",
+        classic_richardson_acceleration = acceleration1,
+        anderson_depth = 5,
+        l_abs_tol = 1.0e-6,
+        l_max_its = 500,
+        apply_wgdsa = true,
+        wgdsa_l_abs_tol = 1.0e-4,
+      },
+    },
+  }
+
+  local phys = lbs.DiscreteOrdinatesSolver.Create(lbs_block)
+  lbs.SetOptions(phys, lbs_options)
+  lbs.SetOptions(phys, { field_function_prefix = acceleration0 .. "_" .. acceleration1 })
+
+  local ss_solver = lbs.SteadyStateSolver.Create({ lbs_solver_handle = phys })
+  solver.Initialize(ss_solver)
+  solver.Execute(ss_solver)
+
+  local num_sweeps = {
+    solver.GetInfo(ss_solver, { name = "num_sweeps", groupset = 0 }),
+    solver.GetInfo(ss_solver, { name = "num_sweeps", groupset = 1 }),
+  }
+  log.Log(
+    LOG_0,
+    string.format(
+      "Sweeps with %s/%s acceleration: %d and %d",
+      acceleration0,
+      acceleration1,
+      num_sweeps[1],
+      num_sweeps[2]
+    )
+  )
+  return phys, num_sweeps
+end
+
+--############################################### Initialize and Execute Solver
+phys0, plain_sweeps = Solve("none", "none")
+phys1, accelerated_sweeps = Solve("aitken", "anderson")
+
+if accelerated_sweeps[1] < plain_sweeps[1] then
+  log.Log(LOG_0, "Aitken extrapolation reduces the number of sweeps")
+end
+if accelerated_sweeps[2] < plain_sweeps[2] then
+  log.Log(LOG_0, "Anderson mixing reduces the number of sweeps")
+end
+
+--############################################### Get field functions
+fflist, count = lbs.GetScalarFieldFunctionList(phys1)
+
+--############################################### Volume integrations
+vol0 = logvol.RPPLogicalVolume.Create({ infx = true, infy = true, infz = true })
+ffi1 = fieldfunc.FFInterpolationCreate(VOLUME)
+curffi = ffi1
+fieldfunc.SetProperty(curffi, OPERATION, OP_MAX)
+fieldfunc.SetProperty(curffi, LOGICAL_VOLUME, vol0)
+fieldfunc.SetProperty(curffi, ADD_FIELDFUNCTION, fflist[1])
+
+fieldfunc.Initialize(curffi)
+fieldfunc.Execute(curffi)
+maxval = fieldfunc.GetValue(curffi)
+
+log.Log(LOG_0, string.format("Max-value1=%.5f", maxval))
+
+ffi2 = fieldfunc.FFInterpolationCreate(VOLUME)
+curffi = ffi2
+fieldfunc.SetProperty(curffi, OPERATION, OP_MAX)
+fieldfunc.SetProperty(curffi, LOGICAL_VOLUME, vol0)
+fieldfunc.SetProperty(curffi, ADD_FIELDFUNCTION, fflist[160])
+
+fieldfunc.Initialize(curffi)
+fieldfunc.Execute(curffi)
+maxval = fieldfunc.GetValue(curffi)
+
+log.Log(LOG_0, string.format("Max-value2=%.5e", maxval))
@@ -0,0 +1,223 @@
+-- 1D Transport test with arbitrary incident fluxes given by lua boundary functions
+-- SDM: PWLD
+-- Test: An isotropic arbitrary boundary, given either per angle-group value or as separable
+--       angular and group factors, reproduces the isotropic boundary. An anisotropic boundary
+--       gives the same flux in separable and non-separable form.
+num_procs = 2
+
+-- Check num_procs
+if check_num_procs == nil and number_of_processes ~= num_procs then
+  log.Log(
+    LOG_0ERROR,
+    "Incorrect amount of processors. "
+      .. "Expected "
+      .. tostring(num_procs)
+      .. ". Pass check_num_procs=false to override if possible."
+  )
+  os.exit(false)
+end
+
+-- Setup mesh
+nodes = {}
+N = 50
+L = 5.0
+dx = L / N
+for i = 0, N do
+  nodes[i + 1] = i * dx
+end
+
+meshgen = mesh.OrthogonalMeshGenerator.Create({ node_sets = { nodes } })
+mesh.MeshGenerator.Execute(meshgen)
+
+-- Set Material IDs
+mesh.SetUniformMaterialID(0)
+
+-- Add materials
+num_groups = 2
+
+materials = {}
+materials[1] = mat.AddMaterial("Water")
+mat.SetProperty(
+  materials[1],
+  TRANSPORT_XSECTIONS,
+  OPENSN_XSFILE,
+  "../transport_keigen/xs_water_g2.xs"
+)
+
+-- Incident fluxes per group
+q = { 1.0, 0.5 }
+
+-- Boundary functions
+function IsotropicFlux(
+  cell_global_id,
+  material_id,
+  location,
+  normal,
+  quadrature_angle_indices,
+  quadrature_angle_vectors,
+  quadrature_phi_theta_angles,
+  group_indices,
+  time
+)
+  local psi = {}
+  for n = 1, #quadrature_angle_vectors do
+    for gi = 1, #group_indices do
+      psi[#psi + 1] = q[group_indices[gi] + 1]
+    end
+  end
+  return psi
+end
+
+function AnisotropicFlux(
+  cell_global_id,
+  material_id,
+  location,
+  normal,
+  quadrature_angle_indices,
+  quadrature_angle_vectors,
+  quadrature_phi_theta_angles,
+  group_indices,
+  time
+)
+  local psi = {}
+  for n = 1, #quadrature_angle_vectors do
+    local mu = quadrature_angle_vectors[n].z
+    for gi = 1, #group_indices do
+      psi[#psi + 1] = (1.0 + mu * mu) * q[group_indices[gi] + 1]
+    end
+  end
+  return psi
+end
+
+function UnitAngularFactors(
+  cell_global_id,
+  material_id,
+  location,
+  normal,
+  quadrature_angle_vectors,
+  quadrature_phi_theta_angles,
+  time
+)
+  local factors = {}
+  for n = 1, #quadrature_angle_vectors do
+    factors[n] = 1.0
+  end
+  return factors
+end
+
+function AnisotropicAngularFactors(
+  cell_global_id,
+  material_id,
+  location,
+  normal,
+  quadrature_angle_vectors,
+  quadrature_phi_theta_angles,
+  time
+)
+  local factors = {}
+  for n = 1, #quadrature_angle_vectors do
+    local mu = quadrature_angle_vectors[n].z
+    factors[n] = 1.0 + mu * mu
+  end
+  return factors
+end
+
+function GroupFactors(cell_global_id, material_id, location, normal, time)
+  return q
+end
+
+bndry_funcs = {
+  iso_full = lbs.LuaBoundaryFunction.Create({
+    function_name = "IsotropicFlux",
+    time_dependent = false,
+  }),
+  iso_sep = lbs.LuaBoundaryFunction.Create({
+    angular_function_name = "UnitAngularFactors",
+    group_function_name = "GroupFactors",
+    time_dependent = false,
+  }),
+  ani_full = lbs.LuaBoundaryFunction.Create({
+    function_name = "AnisotropicFlux",
+    time_dependent = false,
+  }),
+  ani_sep = lbs.LuaBoundaryFunction.Create({
+    angular_function_name = "AnisotropicAngularFactors",
+    group_function_name = "GroupFactors",
+    time_dependent = false,
+  }),
+}
+
+-- Setup physics
+pquad = aquad.CreateProductQuadrature(GAUSS_LEGENDRE, 16)
+
+domain_vol = logvol.RPPLogicalVolume.Create({ infx = true, infy = true, infz = true })
+
+function Integral(ff_name)
+  local ffi = fieldfunc.FFInterpolationCreate(VOLUME)
+  fieldfunc.SetProperty(ffi, OPERATION, OP_SUM)
+  fieldfunc.SetProperty(ffi, LOGICAL_VOLUME, domain_vol)
+  fieldfunc.SetProperty(ffi, ADD_FIELDFUNCTION, fieldfunc.GetHandleByName(ff_name))
+
+  fieldfunc.Initialize(ffi)
+  fieldfunc.Execute(ffi)
+  return fieldfunc.GetValue(ffi)
+end
+
+-- Solves the problem with the given zmin boundary condition and returns the group integrals
+function Solve(prefix, bndry_condition)
+  bndry_condition.name = "zmin"
+  local phys = lbs.DiscreteOrdinatesSolver.Create({
+    name = prefix .. "_solver",
+    num_groups = num_groups,
+    groupsets = {
+      {
+        groups_from_to = { 0, num_groups - 1 },
+        angular_quadrature_handle = pquad,
+        inner_linear_method = "gmres",
+        l_abs_tol = 1.0e-10,
+        l_max_its = 300,
+        gmres_restart_interval = 100,
+      },
+    },
+    options = {
+      scattering_order = 0,
+      boundary_conditions = { bndry_condition },
+      field_function_prefix = prefix,
+    },
+  })
+  local ss_solver = lbs.SteadyStateSolver.Create({ lbs_solver_handle = phys })
+  solver.Initialize(ss_solver)
+  solver.Execute(ss_solver)
+
+  local integrals = {}
+  for g = 0, num_groups - 1 do
+    integrals[g + 1] = Integral(prefix .. string.format("_phi_g%03d_m00", g))
+  end
+  return integrals
+end
+
+function MaxRelDiff(a, b)
+  local max_diff = 0.0
+  for g = 1, num_groups do
+    log.Log(LOG_0, string.format("Group %d %.8e %.8e", g - 1, a[g], b[g]))
+    max_diff = math.max(max_diff, math.abs(a[g] - b[g]) / math.abs(b[g]))
+  end
+  return max_diff
+end
+
+ref = Solve("iso", { type = "isotropic", group_strength = q })
+iso_full = Solve("iso_full", { type = "arbitrary", function_handle = bndry_funcs.iso_full })
+iso_sep = Solve("iso_sep", { type = "arbitrary", function_handle = bndry_funcs.iso_sep })
+ani_full = Solve("ani_full", { type = "arbitrary", function_handle = bndry_funcs.ani_full })
+ani_sep = Solve("ani_sep", { type = "arbitrary", function_handle = bndry_funcs.ani_sep })
+
+if MaxRelDiff(iso_full, ref) < 1.0e-8 then
+  log.Log(LOG_0, "Non-separable isotropic boundary matches the isotropic boundary")
+end
+if MaxRelDiff(iso_sep, ref) < 1.0e-8 then
+  log.Log(LOG_0, "Separable isotropic boundary matches the isotropic boundary")
+end
+-- The anisotropic boundary puts more particles into grazing directions than the isotropic one
+if MaxRelDiff(ani_sep, ani_full) < 1.0e-8 and ani_full[1] > ref[1] then
+  log.Log(LOG_0, "Separable and non-separable anisotropic boundaries agree")
+end
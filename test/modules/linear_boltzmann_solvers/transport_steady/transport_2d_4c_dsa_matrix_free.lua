@@ -0,0 +1,155 @@
+-- 2D LinearBSolver test of a block of graphite with an air cavity. DSA and TG
+-- SDM: PWLD
+-- Test: Same as 4a solved with a matrix-free and with an assembled WGDSA operator.
+--       The matrix-free operator matches the assembled operator on a random vector, and the
+--       scalar fluxes of both solves agree.
+num_procs = 4
+
+--############################################### Check num_procs
+if check_num_procs == nil and number_of_processes ~= num_procs then
+  log.Log(
+    LOG_0ERROR,
+    "Incorrect amount of processors. "
+      .. "Expected "
+      .. tostring(num_procs)
+      .. ". Pass check_num_procs=false to override if possible."
+  )
+  os.exit(false)
+end
+
+--############################################### Setup mesh
+nodes = {}
+N = 20
+L = 100
+xmin = -L / 2
+dx = L / N
+for i = 1, (N + 1) do
+  k = i - 1
+  nodes[i] = xmin + k * dx
+end
+
+meshgen1 = mesh.OrthogonalMeshGenerator.Create({ node_sets = { nodes, nodes } })
+mesh.MeshGenerator.Execute(meshgen1)
+
+--############################################### Set Material IDs
+mesh.SetUniformMaterialID(0)
+
+vol1 = logvol.RPPLogicalVolume.Create({
+  xmin = -10.0,
+  xmax = 10.0,
+  ymin = -10.0,
+  ymax = 10.0,
+  infz = true,
+})
+mesh.SetMaterialIDFromLogicalVolume(vol1, 1)
+
+--############################################### Add materials
+materials = {}
+materials[1] = mat.AddMaterial("Test Material")
+materials[2] = mat.AddMaterial("Test Material2")
+
+num_groups = 168
+mat.SetProperty(materials[1], TRANSPORT_XSECTIONS, OPENSN_XSFILE, "xs_graphite_pure.xs")
+mat.SetProperty(materials[2], TRANSPORT_XSECTIONS, OPENSN_XSFILE, "xs_air50RH.xs")
+
+src = {}
+for g = 1, num_groups do
+  src[g] = 0.0
+end
+src[1] = 1.0
+mat.SetProperty(materials[1], ISOTROPIC_MG_SOURCE, FROM_ARRAY, src)
+src[1] = 0.0
+mat.SetProperty(materials[2], ISOTROPIC_MG_SOURCE, FROM_ARRAY, src)
+
+--############################################### Setup Physics
+pquad0 = aquad.CreateProductQuadrature(GAUSS_LEGENDRE_CHEBYSHEV, 2, 2, false)
+aquad.OptimizeForPolarSymmetry(pquad0, 4.0 * math.pi)
+
+function MakeLBSBlock(matrix_free)
+  return {
+    num_groups = num_groups,
+    groupsets = {
+      {
+        groups_from_to = { 0, 62 },
+        angular_quadrature_handle = pquad0,
+        angle_aggregation_num_subsets = 1,
+        groupset_num_subsets = 1,
+        inner_linear_method = "gmres",
+        l_abs_tol = 1.0e-6,
+        l_max_its = 1000,
+        gmres_restart_interval = 30,
+        apply_wgdsa = true,
+        wgdsa_l_abs_tol = 1.0e-2,
+        wgdsa_matrix_free = matrix_free,
+        wgdsa_matrix_free_check = matrix_free,
+      },
+      {
+        groups_from_to = { 63, num_groups - 1 },
+        angular_quadrature_handle = pquad0,
+        angle_aggregation_num_subsets = 1,
+        groupset_num_subsets = 1,
+        inner_linear_method = "gmres",
+        l_abs_tol = 1.0e-6,
+        l_max_its = 1000,
+        gmres_restart_interval = 30,
+        apply_wgdsa = true,
+        apply_tgdsa = true,
+        wgdsa_l_abs_tol = 1.0e-2,
+        wgdsa_matrix_free = matrix_free,
+        wgdsa_matrix_free_check = matrix_free,
+      },
+    },
+    options = {
+      scattering_order = 1,
+    },
+  }
+end
+
+whole_domain = logvol.RPPLogicalVolume.Create({ infx = true, infy = true, infz = true })
+
+-- Returns the volume integrals of the first and last group scalar fluxes
+function Solve(matrix_free)
+  local phys = lbs.DiscreteOrdinatesSolver.Create(MakeLBSBlock(matrix_free))
+  local ss_solver = lbs.SteadyStateSolver.Create({ lbs_solver_handle = phys })
+
+  solver.Initialize(ss_solver)
+  solver.Execute(ss_solver)
+
+  local fflist, count = lbs.GetScalarFieldFunctionList(phys)
+  local values = {}
+  for k, ff in ipairs({ fflist[1], fflist[count] }) do
+    local ffi = fieldfunc.FFInterpolationCreate(VOLUME)
+    fieldfunc.SetProperty(ffi, OPERATION, OP_SUM)
+    fieldfunc.SetProperty(ffi, LOGICAL_VOLUME, whole_domain)
+    fieldfunc.SetProperty(ffi, ADD_FIELDFUNCTION, ff)
+    fieldfunc.Initialize(ffi)
+    fieldfunc.Execute(ffi)
+    values[k] = fieldfunc.GetValue(ffi)
+  end
+  return values
+end
+
+--############################################### Initialize and Execute Solvers
+matrix_free_values = Solve(true)
+assembled_values = Solve(false)
+
+--############################################### Compare
+agree = true
+for k = 1, 2 do
+  log.Log(
+    LOG_0,
+    string.format(
+      "Flux integral %d matrix-free=%.6e assembled=%.6e",
+      k,
+      matrix_free_values[k],
+      assembled_values[k]
+    )
+  )
+  local diff = math.abs(matrix_free_values[k] - assembled_values[k])
+  if diff > 1.0e-4 * math.abs(assembled_values[k]) then
+    agree = false
+  end
+end
+if agree then
+  log.Log(LOG_0, "Matrix-free and assembled WGDSA agree")
+end
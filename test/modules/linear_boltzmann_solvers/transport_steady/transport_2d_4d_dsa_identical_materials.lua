@@ -0,0 +1,129 @@
+-- 2D LinearBSolver test of a block of graphite with an air cavity. DSA and TG
+-- The problem of transport_2d_4a_dsa_ortho.lua with the graphite split into three materials with
+-- identical cross sections. The two-grid energy collapse groups identical materials, so only the
+-- graphite and the air are collapsed and the iterations are the same as for the single graphite
+-- material.
+-- SDM: PWLD
+-- Test: Two-grid energy collapse: 2 distinct material(s) collapsed.
+-- and   WGS groups [0-62] Iteration    53 Residual 5.96018e-07 CONVERGED
+-- and   WGS groups [63-167] Iteration    59 Residual 5.96296e-07 CONVERGED
+num_procs = 4
+
+--############################################### Check num_procs
+if check_num_procs == nil and number_of_processes ~= num_procs then
+  log.Log(
+    LOG_0ERROR,
+    "Incorrect amount of processors. "
+      .. "Expected "
+      .. tostring(num_procs)
+      .. ". Pass check_num_procs=false to override if possible."
+  )
+  os.exit(false)
+end
+
+--############################################### Setup mesh
+nodes = {}
+N = 20
+L = 100
+--N=10
+--L=200e6
+xmin = -L / 2
+--xmin = 0.0
+dx = L / N
+for i = 1, (N + 1) do
+  k = i - 1
+  nodes[i] = xmin + k * dx
+end
+
+meshgen1 = mesh.OrthogonalMeshGenerator.Create({ node_sets = { nodes, nodes } })
+mesh.MeshGenerator.Execute(meshgen1)
+
+--############################################### Set Material IDs
+mesh.SetUniformMaterialID(0)
+
+vol1 = logvol.RPPLogicalVolume.Create({
+  xmin = -10.0,
+  xmax = 10.0,
+  ymin = -10.0,
+  ymax = 10.0,
+  infz = true,
+})
+mesh.SetMaterialIDFromLogicalVolume(vol1, 1)
+
+-- Strips of graphite on the left and the right of the domain get their own materials
+vol2 = logvol.RPPLogicalVolume.Create({ xmin = -50.0, xmax = -30.0, infy = true, infz = true })
+mesh.SetMaterialIDFromLogicalVolume(vol2, 2)
+vol3 = logvol.RPPLogicalVolume.Create({ xmin = 30.0, xmax = 50.0, infy = true, infz = true })
+mesh.SetMaterialIDFromLogicalVolume(vol3, 3)
+
+--############################################### Add materials
+materials = {}
+materials[1] = mat.AddMaterial("Test Material")
+materials[2] = mat.AddMaterial("Test Material2")
+materials[3] = mat.AddMaterial("Test Material3")
+materials[4] = mat.AddMaterial("Test Material4")
+
+num_groups = 168
+mat.SetProperty(materials[1], TRANSPORT_XSECTIONS, OPENSN_XSFILE, "xs_graphite_pure.xs")
+mat.SetProperty(materials[2], TRANSPORT_XSECTIONS, OPENSN_XSFILE, "xs_air50RH.xs")
+mat.SetProperty(materials[3], TRANSPORT_XSECTIONS, OPENSN_XSFILE, "xs_graphite_pure.xs")
+mat.SetProperty(materials[4], TRANSPORT_XSECTIONS, OPENSN_XSFILE, "xs_graphite_pure.xs")
+
+src = {}
+for g = 1, num_groups do
+  src[g] = 0.0
+end
+src[1] = 1.0
+mat.SetProperty(materials[1], ISOTROPIC_MG_SOURCE, FROM_ARRAY, src)
+mat.SetProperty(materials[3], ISOTROPIC_MG_SOURCE, FROM_ARRAY, src)
+mat.SetProperty(materials[4], ISOTROPIC_MG_SOURCE, FROM_ARRAY, src)
+src[1] = 0.0
+mat.SetProperty(materials[2], ISOTROPIC_MG_SOURCE, FROM_ARRAY, src)
+
+--############################################### Setup Physics
+pquad0 = aquad.CreateProductQuadrature(GAUSS_LEGENDRE_CHEBYSHEV, 2, 2, false)
+aquad.OptimizeForPolarSymmetry(pquad0, 4.0 * math.pi)
+
+lbs_block = {
+  num_groups = num_groups,
+  groupsets = {
+    {
+      groups_from_to = { 0, 62 },
+      angular_quadrature_handle = pquad0,
+      angle_aggregation_num_subsets = 1,
+      groupset_num_subsets = 1,
+      inner_linear_method = "gmres",
+      l_abs_tol = 1.0e-6,
+      l_max_its = 1000,
+      gmres_restart_interval = 30,
+      apply_wgdsa = true,
+      wgdsa_l_abs_tol = 1.0e-2,
+    },
+    {
+      groups_from_to = { 63, num_groups - 1 },
+      angular_quadrature_handle = pquad0,
+      angle_aggregation_num_subsets = 1,
+      groupset_num_subsets = 1,
+      inner_linear_method = "gmres",
+      l_abs_tol = 1.0e-6,
+      l_max_its = 1000,
+      gmres_restart_interval = 30,
+      apply_wgdsa = true,
+      apply_tgdsa = true,
+      wgdsa_l_abs_tol = 1.0e-2,
+    },
+  },
+}
+
+lbs_options = {
+  scattering_order = 1,
+}
+
+phys1 = lbs.DiscreteOrdinatesSolver.Create(lbs_block)
+lbs.SetOptions(phys1, lbs_options)
+
+--############################################### Initialize and Execute Solver
+ss_solver = lbs.SteadyStateSolver.Create({ lbs_solver_handle = phys1 })
+
+solver.Initialize(ss_solver)
+solver.Execute(ss_solver)
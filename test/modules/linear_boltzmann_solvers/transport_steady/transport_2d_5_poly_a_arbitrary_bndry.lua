@@ -0,0 +1,139 @@
+-- 2D Transport test with an anisotropic, heterogeneous arbitrary boundary on xmin.
+-- SDM: PWLD
+-- Test: The boundary given by a lua function name and by a boundary function handle gives the
+--       same flux, and particles only enter through the upper half of the xmin boundary.
+num_procs = 2
+
+--############################################### Check num_procs
+if check_num_procs == nil and number_of_processes ~= num_procs then
+  log.Log(
+    LOG_0ERROR,
+    "Incorrect amount of processors. "
+      .. "Expected "
+      .. tostring(num_procs)
+      .. ". Pass check_num_procs=false to override if possible."
+  )
+  os.exit(false)
+end
+
+--############################################### Setup mesh
+nodes = {}
+N = 20
+L = 10.0
+xmin = -L / 2
+dx = L / N
+for i = 1, (N + 1) do
+  k = i - 1
+  nodes[i] = xmin + k * dx
+end
+
+meshgen1 = mesh.OrthogonalMeshGenerator.Create({ node_sets = { nodes, nodes } })
+mesh.MeshGenerator.Execute(meshgen1)
+
+--############################################### Set Material IDs
+mesh.SetUniformMaterialID(0)
+
+--############################################### Add materials
+materials = {}
+materials[1] = mat.AddMaterial("Test Material")
+
+num_groups = 1
+mat.SetProperty(materials[1], TRANSPORT_XSECTIONS, SIMPLE_ONE_GROUP, 1.0, 0.5)
+mat.SetProperty(materials[1], ISOTROPIC_MG_SOURCE, FROM_ARRAY, { 0.0 })
+
+--############################################### Boundary function
+-- Unit incident flux through the upper half of the boundary for upward directions
+function luaBoundaryFunctionA(
+  cell_global_id,
+  material_id,
+  location,
+  normal,
+  quadrature_angle_indices,
+  quadrature_angle_vectors,
+  quadrature_phi_theta_angles,
+  group_indices,
+  time
+)
+  local psi = {}
+  for ni = 1, #quadrature_angle_vectors do
+    local omega = quadrature_angle_vectors[ni]
+    for gi = 1, #group_indices do
+      local value = 1.0
+      if location.y < 0.0 or omega.y < 0.0 then
+        value = 0.0
+      end
+      psi[#psi + 1] = value
+    end
+  end
+  return psi
+end
+
+--############################################### Setup Physics
+pquad0 = aquad.CreateProductQuadrature(GAUSS_LEGENDRE_CHEBYSHEV, 12, 2)
+aquad.OptimizeForPolarSymmetry(pquad0, 4.0 * math.pi)
+
+upper_vol = logvol.RPPLogicalVolume.Create({ ymin = 0.0, ymax = L, infx = true, infz = true })
+lower_vol = logvol.RPPLogicalVolume.Create({ ymin = -L, ymax = 0.0, infx = true, infz = true })
+
+function Integral(prefix, volume)
+  local ff = fieldfunc.GetHandleByName(prefix .. "_phi_g000_m00")
+  local ffi = fieldfunc.FFInterpolationCreate(VOLUME)
+  fieldfunc.SetProperty(ffi, OPERATION, OP_SUM)
+  fieldfunc.SetProperty(ffi, LOGICAL_VOLUME, volume)
+  fieldfunc.SetProperty(ffi, ADD_FIELDFUNCTION, ff)
+
+  fieldfunc.Initialize(ffi)
+  fieldfunc.Execute(ffi)
+  return fieldfunc.GetValue(ffi)
+end
+
+-- Solves the problem with the given xmin boundary condition and returns the flux integrals over
+-- the upper and lower halves of the domain
+function Solve(prefix, bndry_condition)
+  bndry_condition.name = "xmin"
+  bndry_condition.type = "arbitrary"
+  local phys = lbs.DiscreteOrdinatesSolver.Create({
+    name = prefix .. "_solver",
+    num_groups = num_groups,
+    groupsets = {
+      {
+        groups_from_to = { 0, 0 },
+        angular_quadrature_handle = pquad0,
+        angle_aggregation_num_subsets = 1,
+        groupset_num_subsets = 2,
+        inner_linear_method = "gmres",
+        l_abs_tol = 1.0e-10,
+        l_max_its = 300,
+        gmres_restart_interval = 100,
+      },
+    },
+    options = {
+      scattering_order = 1,
+      boundary_conditions = { bndry_condition },
+      field_function_prefix = prefix,
+    },
+  })
+  local ss_solver = lbs.SteadyStateSolver.Create({ lbs_solver_handle = phys })
+  solver.Initialize(ss_solver)
+  solver.Execute(ss_solver)
+
+  local upper = Integral(prefix, upper_vol)
+  local lower = Integral(prefix, lower_vol)
+  log.Log(LOG_0, string.format("%s upper %.8e lower %.8e", prefix, upper, lower))
+  return { upper, lower }
+end
+
+by_name = Solve("by_name", { function_name = "luaBoundaryFunctionA" })
+bndry_func = lbs.LuaBoundaryFunction.Create({ function_name = "luaBoundaryFunctionA" })
+by_handle = Solve("by_handle", { function_handle = bndry_func })
+
+max_rel_diff = 0.0
+for i = 1, 2 do
+  max_rel_diff = math.max(max_rel_diff, math.abs(by_name[i] - by_handle[i]) / by_handle[i])
+end
+if max_rel_diff < 1.0e-12 then
+  log.Log(LOG_0, "Boundary function name and handle give the same flux")
+end
+if by_handle[1] > by_handle[2] then
+  log.Log(LOG_0, "The flux is larger in the upper half of the domain")
+end
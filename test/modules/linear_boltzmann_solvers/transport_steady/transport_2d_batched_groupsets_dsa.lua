@@ -0,0 +1,155 @@
+-- 2D Transport test with two point sources solved as one batch over two WGDSA accelerated
+-- groupsets coupled by upscattering
+-- SDM: PWLD
+-- Test: Batched phi integrals of both right-hand sides match separate solves with a single
+--       groupset holding both groups.
+num_procs = 2
+
+-- Check num_procs
+if check_num_procs == nil and number_of_processes ~= num_procs then
+  log.Log(
+    LOG_0ERROR,
+    "Incorrect amount of processors. "
+      .. "Expected "
+      .. tostring(num_procs)
+      .. ". Pass check_num_procs=false to override if possible."
+  )
+  os.exit(false)
+end
+
+-- Setup mesh
+N = 20
+L = 10.0
+ds = L / N
+
+nodes = {}
+for i = 0, N do
+  nodes[i + 1] = i * ds
+end
+meshgen = mesh.OrthogonalMeshGenerator.Create({ node_sets = { nodes, nodes } })
+mesh.MeshGenerator.Execute(meshgen)
+
+-- Set Material IDs
+mesh.SetUniformMaterialID(0)
+
+-- Add materials
+num_groups = 2
+
+materials = {}
+materials[1] = mat.AddMaterial("Water")
+
+-- Add cross sections, the thermal group upscatters into the fast group
+mat.SetProperty(
+  materials[1],
+  TRANSPORT_XSECTIONS,
+  OPENSN_XSFILE,
+  "../transport_keigen/xs_water_g2.xs"
+)
+
+-- Add sources
+pt_src_a = lbs.PointSource.Create({
+  location = { 2.5 + 0.25 * ds, 2.5 + 0.25 * ds, 0.0 },
+  strength = { 1.0, 0.0 },
+})
+pt_src_b = lbs.PointSource.Create({
+  location = { 6.5 + 0.25 * ds, 5.0 + 0.25 * ds, 0.0 },
+  strength = { 0.5, 1.0 },
+})
+sources = { pt_src_a, pt_src_b }
+
+-- Setup physics
+pquad = aquad.CreateProductQuadrature(GAUSS_LEGENDRE_CHEBYSHEV, 8, 2)
+aquad.OptimizeForPolarSymmetry(pquad, 4.0 * math.pi)
+
+-- Batched solver with one WGDSA accelerated groupset per group
+phys = lbs.DiscreteOrdinatesSolver.Create({
+  num_groups = num_groups,
+  groupsets = {
+    {
+      groups_from_to = { 0, 0 },
+      angular_quadrature_handle = pquad,
+      l_abs_tol = 1.0e-8,
+      l_max_its = 500,
+      apply_wgdsa = true,
+      wgdsa_l_abs_tol = 1.0e-4,
+    },
+    {
+      groups_from_to = { 1, 1 },
+      angular_quadrature_handle = pquad,
+      l_abs_tol = 1.0e-8,
+      l_max_its = 500,
+      apply_wgdsa = true,
+      wgdsa_l_abs_tol = 1.0e-4,
+    },
+  },
+  options = {
+    scattering_order = 0,
+    verbose_ags_iterations = true,
+  },
+})
+
+batched_solver = lbs.BatchedSteadyStateSolver.Create({
+  lbs_solver_handle = phys,
+  point_sources = sources,
+  ags_tolerance = 1.0e-8,
+})
+
+solver.Initialize(batched_solver)
+solver.Execute(batched_solver)
+
+-- Reference solver with both groups in one groupset
+ref_phys = lbs.DiscreteOrdinatesSolver.Create({
+  name = "ReferenceSolver",
+  num_groups = num_groups,
+  groupsets = {
+    {
+      groups_from_to = { 0, num_groups - 1 },
+      angular_quadrature_handle = pquad,
+      inner_linear_method = "gmres",
+      l_abs_tol = 1.0e-8,
+      l_max_its = 500,
+      gmres_restart_interval = 100,
+    },
+  },
+  options = {
+    scattering_order = 0,
+    field_function_prefix = "ref",
+  },
+})
+ref_solver = lbs.SteadyStateSolver.Create({ lbs_solver_handle = ref_phys })
+solver.Initialize(ref_solver)
+
+domain_vol = logvol.RPPLogicalVolume.Create({ infx = true, infy = true, infz = true })
+
+function Integral(ff_name)
+  local ffi = fieldfunc.FFInterpolationCreate(VOLUME)
+  fieldfunc.SetProperty(ffi, OPERATION, OP_SUM)
+  fieldfunc.SetProperty(ffi, LOGICAL_VOLUME, domain_vol)
+  fieldfunc.SetProperty(ffi, ADD_FIELDFUNCTION, fieldfunc.GetHandleByName(ff_name))
+
+  fieldfunc.Initialize(ffi)
+  fieldfunc.Execute(ffi)
+  return fieldfunc.GetValue(ffi)
+end
+
+-- Compare every right-hand side and group with a separate solve
+max_rel_diff = 0.0
+for k = 1, #sources do
+  solver.SetProperties(batched_solver, { rhs = k - 1 })
+  lbs.SetOptions(ref_phys, { clear_point_sources = true, point_sources = { sources[k] } })
+  solver.Execute(ref_solver)
+  for g = 0, num_groups - 1 do
+    local ff_name = string.format("phi_g%03d_m00", g)
+    local batched = Integral(ff_name)
+    local single = Integral("ref_" .. ff_name)
+    log.Log(
+      LOG_0,
+      string.format("RHS %d group %d batched=%.5e single=%.5e", k - 1, g, batched, single)
+    )
+    max_rel_diff = math.max(max_rel_diff, math.abs(batched - single) / math.abs(single))
+  end
+end
+
+if max_rel_diff < 1.0e-4 then
+  log.Log(LOG_0, "Batched and single solves agree")
+end
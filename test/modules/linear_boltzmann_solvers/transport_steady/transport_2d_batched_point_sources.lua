@@ -0,0 +1,149 @@
+-- 2D Transport test with two point sources solved as one batch
+-- SDM: PWLD
+-- Test: Batched QoI 0=2.90386e-05
+--       The batched solution of the second source matches a separate solve.
+num_procs = 4
+
+-- Check num_procs
+if check_num_procs == nil and number_of_processes ~= num_procs then
+  log.Log(
+    LOG_0ERROR,
+    "Incorrect amount of processors. "
+      .. "Expected "
+      .. tostring(num_procs)
+      .. ". Pass check_num_procs=false to override if possible."
+  )
+  os.exit(false)
+end
+
+-- Setup mesh
+N = 60
+L = 5.0
+ds = L / N
+
+nodes = {}
+for i = 0, N do
+  nodes[i + 1] = i * ds
+end
+meshgen = mesh.OrthogonalMeshGenerator.Create({ node_sets = { nodes, nodes } })
+mesh.MeshGenerator.Execute(meshgen)
+
+-- Set Material IDs
+mesh.SetUniformMaterialID(0)
+
+vol1a = logvol.RPPLogicalVolume.Create({
+  infx = true,
+  ymin = 0.0,
+  ymax = 0.8 * L,
+  infz = true,
+})
+
+mesh.SetMaterialIDFromLogicalVolume(vol1a, 1)
+
+vol0 = logvol.RPPLogicalVolume.Create({
+  xmin = 2.5 - 0.166666,
+  xmax = 2.5 + 0.166666,
+  infy = true,
+  infz = true,
+})
+mesh.SetMaterialIDFromLogicalVolume(vol0, 0)
+
+vol1b = logvol.RPPLogicalVolume.Create({
+  xmin = -1 + 2.5,
+  xmax = 1 + 2.5,
+  ymin = 0.9 * L,
+  ymax = L,
+  infz = true,
+})
+mesh.SetMaterialIDFromLogicalVolume(vol1b, 1)
+
+-- Add materials
+num_groups = 1
+
+materials = {}
+materials[1] = mat.AddMaterial("Test Material1")
+materials[2] = mat.AddMaterial("Test Material2")
+
+-- Add cross sections
+mat.SetProperty(materials[1], TRANSPORT_XSECTIONS, SIMPLE_ONE_GROUP, 0.01, 0.01)
+mat.SetProperty(materials[2], TRANSPORT_XSECTIONS, SIMPLE_ONE_GROUP, 0.1 * 20, 0.8)
+
+-- Add sources
+loc_a = { 1.25 - 0.5 * ds, 1.5 * ds, 0.0 }
+pt_src_a = lbs.PointSource.Create({ location = loc_a, strength = { 1.0 } })
+
+loc_b = { 3.75 - 0.5 * ds, 2.5 - 0.5 * ds, 0.0 }
+pt_src_b = lbs.PointSource.Create({ location = loc_b, strength = { 2.0 } })
+
+-- Setup physics
+pquad = aquad.CreateProductQuadrature(GAUSS_LEGENDRE_CHEBYSHEV, 48, 6)
+aquad.OptimizeForPolarSymmetry(pquad, 4.0 * math.pi)
+
+lbs_block = {
+  num_groups = num_groups,
+  groupsets = {
+    {
+      groups_from_to = { 0, num_groups - 1 },
+      angular_quadrature_handle = pquad,
+      inner_linear_method = "gmres",
+      l_abs_tol = 1.0e-6,
+      l_max_its = 500,
+      gmres_restart_interval = 100,
+    },
+  },
+  options = {
+    scattering_order = 0,
+  },
+}
+phys = lbs.DiscreteOrdinatesSolver.Create(lbs_block)
+
+-- Batched solve of both sources
+batched_solver = lbs.BatchedSteadyStateSolver.Create({
+  lbs_solver_handle = phys,
+  point_sources = { pt_src_a, pt_src_b },
+})
+
+solver.Initialize(batched_solver)
+solver.Execute(batched_solver)
+
+-- Define QoI region
+qoi_vol = logvol.RPPLogicalVolume.Create({
+  xmin = 0.5,
+  xmax = 0.8333,
+  ymin = 4.16666,
+  ymax = 4.33333,
+  infz = true,
+})
+
+ff_m0 = fieldfunc.GetHandleByName("phi_g000_m00")
+
+function ComputeQoI()
+  local ffi = fieldfunc.FFInterpolationCreate(VOLUME)
+  fieldfunc.SetProperty(ffi, OPERATION, OP_SUM)
+  fieldfunc.SetProperty(ffi, LOGICAL_VOLUME, qoi_vol)
+  fieldfunc.SetProperty(ffi, ADD_FIELDFUNCTION, ff_m0)
+
+  fieldfunc.Initialize(ffi)
+  fieldfunc.Execute(ffi)
+  return fieldfunc.GetValue(ffi)
+end
+
+solver.SetProperties(batched_solver, { rhs = 0 })
+batched_qoi_a = ComputeQoI()
+solver.SetProperties(batched_solver, { rhs = 1 })
+batched_qoi_b = ComputeQoI()
+
+-- Separate solve of the second source
+lbs.SetOptions(phys, { point_sources = { pt_src_b } })
+ss_solver = lbs.SteadyStateSolver.Create({ lbs_solver_handle = phys })
+solver.Execute(ss_solver)
+single_qoi_b = ComputeQoI()
+
+-- Print results
+log.Log(LOG_0, "Number of right-hand sides " .. solver.GetInfo(batched_solver, "num_rhs"))
+log.Log(LOG_0, string.format("Batched QoI 0=%.5e", batched_qoi_a))
+log.Log(LOG_0, string.format("Batched QoI 1=%.5e", batched_qoi_b))
+log.Log(LOG_0, string.format("Single QoI 1=%.5e", single_qoi_b))
+if math.abs(batched_qoi_b - single_qoi_b) < 1.0e-3 * math.abs(single_qoi_b) then
+  log.Log(LOG_0, "Batched and single solves agree")
+end
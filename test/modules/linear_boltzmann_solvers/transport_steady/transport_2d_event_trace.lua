@@ -0,0 +1,149 @@
+-- 2D, 1-group transport problem that records and writes a sweep event trace.
+-- Test: Event trace written to "transport_2d_event_trace.json". Every line of the file has the
+--       Chrome trace format, both ranks are named, the sweep events are present and every async
+--       begin event has a matching end event.
+num_procs = 2
+
+--############################################### Check num_procs
+if check_num_procs == nil and number_of_processes ~= num_procs then
+  log.Log(
+    LOG_0ERROR,
+    "Incorrect amount of processors. "
+      .. "Expected "
+      .. tostring(num_procs)
+      .. ". Pass check_num_procs=false to override if possible."
+  )
+  os.exit(false)
+end
+
+--############################################### Setup mesh
+nodes = {}
+N = 20
+L = 10.0
+xmin = -L / 2
+dx = L / N
+for i = 1, (N + 1) do
+  k = i - 1
+  nodes[i] = xmin + k * dx
+end
+
+meshgen = mesh.OrthogonalMeshGenerator.Create({ node_sets = { nodes, nodes } })
+mesh.MeshGenerator.Execute(meshgen)
+
+--############################################### Set Material IDs
+mesh.SetUniformMaterialID(0)
+
+--############################################### Add materials
+materials = {}
+materials[1] = mat.AddMaterial("Test Material")
+
+num_groups = 1
+xs_simple = xs.Create()
+xs.Set(xs_simple, SIMPLE_ONE_GROUP, 1.0, 0.5)
+mat.SetProperty(materials[1], TRANSPORT_XSECTIONS, EXISTING, xs_simple)
+
+src = {}
+for g = 1, num_groups do
+  src[g] = 1.0
+end
+mat.SetProperty(materials[1], ISOTROPIC_MG_SOURCE, FROM_ARRAY, src)
+
+--############################################### Setup Physics
+pquad = aquad.CreateProductQuadrature(GAUSS_LEGENDRE_CHEBYSHEV, 4, 4)
+aquad.OptimizeForPolarSymmetry(pquad, 4.0 * math.pi)
+
+lbs_block = {
+  num_groups = num_groups,
+  groupsets = {
+    {
+      groups_from_to = { 0, num_groups - 1 },
+      angular_quadrature_handle = pquad,
+      inner_linear_method = "gmres",
+      l_abs_tol = 1.0e-6,
+      l_max_its = 100,
+      gmres_restart_interval = 30,
+    },
+  },
+  options = {
+    scattering_order = 0,
+    boundary_conditions = {
+      { name = "xmin", type = "reflecting" },
+      { name = "ymin", type = "reflecting" },
+    },
+  },
+}
+
+phys = lbs.DiscreteOrdinatesSolver.Create(lbs_block)
+
+--############################################### Initialize and Execute Solver
+ss_solver = lbs.SteadyStateSolver.Create({ lbs_solver_handle = phys })
+
+solver.Initialize(ss_solver)
+
+EnableEventTrace(100000)
+solver.Execute(ss_solver)
+WriteEventTrace("transport_2d_event_trace.json")
+
+--############################################### Check the trace file
+-- The trace is written by rank 0 with one event object per line
+trace_file = "transport_2d_event_trace.json"
+if location_id == 0 then
+  local event_pattern = '^{"name":"([%w_]+)","cat":"sweep","ph":"X","ts":[%d%.]+,"dur":[%d%.]+,'
+    .. '"pid":%d+,"tid":0[^{}]*{?[^{}]*}?},?$'
+  local async_pattern = '^{"name":"([%w_]+)","cat":"sweep","ph":"([be])","ts":[%d%.]+,'
+    .. '"pid":(%d+),"tid":0,"id":(%d+)},?$'
+  local process_pattern = '^{"name":"process_name","ph":"M","pid":(%d+),'
+    .. '"args":{"name":"rank %d+"}},?$'
+
+  local lines = {}
+  for line in io.lines(trace_file) do
+    lines[#lines + 1] = line
+  end
+
+  local valid = lines[1] == '{"displayTimeUnit":"ms","traceEvents":[' and lines[#lines] == "]}"
+  local num_ranks = 0
+  local event_counts = {}
+  local open_async = {}
+  for i = 2, #lines - 1 do
+    local name = string.match(lines[i], event_pattern)
+    local async_name, phase, pid, id = string.match(lines[i], async_pattern)
+    if name ~= nil then
+      event_counts[name] = (event_counts[name] or 0) + 1
+    elseif async_name ~= nil then
+      local key = async_name .. ":" .. pid .. ":" .. id
+      if phase == "b" then
+        valid = valid and not open_async[key]
+        open_async[key] = true
+      else
+        valid = valid and open_async[key] == true
+        open_async[key] = nil
+      end
+    elseif string.match(lines[i], process_pattern) ~= nil then
+      num_ranks = num_ranks + 1
+    else
+      log.Log(LOG_0, "Invalid event trace line: " .. lines[i])
+      valid = false
+    end
+  end
+  if next(open_async) ~= nil then
+    log.Log(LOG_0, "Unmatched async event " .. next(open_async))
+    valid = false
+  end
+  -- Only the last line of the event list may omit the trailing comma
+  for i = 2, #lines - 2 do
+    if string.sub(lines[i], -1) ~= "," then
+      valid = false
+    end
+  end
+
+  local expected_events = { "sweep", "angle_set", "sweep_chunk", "send_post", "receive" }
+  for _, name in ipairs(expected_events) do
+    log.Log(LOG_0, string.format("Event trace %s events: %d", name, event_counts[name] or 0))
+    if event_counts[name] == nil then
+      valid = false
+    end
+  end
+  if valid and num_ranks == num_procs then
+    log.Log(LOG_0, "Event trace file is valid and holds the sweep events of all ranks")
+  end
+end
@@ -0,0 +1,147 @@
+-- 2D 1-group heterogeneous problem, method of characteristics against PWLD discrete ordinates
+-- A scattering medium with a distributed source surrounds an absorbing block. An isotropic flux
+-- enters through xmin, the other boundaries are vacuum. Both solvers use the same angular
+-- quadrature, so the integrals of the flux over the absorber, the source region and the whole
+-- domain differ only by the spatial discretization and the cyclic track angles.
+-- Test: The MOC and PWLD integrals agree within 2% and the tracking has 828 tracks.
+num_procs = 1
+
+--############################################### Check num_procs
+if check_num_procs == nil and number_of_processes ~= num_procs then
+  log.Log(
+    LOG_0ERROR,
+    "Incorrect amount of processors. "
+      .. "Expected "
+      .. tostring(num_procs)
+      .. ". Pass check_num_procs=false to override if possible."
+  )
+  os.exit(false)
+end
+
+-- Create Mesh
+nodes = {}
+N = 40
+L = 4.0
+dx = L / N
+for i = 1, (N + 1) do
+  nodes[i] = (i - 1) * dx
+end
+
+meshgen = mesh.OrthogonalMeshGenerator.Create({ node_sets = { nodes, nodes } })
+mesh.MeshGenerator.Execute(meshgen)
+
+-- Set Material IDs
+mesh.SetUniformMaterialID(0)
+absorber_vol = logvol.RPPLogicalVolume.Create({
+  xmin = 2.0,
+  xmax = 3.0,
+  ymin = 1.0,
+  ymax = 3.0,
+  infz = true,
+})
+mesh.SetMaterialIDFromLogicalVolume(absorber_vol, 1)
+
+materials = {}
+materials[1] = mat.AddMaterial("Scatterer")
+materials[2] = mat.AddMaterial("Absorber")
+
+num_groups = 1
+
+-- Add cross sections to materials
+mat.SetProperty(materials[1], TRANSPORT_XSECTIONS, SIMPLE_ONE_GROUP, 1.0, 0.5)
+mat.SetProperty(materials[2], TRANSPORT_XSECTIONS, SIMPLE_ONE_GROUP, 2.0, 0.2)
+
+mat.SetProperty(materials[1], ISOTROPIC_MG_SOURCE, FROM_ARRAY, { 1.0 })
+mat.SetProperty(materials[2], ISOTROPIC_MG_SOURCE, FROM_ARRAY, { 0.0 })
+
+-- Angular Quadrature
+pquad = aquad.CreateProductQuadrature(GAUSS_LEGENDRE_CHEBYSHEV, 4, 2)
+
+-- Number of tracks for the 8 azimuthal angles modulo pi of the quadrature, a track spacing of
+-- 0.05 and the 4 x 4 domain, sum over the angles of
+--   ceil(L |sin(alpha)| / 0.05) + ceil(L |cos(alpha)| / 0.05) = 828
+
+function CreateSolver(solver_type, extra_params)
+  local params = {
+    num_groups = num_groups,
+    groupsets = {
+      {
+        groups_from_to = { 0, num_groups - 1 },
+        angular_quadrature_handle = pquad,
+        inner_linear_method = "gmres",
+        l_abs_tol = 1.0e-9,
+        l_max_its = 300,
+        gmres_restart_interval = 30,
+      },
+    },
+    options = {
+      scattering_order = 0,
+      boundary_conditions = {
+        { name = "xmin", type = "isotropic", group_strength = { 1.0 } },
+        { name = "xmax", type = "vacuum" },
+        { name = "ymin", type = "vacuum" },
+        { name = "ymax", type = "vacuum" },
+      },
+    },
+  }
+  for key, value in pairs(extra_params) do
+    params[key] = value
+  end
+
+  local phys = solver_type.Create(params)
+  local ss_solver = lbs.SteadyStateSolver.Create({ lbs_solver_handle = phys })
+  solver.Initialize(ss_solver)
+  solver.Execute(ss_solver)
+  return phys
+end
+
+moc_phys = CreateSolver(lbs.MOCSolver, { name = "moc_solver", track_spacing = 0.05 })
+do_phys = CreateSolver(lbs.DiscreteOrdinatesSolver, { name = "pwld_solver" })
+
+-- Integrals of the flux over the regions
+source_vol = logvol.RPPLogicalVolume.Create({
+  xmin = 0.0,
+  xmax = 2.0,
+  ymin = 0.0,
+  ymax = 4.0,
+  infz = true,
+})
+domain_vol = logvol.RPPLogicalVolume.Create({ infx = true, infy = true, infz = true })
+regions = {
+  { name = "absorber", volume = absorber_vol },
+  { name = "source", volume = source_vol },
+  { name = "domain", volume = domain_vol },
+}
+
+function Integral(phys, volume)
+  local fflist, count = lbs.GetScalarFieldFunctionList(phys)
+  local ffi = fieldfunc.FFInterpolationCreate(VOLUME)
+  fieldfunc.SetProperty(ffi, OPERATION, OP_SUM)
+  fieldfunc.SetProperty(ffi, LOGICAL_VOLUME, volume)
+  fieldfunc.SetProperty(ffi, ADD_FIELDFUNCTION, fflist[1])
+  fieldfunc.Initialize(ffi)
+  fieldfunc.Execute(ffi)
+  return fieldfunc.GetValue(ffi)
+end
+
+max_rel_diff = 0.0
+for _, region in ipairs(regions) do
+  local moc_value = Integral(moc_phys, region.volume)
+  local do_value = Integral(do_phys, region.volume)
+  local rel_diff = math.abs(moc_value - do_value) / do_value
+  log.Log(
+    LOG_0,
+    string.format(
+      "Region %s: MOC %.6e, PWLD %.6e, relative difference %.3e",
+      region.name,
+      moc_value,
+      do_value,
+      rel_diff
+    )
+  )
+  max_rel_diff = math.max(max_rel_diff, rel_diff)
+end
+
+if max_rel_diff < 0.02 then
+  log.Log(LOG_0, "MOC and PWLD solutions agree within 2%")
+end
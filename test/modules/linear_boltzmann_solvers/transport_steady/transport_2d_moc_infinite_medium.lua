@@ -0,0 +1,97 @@
+-- 2D 1-group infinite medium with scattering, method of characteristics
+-- Reflecting boundaries connect all tracks into cycles, the flux is Q / sigma_a everywhere.
+-- Test: Max-value=2.00000 and Avg-value=2.00000
+num_procs = 1
+
+--############################################### Check num_procs
+if check_num_procs == nil and number_of_processes ~= num_procs then
+  log.Log(
+    LOG_0ERROR,
+    "Incorrect amount of processors. "
+      .. "Expected "
+      .. tostring(num_procs)
+      .. ". Pass check_num_procs=false to override if possible."
+  )
+  os.exit(false)
+end
+
+-- Create Mesh
+nodes = {}
+N = 10
+L = 10
+xmin = -L / 2
+dx = L / N
+for i = 1, (N + 1) do
+  k = i - 1
+  nodes[i] = xmin + k * dx
+end
+
+meshgen = mesh.OrthogonalMeshGenerator.Create({ node_sets = { nodes, nodes } })
+mesh.MeshGenerator.Execute(meshgen)
+
+-- Set Material IDs
+mesh.SetUniformMaterialID(0)
+
+materials = {}
+materials[1] = mat.AddMaterial("TestMat")
+
+num_groups = 1
+
+-- Add cross sections to materials
+mat.SetProperty(materials[1], TRANSPORT_XSECTIONS, SIMPLE_ONE_GROUP, 1.0, 0.5)
+
+src = {}
+src[1] = 1.0
+mat.SetProperty(materials[1], ISOTROPIC_MG_SOURCE, FROM_ARRAY, src)
+
+-- Angular Quadrature
+pquad = aquad.CreateProductQuadrature(GAUSS_LEGENDRE_CHEBYSHEV, 4, 2)
+
+-- LBS block option
+lbs_block = {
+  num_groups = num_groups,
+  groupsets = {
+    {
+      groups_from_to = { 0, num_groups - 1 },
+      angular_quadrature_handle = pquad,
+      inner_linear_method = "gmres",
+      l_abs_tol = 1.0e-9,
+      l_max_its = 300,
+      gmres_restart_interval = 30,
+    },
+  },
+  track_spacing = 0.25,
+  options = {
+    boundary_conditions = {
+      { name = "xmin", type = "reflecting" },
+      { name = "xmax", type = "reflecting" },
+      { name = "ymin", type = "reflecting" },
+      { name = "ymax", type = "reflecting" },
+    },
+  },
+}
+
+phys = lbs.MOCSolver.Create(lbs_block)
+
+-- Initialize and execute solver
+ss_solver = lbs.SteadyStateSolver.Create({ lbs_solver_handle = phys })
+
+solver.Initialize(ss_solver)
+solver.Execute(ss_solver)
+
+-- Get field functions
+fflist, count = lbs.GetScalarFieldFunctionList(phys)
+vol0 = logvol.RPPLogicalVolume.Create({ infx = true, infy = true, infz = true })
+
+function Value(operation)
+  ffi = fieldfunc.FFInterpolationCreate(VOLUME)
+  fieldfunc.SetProperty(ffi, OPERATION, operation)
+  fieldfunc.SetProperty(ffi, LOGICAL_VOLUME, vol0)
+  fieldfunc.SetProperty(ffi, ADD_FIELDFUNCTION, fflist[1])
+  fieldfunc.Initialize(ffi)
+  fieldfunc.Execute(ffi)
+  return fieldfunc.GetValue(ffi)
+end
+
+log.Log(LOG_0, string.format("Max-value=%.5f", Value(OP_MAX)))
+log.Log(LOG_0, string.format("Avg-value=%.5f", Value(OP_AVG)))
@@ -0,0 +1,140 @@
+-- 1D transient transport test with time-dependent arbitrary boundaries.
+-- A uniform source Q is switched on at t = 0 in a pure scatterer, so the flux of an infinite
+-- medium grows linearly, phi(t) = v Q t, and both the implicit Euler and the Crank-Nicolson
+-- schemes reproduce it exactly. The slab boundaries are given the isotropic incident flux
+-- phi(t) / W of the infinite medium, with W the sum of the quadrature weights, so the flux
+-- inside the slab stays uniform only if the boundaries are evaluated at the time each step
+-- solves for.
+-- SDM: PWLD
+-- Test: The final flux equals v Q t_end for both schemes.
+num_procs = 2
+
+--############################################### Check num_procs
+if check_num_procs == nil and number_of_processes ~= num_procs then
+  log.Log(
+    LOG_0ERROR,
+    "Incorrect amount of processors. "
+      .. "Expected "
+      .. tostring(num_procs)
+      .. ". Pass check_num_procs=false to override if possible."
+  )
+  os.exit(false)
+end
+
+--############################################### Setup mesh
+nodes = {}
+N = 10
+L = 2.0
+dx = L / N
+for i = 0, N do
+  nodes[i + 1] = i * dx
+end
+
+meshgen1 = mesh.OrthogonalMeshGenerator.Create({ node_sets = { nodes } })
+mesh.MeshGenerator.Execute(meshgen1)
+
+--############################################### Set Material IDs
+mesh.SetUniformMaterialID(0)
+
+--############################################### Add materials
+materials = {}
+materials[1] = mat.AddMaterial("Test Material")
+
+num_groups = 1
+mat.SetProperty(materials[1], TRANSPORT_XSECTIONS, OPENSN_XSFILE, "xs_inf_pure_scatter_1g.xs")
+
+-- Velocity of xs_inf_pure_scatter_1g.xs
+velocity = 1.0
+
+Q = 1.0
+mat.SetProperty(materials[1], ISOTROPIC_MG_SOURCE, FROM_ARRAY, { Q })
+
+--############################################### Setup Physics
+pquad = aquad.CreateProductQuadrature(GAUSS_LEGENDRE, 8)
+
+weight_sum = 0.0
+for _, qpoint in ipairs(aquad.GetProductQuadrature(pquad)) do
+  weight_sum = weight_sum + qpoint.weight
+end
+
+function InfiniteMediumFlux(
+  cell_global_id,
+  material_id,
+  location,
+  normal,
+  quadrature_angle_indices,
+  quadrature_angle_vectors,
+  quadrature_phi_theta_angles,
+  group_indices,
+  time
+)
+  local psi = {}
+  for n = 1, #quadrature_angle_indices do
+    psi[n] = velocity * Q * time / weight_sum
+  end
+  return psi
+end
+
+bndry_func = lbs.LuaBoundaryFunction.Create({ function_name = "InfiniteMediumFlux" })
+
+domain_vol = logvol.RPPLogicalVolume.Create({ infx = true, infy = true, infz = true })
+
+function AverageFlux(ff_name)
+  local ffi = fieldfunc.FFInterpolationCreate(VOLUME)
+  fieldfunc.SetProperty(ffi, OPERATION, OP_AVG)
+  fieldfunc.SetProperty(ffi, LOGICAL_VOLUME, domain_vol)
+  fieldfunc.SetProperty(ffi, ADD_FIELDFUNCTION, fieldfunc.GetHandleByName(ff_name))
+
+  fieldfunc.Initialize(ffi)
+  fieldfunc.Execute(ffi)
+  return fieldfunc.GetValue(ffi)
+end
+
+-- Runs a transient with the given scheme and returns the relative error of the final flux
+function RunTransient(prefix, time_integration)
+  local phys = lbs.DiscreteOrdinatesSolver.Create({
+    name = prefix .. "_lbs",
+    num_groups = num_groups,
+    groupsets = {
+      {
+        groups_from_to = { 0, num_groups - 1 },
+        angular_quadrature_handle = pquad,
+        inner_linear_method = "gmres",
+        l_abs_tol = 1.0e-12,
+        l_max_its = 300,
+        gmres_restart_interval = 30,
+      },
+    },
+    options = {
+      boundary_conditions = {
+        { name = "zmin", type = "arbitrary", function_handle = bndry_func },
+        { name = "zmax", type = "arbitrary", function_handle = bndry_func },
+      },
+      field_function_prefix = prefix,
+    },
+  })
+
+  local end_time = 1.0
+  local transient = lbs.TransientSolver.Create({
+    name = prefix .. "_transient",
+    lbs_solver_handle = phys,
+    time_integration = time_integration,
+    initial_condition = "zero",
+    dt = 0.1,
+    end_time = end_time,
+  })
+  solver.Initialize(transient)
+  solver.Execute(transient)
+
+  local phi = AverageFlux(prefix .. "_phi_g000_m00")
+  local phi_exact = velocity * Q * end_time
+  log.Log(LOG_0, string.format("%s: final flux %.8e, expected %.8e", prefix, phi, phi_exact))
+  return math.abs(phi - phi_exact) / phi_exact
+end
+
+if RunTransient("ie", "implicit_euler") < 1.0e-8 then
+  log.Log(LOG_0, "Implicit Euler with a time-dependent boundary gives the exact flux")
+end
+if RunTransient("cn", "crank_nicolson") < 1.0e-8 then
+  log.Log(LOG_0, "Crank-Nicolson with a time-dependent boundary gives the exact flux")
+end
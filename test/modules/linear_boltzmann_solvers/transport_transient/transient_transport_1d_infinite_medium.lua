@@ -0,0 +1,87 @@
+-- 1D transient transport test in an infinite critical medium with delayed neutron precursors.
+-- The flux is driven by a uniform source switched on at t = 0. All boundaries are reflecting,
+-- so the solution is spatially uniform and follows the implicit Euler discretization of the
+-- infinite-medium kinetics equations.
+-- SDM: PWLD
+-- Test: Final fission rate 9.213230e+02
+num_procs = 2
+
+--############################################### Check num_procs
+if check_num_procs == nil and number_of_processes ~= num_procs then
+  log.Log(
+    LOG_0ERROR,
+    "Incorrect amount of processors. "
+      .. "Expected "
+      .. tostring(num_procs)
+      .. ". Pass check_num_procs=false to override if possible."
+  )
+  os.exit(false)
+end
+
+--############################################### Setup mesh
+nodes = {}
+N = 10
+L = 10.0
+xmin = 0.0
+dx = L / N
+for i = 1, (N + 1) do
+  k = i - 1
+  nodes[i] = xmin + k * dx
+end
+
+meshgen1 = mesh.OrthogonalMeshGenerator.Create({ node_sets = { nodes } })
+mesh.MeshGenerator.Execute(meshgen1)
+
+--############################################### Set Material IDs
+mesh.SetUniformMaterialID(0)
+
+--############################################### Add materials
+materials = {}
+materials[1] = mat.AddMaterial("Test Material")
+
+num_groups = 1
+mat.SetProperty(materials[1], TRANSPORT_XSECTIONS, OPENSN_XSFILE, "xs_inf_critical_1g.xs")
+
+src = {}
+src[1] = 1.0
+mat.SetProperty(materials[1], ISOTROPIC_MG_SOURCE, FROM_ARRAY, src)
+
+--############################################### Setup Physics
+pquad = aquad.CreateProductQuadrature(GAUSS_LEGENDRE, 8)
+lbs_block = {
+  num_groups = num_groups,
+  groupsets = {
+    {
+      groups_from_to = { 0, num_groups - 1 },
+      angular_quadrature_handle = pquad,
+      inner_linear_method = "gmres",
+      l_abs_tol = 1.0e-10,
+      l_max_its = 300,
+      gmres_restart_interval = 30,
+    },
+  },
+  options = {
+    boundary_conditions = {
+      { name = "zmin", type = "reflecting" },
+      { name = "zmax", type = "reflecting" },
+    },
+    use_precursors = true,
+  },
+}
+
+phys1 = lbs.DiscreteOrdinatesSolver.Create(lbs_block)
+
+--############################################### Initialize and Execute Solver
+transient = lbs.TransientSolver.Create({
+  lbs_solver_handle = phys1,
+  time_integration = "implicit_euler",
+  initial_condition = "zero",
+  dt = 0.1,
+  end_time = 1.0,
+})
+
+solver.Initialize(transient)
+solver.Execute(transient)
+
+fission_rate = solver.GetInfo(transient, "fission_rate")
+log.Log(LOG_0, string.format("Final fission rate %.6e", fission_rate))
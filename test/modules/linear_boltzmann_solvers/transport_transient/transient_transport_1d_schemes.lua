@@ -0,0 +1,178 @@
+-- 1D transient transport tests of the time integration options in an infinite medium.
+-- A uniform source is switched on at t = 0 in a non-fissile medium with reflecting boundaries,
+-- so the flux stays spatially uniform and every step must reproduce the theta-scheme recurrence
+--   phi_theta = (phi_n / (theta dt v) + Q) / (1 / (theta dt v) + sigma_a)
+--   phi_{n+1} = (phi_theta - (1 - theta) phi_n) / theta
+-- for the size dt of the accepted step. The cases are implicit Euler with adaptive time
+-- stepping, Crank-Nicolson, and Crank-Nicolson with a single precision angular flux history.
+-- SDM: PWLD
+-- Test: The flux of every step agrees with the recurrence.
+num_procs = 2
+
+--############################################### Check num_procs
+if check_num_procs == nil and number_of_processes ~= num_procs then
+  log.Log(
+    LOG_0ERROR,
+    "Incorrect amount of processors. "
+      .. "Expected "
+      .. tostring(num_procs)
+      .. ". Pass check_num_procs=false to override if possible."
+  )
+  os.exit(false)
+end
+
+--############################################### Setup mesh
+nodes = {}
+N = 10
+L = 10.0
+dx = L / N
+for i = 0, N do
+  nodes[i + 1] = i * dx
+end
+
+meshgen1 = mesh.OrthogonalMeshGenerator.Create({ node_sets = { nodes } })
+mesh.MeshGenerator.Execute(meshgen1)
+
+--############################################### Set Material IDs
+mesh.SetUniformMaterialID(0)
+
+--############################################### Add materials
+materials = {}
+materials[1] = mat.AddMaterial("Test Material")
+
+num_groups = 1
+mat.SetProperty(materials[1], TRANSPORT_XSECTIONS, OPENSN_XSFILE, "xs_inf_half_scatter_1g.xs")
+
+-- Cross section data of xs_inf_half_scatter_1g.xs
+sigma_a = 0.5
+velocity = 1.0
+
+Q = 1.0
+mat.SetProperty(materials[1], ISOTROPIC_MG_SOURCE, FROM_ARRAY, { Q })
+
+--############################################### Setup Physics
+pquad = aquad.CreateProductQuadrature(GAUSS_LEGENDRE, 8)
+
+domain_vol = logvol.RPPLogicalVolume.Create({ infx = true, infy = true, infz = true })
+
+function AverageFlux(ff_name)
+  local ffi = fieldfunc.FFInterpolationCreate(VOLUME)
+  fieldfunc.SetProperty(ffi, OPERATION, OP_AVG)
+  fieldfunc.SetProperty(ffi, LOGICAL_VOLUME, domain_vol)
+  fieldfunc.SetProperty(ffi, ADD_FIELDFUNCTION, fieldfunc.GetHandleByName(ff_name))
+
+  fieldfunc.Initialize(ffi)
+  fieldfunc.Execute(ffi)
+  return fieldfunc.GetValue(ffi)
+end
+
+-- Steps a transient to its end time and returns the maximum relative difference to the
+-- recurrence and the accepted step sizes
+function RunTransient(prefix, transient_params)
+  local theta = 1.0
+  if transient_params.time_integration == "crank_nicolson" then
+    theta = 0.5
+  end
+
+  local phys = lbs.DiscreteOrdinatesSolver.Create({
+    name = prefix .. "_lbs",
+    num_groups = num_groups,
+    groupsets = {
+      {
+        groups_from_to = { 0, num_groups - 1 },
+        angular_quadrature_handle = pquad,
+        inner_linear_method = "gmres",
+        l_abs_tol = 1.0e-12,
+        l_max_its = 300,
+        gmres_restart_interval = 30,
+      },
+    },
+    options = {
+      boundary_conditions = {
+        { name = "zmin", type = "reflecting" },
+        { name = "zmax", type = "reflecting" },
+      },
+      field_function_prefix = prefix,
+    },
+  })
+
+  transient_params.name = prefix .. "_transient"
+  transient_params.lbs_solver_handle = phys
+  transient_params.initial_condition = "zero"
+  local transient = lbs.TransientSolver.Create(transient_params)
+  solver.Initialize(transient)
+
+  local ff_name = prefix .. "_phi_g000_m00"
+  local end_time = transient_params.end_time
+  local phi = 0.0
+  local max_rel_diff = 0.0
+  local dts = {}
+  while solver.GetInfo(transient, "time") < end_time * (1.0 - 1.0e-12) do
+    solver.Step(transient)
+    local dt = solver.GetInfo(transient, "dt")
+    solver.Advance(transient)
+
+    local tau = theta * dt * velocity
+    local phi_theta = (phi / tau + Q) / (1.0 / tau + sigma_a)
+    phi = (phi_theta - (1.0 - theta) * phi) / theta
+
+    local phi_solver = AverageFlux(ff_name)
+    max_rel_diff = math.max(max_rel_diff, math.abs(phi_solver - phi) / phi)
+    dts[#dts + 1] = dt
+  end
+  log.Log(
+    LOG_0,
+    string.format(
+      "%s: %d steps, final flux %.8e, max relative difference %.3e",
+      prefix,
+      #dts,
+      phi,
+      max_rel_diff
+    )
+  )
+  return max_rel_diff, dts
+end
+
+-- Implicit Euler with adaptive time stepping. Steps from the zero initial condition change the
+-- flux by 100%, so the first step is rejected down to the minimum step size, and the step size
+-- grows once the flux approaches its steady state.
+ie_diff, ie_dts = RunTransient("ie_adapt", {
+  time_integration = "implicit_euler",
+  dt = 0.1,
+  end_time = 4.0,
+  adapt_dt = true,
+  adapt_dt_min = 0.025,
+  adapt_dt_max_change = 0.1,
+  adapt_dt_min_change = 0.01,
+})
+max_dt = 0.0
+for _, dt in ipairs(ie_dts) do
+  max_dt = math.max(max_dt, dt)
+end
+if ie_diff < 1.0e-8 then
+  log.Log(LOG_0, "Implicit Euler with adaptive steps agrees with the recurrence")
+end
+if math.abs(ie_dts[1] - 0.025) < 1.0e-12 and max_dt > 0.1 then
+  log.Log(LOG_0, "Adaptive stepping shrank the first step and grew later steps")
+end
+
+-- Crank-Nicolson
+cn_diff = RunTransient("cn", {
+  time_integration = "crank_nicolson",
+  dt = 0.1,
+  end_time = 1.0,
+})
+if cn_diff < 1.0e-8 then
+  log.Log(LOG_0, "Crank-Nicolson agrees with the recurrence")
+end
+
+-- Crank-Nicolson with the angular flux history in single precision
+cn_sp_diff = RunTransient("cn_sp", {
+  time_integration = "crank_nicolson",
+  dt = 0.1,
+  end_time = 1.0,
+  single_precision_psi_history = true,
+})
+if cn_sp_diff < 1.0e-5 then
+  log.Log(LOG_0, "Crank-Nicolson with single precision history agrees with the recurrence")
+end
@@ -0,0 +1,14 @@
+NUM_GROUPS		1
+NUM_MOMENTS	    1
+
+SIGMA_T_BEGIN
+0		1
+SIGMA_T_END
+
+TRANSFER_MOMENTS_BEGIN
+M_GPRIME_G_VAL	0	0	0	1.0
+TRANSFER_MOMENTS_END
+
+VELOCITY_BEGIN
+0		1.0
+VELOCITY_END
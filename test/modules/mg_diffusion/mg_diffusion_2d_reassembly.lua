@@ -0,0 +1,100 @@
+-- 2D one-group CFEM multigroup diffusion reassembled after a cross section change
+-- A scattering medium with a distributed source surrounds an absorbing block. The problem is
+-- solved, the cross sections of the block are changed, the system is reassembled and solved
+-- again. The result is compared with a solver created from scratch with the new cross sections.
+-- Test: The reassembled and the from-scratch solutions agree.
+num_procs = 1
+
+--############################################### Check num_procs
+if check_num_procs == nil and number_of_processes ~= num_procs then
+  log.Log(
+    LOG_0ERROR,
+    "Incorrect amount of processors. "
+      .. "Expected "
+      .. tostring(num_procs)
+      .. ". Pass check_num_procs=false to override if possible."
+  )
+  os.exit(false)
+end
+
+--############################################### Setup mesh
+nodes = {}
+N = 20
+L = 2.0
+dx = L / N
+for i = 1, (N + 1) do
+  nodes[i] = (i - 1) * dx
+end
+
+meshgen1 = mesh.OrthogonalMeshGenerator.Create({ node_sets = { nodes, nodes } })
+mesh.MeshGenerator.Execute(meshgen1)
+
+--############################################### Set Material IDs
+mesh.SetUniformMaterialID(0)
+block_vol = logvol.RPPLogicalVolume.Create({
+  xmin = 0.5,
+  xmax = 1.5,
+  ymin = 0.5,
+  ymax = 1.5,
+  infz = true,
+})
+mesh.SetMaterialIDFromLogicalVolume(block_vol, 1)
+
+--############################################### Add materials
+materials = {}
+materials[1] = mat.AddMaterial("Scatterer")
+materials[2] = mat.AddMaterial("Block")
+
+mat.SetProperty(materials[1], TRANSPORT_XSECTIONS, SIMPLE_ONE_GROUP, 1.0, 0.5)
+mat.SetProperty(materials[2], TRANSPORT_XSECTIONS, SIMPLE_ONE_GROUP, 2.0, 0.2)
+
+mat.SetProperty(materials[1], ISOTROPIC_MG_SOURCE, FROM_ARRAY, { 1.0 })
+mat.SetProperty(materials[2], ISOTROPIC_MG_SOURCE, FROM_ARRAY, { 0.0 })
+
+--############################################### Setup Physics
+function CreateSolver(name)
+  local phys = diffusion.CFEMMGSolverCreate(name)
+  solver.SetBasicOption(phys, "residual_tolerance", 1.0e-12)
+  solver.Initialize(phys)
+  return phys
+end
+
+domain_vol = logvol.RPPLogicalVolume.Create({ infx = true, infy = true, infz = true })
+
+function Integral(phys, volume)
+  local fflist, count = solver.GetFieldFunctionList(phys)
+  local ffi = fieldfunc.FFInterpolationCreate(VOLUME)
+  fieldfunc.SetProperty(ffi, OPERATION, OP_SUM)
+  fieldfunc.SetProperty(ffi, LOGICAL_VOLUME, volume)
+  fieldfunc.SetProperty(ffi, ADD_FIELDFUNCTION, fflist[1])
+  fieldfunc.Initialize(ffi)
+  fieldfunc.Execute(ffi)
+  return fieldfunc.GetValue(ffi)
+end
+
+phys1 = CreateSolver("reassembled")
+solver.Execute(phys1)
+old_value = Integral(phys1, domain_vol)
+
+-- Make the block a stronger absorber and reassemble
+mat.SetProperty(materials[2], TRANSPORT_XSECTIONS, SIMPLE_ONE_GROUP, 4.0, 0.1)
+solver.SetProperties(phys1, { reassemble = true })
+solver.Execute(phys1)
+
+phys2 = CreateSolver("from_scratch")
+solver.Execute(phys2)
+
+max_rel_diff = 0.0
+for _, volume in ipairs({ block_vol, domain_vol }) do
+  local value = Integral(phys1, volume)
+  local ref_value = Integral(phys2, volume)
+  log.Log(LOG_0, string.format("Reassembled %.8e, from scratch %.8e", value, ref_value))
+  max_rel_diff = math.max(max_rel_diff, math.abs(value - ref_value) / ref_value)
+end
+
+if math.abs(Integral(phys2, domain_vol) - old_value) / old_value > 1.0e-3 then
+  log.Log(LOG_0, "The cross section change changes the solution")
+end
+if max_rel_diff < 1.0e-6 then
+  log.Log(LOG_0, "The reassembled and from-scratch solutions agree")
+end
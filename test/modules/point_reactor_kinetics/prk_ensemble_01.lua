@@ -0,0 +1,33 @@
+-- Point-Reactor Kinetics ensemble test
+-- Member 0 reproduces the single-system transient of the post-processor tests
+-- and is compared against prk.TransientSolver run alongside the ensemble.
+
+single = prk.TransientSolver.Create({ initial_source = 0.0 })
+
+ensemble = prk.EnsembleTransientSolver.Create({
+  initial_rho = { 0.0, 0.0, -0.5 },
+  initial_source = { 0.0, 0.0, 1.0 },
+  gen_time = { 1.0e-5, 1.0e-5, 1.0e-4 },
+})
+
+solver.Initialize(single)
+solver.Initialize(ensemble)
+
+for t = 1, 20 do
+  solver.Step(single)
+  solver.Step(ensemble)
+  time = solver.GetInfo(ensemble, "time_next")
+
+  solver.Advance(single)
+  solver.Advance(ensemble)
+  if time > 0.1 then
+    prk.SetParam(single, "rho", 0.8)
+    solver.SetProperties(ensemble, { rho = { 0.8, 0.5, -0.2 } })
+  end
+end
+
+print(string.format("Single population %.6e", solver.GetInfo(single, "neutron_population")))
+for m = 0, solver.GetInfo(ensemble, "num_members") - 1 do
+  population = solver.GetInfo(ensemble, { name = "neutron_population", member = m })
+  print(string.format("Ensemble member %d population %.6e", m, population))
+end